@@ -0,0 +1,62 @@
+//----------------------------------------------------------------------------------------------------
+// Main_Benchmark.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+#include "Benchmark/MicroBenchmarkSuite.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Game/Framework/GameCommon.hpp"
+
+//----------------------------------------------------------------------------------------------------
+static std::string const REPORT_PATH = "Logs/MicroBenchmarks.txt";
+
+//----------------------------------------------------------------------------------------------------
+// ProtogameJS2D_Benchmark [-repetitions=R -filter=text -label=commit -out=path]
+//
+// Runs MicroBenchmarkSuite with R timed repetitions per benchmark (default 5) and writes the results as
+// Google Benchmark JSON (default Logs/MicroBenchmarks.json), so runs from two commits can be compared.
+// Exit code 1 when a benchmark reported an error or the JSON could not be written.
+//----------------------------------------------------------------------------------------------------
+int main(int const argc, char* argv[])
+{
+    std::string commandLine;
+
+    for (int argIndex = 1; argIndex < argc; ++argIndex)
+    {
+        commandLine += std::string(argv[argIndex]) + " ";
+    }
+
+    sMicroBenchmarkConfig config;
+    FindCommandLineUInt(commandLine, "repetitions", config.m_repetitions);
+    FindCommandLineString(commandLine, "filter", config.m_filter);
+    FindCommandLineString(commandLine, "label", config.m_contextLabel);
+    FindCommandLineString(commandLine, "out", config.m_jsonPath);
+
+    MicroBenchmarkSuite suite(config);
+
+    auto const start = std::chrono::steady_clock::now();
+    suite.Run();
+    double const seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    MicroBenchmarkRunner const& runner     = suite.GetRunner();
+    uint32_t const              errorCount = runner.GetErrorCount();
+    bool const                  isWritten  = runner.WriteJson();
+    bool const                  isValid    = isWritten && errorCount == 0 && !runner.GetResults().empty();
+
+    String report = Stringf("Micro-benchmarks: %u run, %u repetitions each, median per iteration\n", static_cast<uint32_t>(runner.GetResults().size()),
+                            config.m_repetitions);
+    report += runner.ToReport();
+    report += Stringf("total seconds    %.1f\n", seconds);
+    report += Stringf("json             %s%s\n", config.m_jsonPath.c_str(), isWritten ? "" : " (write FAILED)");
+    report += Stringf("errors           %u\n", errorCount);
+    report += Stringf("validation       %s\n", isValid ? "OK" : "FAILED");
+
+    std::fputs(report.c_str(), stdout);
+    WriteTextFile(REPORT_PATH, report);
+
+    return isValid ? 0 : 1;
+}
@@ -0,0 +1,408 @@
+//----------------------------------------------------------------------------------------------------
+// MicroBenchmark.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Benchmark/MicroBenchmark.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <ctime>
+#endif
+
+#include "Engine/Core/StringUtils.hpp"
+#include "Game/Framework/GameCommon.hpp"
+
+//----------------------------------------------------------------------------------------------------
+void const* volatile g_microBenchmarkSink = nullptr;
+
+//----------------------------------------------------------------------------------------------------
+// User plus kernel time of every thread in the process, read the way Google Benchmark reads it on
+// Windows. Not std::clock(): on MSVC that returns wall time since process start. The counters advance
+// in scheduler ticks (about 15.6 ms), so cpu_time is coarse for runs near m_minRunSeconds.
+//
+static uint64_t GetProcessCpuNanoseconds()
+{
+#if defined(_WIN32)
+    FILETIME creationTime;
+    FILETIME exitTime;
+    FILETIME kernelTime;
+    FILETIME userTime;
+
+    if (!GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime))
+    {
+        return 0;
+    }
+
+    auto const toTicks = [](FILETIME const& time) { return static_cast<uint64_t>(time.dwHighDateTime) << 32 | time.dwLowDateTime; };
+
+    return (toTicks(kernelTime) + toTicks(userTime)) * 100;      // FILETIME counts 100 ns ticks
+#else
+    timespec time;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &time);
+
+    return static_cast<uint64_t>(time.tv_sec) * 1000000000ull + static_cast<uint64_t>(time.tv_nsec);
+#endif
+}
+
+//----------------------------------------------------------------------------------------------------
+// Google Benchmark's context date: ISO 8601 with the UTC offset.
+//
+static std::string GetUtcDateString()
+{
+    auto const                        now = std::chrono::system_clock::now();
+    auto const                        day = std::chrono::floor<std::chrono::days>(now);
+    std::chrono::year_month_day const date(day);
+    std::chrono::hh_mm_ss const       time(std::chrono::floor<std::chrono::seconds>(now - day));
+
+    return Stringf("%04d-%02u-%02uT%02d:%02d:%02d+00:00", static_cast<int>(date.year()), static_cast<unsigned>(date.month()),
+                   static_cast<unsigned>(date.day()), static_cast<int>(time.hours().count()), static_cast<int>(time.minutes().count()),
+                   static_cast<int>(time.seconds().count()));
+}
+
+//----------------------------------------------------------------------------------------------------
+static double GetMean(std::vector<double> const& values)
+{
+    double sum = 0.0;
+
+    for (double const value : values)
+    {
+        sum += value;
+    }
+
+    return values.empty() ? 0.0 : sum / static_cast<double>(values.size());
+}
+
+//----------------------------------------------------------------------------------------------------
+// Sample standard deviation, as Google Benchmark reports it.
+//
+static double GetStandardDeviation(std::vector<double> const& values)
+{
+    if (values.size() < 2)
+    {
+        return 0.0;
+    }
+
+    double const mean       = GetMean(values);
+    double       sumSquares = 0.0;
+
+    for (double const value : values)
+    {
+        sumSquares += (value - mean) * (value - mean);
+    }
+
+    return std::sqrt(sumSquares / static_cast<double>(values.size() - 1));
+}
+
+//----------------------------------------------------------------------------------------------------
+static std::vector<double> GetRunTimes(sMicroBenchmarkResult const& result, bool const isCpuTime)
+{
+    std::vector<double> times;
+
+    for (sMicroBenchmarkRun const& run : result.m_runs)
+    {
+        times.push_back(isCpuTime ? run.m_cpuNanoseconds : run.m_realNanoseconds);
+    }
+
+    return times;
+}
+
+//----------------------------------------------------------------------------------------------------
+// One entry of the "benchmarks" array; the aggregate fields are only written for aggregates.
+//
+static void AppendJsonEntry(std::string&                 out_json,
+                            sMicroBenchmarkResult const& result,
+                            std::string const&           name,
+                            char const*                  aggregateName,
+                            uint32_t                     repetitionIndex,
+                            uint64_t                     iterations,
+                            double                       realNanoseconds,
+                            double                       cpuNanoseconds)
+{
+    out_json += out_json.back() == '[' ? "\n    {\n" : ",\n    {\n";
+    out_json += "      \"name\": ";
+    AppendJsonString(out_json, name);
+    out_json += ",\n      \"run_name\": ";
+    AppendJsonString(out_json, result.m_name);
+    out_json += Stringf(",\n      \"run_type\": \"%s\",\n", aggregateName != nullptr ? "aggregate" : "iteration");
+    out_json += Stringf("      \"repetitions\": %u,\n", static_cast<uint32_t>(result.m_runs.size()));
+
+    if (aggregateName != nullptr)
+    {
+        out_json += Stringf("      \"threads\": 1,\n      \"aggregate_name\": \"%s\",\n      \"aggregate_unit\": \"time\",\n", aggregateName);
+    }
+    else
+    {
+        out_json += Stringf("      \"repetition_index\": %u,\n      \"threads\": 1,\n", repetitionIndex);
+    }
+
+    if (!result.m_errorMessage.empty())
+    {
+        out_json += "      \"error_occurred\": true,\n      \"error_message\": ";
+        AppendJsonString(out_json, result.m_errorMessage);
+        out_json += ",\n";
+    }
+
+    out_json += Stringf("      \"iterations\": %llu,\n", static_cast<unsigned long long>(iterations));
+    out_json += Stringf("      \"real_time\": %.9g,\n      \"cpu_time\": %.9g,\n      \"time_unit\": \"ns\"", realNanoseconds, cpuNanoseconds);
+
+    if (result.m_itemsPerIteration > 0 && realNanoseconds > 0.0)
+    {
+        out_json += Stringf(",\n      \"items_per_second\": %.9g", 1e9 * static_cast<double>(result.m_itemsPerIteration) / realNanoseconds);
+    }
+
+    if (result.m_bytesPerIteration > 0 && realNanoseconds > 0.0)
+    {
+        out_json += Stringf(",\n      \"bytes_per_second\": %.9g", 1e9 * static_cast<double>(result.m_bytesPerIteration) / realNanoseconds);
+    }
+
+    if (!result.m_label.empty())
+    {
+        out_json += ",\n      \"label\": ";
+        AppendJsonString(out_json, result.m_label);
+    }
+
+    out_json += "\n    }";
+}
+
+//----------------------------------------------------------------------------------------------------
+MicroBenchmarkState::MicroBenchmarkState(uint64_t const iterations,
+                                         int64_t const  argument)
+    : m_iterations(iterations),
+      m_remaining(iterations),
+      m_argument(argument)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+void MicroBenchmarkState::PauseTiming()
+{
+    if (!m_isTiming)
+    {
+        return;
+    }
+
+    m_realNanoseconds += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - m_realStart).count();
+    m_cpuNanoseconds  += static_cast<double>(GetProcessCpuNanoseconds() - m_cpuStart);
+    m_isTiming         = false;
+}
+
+//----------------------------------------------------------------------------------------------------
+void MicroBenchmarkState::ResumeTiming()
+{
+    if (m_isTiming)
+    {
+        return;
+    }
+
+    m_isTiming  = true;
+    m_cpuStart  = GetProcessCpuNanoseconds();
+    m_realStart = std::chrono::steady_clock::now();
+}
+
+//----------------------------------------------------------------------------------------------------
+void MicroBenchmarkState::SetError(std::string const& message)
+{
+    m_errorMessage = message;
+    m_remaining    = 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+MicroBenchmarkRunner::MicroBenchmarkRunner(sMicroBenchmarkConfig const& config)
+    : m_config(config)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+void MicroBenchmarkRunner::Register(std::string const&          name,
+                                    BenchmarkFunction const&    function,
+                                    std::vector<int64_t> const& arguments)
+{
+    if (arguments.empty())
+    {
+        m_benchmarks.push_back({name, function, 0});
+        return;
+    }
+
+    for (int64_t const argument : arguments)
+    {
+        m_benchmarks.push_back({Stringf("%s/%lld", name.c_str(), static_cast<long long>(argument)), function, argument});
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+std::vector<sMicroBenchmarkResult> const& MicroBenchmarkRunner::Run()
+{
+    m_results.clear();
+
+    for (sBenchmark const& benchmark : m_benchmarks)
+    {
+        if (m_config.m_filter.empty() || benchmark.m_name.find(m_config.m_filter) != std::string::npos)
+        {
+            m_results.push_back(RunBenchmark(benchmark));
+        }
+    }
+
+    return m_results;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Same growth rule as Google Benchmark: aim 40% past the minimum time from the last run's rate, but
+// never grow more than 10x at once, so one slow first iteration cannot overshoot by orders of magnitude.
+//
+sMicroBenchmarkResult MicroBenchmarkRunner::RunBenchmark(sBenchmark const& benchmark) const
+{
+    sMicroBenchmarkResult result;
+    result.m_name = benchmark.m_name;
+
+    double const minNanoseconds = m_config.m_minRunSeconds * 1e9;
+    uint64_t     iterations     = 1;
+
+    for (;;)
+    {
+        MicroBenchmarkState state(iterations, benchmark.m_argument);
+        benchmark.m_function(state);
+
+        if (!state.GetError().empty())
+        {
+            result.m_errorMessage = state.GetError();
+            return result;
+        }
+
+        double const elapsed = state.GetRealNanoseconds();
+
+        if (elapsed >= minNanoseconds || iterations >= m_config.m_maxIterations)
+        {
+            break;
+        }
+
+        double const multiplier = elapsed / minNanoseconds > 0.1 ? 1.4 * minNanoseconds / std::max(elapsed, 1.0) : 10.0;
+        iterations = std::min(std::max(static_cast<uint64_t>(static_cast<double>(iterations) * std::min(multiplier, 10.0)), iterations + 1), m_config.m_maxIterations);
+    }
+
+    for (uint32_t repetition = 0; repetition < std::max(m_config.m_repetitions, 1u); ++repetition)
+    {
+        MicroBenchmarkState state(iterations, benchmark.m_argument);
+        benchmark.m_function(state);
+
+        if (!state.GetError().empty())
+        {
+            result.m_errorMessage = state.GetError();
+            return result;
+        }
+
+        double const count = static_cast<double>(iterations);
+        result.m_runs.push_back({iterations, state.GetRealNanoseconds() / count, state.GetCpuNanoseconds() / count});
+        result.m_itemsPerIteration = state.GetItemsPerIteration();
+        result.m_bytesPerIteration = state.GetBytesPerIteration();
+        result.m_label             = state.GetLabel();
+    }
+
+    return result;
+}
+
+//----------------------------------------------------------------------------------------------------
+std::string MicroBenchmarkRunner::ToJson() const
+{
+    std::string json = "{\n  \"context\": {\n    \"date\": ";
+    AppendJsonString(json, GetUtcDateString());
+    json += ",\n    \"executable\": \"Game -headlessBench\"";
+    json += Stringf(",\n    \"num_cpus\": %u", std::thread::hardware_concurrency());
+    json += ",\n    \"cpu_scaling_enabled\": false";
+#if defined(NDEBUG)
+    json += ",\n    \"library_build_type\": \"release\"";
+#else
+    json += ",\n    \"library_build_type\": \"debug\"";
+#endif
+    json += Stringf(",\n    \"min_run_seconds\": %.9g,\n    \"repetitions\": %u", m_config.m_minRunSeconds, m_config.m_repetitions);
+
+    if (!m_config.m_contextLabel.empty())
+    {
+        json += ",\n    \"label\": ";
+        AppendJsonString(json, m_config.m_contextLabel);
+    }
+
+    json += "\n  },\n  \"benchmarks\": [";
+
+    for (sMicroBenchmarkResult const& result : m_results)
+    {
+        if (result.m_runs.empty())
+        {
+            AppendJsonEntry(json, result, result.m_name, nullptr, 0, 0, 0.0, 0.0);
+            continue;
+        }
+
+        for (uint32_t index = 0; index < result.m_runs.size(); ++index)
+        {
+            sMicroBenchmarkRun const& run = result.m_runs[index];
+            AppendJsonEntry(json, result, result.m_name, nullptr, index, run.m_iterations, run.m_realNanoseconds, run.m_cpuNanoseconds);
+        }
+
+        // Aggregates carry the repetition count as their iterations, as Google Benchmark writes them.
+        std::vector<double> const realTimes   = GetRunTimes(result, false);
+        std::vector<double> const cpuTimes    = GetRunTimes(result, true);
+        uint64_t const            repetitions = result.m_runs.size();
+
+        AppendJsonEntry(json, result, result.m_name + "_mean", "mean", 0, repetitions, GetMean(realTimes), GetMean(cpuTimes));
+        AppendJsonEntry(json, result, result.m_name + "_median", "median", 0, repetitions, GetMedian(realTimes), GetMedian(cpuTimes));
+        AppendJsonEntry(json, result, result.m_name + "_stddev", "stddev", 0, repetitions, GetStandardDeviation(realTimes), GetStandardDeviation(cpuTimes));
+    }
+
+    json += "\n  ]\n}\n";
+    return json;
+}
+
+//----------------------------------------------------------------------------------------------------
+std::string MicroBenchmarkRunner::ToReport() const
+{
+    std::string report;
+
+    for (sMicroBenchmarkResult const& result : m_results)
+    {
+        if (!result.m_errorMessage.empty())
+        {
+            report += Stringf("%-48s ERROR %s\n", result.m_name.c_str(), result.m_errorMessage.c_str());
+            continue;
+        }
+
+        std::vector<double> const realTimes = GetRunTimes(result, false);
+        double const              median    = GetMedian(realTimes);
+        double const              deviation = median > 0.0 ? 100.0 * GetStandardDeviation(realTimes) / median : 0.0;
+
+        report += Stringf("%-48s %12.1f ns  +-%5.1f%%  %12llu it", result.m_name.c_str(), median, deviation,
+                          static_cast<unsigned long long>(result.m_runs.front().m_iterations));
+
+        if (result.m_itemsPerIteration > 0 && median > 0.0)
+        {
+            report += Stringf("  %10.3f M items/s", 1e3 * static_cast<double>(result.m_itemsPerIteration) / median);
+        }
+
+        if (result.m_bytesPerIteration > 0 && median > 0.0)
+        {
+            report += Stringf("  %10.1f MB/s", 1e3 * static_cast<double>(result.m_bytesPerIteration) / median);
+        }
+
+        report += result.m_label.empty() ? "\n" : Stringf("  %s\n", result.m_label.c_str());
+    }
+
+    return report;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool MicroBenchmarkRunner::WriteJson() const
+{
+    return WriteTextFile(m_config.m_jsonPath, ToJson());
+}
+
+//----------------------------------------------------------------------------------------------------
+uint32_t MicroBenchmarkRunner::GetErrorCount() const
+{
+    return static_cast<uint32_t>(std::count_if(m_results.begin(), m_results.end(),
+                                               [](sMicroBenchmarkResult const& result) { return !result.m_errorMessage.empty(); }));
+}
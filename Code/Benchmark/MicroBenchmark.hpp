@@ -0,0 +1,163 @@
+//----------------------------------------------------------------------------------------------------
+// MicroBenchmark.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+struct sMicroBenchmarkConfig
+{
+    double      m_minRunSeconds = 0.05;             // Iterations grow until one run takes at least this long
+    uint64_t    m_maxIterations = 1000000000;
+    uint32_t    m_repetitions   = 5;                // Timed runs per benchmark after calibration
+    std::string m_filter;                           // Only names containing this run; empty runs all
+    std::string m_contextLabel;                     // Written to the JSON context, e.g. the commit hash
+    std::string m_jsonPath      = "Logs/MicroBenchmarks.json";
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sMicroBenchmarkRun
+{
+    uint64_t m_iterations      = 0;
+    double   m_realNanoseconds = 0.0;     // Per iteration
+    double   m_cpuNanoseconds  = 0.0;     // Per iteration, process CPU time (user + kernel)
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sMicroBenchmarkResult
+{
+    std::string                     m_name;
+    std::string                     m_label;
+    std::string                     m_errorMessage;             // Set by MicroBenchmarkState::SetError()
+    uint64_t                        m_itemsPerIteration = 0;     // > 0 adds items_per_second
+    uint64_t                        m_bytesPerIteration = 0;     // > 0 adds bytes_per_second
+    std::vector<sMicroBenchmarkRun> m_runs;                      // One per repetition
+};
+
+//----------------------------------------------------------------------------------------------------
+// Handed to a benchmark function for one run. Setup before the loop and teardown after it are not
+// timed; the loop body is timed for GetIterations() passes:
+//
+//     while (state.KeepRunning()) { DoNotOptimize(Work()); }
+//
+// PauseTiming()/ResumeTiming() exclude per-iteration setup, at the cost of two clock reads each.
+//----------------------------------------------------------------------------------------------------
+class MicroBenchmarkState
+{
+public:
+    MicroBenchmarkState(uint64_t iterations, int64_t argument);
+
+    bool KeepRunning()
+    {
+        if (m_remaining > 0)
+        {
+            if (!m_isStarted)
+            {
+                m_isStarted = true;
+                ResumeTiming();
+            }
+
+            --m_remaining;
+            return true;
+        }
+
+        PauseTiming();
+        return false;
+    }
+
+    void PauseTiming();
+    void ResumeTiming();
+
+    uint64_t GetIterations() const { return m_iterations; }
+    int64_t  GetArgument() const { return m_argument; }
+
+    void SetItemsPerIteration(uint64_t itemCount) { m_itemsPerIteration = itemCount; }
+    void SetBytesPerIteration(uint64_t byteCount) { m_bytesPerIteration = byteCount; }
+    void SetLabel(std::string const& label) { m_label = label; }
+    void SetError(std::string const& message);          // Marks the benchmark failed; KeepRunning() stops
+
+    double             GetRealNanoseconds() const { return m_realNanoseconds; }
+    double             GetCpuNanoseconds() const { return m_cpuNanoseconds; }
+    uint64_t           GetItemsPerIteration() const { return m_itemsPerIteration; }
+    uint64_t           GetBytesPerIteration() const { return m_bytesPerIteration; }
+    std::string const& GetLabel() const { return m_label; }
+    std::string const& GetError() const { return m_errorMessage; }
+
+private:
+    uint64_t m_iterations = 0;
+    uint64_t m_remaining  = 0;
+    int64_t  m_argument   = 0;
+    bool     m_isStarted  = false;
+    bool     m_isTiming   = false;
+
+    std::chrono::steady_clock::time_point m_realStart;
+    uint64_t                              m_cpuStart        = 0;      // GetProcessCpuNanoseconds()
+    double                                m_realNanoseconds = 0.0;
+    double                                m_cpuNanoseconds  = 0.0;
+
+    uint64_t    m_itemsPerIteration = 0;
+    uint64_t    m_bytesPerIteration = 0;
+    std::string m_label;
+    std::string m_errorMessage;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Keeps a computed value alive so the optimizer cannot drop the work that produced it: the address
+// escapes, and the fence makes the compiler assume it is read there.
+//----------------------------------------------------------------------------------------------------
+extern void const* volatile g_microBenchmarkSink;
+
+template <typename T>
+void DoNotOptimize(T const& value)
+{
+    g_microBenchmarkSink = &value;
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Runs registered benchmark functions the way Google Benchmark does: the iteration count is calibrated
+// until one run takes m_minRunSeconds (that run doubles as warm-up), then m_repetitions runs are
+// timed. Results are written as Google Benchmark JSON (per-repetition entries plus mean / median /
+// stddev aggregates), so two commits' files can be diffed with Google Benchmark's compare.py.
+//
+// A benchmark registered with arguments runs once per argument as "name/argument".
+//----------------------------------------------------------------------------------------------------
+class MicroBenchmarkRunner
+{
+public:
+    using BenchmarkFunction = std::function<void(MicroBenchmarkState&)>;
+
+    explicit MicroBenchmarkRunner(sMicroBenchmarkConfig const& config);
+
+    void Register(std::string const& name, BenchmarkFunction const& function, std::vector<int64_t> const& arguments = {});
+
+    std::vector<sMicroBenchmarkResult> const& Run();
+
+    std::string ToJson() const;
+    std::string ToReport() const;          // One line per benchmark, for the console and Logs
+    bool        WriteJson() const;
+    uint32_t    GetErrorCount() const;
+
+    std::vector<sMicroBenchmarkResult> const& GetResults() const { return m_results; }
+
+private:
+    struct sBenchmark
+    {
+        std::string       m_name;
+        BenchmarkFunction m_function;
+        int64_t           m_argument = 0;
+    };
+
+    sMicroBenchmarkResult RunBenchmark(sBenchmark const& benchmark) const;
+
+    sMicroBenchmarkConfig              m_config;
+    std::vector<sBenchmark>            m_benchmarks;
+    std::vector<sMicroBenchmarkResult> m_results;
+};
@@ -0,0 +1,404 @@
+//----------------------------------------------------------------------------------------------------
+// MicroBenchmarkSuite.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Benchmark/MicroBenchmarkSuite.hpp"
+
+#include <any>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/RandomNumberGenerator.hpp"
+#include "Engine/Math/Vec2.hpp"
+#include "Engine/Math/Vec3.hpp"
+#include "Game/Prop.hpp"
+#include "Game/PropMeshCache.hpp"
+#include "Game/Framework/CountingRenderer.hpp"
+#include "Game/Framework/FileWatcher.hpp"
+#include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/GameScriptInterface.hpp"
+#include "Game/Framework/ScriptReloader.hpp"
+#include "Game/Framework/StringTable.hpp"
+
+//----------------------------------------------------------------------------------------------------
+static uint32_t constexpr SCRATCH_WATCHED_FILE_COUNT = 4096;
+static uint32_t constexpr SCRATCH_SCRIPT_KIBIBYTES[] = {16, 256};
+
+//----------------------------------------------------------------------------------------------------
+// Times one DebugDraw*() call per iteration; the CountingRenderer frame says how many vertices it built.
+//
+template <typename DrawFunction>
+static void TimeDebugDraw(MicroBenchmarkState& state, DrawFunction const& draw)
+{
+    g_countingRenderer->BeginFrame();
+
+    while (state.KeepRunning())
+    {
+        draw();
+    }
+
+    uint32_t const vertexCount = g_countingRenderer->GetCurrentFrame().m_vertexCount / static_cast<uint32_t>(state.GetIterations());
+
+    if (vertexCount == 0)
+    {
+        state.SetError("no vertices reached the CountingRenderer");
+    }
+
+    state.SetItemsPerIteration(vertexCount);
+    state.SetLabel(Stringf("%u vertices", vertexCount));
+}
+
+//----------------------------------------------------------------------------------------------------
+MicroBenchmarkSuite::MicroBenchmarkSuite(sMicroBenchmarkConfig const& config)
+    : m_runner(config)
+{
+    std::error_code errorCode;
+    m_scratchRoot = (std::filesystem::temp_directory_path(errorCode) / "GameMicroBenchmarks").string();
+
+    RegisterScriptInterface();
+    RegisterEntity();
+    RegisterPropMesh();
+    RegisterFileWatcher();
+    RegisterScriptReloader();
+    RegisterDebugDraw();
+}
+
+//----------------------------------------------------------------------------------------------------
+MicroBenchmarkSuite::~MicroBenchmarkSuite()
+{
+    std::error_code errorCode;
+    std::filesystem::remove_all(m_scratchRoot, errorCode);
+}
+
+//----------------------------------------------------------------------------------------------------
+void MicroBenchmarkSuite::Run()
+{
+    // A failed setup is reported by the benchmarks that need the files.
+    CreateScratchFiles();
+
+    CountingRenderer* const previousRenderer = g_countingRenderer;
+    CountingRenderer        countingRenderer(sCountingRendererConfig{});
+    g_countingRenderer = &countingRenderer;
+
+    m_runner.Run();
+
+    g_countingRenderer = previousRenderer;
+}
+
+//----------------------------------------------------------------------------------------------------
+void MicroBenchmarkSuite::RegisterScriptInterface()
+{
+    // CallMethod()'s name lookup: one hash and table probe, then a switch on "..."_sid literals. The
+    // method bodies themselves need a Game.
+    m_runner.Register("ScriptInterface/MethodLookup/hit", [](MicroBenchmarkState& state)
+    {
+        std::string const methodName = "isHotReloadEnabled";
+        StringTable::Intern(methodName);     // As GameScriptInterface's constructor does for every method
+
+        while (state.KeepRunning())
+        {
+            StringID const methodID = StringTable::Find(methodName);
+            DoNotOptimize(methodID);
+        }
+    });
+
+    m_runner.Register("ScriptInterface/MethodLookup/unknown", [](MicroBenchmarkState& state)
+    {
+        std::string const methodName = "notAGameMethod";
+
+        while (state.KeepRunning())
+        {
+            StringID const methodID = StringTable::Find(methodName);
+            DoNotOptimize(methodID);
+        }
+    });
+
+    // Marshalling: moveProp's arguments as V8Subsystem hands them over (every JS number is a double).
+    m_runner.Register("ScriptInterface/Marshal/moveProp", [](MicroBenchmarkState& state)
+    {
+        std::vector<std::any> const args = {3.0, 1.5, -2.25, 4.0};
+
+        while (state.KeepRunning())
+        {
+            int const  propIndex = GameScriptInterface::ExtractInt(args[0]);
+            Vec3 const position  = GameScriptInterface::ExtractVec3(args, 1);
+            DoNotOptimize(propIndex);
+            DoNotOptimize(position);
+        }
+    });
+
+    m_runner.Register("ScriptInterface/ExtractFloat/double", [](MicroBenchmarkState& state)
+    {
+        std::any const arg = 1.25;
+
+        while (state.KeepRunning())
+        {
+            float const value = GameScriptInterface::ExtractFloat(arg);
+            DoNotOptimize(value);
+        }
+    });
+
+    // An int falls through the double and float type checks first.
+    m_runner.Register("ScriptInterface/ExtractFloat/int", [](MicroBenchmarkState& state)
+    {
+        std::any const arg = 7;
+
+        while (state.KeepRunning())
+        {
+            float const value = GameScriptInterface::ExtractFloat(arg);
+            DoNotOptimize(value);
+        }
+    });
+
+    m_runner.Register("ScriptInterface/ExtractVec3", [](MicroBenchmarkState& state)
+    {
+        std::vector<std::any> const args = {1.5, -2.25, 4.0};
+
+        while (state.KeepRunning())
+        {
+            Vec3 const value = GameScriptInterface::ExtractVec3(args, 0);
+            DoNotOptimize(value);
+        }
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+void MicroBenchmarkSuite::RegisterEntity()
+{
+    m_runner.Register("Entity/GetModelToWorldTransform", [](MicroBenchmarkState& state)
+    {
+        uint32_t const                     propCount = static_cast<uint32_t>(state.GetArgument());
+        std::vector<std::unique_ptr<Prop>> props;
+        RandomNumberGenerator              rng;
+
+        for (uint32_t index = 0; index < propCount; ++index)
+        {
+            props.push_back(std::make_unique<Prop>(nullptr));
+            props.back()->m_position    = Vec3(rng.RollRandomFloatInRange(-50.f, 50.f), rng.RollRandomFloatInRange(-50.f, 50.f), rng.RollRandomFloatInRange(0.f, 10.f));
+            props.back()->m_orientation = EulerAngles(rng.RollRandomFloatInRange(0.f, 360.f), rng.RollRandomFloatInRange(-90.f, 90.f), rng.RollRandomFloatInRange(0.f, 360.f));
+        }
+
+        state.SetItemsPerIteration(propCount);
+
+        while (state.KeepRunning())
+        {
+            for (std::unique_ptr<Prop> const& prop : props)
+            {
+                Mat44 const modelToWorld = prop->GetModelToWorldTransform();
+                DoNotOptimize(modelToWorld);
+            }
+        }
+    }, {1, 1024});
+}
+
+//----------------------------------------------------------------------------------------------------
+void MicroBenchmarkSuite::RegisterPropMesh()
+{
+    m_runner.Register("PropMesh/BuildCube", [](MicroBenchmarkState& state)
+    {
+        while (state.KeepRunning())
+        {
+            sPropMesh mesh;
+            PropMeshCache::BuildMesh(ePropMeshType::CUBE, mesh);
+            DoNotOptimize(mesh);
+        }
+    });
+
+    m_runner.Register("PropMesh/BuildSphere", [](MicroBenchmarkState& state)
+    {
+        while (state.KeepRunning())
+        {
+            sPropMesh mesh;
+            PropMeshCache::BuildMesh(ePropMeshType::SPHERE, mesh);
+            DoNotOptimize(mesh);
+        }
+    });
+
+    m_runner.Register("PropMesh/BuildGrid", [](MicroBenchmarkState& state)
+    {
+        while (state.KeepRunning())
+        {
+            sPropMesh mesh;
+            PropMeshCache::BuildMesh(ePropMeshType::GRID, mesh);
+            DoNotOptimize(mesh);
+        }
+    });
+
+    // Every LOD level of the shared sphere copied and remapped into one atlas region.
+    m_runner.Register("PropMesh/SetTextureAtlasRegion/sphere", [](MicroBenchmarkState& state)
+    {
+        Prop prop(nullptr);
+        prop.InitializeLocalVertsForSphere();
+
+        AABB2 const uvBounds(0.25f, 0.5f, 0.5f, 0.75f);
+
+        while (state.KeepRunning())
+        {
+            prop.SetTextureAtlasRegion(uvBounds);
+        }
+
+        state.SetItemsPerIteration(prop.GetVertexCount());
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+// The setup reruns for each calibration and repetition, so the files go in through AddWatchedFiles(),
+// which logs once per batch instead of once per file.
+//
+void MicroBenchmarkSuite::RegisterFileWatcher()
+{
+    m_runner.Register("FileWatcher/CheckFileChanges", [this](MicroBenchmarkState& state)
+    {
+        uint32_t const fileCount = static_cast<uint32_t>(state.GetArgument());
+        FileWatcher    watcher;
+
+        if (!watcher.Initialize(m_scratchRoot))
+        {
+            state.SetError("FileWatcher could not use the scratch folder");
+            return;
+        }
+
+        std::vector<std::string> relativePaths;
+
+        for (uint32_t index = 0; index < fileCount; ++index)
+        {
+            relativePaths.push_back(GetScratchWatchedPath(index));
+        }
+
+        if (watcher.AddWatchedFiles(relativePaths) != fileCount)
+        {
+            state.SetError("missing scratch files");
+            return;
+        }
+
+        state.SetItemsPerIteration(fileCount);
+
+        while (state.KeepRunning())
+        {
+            watcher.CheckFileChanges();
+        }
+
+        if (watcher.HasPendingChanges())
+        {
+            state.SetError("unchanged files were reported as changed");
+        }
+    }, {16, 256, SCRATCH_WATCHED_FILE_COUNT});
+}
+
+//----------------------------------------------------------------------------------------------------
+void MicroBenchmarkSuite::RegisterScriptReloader()
+{
+    m_runner.Register("ScriptReloader/ReadScriptFile", [this](MicroBenchmarkState& state)
+    {
+        uint32_t const    kibibytes = static_cast<uint32_t>(state.GetArgument());
+        std::string const path      = GetScratchScriptPath(kibibytes);
+        ScriptReloader    reloader;
+        std::string       content;
+
+        state.SetBytesPerIteration(static_cast<uint64_t>(kibibytes) * 1024);
+
+        while (state.KeepRunning())
+        {
+            if (!reloader.ReadScriptFile(path, content))
+            {
+                state.SetError(reloader.GetLastError());
+            }
+
+            DoNotOptimize(content);
+        }
+    }, {SCRATCH_SCRIPT_KIBIBYTES[0], SCRATCH_SCRIPT_KIBIBYTES[1]});
+}
+
+//----------------------------------------------------------------------------------------------------
+void MicroBenchmarkSuite::RegisterDebugDraw()
+{
+    Rgba8 const color(255, 200, 0);
+
+    m_runner.Register("DebugDraw/Ring", [color](MicroBenchmarkState& state)
+    {
+        TimeDebugDraw(state, [color]() { DebugDrawRing(Vec2(800.f, 400.f), 120.f, 4.f, color); });
+    });
+
+    m_runner.Register("DebugDraw/Line", [color](MicroBenchmarkState& state)
+    {
+        TimeDebugDraw(state, [color]() { DebugDrawLine(Vec2(100.f, 100.f), Vec2(900.f, 500.f), 3.f, color); });
+    });
+
+    m_runner.Register("DebugDraw/GlowCircle", [color](MicroBenchmarkState& state)
+    {
+        TimeDebugDraw(state, [color]() { DebugDrawGlowCircle(Vec2(800.f, 400.f), 60.f, color, 0.8f); });
+    });
+
+    m_runner.Register("DebugDraw/GlowBox", [color](MicroBenchmarkState& state)
+    {
+        TimeDebugDraw(state, [color]() { DebugDrawGlowBox(Vec2(800.f, 400.f), Vec2(200.f, 80.f), color, 0.8f); });
+    });
+
+    m_runner.Register("DebugDraw/BoxRing", [color](MicroBenchmarkState& state)
+    {
+        TimeDebugDraw(state, [color]() { DebugDrawBoxRing(Vec2(800.f, 400.f), 120.f, 4.f, color); });
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+// Small watched files and script-shaped text of the benchmarked sizes; existing files are reused, so
+// every run of one suite stats and reads the same data.
+//
+bool MicroBenchmarkSuite::CreateScratchFiles()
+{
+    std::error_code errorCode;
+    std::filesystem::create_directories(std::filesystem::path(m_scratchRoot) / "Run" / "Watched", errorCode);
+
+    if (errorCode)
+    {
+        return false;
+    }
+
+    for (uint32_t index = 0; index < SCRATCH_WATCHED_FILE_COUNT; ++index)
+    {
+        std::ofstream file(std::filesystem::path(m_scratchRoot) / "Run" / GetScratchWatchedPath(index), std::ios::binary | std::ios::trunc);
+        file << Stringf("// watched file %u\n", index);
+    }
+
+    for (uint32_t const kibibytes : SCRATCH_SCRIPT_KIBIBYTES)
+    {
+        std::string text;
+        uint32_t    lineIndex = 0;
+
+        while (text.size() < kibibytes * 1024u)
+        {
+            text += Stringf("    update%u(deltaTime) { this.value%u += deltaTime * %u; }\n", lineIndex, lineIndex % 64, lineIndex % 7);
+            ++lineIndex;
+        }
+
+        text.resize(kibibytes * 1024u);
+
+        std::ofstream file(GetScratchScriptPath(kibibytes), std::ios::binary | std::ios::trunc);
+        file << text;
+
+        if (!file)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+std::string MicroBenchmarkSuite::GetScratchWatchedPath(uint32_t const index) const
+{
+    return Stringf("Watched/File%04u.js", index);
+}
+
+//----------------------------------------------------------------------------------------------------
+std::string MicroBenchmarkSuite::GetScratchScriptPath(uint32_t const kibibytes) const
+{
+    return (std::filesystem::path(m_scratchRoot) / "Run" / Stringf("Script%uKiB.js", kibibytes)).string();
+}
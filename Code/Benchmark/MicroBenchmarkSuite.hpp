@@ -0,0 +1,50 @@
+//----------------------------------------------------------------------------------------------------
+// MicroBenchmarkSuite.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <string>
+
+#include "Benchmark/MicroBenchmark.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// The game and framework hot paths, registered on a MicroBenchmarkRunner and run by the Benchmark
+// project's executable (no window, renderer or V8), through the classes' public APIs only:
+//
+//   ScriptInterface/  CallMethod()'s method name lookup (hit, unknown name) and the static
+//                     ExtractInt / ExtractFloat / ExtractVec3 marshalling of V8 numbers
+//   Entity/           GetModelToWorldTransform() over N props
+//   PropMesh/         PropMeshCache::BuildMesh() past the build-once cache, and per-prop atlas UV remapping
+//   FileWatcher/      one CheckFileChanges() pass over N unchanged files
+//   ScriptReloader/   ReadScriptFile() of an N KiB script; compiling needs the V8 isolate App owns
+//   DebugDraw/        DebugDraw*() vertex generation into a CountingRenderer with no g_renderer behind it
+//
+// The FileWatcher and ScriptReloader files are written to a temp folder that the destructor removes.
+//----------------------------------------------------------------------------------------------------
+class MicroBenchmarkSuite
+{
+public:
+    explicit MicroBenchmarkSuite(sMicroBenchmarkConfig const& config);
+    ~MicroBenchmarkSuite();
+
+    void Run();         // Installs its own g_countingRenderer for the duration
+
+    MicroBenchmarkRunner const& GetRunner() const { return m_runner; }
+
+private:
+    void RegisterScriptInterface();
+    void RegisterEntity();
+    void RegisterPropMesh();
+    void RegisterFileWatcher();
+    void RegisterScriptReloader();
+    void RegisterDebugDraw();
+
+    bool        CreateScratchFiles();
+    std::string GetScratchWatchedPath(uint32_t index) const;       // Relative to the FileWatcher root
+    std::string GetScratchScriptPath(uint32_t kibibytes) const;    // Absolute
+
+    MicroBenchmarkRunner m_runner;
+    std::string          m_scratchRoot;     // FileWatcher project root; it watches files under Run/
+};
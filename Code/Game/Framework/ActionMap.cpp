@@ -0,0 +1,460 @@
+//----------------------------------------------------------------------------------------------------
+// ActionMap.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/ActionMap.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string_view>
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/LogSubsystem.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Input/InputSystem.hpp"
+#include "Game/Framework/InputEventQueue.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// Indexed by eAction / eActionAxis; these are the names used in ActionMap.xml and by JS.
+static char const* const ACTION_NAMES[] = {
+    "MoveForward", "MoveBack", "MoveLeft", "MoveRight", "MoveDown", "MoveUp", "RollLeft", "RollRight", "Sprint", "ResetCamera",
+    "Start", "Back", "Pause", "StepFrame", "SlowMotion", "QuickSave", "QuickLoad", "ToggleOcclusion",
+    "DebugLine", "DebugPoint", "DebugSphere", "DebugBasis", "DebugText", "DebugCylinder", "DebugMessage"};
+
+static char const* const AXIS_NAMES[] = {"MoveX", "MoveY", "LookX", "LookY", "RollNegative", "RollPositive"};
+
+static_assert(std::size(ACTION_NAMES) == static_cast<size_t>(eAction::COUNT));
+static_assert(std::size(AXIS_NAMES) == static_cast<size_t>(eActionAxis::COUNT));
+
+//----------------------------------------------------------------------------------------------------
+// Windows virtual-key codes, the same values as the engine KEYCODE_* constants.
+struct sNamedCode
+{
+    char const* m_name;
+    uint8_t     m_code;
+};
+
+static sNamedCode const KEY_NAMES[] = {
+    {"ESC", 0x1B}, {"SPACE", 0x20}, {"SHIFT", 0x10}, {"CTRL", 0x11}, {"ALT", 0x12}, {"ENTER", 0x0D}, {"TAB", 0x09}, {"BACKSPACE", 0x08},
+    {"LEFT", 0x25}, {"UP", 0x26}, {"RIGHT", 0x27}, {"DOWN", 0x28}, {"LMB", 0x01}, {"RMB", 0x02}, {"MMB", 0x04},
+    {"F1", 0x70}, {"F2", 0x71}, {"F3", 0x72}, {"F4", 0x73}, {"F5", 0x74}, {"F6", 0x75},
+    {"F7", 0x76}, {"F8", 0x77}, {"F9", 0x78}, {"F10", 0x79}, {"F11", 0x7A}, {"F12", 0x7B}};
+
+static sNamedCode const BUTTON_NAMES[] = {
+    {"A", XBOX_BUTTON_A}, {"B", XBOX_BUTTON_B}, {"X", XBOX_BUTTON_X}, {"Y", XBOX_BUTTON_Y},
+    {"BACK", XBOX_BUTTON_BACK}, {"START", XBOX_BUTTON_START}, {"LSHOULDER", XBOX_BUTTON_LSHOULDER}, {"RSHOULDER", XBOX_BUTTON_RSHOULDER}};
+
+static char const* const AXIS_SOURCE_NAMES[] = {"None", "LeftStickX", "LeftStickY", "RightStickX", "RightStickY", "LeftTrigger", "RightTrigger"};
+
+//----------------------------------------------------------------------------------------------------
+// Used when Data/Config/ActionMap.xml is missing; keep the two in step.
+struct sDefaultBinding
+{
+    eAction     m_action;
+    char const* m_keys;
+    char const* m_buttons;
+};
+
+static sDefaultBinding const DEFAULT_BINDINGS[] = {
+    {eAction::MOVE_FORWARD, "W", ""}, {eAction::MOVE_BACK, "S", ""}, {eAction::MOVE_LEFT, "A", ""}, {eAction::MOVE_RIGHT, "D", ""},
+    {eAction::MOVE_DOWN, "Z", "LSHOULDER"}, {eAction::MOVE_UP, "C", "RSHOULDER"}, {eAction::ROLL_LEFT, "Q", ""}, {eAction::ROLL_RIGHT, "E", ""},
+    {eAction::SPRINT, "SHIFT", "A"}, {eAction::RESET_CAMERA, "H", "START"},
+    {eAction::START, "SPACE", "START"}, {eAction::BACK, "ESC", "BACK"}, {eAction::PAUSE, "P", "B"}, {eAction::STEP_FRAME, "O", "Y"},
+    {eAction::SLOW_MOTION, "T", "X"}, {eAction::QUICK_SAVE, "F5", ""}, {eAction::QUICK_LOAD, "F9", ""}, {eAction::TOGGLE_OCCLUSION, "F6", ""},
+    {eAction::DEBUG_LINE, "1", ""}, {eAction::DEBUG_POINT, "2", ""}, {eAction::DEBUG_SPHERE, "3", ""}, {eAction::DEBUG_BASIS, "4", ""},
+    {eAction::DEBUG_TEXT, "5", ""}, {eAction::DEBUG_CYLINDER, "6", ""}, {eAction::DEBUG_MESSAGE, "7", ""}};
+
+//----------------------------------------------------------------------------------------------------
+template <size_t N>
+static int FindName(char const* const (&names)[N], std::string_view const name)
+{
+    for (size_t i = 0; i < N; ++i)
+    {
+        if (name == names[i]) return static_cast<int>(i);
+    }
+
+    return -1;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Single letters and digits are their own key codes.
+//
+static bool ParseKeyName(std::string_view const name, uint8_t& out_code)
+{
+    if (name.size() == 1 && std::isalnum(static_cast<unsigned char>(name[0])))
+    {
+        out_code = static_cast<uint8_t>(std::toupper(static_cast<unsigned char>(name[0])));
+        return true;
+    }
+
+    for (sNamedCode const& key : KEY_NAMES)
+    {
+        if (name == key.m_name)
+        {
+            out_code = key.m_code;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------------------------------
+static bool ParseButtonName(std::string_view const name, uint8_t& out_code)
+{
+    for (sNamedCode const& button : BUTTON_NAMES)
+    {
+        if (name == button.m_name)
+        {
+            out_code = button.m_code;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Value of name="..." inside one element's attribute text, or false if the attribute is absent.
+//
+static bool FindAttribute(std::string_view const attributes,
+                          char const*            name,
+                          std::string_view&      out_value)
+{
+    size_t const nameLength = std::strlen(name);
+
+    for (size_t cursor = attributes.find(name); cursor != std::string_view::npos; cursor = attributes.find(name, cursor + 1))
+    {
+        bool const isWordStart = cursor == 0 || std::isspace(static_cast<unsigned char>(attributes[cursor - 1]));
+        size_t     equals      = cursor + nameLength;
+
+        while (equals < attributes.size() && std::isspace(static_cast<unsigned char>(attributes[equals]))) ++equals;
+
+        if (!isWordStart || equals + 1 >= attributes.size() || attributes[equals] != '=')
+        {
+            continue;
+        }
+
+        size_t const open  = attributes.find_first_of("\"'", equals + 1);
+        size_t const close = open != std::string_view::npos ? attributes.find(attributes[open], open + 1) : std::string_view::npos;
+
+        if (close == std::string_view::npos)
+        {
+            return false;
+        }
+
+        out_value = attributes.substr(open + 1, close - open - 1);
+        return true;
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Space- or comma-separated names.
+//
+template <typename Function>
+static bool ForEachName(std::string_view const list, Function const& function)
+{
+    size_t cursor = 0;
+
+    while (cursor < list.size())
+    {
+        size_t const start = list.find_first_not_of(" \t,", cursor);
+
+        if (start == std::string_view::npos) break;
+
+        size_t const end = std::min(list.find_first_of(" \t,", start), list.size());
+
+        if (!function(list.substr(start, end - start)))
+        {
+            return false;
+        }
+
+        cursor = end;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+ActionMap::ActionMap()
+{
+    for (sDefaultBinding const& binding : DEFAULT_BINDINGS)
+    {
+        uint32_t const actionMask = GetBit(binding.m_action);
+
+        ForEachName(binding.m_keys, [this, actionMask](std::string_view const name)
+        {
+            uint8_t code = 0;
+            if (ParseKeyName(name, code)) AddBinding(m_keyBindings, code, actionMask);
+            return true;
+        });
+
+        ForEachName(binding.m_buttons, [this, actionMask](std::string_view const name)
+        {
+            uint8_t code = 0;
+            if (ParseButtonName(name, code)) AddBinding(m_buttonBindings, code, actionMask);
+            return true;
+        });
+    }
+
+    // Axes default to the source listed in the same position: MoveX = LeftStickX ... RollPositive = RightTrigger.
+    for (uint8_t axis = 0; axis < static_cast<uint8_t>(eActionAxis::COUNT); ++axis)
+    {
+        m_axisBindings[axis].m_source = static_cast<eAxisSource>(axis + 1);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+bool ActionMap::LoadFromFile(std::string const& filePath)
+{
+    std::ifstream file(filePath);
+
+    if (!file.is_open())
+    {
+        DAEMON_LOG(LogGame, eLogVerbosity::Warning, StringFormat("(ActionMap::LoadFromFile)({} not found, keeping built-in bindings)", filePath));
+        return false;
+    }
+
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+
+    std::string error;
+
+    if (!LoadFromText(buffer.str(), error))
+    {
+        DAEMON_LOG(LogGame, eLogVerbosity::Error, StringFormat("(ActionMap::LoadFromFile)({}: {})", filePath, error));
+        return false;
+    }
+
+    DAEMON_LOG(LogGame, eLogVerbosity::Log, StringFormat("(ActionMap::LoadFromFile)({}: {} bindings)", filePath, GetBindingCount()));
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Only <Action .../> and <Axis .../> elements are read; comments and anything else are skipped.
+// Actions and axes not mentioned in the text end up unbound.
+//
+bool ActionMap::LoadFromText(std::string const& text,
+                             std::string&       out_error)
+{
+    std::vector<sInputBinding> keyBindings;
+    std::vector<sInputBinding> buttonBindings;
+    sAxisBinding               axisBindings[static_cast<uint8_t>(eActionAxis::COUNT)];
+
+    std::string_view const document = text;
+    size_t                 cursor   = 0;
+
+    while ((cursor = document.find('<', cursor)) != std::string_view::npos)
+    {
+        if (document.substr(cursor, 4) == "<!--")
+        {
+            size_t const commentEnd = document.find("-->", cursor + 4);
+            cursor                  = commentEnd != std::string_view::npos ? commentEnd + 3 : document.size();
+            continue;
+        }
+
+        size_t const tagEnd = document.find('>', cursor);
+
+        if (tagEnd == std::string_view::npos)
+        {
+            out_error = "unterminated element";
+            return false;
+        }
+
+        std::string_view const element = document.substr(cursor + 1, tagEnd - cursor - 1);
+        cursor                         = tagEnd + 1;
+
+        bool const isAction = element.starts_with("Action ");
+        bool const isAxis   = element.starts_with("Axis ");
+
+        if (!isAction && !isAxis)
+        {
+            continue;
+        }
+
+        std::string_view name;
+
+        if (!FindAttribute(element, "name", name))
+        {
+            out_error = Stringf("<%s> without a name", isAction ? "Action" : "Axis");
+            return false;
+        }
+
+        if (isAction)
+        {
+            int const action = FindName(ACTION_NAMES, name);
+
+            if (action < 0)
+            {
+                out_error = Stringf("unknown action \"%s\"", std::string(name).c_str());
+                return false;
+            }
+
+            uint32_t const   actionMask = 1u << action;
+            std::string_view keys;
+            std::string_view buttons;
+
+            bool const areKeysValid = !FindAttribute(element, "keys", keys) || ForEachName(keys, [&](std::string_view const keyName)
+            {
+                uint8_t code = 0;
+                if (!ParseKeyName(keyName, code))
+                {
+                    out_error = Stringf("unknown key \"%s\" for %s", std::string(keyName).c_str(), ACTION_NAMES[action]);
+                    return false;
+                }
+
+                AddBinding(keyBindings, code, actionMask);
+                return true;
+            });
+
+            bool const areButtonsValid = areKeysValid && (!FindAttribute(element, "buttons", buttons) || ForEachName(buttons, [&](std::string_view const buttonName)
+            {
+                uint8_t code = 0;
+                if (!ParseButtonName(buttonName, code))
+                {
+                    out_error = Stringf("unknown button \"%s\" for %s", std::string(buttonName).c_str(), ACTION_NAMES[action]);
+                    return false;
+                }
+
+                AddBinding(buttonBindings, code, actionMask);
+                return true;
+            }));
+
+            if (!areButtonsValid)
+            {
+                return false;
+            }
+        }
+        else
+        {
+            int const        axis = FindName(AXIS_NAMES, name);
+            std::string_view sourceName;
+            std::string_view scale;
+
+            if (axis < 0)
+            {
+                out_error = Stringf("unknown axis \"%s\"", std::string(name).c_str());
+                return false;
+            }
+
+            int const source = FindAttribute(element, "source", sourceName) ? FindName(AXIS_SOURCE_NAMES, sourceName) : -1;
+
+            if (source < 0)
+            {
+                out_error = Stringf("axis %s needs a source (LeftStickX ... RightTrigger)", AXIS_NAMES[axis]);
+                return false;
+            }
+
+            axisBindings[axis].m_source = static_cast<eAxisSource>(source);
+            axisBindings[axis].m_scale  = FindAttribute(element, "scale", scale) ? std::strtof(std::string(scale).c_str(), nullptr) : 1.f;
+        }
+    }
+
+    m_keyBindings    = std::move(keyBindings);
+    m_buttonBindings = std::move(buttonBindings);
+    std::copy(std::begin(axisBindings), std::end(axisBindings), std::begin(m_axisBindings));
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void ActionMap::Resolve(InputEventQueue const& inputEvents,
+                        XboxController const&  controller)
+{
+    sActionState state;
+
+    for (sInputBinding const& binding : m_keyBindings)
+    {
+        if (inputEvents.IsKeyDown(binding.m_code)) state.m_down |= binding.m_actionMask;
+        if (inputEvents.WasKeyJustPressed(binding.m_code)) state.m_pressed |= binding.m_actionMask;
+        if (inputEvents.WasKeyJustReleased(binding.m_code)) state.m_released |= binding.m_actionMask;
+    }
+
+    uint32_t buttonsDown = 0;
+
+    for (sInputBinding const& binding : m_buttonBindings)
+    {
+        uint32_t const buttonBit = 1u << binding.m_code;
+
+        if (controller.IsButtonDown(static_cast<XboxButtonID>(binding.m_code)))
+        {
+            buttonsDown |= buttonBit;
+            state.m_down |= binding.m_actionMask;
+
+            if ((m_buttonsDown & buttonBit) == 0) state.m_pressed |= binding.m_actionMask;
+        }
+        else if ((m_buttonsDown & buttonBit) != 0)
+        {
+            state.m_released |= binding.m_actionMask;
+        }
+    }
+
+    m_buttonsDown = buttonsDown;
+
+    for (uint8_t axis = 0; axis < static_cast<uint8_t>(eActionAxis::COUNT); ++axis)
+    {
+        float value = 0.f;
+
+        switch (m_axisBindings[axis].m_source)
+        {
+        case eAxisSource::LEFT_STICK_X:  value = controller.GetLeftStick().GetPosition().x;  break;
+        case eAxisSource::LEFT_STICK_Y:  value = controller.GetLeftStick().GetPosition().y;  break;
+        case eAxisSource::RIGHT_STICK_X: value = controller.GetRightStick().GetPosition().x; break;
+        case eAxisSource::RIGHT_STICK_Y: value = controller.GetRightStick().GetPosition().y; break;
+        case eAxisSource::LEFT_TRIGGER:  value = controller.GetLeftTrigger();                break;
+        case eAxisSource::RIGHT_TRIGGER: value = controller.GetRightTrigger();               break;
+        case eAxisSource::NONE:          break;
+        }
+
+        state.m_axes[axis] = value * m_axisBindings[axis].m_scale;
+    }
+
+    m_state = state;
+}
+
+//----------------------------------------------------------------------------------------------------
+uint32_t ActionMap::GetBindingCount() const
+{
+    uint32_t count = 0;
+
+    for (sInputBinding const& binding : m_keyBindings) count += static_cast<uint32_t>(std::popcount(binding.m_actionMask));
+    for (sInputBinding const& binding : m_buttonBindings) count += static_cast<uint32_t>(std::popcount(binding.m_actionMask));
+
+    return count;
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC char const* ActionMap::GetActionName(eAction const action)
+{
+    return ACTION_NAMES[static_cast<uint8_t>(action)];
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC char const* ActionMap::GetAxisName(eActionAxis const axis)
+{
+    return AXIS_NAMES[static_cast<uint8_t>(axis)];
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC void ActionMap::AddBinding(std::vector<sInputBinding>& bindings,
+                                  uint8_t const               code,
+                                  uint32_t const              actionMask)
+{
+    auto const iterator = std::find_if(bindings.begin(), bindings.end(), [code](sInputBinding const& binding) { return binding.m_code == code; });
+
+    if (iterator != bindings.end())
+    {
+        iterator->m_actionMask |= actionMask;
+        return;
+    }
+
+    bindings.push_back({code, actionMask});
+}
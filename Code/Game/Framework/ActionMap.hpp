@@ -0,0 +1,134 @@
+//----------------------------------------------------------------------------------------------------
+// ActionMap.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class InputEventQueue;
+class XboxController;
+
+//----------------------------------------------------------------------------------------------------
+enum class eAction : uint8_t
+{
+    MOVE_FORWARD,
+    MOVE_BACK,
+    MOVE_LEFT,
+    MOVE_RIGHT,
+    MOVE_DOWN,
+    MOVE_UP,
+    ROLL_LEFT,
+    ROLL_RIGHT,
+    SPRINT,
+    RESET_CAMERA,
+    START,
+    BACK,
+    PAUSE,
+    STEP_FRAME,
+    SLOW_MOTION,
+    QUICK_SAVE,
+    QUICK_LOAD,
+    TOGGLE_OCCLUSION,
+    DEBUG_LINE,
+    DEBUG_POINT,
+    DEBUG_SPHERE,
+    DEBUG_BASIS,
+    DEBUG_TEXT,
+    DEBUG_CYLINDER,
+    DEBUG_MESSAGE,
+    COUNT
+};
+
+//----------------------------------------------------------------------------------------------------
+enum class eActionAxis : uint8_t
+{
+    MOVE_X,
+    MOVE_Y,
+    LOOK_X,
+    LOOK_Y,
+    ROLL_NEGATIVE,
+    ROLL_POSITIVE,
+    COUNT
+};
+
+//----------------------------------------------------------------------------------------------------
+// One bit per eAction, so a whole step's actions are three words.
+//----------------------------------------------------------------------------------------------------
+struct sActionState
+{
+    uint32_t m_down     = 0;
+    uint32_t m_pressed  = 0;
+    uint32_t m_released = 0;
+    float    m_axes[static_cast<uint8_t>(eActionAxis::COUNT)] = {};
+};
+
+static_assert(static_cast<uint8_t>(eAction::COUNT) <= 32, "sActionState holds one 32-bit word per state");
+
+//----------------------------------------------------------------------------------------------------
+// Keyboard and controller bindings for game actions, read from data (Data/Config/ActionMap.xml):
+//     <Action name="Sprint" keys="SHIFT" buttons="A"/>
+//     <Axis name="MoveX" source="LeftStickX" scale="1"/>
+// Resolve() runs once per sim step and turns every bound key and button into the action bitsets and
+// axis values; game code and JS then read actions instead of querying keys one by one.
+//
+// Keys come from the InputEventQueue, so a tap inside one step still sets the pressed and released
+// bits. Controller buttons are polled, and their edges are taken against the previous Resolve().
+//----------------------------------------------------------------------------------------------------
+class ActionMap
+{
+public:
+    ActionMap();      // Built-in bindings, the same as the shipped ActionMap.xml
+
+    bool LoadFromFile(std::string const& filePath);      // false (bindings unchanged) if missing or invalid
+    bool LoadFromText(std::string const& text, std::string& out_error);
+
+    void Resolve(InputEventQueue const& inputEvents, XboxController const& controller);
+
+    bool  IsDown(eAction action) const { return (m_state.m_down & GetBit(action)) != 0; }
+    bool  WasJustPressed(eAction action) const { return (m_state.m_pressed & GetBit(action)) != 0; }
+    bool  WasJustReleased(eAction action) const { return (m_state.m_released & GetBit(action)) != 0; }
+    float GetAxis(eActionAxis axis) const { return m_state.m_axes[static_cast<uint8_t>(axis)]; }
+
+    sActionState const& GetState() const { return m_state; }
+    uint32_t            GetBindingCount() const;
+
+    static char const* GetActionName(eAction action);
+    static char const* GetAxisName(eActionAxis axis);
+
+private:
+    enum class eAxisSource : uint8_t
+    {
+        NONE,
+        LEFT_STICK_X,
+        LEFT_STICK_Y,
+        RIGHT_STICK_X,
+        RIGHT_STICK_Y,
+        LEFT_TRIGGER,
+        RIGHT_TRIGGER
+    };
+
+    struct sInputBinding
+    {
+        uint8_t  m_code       = 0;      // Key code or XboxButtonID
+        uint32_t m_actionMask = 0;      // Every action bound to it
+    };
+
+    struct sAxisBinding
+    {
+        eAxisSource m_source = eAxisSource::NONE;
+        float       m_scale  = 1.f;
+    };
+
+    static uint32_t GetBit(eAction action) { return 1u << static_cast<uint8_t>(action); }
+    static void     AddBinding(std::vector<sInputBinding>& bindings, uint8_t code, uint32_t actionMask);
+
+    std::vector<sInputBinding> m_keyBindings;          // One entry per distinct key
+    std::vector<sInputBinding> m_buttonBindings;       // One entry per distinct button
+    sAxisBinding               m_axisBindings[static_cast<uint8_t>(eActionAxis::COUNT)];
+    uint32_t                   m_buttonsDown = 0;      // As of the previous Resolve()
+    sActionState               m_state;
+};
@@ -22,17 +22,29 @@
 #include "Engine/Resource/ResourceSubsystem.hpp"
 #include "Engine/Scripting/V8Subsystem.hpp"
 #include "Game/Game.hpp"
+#include "Game/Framework/ConsoleScrollback.hpp"
+#include "Game/Framework/CountingRenderer.hpp"
+#include "Game/Framework/EventBus.hpp"
+#include "Game/Framework/GameConfig.hpp"
 #include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/InputEventQueue.hpp"
+#include "Game/Framework/TextLayoutCache.hpp"
 
 //----------------------------------------------------------------------------------------------------
 App*                   g_app               = nullptr;       // Created and owned by Main_Windows.cpp
 AudioSystem*           g_audio             = nullptr;       // Created and owned by the App
 BitmapFont*            g_bitmapFont        = nullptr;       // Created and owned by the App
+ConsoleScrollback*     g_consoleScrollback = nullptr;       // Created and owned by the App
+CountingRenderer*      g_countingRenderer  = nullptr;       // Created and owned by the App
+EventBus*              g_eventBus          = nullptr;       // Created and owned by the App
 Game*                  g_game              = nullptr;       // Created and owned by the App
+GameConfig*            g_gameConfig        = nullptr;       // Created and owned by the App
+InputEventQueue*       g_inputEventQueue   = nullptr;       // Created and owned by the App
 Renderer*              g_renderer          = nullptr;       // Created and owned by the App
 RandomNumberGenerator* g_rng               = nullptr;       // Created and owned by the App
 Window*                g_window            = nullptr;       // Created and owned by the App
 ResourceSubsystem*     g_resourceSubsystem = nullptr;       // Created and owned by the App
+TextLayoutCache*       g_textLayoutCache   = nullptr;       // Created and owned by the App
 V8Subsystem*           g_v8Subsystem       = nullptr;
 
 //----------------------------------------------------------------------------------------------------
@@ -41,6 +53,17 @@ STATIC bool App::m_isQuitting = false;
 //----------------------------------------------------------------------------------------------------
 void App::Startup()
 {
+    //-Start-of-GameConfig----------------------------------------------------------------------------
+
+    // First, since the subsystems below are configured from it.
+    sGameConfigSettings const gameConfigSettings;
+    g_gameConfig = new GameConfig(gameConfigSettings);
+    g_gameConfig->Load();
+
+    sGameConfig const& gameConfig = g_gameConfig->Get();
+
+    //-End-of-GameConfig------------------------------------------------------------------------------
+    //------------------------------------------------------------------------------------------------
     //-Start-of-EventSystem---------------------------------------------------------------------------
 
     sEventSystemConfig constexpr sEventSystemConfig;
@@ -48,6 +71,10 @@ void App::Startup()
     g_eventSystem->SubscribeEventCallbackFunction("OnCloseButtonClicked", OnCloseButtonClicked);
     g_eventSystem->SubscribeEventCallbackFunction("quit", OnCloseButtonClicked);
 
+    // Cross-thread game events (file changes, finished snapshot writes), dispatched once per frame.
+    sEventBusConfig constexpr eventBusConfig;
+    g_eventBus = new EventBus(eventBusConfig);
+
     //-End-of-EventSystem-----------------------------------------------------------------------------
     //------------------------------------------------------------------------------------------------
     //-Start-of-InputSystem---------------------------------------------------------------------------
@@ -55,6 +82,10 @@ void App::Startup()
     sInputSystemConfig constexpr sInputSystemConfig;
     g_input = new InputSystem(sInputSystemConfig);
 
+    // The sim reads keys from timestamped window events, consumed once per step, not from frame polling.
+    sInputEventQueueConfig constexpr inputEventQueueConfig;
+    g_inputEventQueue = new InputEventQueue(inputEventQueueConfig);
+
     //-End-of-InputSystem-----------------------------------------------------------------------------
     //------------------------------------------------------------------------------------------------
     //-Start-of-Window--------------------------------------------------------------------------------
@@ -74,6 +105,10 @@ void App::Startup()
     sRendererConfig.m_window = g_window;
     g_renderer               = new Renderer(sRendererConfig);
 
+    // Game-side draws go through the counting front so per-frame cost can be shown and queried from JS.
+    sCountingRendererConfig constexpr countingRendererConfig;
+    g_countingRenderer = new CountingRenderer(countingRendererConfig);
+
     //-End-of-Renderer--------------------------------------------------------------------------------
     //------------------------------------------------------------------------------------------------
     //-Start-of-DebugRender---------------------------------------------------------------------------
@@ -93,41 +128,55 @@ void App::Startup()
     devConsoleConfig.m_defaultCamera   = m_devConsoleCamera;
     g_devConsole                       = new DevConsole(devConsoleConfig);
 
-    g_devConsole->AddLine(DevConsole::INFO_MAJOR, "Controls");
-    g_devConsole->AddLine(DevConsole::INFO_MINOR, "(Mouse) Aim");
-    g_devConsole->AddLine(DevConsole::INFO_MINOR, "(W/A)   Move");
-    g_devConsole->AddLine(DevConsole::INFO_MINOR, "(S/D)   Strafe");
-    g_devConsole->AddLine(DevConsole::INFO_MINOR, "(Q/E)   Roll");
-    g_devConsole->AddLine(DevConsole::INFO_MINOR, "(Z/C)   Elevate");
-    g_devConsole->AddLine(DevConsole::INFO_MINOR, "(Shift) Sprint");
-    g_devConsole->AddLine(DevConsole::INFO_MINOR, "(H)     Set Camera to Origin");
-    g_devConsole->AddLine(DevConsole::INFO_MINOR, "(1)     Spawn Line");
-    g_devConsole->AddLine(DevConsole::INFO_MINOR, "(2)     Spawn Point");
-    g_devConsole->AddLine(DevConsole::INFO_MINOR, "(3)     Spawn Wireframe Sphere");
-    g_devConsole->AddLine(DevConsole::INFO_MINOR, "(4)     Spawn Basis");
-    g_devConsole->AddLine(DevConsole::INFO_MINOR, "(5)     Spawn Billboard Text");
-    g_devConsole->AddLine(DevConsole::INFO_MINOR, "(6)     Spawn Wireframe Cylinder");
-    g_devConsole->AddLine(DevConsole::INFO_MINOR, "(7)     Add Message");
-    g_devConsole->AddLine(DevConsole::INFO_MINOR, "(~)     Toggle Dev Console");
-    g_devConsole->AddLine(DevConsole::INFO_MINOR, "(ESC)   Exit Game");
-    g_devConsole->AddLine(DevConsole::INFO_MINOR, "(SPACE) Start Game");
+    m_devConsoleCamera->SetOrthoGraphicView(Vec2::ZERO, Vec2(1600.f, 900.f));
+
+    // Console output lives in a bounded ring with retained glyph geometry; the engine console only
+    // draws the input line under it.
+    sTextLayoutCacheConfig constexpr textLayoutCacheConfig;
+    g_textLayoutCache = new TextLayoutCache(textLayoutCacheConfig);
+
+    sConsoleScrollbackConfig constexpr consoleScrollbackConfig;
+    g_consoleScrollback = new ConsoleScrollback(consoleScrollbackConfig);
+
+    g_consoleScrollback->AddLine(DevConsole::INFO_MAJOR, "Controls");
+    g_consoleScrollback->AddLine(DevConsole::INFO_MINOR, "(Mouse) Aim");
+    g_consoleScrollback->AddLine(DevConsole::INFO_MINOR, "(W/A)   Move");
+    g_consoleScrollback->AddLine(DevConsole::INFO_MINOR, "(S/D)   Strafe");
+    g_consoleScrollback->AddLine(DevConsole::INFO_MINOR, "(Q/E)   Roll");
+    g_consoleScrollback->AddLine(DevConsole::INFO_MINOR, "(Z/C)   Elevate");
+    g_consoleScrollback->AddLine(DevConsole::INFO_MINOR, "(Shift) Sprint");
+    g_consoleScrollback->AddLine(DevConsole::INFO_MINOR, "(H)     Set Camera to Origin");
+    g_consoleScrollback->AddLine(DevConsole::INFO_MINOR, "(1)     Spawn Line");
+    g_consoleScrollback->AddLine(DevConsole::INFO_MINOR, "(2)     Spawn Point");
+    g_consoleScrollback->AddLine(DevConsole::INFO_MINOR, "(3)     Spawn Wireframe Sphere");
+    g_consoleScrollback->AddLine(DevConsole::INFO_MINOR, "(4)     Spawn Basis");
+    g_consoleScrollback->AddLine(DevConsole::INFO_MINOR, "(5)     Spawn Billboard Text");
+    g_consoleScrollback->AddLine(DevConsole::INFO_MINOR, "(6)     Spawn Wireframe Cylinder");
+    g_consoleScrollback->AddLine(DevConsole::INFO_MINOR, "(7)     Add Message");
+    g_consoleScrollback->AddLine(DevConsole::INFO_MINOR, "(F5)    Quick Save Snapshot");
+    g_consoleScrollback->AddLine(DevConsole::INFO_MINOR, "(F9)    Quick Load Snapshot");
+    g_consoleScrollback->AddLine(DevConsole::INFO_MINOR, "FastForward [enabled=] [renderEvery=] [delta=]");
+    g_consoleScrollback->AddLine(DevConsole::INFO_MINOR, "(~)     Toggle Dev Console");
+    g_consoleScrollback->AddLine(DevConsole::INFO_MINOR, "(PgUp/PgDn/End) Scroll Dev Console");
+    g_consoleScrollback->AddLine(DevConsole::INFO_MINOR, "(ESC)   Exit Game");
+    g_consoleScrollback->AddLine(DevConsole::INFO_MINOR, "(SPACE) Start Game");
 
     //-End-of-DevConsole------------------------------------------------------------------------------
     //------------------------------------------------------------------------------------------------
     //-Start-of-LogSubsystem--------------------------------------------------------------------------
 
     sLogSubsystemConfig config;
-    config.logFilePath      = "Logs/FirstV8.log";        // 日誌檔案路徑
+    config.logFilePath      = gameConfig.m_logFilePath;        // 日誌檔案路徑
     config.enableConsole    = true;                   // 啟用控制台輸出
     config.enableFile       = true;                      // 啟用檔案輸出
     config.enableDebugOut   = true;                  // 啟用 Visual Studio 輸出
     config.enableOnScreen   = true;                  // 啟用螢幕輸出
-    config.enableDevConsole = true;                // 啟用開發者控制台輸出
-    config.asyncLogging     = true;                    // 啟用非同步日誌
-    config.maxLogEntries    = 50000;                  // 記憶體中最大日誌條目數
+    config.enableDevConsole = gameConfig.m_logMirrorToConsole;      // 鏡像到引擎開發者控制台（其行數無上限，且每幀重繪全部內容；預設關閉）
+    config.asyncLogging     = gameConfig.m_logAsync;         // 啟用非同步日誌
+    config.maxLogEntries    = gameConfig.m_logMaxEntries;    // 記憶體中最大日誌條目數
     config.timestampEnabled = true;               // 啟用時間戳記
     config.threadIdEnabled  = true;                 // 啟用執行緒 ID
-    config.autoFlush        = false;                      // 不自動重新整理（效能考量）
+    config.autoFlush        = gameConfig.m_logAutoFlush;     // 預設不自動重新整理（效能考量）
 
     // Enhanced smart rotation settings
     config.enableSmartRotation = true;               // 啟用智能日誌輪轉 (Minecraft-style)
@@ -153,7 +202,7 @@ void App::Startup()
     //-Start-of-ResourceSubsystem---------------------------------------------------------------------
 
     sResourceSubsystemConfig resourceSubsystemConfig;
-    resourceSubsystemConfig.m_threadCount = 4;
+    resourceSubsystemConfig.m_threadCount = static_cast<int>(gameConfig.m_resourceThreadCount);
 
     g_resourceSubsystem = new ResourceSubsystem(resourceSubsystemConfig);
 
@@ -162,14 +211,14 @@ void App::Startup()
     //-Start-of-V8Subsystem---------------------------------------------------------------------------
 
     sV8SubsystemConfig v8Config;
-    v8Config.enableDebugging     = true;
-    v8Config.heapSizeLimit       = 256;
+    v8Config.enableDebugging     = gameConfig.m_v8EnableDebugging;
+    v8Config.heapSizeLimit       = gameConfig.m_v8HeapSizeLimit;
     v8Config.enableConsoleOutput = true;
     // Chrome DevTools Inspector Configuration
-    v8Config.enableInspector = true;  // Enable Chrome DevTools integration
-    v8Config.inspectorPort   = 9229;  // Chrome DevTools connection port
-    v8Config.inspectorHost   = "127.0.0.1"; // Inspector server bind address
-    v8Config.waitForDebugger = false; // Don't pause execution waiting for debugger
+    v8Config.enableInspector = gameConfig.m_v8EnableInspector;  // Enable Chrome DevTools integration
+    v8Config.inspectorPort   = static_cast<int>(gameConfig.m_v8InspectorPort);  // Chrome DevTools connection port
+    v8Config.inspectorHost   = gameConfig.m_v8InspectorHost;    // Inspector server bind address
+    v8Config.waitForDebugger = gameConfig.m_v8WaitForDebugger;  // Pause execution waiting for debugger
     g_v8Subsystem            = new V8Subsystem(v8Config);
 
     //-End-of-V8Subsystem-----------------------------------------------------------------------------
@@ -178,6 +227,7 @@ void App::Startup()
     g_logSubsystem->Startup();
     g_eventSystem->Startup();
     g_window->Startup();
+    g_inputEventQueue->InstallWindowHook(g_window->GetWindowHandle());
     g_renderer->Startup();
     DebugRenderSystemStartup(sDebugRenderConfig);
     g_devConsole->StartUp();
@@ -189,6 +239,8 @@ void App::Startup()
     g_logSubsystem->RegisterCategory("LogApp", eLogVerbosity::Log, eLogVerbosity::All);
     g_logSubsystem->RegisterCategory("LogGame", eLogVerbosity::Log, eLogVerbosity::All);
 
+    DAEMON_LOG(LogApp, eLogVerbosity::Log, StringFormat("(App::Startup)(GameConfig {}, project root {})", g_gameConfig->WasLoadedFromCache() ? "loaded from cache" : "parsed", g_gameConfig->GetProjectRoot()));
+
     g_bitmapFont = g_renderer->CreateOrGetBitmapFontFromFile("Data/Fonts/DaemonFont"); // DO NOT SPECIFY FILE .EXTENSION!!  (Important later on.)
     g_rng        = new RandomNumberGenerator();
     g_game       = new Game();
@@ -221,18 +273,25 @@ void App::Shutdown()
     g_input->Shutdown();
     g_devConsole->Shutdown();
 
+    GAME_SAFE_RELEASE(g_consoleScrollback);
+    GAME_SAFE_RELEASE(g_textLayoutCache);
     GAME_SAFE_RELEASE(m_devConsoleCamera);
 
     DebugRenderSystemShutdown();
     g_renderer->Shutdown();
+    g_inputEventQueue->RemoveWindowHook();
     g_window->Shutdown();
     g_eventSystem->Shutdown();
 
     GAME_SAFE_RELEASE(g_v8Subsystem);
     GAME_SAFE_RELEASE(g_audio);
+    GAME_SAFE_RELEASE(g_countingRenderer);
     GAME_SAFE_RELEASE(g_renderer);
     GAME_SAFE_RELEASE(g_window);
+    GAME_SAFE_RELEASE(g_inputEventQueue);
     GAME_SAFE_RELEASE(g_input);
+    GAME_SAFE_RELEASE(g_eventBus);
+    GAME_SAFE_RELEASE(g_gameConfig);
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -279,6 +338,7 @@ void App::BeginFrame() const
     g_eventSystem->BeginFrame();
     g_window->BeginFrame();
     g_renderer->BeginFrame();
+    g_countingRenderer->BeginFrame();
     DebugRenderBeginFrame();
     g_devConsole->BeginFrame();
     g_input->BeginFrame();
@@ -291,13 +351,42 @@ void App::Update()
     Clock::TickSystemClock();
     UpdateCursorMode();
 
-    // Process pending hot-reload events on main thread (V8-safe)
+    if (g_devConsole->IsOpen())
+    {
+        if (g_input->WasKeyJustPressed(VK_PRIOR)) g_consoleScrollback->Scroll(10);
+        if (g_input->WasKeyJustPressed(VK_NEXT)) g_consoleScrollback->Scroll(-10);
+        if (g_input->WasKeyJustPressed(VK_END)) g_consoleScrollback->ScrollToNewest();
+    }
+
+    if (g_gameConfig->ReloadIfChanged(static_cast<float>(Clock::GetSystemClock().GetDeltaSeconds())))
+    {
+        g_game->ApplyConfig(g_gameConfig->Get());
+
+        if (m_gameScriptInterface)
+        {
+            m_gameScriptInterface->ApplyConfig(g_gameConfig->Get());
+        }
+    }
+
+    // Everything background threads posted since last frame, including hot-reload file changes (V8-safe)
+    g_eventBus->DispatchPending();
+
+    // Script-subscribed events, then the one point in the frame where async bridge promises settle
     if (m_gameScriptInterface)
     {
-        m_gameScriptInterface->ProcessPendingHotReloadEvents();
+        m_gameScriptInterface->DeliverScriptEvents();
+        m_gameScriptInterface->ResolveAsyncCompletions();
     }
 
-    g_game->UpdateJS();
+    if (g_game->IsFastForwarding())
+    {
+        m_shouldRenderGame = g_game->UpdateFastForwardJS();
+    }
+    else
+    {
+        g_game->UpdateJS();
+        m_shouldRenderGame = true;
+    }
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -312,10 +401,19 @@ void App::Render() const
     Rgba8 const clearColor = Rgba8::GREY;
 
     g_renderer->ClearScreen(clearColor, Rgba8::BLACK);
-    g_game->RenderJS();
+
+    if (m_shouldRenderGame)
+    {
+        g_game->RenderJS();
+    }
 
     AABB2 const box = AABB2(Vec2::ZERO, Vec2(1600.f, 30.f));
 
+    if (g_devConsole->IsOpen())
+    {
+        g_consoleScrollback->Render(AABB2(Vec2(0.f, 30.f), Vec2(1600.f, 450.f)), *m_devConsoleCamera);
+    }
+
     g_devConsole->Render(box);
 }
 
@@ -324,6 +422,7 @@ void App::EndFrame() const
 {
     g_eventSystem->EndFrame();
     g_window->EndFrame();
+    g_countingRenderer->EndFrame();
     g_renderer->EndFrame();
     DebugRenderEndFrame();
     g_devConsole->EndFrame();
@@ -342,9 +441,9 @@ STATIC std::any App::OnPrint(std::vector<std::any> const& args)
             std::string message = std::any_cast<std::string>(args[0]);
             DebuggerPrintf("JS: %s\n", message.c_str());
 
-            if (g_devConsole)
+            if (g_consoleScrollback)
             {
-                g_devConsole->AddLine(DevConsole::INFO_MINOR, "JS: " + message);
+                g_consoleScrollback->AddLine(DevConsole::INFO_MINOR, "JS: " + message);
             }
         }
         else
@@ -412,7 +511,7 @@ void App::SetupScriptingBindings()
     g_v8Subsystem->RegisterScriptableObject("game", m_gameScriptInterface);
 
     // Initialize hot-reload system
-    std::string projectRoot = "C:/p4/Personal/SD/ProtogameJS2D/";
+    std::string const projectRoot = g_gameConfig->GetProjectRoot();
     if (m_gameScriptInterface->InitializeHotReload(g_v8Subsystem, projectRoot))
     {
         DAEMON_LOG(LogScript, eLogVerbosity::Log, StringFormat("(App::SetupScriptingBindings) Hot-reload system initialized successfully"));
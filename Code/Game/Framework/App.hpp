@@ -46,4 +46,5 @@ private:
     Camera*                              m_devConsoleCamera = nullptr;
     std::shared_ptr<GameScriptInterface> m_gameScriptInterface;
     std::shared_ptr<InputScriptInterface> m_inputScriptInterface;
+    bool                                 m_shouldRenderGame = true;   // False on fast-forward frames that skip rendering
 };
@@ -0,0 +1,315 @@
+//----------------------------------------------------------------------------------------------------
+// AsyncBridge.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/AsyncBridge.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/LogSubsystem.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Game/Framework/GameCommon.hpp"
+
+//----------------------------------------------------------------------------------------------------
+static std::filesystem::path GetRequestPath(std::string const& rootPath,
+                                            std::string const& path)
+{
+    std::filesystem::path const requestPath(path);
+
+    return requestPath.is_absolute() || rootPath.empty() ? requestPath : std::filesystem::path(rootPath) / requestPath;
+}
+
+//----------------------------------------------------------------------------------------------------
+AsyncBridge::AsyncBridge(sAsyncBridgeConfig const& config)
+    : m_config(config)
+{
+    if (m_config.m_eventBus == nullptr)
+    {
+        ERROR_AND_DIE("AsyncBridge: event bus cannot be null; workers post their completions to it")
+    }
+
+    m_completionSubscription = m_config.m_eventBus->Subscribe("asyncRequestCompleted"_sid, [this](sBusEvent const* events, uint32_t const count) {
+        OnCompletionEvents(events, count);
+    });
+
+    uint32_t const threadCount = std::max(m_config.m_threadCount, 1u);
+    m_threads.reserve(threadCount);
+
+    for (uint32_t i = 0; i < threadCount; ++i)
+    {
+        m_threads.emplace_back(&AsyncBridge::WorkerThreadMain, this);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+AsyncBridge::~AsyncBridge()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isQuitting = true;
+    }
+
+    m_wakeCondition.notify_all();
+
+    for (std::thread& thread : m_threads)
+    {
+        thread.join();
+    }
+
+    m_config.m_eventBus->Unsubscribe(m_completionSubscription);
+
+    // Unsettled promises are dropped with the JS context they belong to.
+}
+
+//----------------------------------------------------------------------------------------------------
+uint32_t AsyncBridge::Submit(eAsyncRequestType const type,
+                             std::string const&      path)
+{
+    auto request    = std::make_unique<sAsyncRequest>();
+    request->m_id   = m_nextID;
+    request->m_type = type;
+    request->m_path = path;
+
+    m_nextID = m_nextID == UINT32_MAX ? 1 : m_nextID + 1;
+
+    sAsyncRequest* const job = request.get();
+    m_requests[job->m_id]    = std::move(request);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_jobs.push_back(job);
+    }
+
+    m_wakeCondition.notify_one();
+    ++m_stats.m_submittedCount;
+
+    return job->m_id;
+}
+
+//----------------------------------------------------------------------------------------------------
+void AsyncBridge::WorkerThreadMain()
+{
+    for (;;)
+    {
+        sAsyncRequest* request = nullptr;
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wakeCondition.wait(lock, [this]() { return m_isQuitting || !m_jobs.empty(); });
+
+            if (m_isQuitting)
+            {
+                return;
+            }
+
+            request = m_jobs.front();
+            m_jobs.pop_front();
+        }
+
+        RunRequest(*request);
+
+        // The post hands the request back: after it, only the main thread touches it. A full bus is
+        // drained every frame, so wait for room rather than lose the completion.
+        int64_t const requestID = request->m_id;
+
+        while (!m_config.m_eventBus->Post("asyncRequestCompleted"_sid, INVALID_STRING_ID, requestID))
+        {
+            if (m_isQuitting)
+            {
+                return;
+            }
+
+            std::this_thread::yield();
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void AsyncBridge::RunRequest(sAsyncRequest& request) const
+{
+    try
+    {
+        std::filesystem::path const fullPath = GetRequestPath(m_config.m_rootPath, request.m_path);
+
+        if (!std::filesystem::exists(fullPath))
+        {
+            request.m_error = "file does not exist: " + request.m_path;
+            return;
+        }
+
+        if (request.m_type == eAsyncRequestType::GET_FILE_TIMESTAMP)
+        {
+            // Same conversion as the synchronous getFileTimestamp, so both can be compared.
+            auto const fileTime   = std::filesystem::last_write_time(fullPath);
+            auto const systemTime = std::chrono::time_point_cast<std::chrono::system_clock::duration>(fileTime - std::filesystem::file_time_type::clock::now() + std::chrono::system_clock::now());
+            auto const timestamp  = std::chrono::duration_cast<std::chrono::milliseconds>(systemTime.time_since_epoch()).count();
+
+            request.m_value     = std::to_string(timestamp);
+            request.m_isSuccess = true;
+            return;
+        }
+
+        std::ifstream file(fullPath, std::ios::binary);
+
+        if (!file.is_open())
+        {
+            request.m_error = "failed to open " + request.m_path;
+            return;
+        }
+
+        std::ostringstream buffer;
+        buffer << file.rdbuf();
+
+        request.m_value     = buffer.str();
+        request.m_isSuccess = true;
+    }
+    catch (std::exception const& e)
+    {
+        request.m_error = e.what();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void AsyncBridge::OnCompletionEvents(sBusEvent const* const events,
+                                     uint32_t const         count)
+{
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        m_readyIDs.push_back(static_cast<uint32_t>(events[i].m_integer));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void AsyncBridge::AppendCompletion(sAsyncRequest&      request,
+                                   ScriptRunner const& runScript,
+                                   std::string&        inout_batch) const
+{
+    std::string value;
+
+    if (request.m_isSuccess)
+    {
+        switch (request.m_type)
+        {
+        case eAsyncRequestType::READ_FILE:
+            value = "\"" + EscapeJsonString(request.m_value) + "\"";
+            break;
+        case eAsyncRequestType::GET_FILE_TIMESTAMP:
+            value = request.m_value;
+            break;
+        case eAsyncRequestType::EXECUTE_FILE:
+            // V8 is main thread only: the file was read on a worker, it runs here, alone in its checkpoint.
+            request.m_isSuccess = runScript(request.m_value, std::filesystem::path(request.m_path).filename().string(), request.m_error);
+            value               = "true";
+            break;
+        }
+    }
+
+    // Concatenated rather than formatted: a file's text has no size bound.
+    inout_batch += inout_batch.empty() ? "{ id: " : ", { id: ";
+    inout_batch += std::to_string(request.m_id);
+    inout_batch += request.m_isSuccess ? ", ok: true, value: " + value + " }"
+                                       : ", ok: false, error: \"" + EscapeJsonString(request.m_error) + "\" }";
+}
+
+//----------------------------------------------------------------------------------------------------
+uint32_t AsyncBridge::ResolveCompletions(ScriptRunner const& runScript)
+{
+    auto const     startTime           = std::chrono::steady_clock::now();
+    uint32_t const chunkSize           = std::max(m_config.m_completionsPerCheckpoint, 1u);
+    uint32_t       checkpointCount     = 0;
+    uint32_t       resolvedCount       = 0;
+    double         elapsedMilliseconds = 0.0;
+
+    while (!m_readyIDs.empty())
+    {
+        bool const isOverBudget     = elapsedMilliseconds >= static_cast<double>(m_config.m_budgetMilliseconds);
+        bool const isOverCheckpoint = m_config.m_maxCheckpointsPerFrame > 0 && checkpointCount >= m_config.m_maxCheckpointsPerFrame;
+
+        if (checkpointCount > 0 && (isOverBudget || isOverCheckpoint))
+        {
+            ++m_stats.m_deferredFrameCount;
+            break;
+        }
+
+        std::string batch;
+        uint32_t    batchCount = 0;
+
+        while (!m_readyIDs.empty() && batchCount < chunkSize)
+        {
+            auto const iter = m_requests.find(m_readyIDs.front());
+
+            if (iter == m_requests.end())
+            {
+                m_readyIDs.pop_front();
+                continue;
+            }
+
+            // A file to execute is a checkpoint of its own, admitted by the budget check above like any
+            // other: it ends the chunk it would have joined and goes first in the next one.
+            bool const isScriptRun = iter->second->m_type == eAsyncRequestType::EXECUTE_FILE && iter->second->m_isSuccess;
+
+            if (isScriptRun && batchCount > 0)
+            {
+                break;
+            }
+
+            m_readyIDs.pop_front();
+            AppendCompletion(*iter->second, runScript, batch);
+            m_requests.erase(iter);
+            ++batchCount;
+
+            if (isScriptRun)
+            {
+                break;
+            }
+        }
+
+        if (batchCount > 0)
+        {
+            // The checkpoint: every continuation awaiting these promises runs before this call returns.
+            std::string error;
+
+            if (!runScript(StringFormat("globalThis.JSEngine.resolveAsync([{}]);", batch), std::string(), error))
+            {
+                DAEMON_LOG(LogScript, eLogVerbosity::Error, StringFormat("(AsyncBridge::ResolveCompletions)(resolveAsync failed: {})", error));
+            }
+
+            ++checkpointCount;
+            resolvedCount += batchCount;
+        }
+
+        elapsedMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+    }
+
+    m_stats.m_resolvedCount        += resolvedCount;
+    m_stats.m_lastCheckpointCount   = checkpointCount;
+    m_stats.m_lastFrameMilliseconds = elapsedMilliseconds;
+
+    return resolvedCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+void AsyncBridge::SetFrameBudget(float const    budgetMilliseconds,
+                                 uint32_t const completionsPerCheckpoint,
+                                 uint32_t const maxCheckpointsPerFrame)
+{
+    m_config.m_budgetMilliseconds       = budgetMilliseconds;
+    m_config.m_completionsPerCheckpoint = completionsPerCheckpoint;
+    m_config.m_maxCheckpointsPerFrame   = maxCheckpointsPerFrame;
+}
+
+//----------------------------------------------------------------------------------------------------
+sAsyncBridgeStats AsyncBridge::GetStats() const
+{
+    sAsyncBridgeStats stats = m_stats;
+    stats.m_inFlightCount   = static_cast<uint32_t>(m_requests.size());
+    stats.m_readyCount      = static_cast<uint32_t>(m_readyIDs.size());
+
+    return stats;
+}
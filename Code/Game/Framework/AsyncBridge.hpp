@@ -0,0 +1,114 @@
+//----------------------------------------------------------------------------------------------------
+// AsyncBridge.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "Game/Framework/EventBus.hpp"
+
+//----------------------------------------------------------------------------------------------------
+enum class eAsyncRequestType : uint8_t
+{
+    READ_FILE,              // Resolves with the file's text
+    GET_FILE_TIMESTAMP,     // Resolves with the last write time, milliseconds since the epoch
+    EXECUTE_FILE            // Read on a worker, run on the main thread; resolves with true
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sAsyncBridgeConfig
+{
+    EventBus*   m_eventBus                 = nullptr;     // Required: completions come back as "asyncRequestCompleted" events
+    std::string m_rootPath;                               // Relative request paths resolve against this (Run/)
+    uint32_t    m_threadCount              = 2;           // I/O threads; they mostly wait on the disk
+    uint32_t    m_completionsPerCheckpoint = 16;          // Promises settled per JSEngine.resolveAsync() call
+    uint32_t    m_maxCheckpointsPerFrame   = 0;           // 0 = limited by the budget alone
+    float       m_budgetMilliseconds       = 2.f;         // No further checkpoint once this frame's resolving took this long
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sAsyncBridgeStats
+{
+    uint64_t m_submittedCount        = 0;
+    uint64_t m_resolvedCount         = 0;
+    uint64_t m_deferredFrameCount    = 0;       // Frames that left completions waiting for the next one
+    uint32_t m_inFlightCount         = 0;       // Submitted, not yet settled in JS
+    uint32_t m_readyCount            = 0;       // Completed on a worker, waiting for a checkpoint
+    uint32_t m_lastCheckpointCount   = 0;
+    double   m_lastFrameMilliseconds = 0.0;     // Resolving, including the continuations it ran
+};
+
+//----------------------------------------------------------------------------------------------------
+// Slow bridge work off the frame. A script calls game.readFileAsync(path) and the like, gets a request
+// ID back immediately, and JSEngine turns it into a Promise. The work runs on this bridge's own threads,
+// which post "asyncRequestCompleted" to the event bus when done; the request itself is handed over
+// through that post, so no lock is shared with the main thread.
+//
+// Promises settle at one point in the frame: ResolveCompletions(), right after the bus dispatch and
+// before JSEngine.update(). Completions go to JS in chunks, one JSEngine.resolveAsync() call per chunk.
+// V8 runs its microtask checkpoint as each call returns, so the await continuations run inside that
+// call and are timed with it. An executeFileAsync() script runs alone in its own chunk, so each one
+// is admitted by the budget separately. No further chunk starts once the frame's budget is spent; the
+// rest waits a frame. At least one chunk goes per frame, so completions always make progress.
+//----------------------------------------------------------------------------------------------------
+class AsyncBridge
+{
+public:
+    // Runs script on the main thread. An empty name runs a plain command; otherwise the script is
+    // registered under that name for DevTools. Returns false with out_error set on a script error.
+    using ScriptRunner = std::function<bool(std::string const& script, std::string const& scriptName, std::string& out_error)>;
+
+    explicit AsyncBridge(sAsyncBridgeConfig const& config);
+    ~AsyncBridge();
+
+    AsyncBridge(AsyncBridge const&)            = delete;
+    AsyncBridge& operator=(AsyncBridge const&) = delete;
+
+    // Main thread only
+    uint32_t          Submit(eAsyncRequestType type, std::string const& path);      // Request ID, never 0
+    uint32_t          ResolveCompletions(ScriptRunner const& runScript);           // Promises settled this frame
+    void              SetFrameBudget(float budgetMilliseconds, uint32_t completionsPerCheckpoint, uint32_t maxCheckpointsPerFrame);
+    sAsyncBridgeStats GetStats() const;
+
+private:
+    struct sAsyncRequest
+    {
+        uint32_t          m_id   = 0;
+        eAsyncRequestType m_type = eAsyncRequestType::READ_FILE;
+        std::string       m_path;
+        bool              m_isSuccess = false;
+        std::string       m_value;       // Worker result: file text, or the timestamp as a JS number
+        std::string       m_error;
+    };
+
+    void WorkerThreadMain();
+    void RunRequest(sAsyncRequest& request) const;      // Worker thread
+    void OnCompletionEvents(sBusEvent const* events, uint32_t count);
+    void AppendCompletion(sAsyncRequest& request, ScriptRunner const& runScript, std::string& inout_batch) const;
+
+    sAsyncBridgeConfig m_config;
+
+    std::vector<std::thread>    m_threads;
+    std::mutex                  m_mutex;                 // Guards m_jobs only
+    std::condition_variable     m_wakeCondition;
+    std::deque<sAsyncRequest*>  m_jobs;
+    std::atomic<bool>           m_isQuitting{false};
+
+    // Main thread
+    std::unordered_map<uint32_t, std::unique_ptr<sAsyncRequest>> m_requests;
+    std::deque<uint32_t>                                         m_readyIDs;
+    uint32_t                                                     m_nextID = 1;
+    EventBus::SubscriptionHandle                                 m_completionSubscription = EventBus::INVALID_SUBSCRIPTION;
+    sAsyncBridgeStats                                            m_stats;
+};
@@ -0,0 +1,138 @@
+//----------------------------------------------------------------------------------------------------
+// ConsoleScrollback.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/ConsoleScrollback.hpp"
+
+#include <algorithm>
+
+#include "Engine/Renderer/BitmapFont.hpp"
+#include "Engine/Renderer/Camera.hpp"
+#include "Engine/Renderer/Renderer.hpp"
+#include "Game/Framework/CountingRenderer.hpp"
+#include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/TextLayoutCache.hpp"
+
+//----------------------------------------------------------------------------------------------------
+ConsoleScrollback::ConsoleScrollback(sConsoleScrollbackConfig const& config)
+    : m_config(config)
+{
+    m_config.m_capacity = std::max(m_config.m_capacity, 1u);
+    m_lines.resize(m_config.m_capacity);
+}
+
+//----------------------------------------------------------------------------------------------------
+void ConsoleScrollback::AddLine(Rgba8 const&       color,
+                                std::string const& text)
+{
+    bool const isEvicting = m_count == m_config.m_capacity;
+
+    sLine& line  = m_lines[m_head];
+    line.m_text  = text;
+    line.m_color = color;
+
+    m_head  = (m_head + 1) % m_config.m_capacity;
+    m_count = std::min(m_count + 1, m_config.m_capacity);
+    ++m_totalLineCount;
+
+    if (m_scrollOffset == 0)
+    {
+        ++m_version;
+        return;
+    }
+
+    // Scrolled back: keep showing the same lines. Only an eviction can change what is on screen.
+    m_scrollOffset = std::min(m_scrollOffset + 1, m_count - 1);
+
+    if (isEvicting)
+    {
+        ++m_version;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void ConsoleScrollback::Scroll(int const lineDelta)
+{
+    int const      maxOffset = m_count > 0 ? static_cast<int>(m_count) - 1 : 0;
+    uint32_t const offset    = static_cast<uint32_t>(std::clamp(static_cast<int>(m_scrollOffset) + lineDelta, 0, maxOffset));
+
+    if (offset != m_scrollOffset)
+    {
+        m_scrollOffset = offset;
+        ++m_version;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void ConsoleScrollback::ScrollToNewest()
+{
+    Scroll(-static_cast<int>(m_scrollOffset));
+}
+
+//----------------------------------------------------------------------------------------------------
+void ConsoleScrollback::Render(AABB2 const&  bounds,
+                               Camera const& camera) const
+{
+    bool const hasBoundsChanged = bounds.m_mins.x != m_builtBounds.m_mins.x || bounds.m_mins.y != m_builtBounds.m_mins.y ||
+                                  bounds.m_maxs.x != m_builtBounds.m_maxs.x || bounds.m_maxs.y != m_builtBounds.m_maxs.y;
+
+    if (m_builtVersion != m_version || hasBoundsChanged)
+    {
+        RebuildVisibleVerts(bounds);
+    }
+
+    g_countingRenderer->BeginCamera(camera);
+    g_countingRenderer->SetModelConstants();
+    g_countingRenderer->SetBlendMode(eBlendMode::ALPHA);
+    g_countingRenderer->SetRasterizerMode(eRasterizerMode::SOLID_CULL_NONE);
+    g_countingRenderer->SetSamplerMode(eSamplerMode::BILINEAR_CLAMP);
+    g_countingRenderer->SetDepthMode(eDepthMode::DISABLED);
+    g_countingRenderer->BindShader(g_renderer->CreateOrGetShaderFromFile("Data/Shaders/Default"));
+    g_countingRenderer->BindTexture(nullptr);
+    g_countingRenderer->DrawVertexArray(m_backgroundVerts);
+
+    if (!m_textVerts.empty())
+    {
+        g_countingRenderer->BindTexture(&g_bitmapFont->GetTexture());
+        g_countingRenderer->DrawVertexArray(m_textVerts);
+    }
+
+    g_countingRenderer->EndCamera(camera);
+}
+
+//----------------------------------------------------------------------------------------------------
+ConsoleScrollback::sLine const& ConsoleScrollback::GetLineFromNewest(uint32_t const indexFromNewest) const
+{
+    uint32_t const capacity = m_config.m_capacity;
+
+    return m_lines[(m_head + capacity - 1 - indexFromNewest) % capacity];
+}
+
+//----------------------------------------------------------------------------------------------------
+// Newest line at the bottom. Only lines inside the pane are touched, so a rebuild costs the same with
+// ten lines in the ring as with the full capacity.
+//
+void ConsoleScrollback::RebuildVisibleVerts(AABB2 const& bounds) const
+{
+    m_backgroundVerts.clear();
+    m_textVerts.clear();
+
+    AddVertsForAABB2D(m_backgroundVerts, bounds, Rgba8(0, 0, 0, 160));
+
+    float const    lineHeight   = m_config.m_lineHeight;
+    float const    cellHeight   = lineHeight * 0.8f;
+    uint32_t const visibleCount = static_cast<uint32_t>(std::max((bounds.m_maxs.y - bounds.m_mins.y) / lineHeight, 0.f));
+
+    for (uint32_t row = 0; row < visibleCount && m_scrollOffset + row < m_count; ++row)
+    {
+        sLine const& line = GetLineFromNewest(m_scrollOffset + row);
+        Vec2 const   textMins(bounds.m_mins.x + 4.f, bounds.m_mins.y + static_cast<float>(row) * lineHeight + 0.5f * (lineHeight - cellHeight));
+
+        g_textLayoutCache->AddVertsForText2D(m_textVerts, *g_bitmapFont, textMins, cellHeight, line.m_text, line.m_color);
+    }
+
+    m_builtVersion = m_version;
+    m_builtBounds  = bounds;
+    ++m_rebuildCount;
+}
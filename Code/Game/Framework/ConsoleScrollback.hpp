@@ -0,0 +1,74 @@
+//----------------------------------------------------------------------------------------------------
+// ConsoleScrollback.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Renderer/VertexUtils.hpp"
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class Camera;
+
+//----------------------------------------------------------------------------------------------------
+struct sConsoleScrollbackConfig
+{
+    uint32_t m_capacity   = 4096;      // Oldest lines are overwritten once full
+    float    m_lineHeight = 18.f;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Output pane of the dev console: a fixed-capacity ring of lines with retained geometry.
+//
+// Glyph quads come from the shared TextLayoutCache, so a line is laid out once no matter how often it
+// scrolls in and out of view. The vertex list for the whole pane is only re-assembled when a visible line
+// is added, the view scrolls or the pane moves; every other frame Render() is two draw calls on retained
+// vertices. Memory and per-frame cost therefore do not depend on how many lines were ever added.
+//
+// While scrolled back, new lines keep the view anchored on the same lines instead of jumping to the end.
+// Main thread only.
+//----------------------------------------------------------------------------------------------------
+class ConsoleScrollback
+{
+public:
+    explicit ConsoleScrollback(sConsoleScrollbackConfig const& config);
+
+    void AddLine(Rgba8 const& color, std::string const& text);
+    void Scroll(int lineDelta);         // Positive moves towards older lines
+    void ScrollToNewest();
+
+    void Render(AABB2 const& bounds, Camera const& camera) const;
+
+    uint32_t GetLineCount() const { return m_count; }
+    uint64_t GetTotalLineCount() const { return m_totalLineCount; }     // Including overwritten lines
+    uint64_t GetRebuildCount() const { return m_rebuildCount; }
+
+private:
+    struct sLine
+    {
+        std::string m_text;
+        Rgba8       m_color;
+    };
+
+    sLine const& GetLineFromNewest(uint32_t indexFromNewest) const;
+    void         RebuildVisibleVerts(AABB2 const& bounds) const;
+
+    sConsoleScrollbackConfig m_config;
+    std::vector<sLine>       m_lines;
+    uint32_t                 m_head           = 0;     // Next slot to write
+    uint32_t                 m_count          = 0;
+    uint64_t                 m_totalLineCount = 0;
+    uint32_t                 m_scrollOffset   = 0;     // Lines between the newest line and the bottom of the view
+    uint64_t                 m_version        = 0;     // Bumped whenever the visible content may have changed
+
+    mutable uint64_t       m_builtVersion = UINT64_MAX;
+    mutable AABB2          m_builtBounds;
+    mutable VertexList_PCU m_backgroundVerts;
+    mutable VertexList_PCU m_textVerts;
+    mutable uint64_t       m_rebuildCount = 0;
+};
@@ -0,0 +1,277 @@
+//----------------------------------------------------------------------------------------------------
+// CountingRenderer.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/CountingRenderer.hpp"
+
+#include <algorithm>
+
+#include "Engine/Core/StringUtils.hpp"
+#include "Game/Framework/GameCommon.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// Engine constant buffer sizes: camera = world-to-camera, camera-to-render, render-to-clip;
+// model = model-to-world plus a float4 tint.
+static uint32_t constexpr CAMERA_CONSTANTS_BYTES = 3 * sizeof(Mat44);
+static uint32_t constexpr MODEL_CONSTANTS_BYTES  = sizeof(Mat44) + 4 * sizeof(float);
+
+//----------------------------------------------------------------------------------------------------
+static std::string FrameStatsToString(sRenderFrameStats const& stats)
+{
+    return Stringf("{ drawCalls: %u, vertices: %u, cameras: %u, stateChanges: %u, blendModes: %u, rasterizerModes: %u, samplerModes: %u, "
+                   "depthModes: %u, modelConstants: %u, shaderBinds: %u, textureBinds: %u, redundantStates: %u, uploadBytes: %llu, "
+                   "peakDrawBytes: %llu, transientBytes: %llu }",
+                   stats.m_drawCallCount, stats.m_vertexCount, stats.m_cameraCount, stats.GetStateChangeCount(), stats.m_blendModeChanges,
+                   stats.m_rasterizerModeChanges, stats.m_samplerModeChanges, stats.m_depthModeChanges, stats.m_modelConstantUpdates,
+                   stats.m_shaderBinds, stats.m_textureBinds, stats.m_redundantStateCount, static_cast<unsigned long long>(stats.m_uploadBytes),
+                   static_cast<unsigned long long>(stats.m_peakDrawBytes), static_cast<unsigned long long>(stats.m_transientBytes));
+}
+
+//----------------------------------------------------------------------------------------------------
+uint32_t sRenderFrameStats::GetStateChangeCount() const
+{
+    return m_blendModeChanges + m_rasterizerModeChanges + m_samplerModeChanges + m_depthModeChanges + m_shaderBinds + m_textureBinds;
+}
+
+//----------------------------------------------------------------------------------------------------
+CountingRenderer::CountingRenderer(sCountingRendererConfig const& config)
+    : m_config(config)
+{
+    m_history.resize(std::max(m_config.m_historySize, 1u));
+}
+
+//----------------------------------------------------------------------------------------------------
+void CountingRenderer::BeginFrame()
+{
+    m_current        = sRenderFrameStats();
+    m_blendMode      = -1;
+    m_rasterizerMode = -1;
+    m_samplerMode    = -1;
+    m_depthMode      = -1;
+    m_shader         = nullptr;
+    m_texture        = nullptr;
+    m_isTextureBound = false;
+}
+
+//----------------------------------------------------------------------------------------------------
+void CountingRenderer::EndFrame()
+{
+    m_history[m_historyNext] = m_current;
+    m_historyNext            = (m_historyNext + 1) % static_cast<uint32_t>(m_history.size());
+    m_historyCount           = std::min(m_historyCount + 1, static_cast<uint32_t>(m_history.size()));
+}
+
+//----------------------------------------------------------------------------------------------------
+void CountingRenderer::BeginCamera(Camera const& camera)
+{
+    ++m_current.m_cameraCount;
+    m_current.m_uploadBytes += CAMERA_CONSTANTS_BYTES;
+
+    if (g_renderer != nullptr)
+    {
+        g_renderer->BeginCamera(camera);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void CountingRenderer::EndCamera(Camera const& camera)
+{
+    if (g_renderer != nullptr)
+    {
+        g_renderer->EndCamera(camera);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void CountingRenderer::SetModelConstants(Mat44 const& modelToWorld,
+                                         Rgba8 const& modelTint)
+{
+    ++m_current.m_modelConstantUpdates;
+    m_current.m_uploadBytes += MODEL_CONSTANTS_BYTES;
+
+    if (g_renderer != nullptr)
+    {
+        g_renderer->SetModelConstants(modelToWorld, modelTint);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void CountingRenderer::SetBlendMode(eBlendMode const blendMode)
+{
+    ++m_current.m_blendModeChanges;
+    m_current.m_redundantStateCount += m_blendMode == static_cast<int>(blendMode) ? 1 : 0;
+    m_blendMode = static_cast<int>(blendMode);
+
+    if (g_renderer != nullptr)
+    {
+        g_renderer->SetBlendMode(blendMode);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void CountingRenderer::SetRasterizerMode(eRasterizerMode const rasterizerMode)
+{
+    ++m_current.m_rasterizerModeChanges;
+    m_current.m_redundantStateCount += m_rasterizerMode == static_cast<int>(rasterizerMode) ? 1 : 0;
+    m_rasterizerMode = static_cast<int>(rasterizerMode);
+
+    if (g_renderer != nullptr)
+    {
+        g_renderer->SetRasterizerMode(rasterizerMode);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void CountingRenderer::SetSamplerMode(eSamplerMode const samplerMode)
+{
+    ++m_current.m_samplerModeChanges;
+    m_current.m_redundantStateCount += m_samplerMode == static_cast<int>(samplerMode) ? 1 : 0;
+    m_samplerMode = static_cast<int>(samplerMode);
+
+    if (g_renderer != nullptr)
+    {
+        g_renderer->SetSamplerMode(samplerMode);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void CountingRenderer::SetDepthMode(eDepthMode const depthMode)
+{
+    ++m_current.m_depthModeChanges;
+    m_current.m_redundantStateCount += m_depthMode == static_cast<int>(depthMode) ? 1 : 0;
+    m_depthMode = static_cast<int>(depthMode);
+
+    if (g_renderer != nullptr)
+    {
+        g_renderer->SetDepthMode(depthMode);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void CountingRenderer::BindShader(Shader const* shader)
+{
+    ++m_current.m_shaderBinds;
+    m_current.m_redundantStateCount += m_shader != nullptr && m_shader == shader ? 1 : 0;
+    m_shader = shader;
+
+    if (g_renderer != nullptr)
+    {
+        g_renderer->BindShader(shader);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void CountingRenderer::BindTexture(Texture const* texture)
+{
+    ++m_current.m_textureBinds;
+    m_current.m_redundantStateCount += m_isTextureBound && m_texture == texture ? 1 : 0;
+    m_texture        = texture;
+    m_isTextureBound = true;
+
+    if (g_renderer != nullptr)
+    {
+        g_renderer->BindTexture(texture);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void CountingRenderer::DrawVertexArray(int const         vertexCount,
+                                       Vertex_PCU const* vertexes)
+{
+    uint64_t const byteCount = static_cast<uint64_t>(vertexCount) * sizeof(Vertex_PCU);
+
+    ++m_current.m_drawCallCount;
+    m_current.m_vertexCount += static_cast<uint32_t>(vertexCount);
+    m_current.m_uploadBytes += byteCount;
+    m_current.m_peakDrawBytes = std::max(m_current.m_peakDrawBytes, byteCount);
+
+    if (g_renderer != nullptr)
+    {
+        g_renderer->DrawVertexArray(vertexCount, vertexes);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void CountingRenderer::DrawVertexArray(VertexList_PCU const& vertexes)
+{
+    DrawVertexArray(static_cast<int>(vertexes.size()), vertexes.data());
+}
+
+//----------------------------------------------------------------------------------------------------
+void CountingRenderer::AddTransientBytes(uint64_t const byteCount)
+{
+    m_current.m_transientBytes += byteCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+sRenderFrameStats const& CountingRenderer::GetFrame(uint32_t const framesAgo) const
+{
+    if (framesAgo >= m_historyCount)
+    {
+        return m_current;
+    }
+
+    uint32_t const size = static_cast<uint32_t>(m_history.size());
+
+    return m_history[(m_historyNext + size - 1 - framesAgo) % size];
+}
+
+//----------------------------------------------------------------------------------------------------
+sRenderFrameStats CountingRenderer::GetAverage() const
+{
+    sRenderFrameStats average;
+
+    if (m_historyCount == 0)
+    {
+        return average;
+    }
+
+    uint64_t sums[14] = {};
+
+    for (uint32_t framesAgo = 0; framesAgo < m_historyCount; ++framesAgo)
+    {
+        sRenderFrameStats const& frame = GetFrame(framesAgo);
+
+        sums[0] += frame.m_drawCallCount;
+        sums[1] += frame.m_vertexCount;
+        sums[2] += frame.m_cameraCount;
+        sums[3] += frame.m_blendModeChanges;
+        sums[4] += frame.m_rasterizerModeChanges;
+        sums[5] += frame.m_samplerModeChanges;
+        sums[6] += frame.m_depthModeChanges;
+        sums[7] += frame.m_modelConstantUpdates;
+        sums[8] += frame.m_shaderBinds;
+        sums[9] += frame.m_textureBinds;
+        sums[10] += frame.m_redundantStateCount;
+        sums[11] += frame.m_uploadBytes;
+        sums[12] = std::max(sums[12], frame.m_peakDrawBytes);
+        sums[13] += frame.m_transientBytes;
+    }
+
+    uint64_t const count = m_historyCount;
+
+    average.m_drawCallCount         = static_cast<uint32_t>(sums[0] / count);
+    average.m_vertexCount           = static_cast<uint32_t>(sums[1] / count);
+    average.m_cameraCount           = static_cast<uint32_t>(sums[2] / count);
+    average.m_blendModeChanges      = static_cast<uint32_t>(sums[3] / count);
+    average.m_rasterizerModeChanges = static_cast<uint32_t>(sums[4] / count);
+    average.m_samplerModeChanges    = static_cast<uint32_t>(sums[5] / count);
+    average.m_depthModeChanges      = static_cast<uint32_t>(sums[6] / count);
+    average.m_modelConstantUpdates  = static_cast<uint32_t>(sums[7] / count);
+    average.m_shaderBinds           = static_cast<uint32_t>(sums[8] / count);
+    average.m_textureBinds          = static_cast<uint32_t>(sums[9] / count);
+    average.m_redundantStateCount   = static_cast<uint32_t>(sums[10] / count);
+    average.m_uploadBytes           = sums[11] / count;
+    average.m_peakDrawBytes         = sums[12];                 // Peak over the history, not a mean
+    average.m_transientBytes        = sums[13] / count;
+
+    return average;
+}
+
+//----------------------------------------------------------------------------------------------------
+std::string CountingRenderer::ToScriptObjectString() const
+{
+    return Stringf("{ lastFrame: %s, average: %s, historyFrames: %u }", FrameStatsToString(GetFrame(0)).c_str(), FrameStatsToString(GetAverage()).c_str(),
+                   m_historyCount);
+}
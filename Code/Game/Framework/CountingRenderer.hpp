@@ -0,0 +1,104 @@
+//----------------------------------------------------------------------------------------------------
+// CountingRenderer.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Renderer/Renderer.hpp"
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class Camera;
+class Shader;
+class Texture;
+
+//----------------------------------------------------------------------------------------------------
+struct sCountingRendererConfig
+{
+    uint32_t m_historySize = 240;       // Frames kept for GetFrame()/GetAverage()
+};
+
+//----------------------------------------------------------------------------------------------------
+// What one frame cost the renderer. State counts include redundant calls (same value as the last
+// call); those are also counted separately, since they are the cheapest ones to remove.
+//----------------------------------------------------------------------------------------------------
+struct sRenderFrameStats
+{
+    uint32_t m_drawCallCount         = 0;
+    uint32_t m_vertexCount           = 0;
+    uint32_t m_cameraCount           = 0;
+    uint32_t m_blendModeChanges      = 0;
+    uint32_t m_rasterizerModeChanges = 0;
+    uint32_t m_samplerModeChanges    = 0;
+    uint32_t m_depthModeChanges      = 0;
+    uint32_t m_modelConstantUpdates  = 0;
+    uint32_t m_shaderBinds           = 0;
+    uint32_t m_textureBinds          = 0;
+    uint32_t m_redundantStateCount   = 0;
+    uint64_t m_uploadBytes           = 0;     // Vertex data plus camera/model constant buffers
+    uint64_t m_peakDrawBytes         = 0;     // Largest single DrawVertexArray (immediate vertex buffer size)
+    uint64_t m_transientBytes        = 0;     // Per-frame CPU scratch reported by AddTransientBytes()
+
+    uint32_t GetStateChangeCount() const;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Thin front for the engine Renderer on the game's render path: every call is forwarded unchanged to
+// g_renderer and counted into the current frame's sRenderFrameStats. Counting is a few integer adds
+// and compares per call with no allocation or locking, so it stays on in release builds.
+//
+// Only calls made through this class are seen: engine-internal drawing (DebugRender*, DevConsole)
+// bypasses it. Frames are closed by EndFrame() into a ring of the last m_historySize frames.
+//
+// With no g_renderer (headless micro-benchmarks) calls are counted and dropped, which makes this the
+// stub renderer for timing vertex generation without a device.
+//----------------------------------------------------------------------------------------------------
+class CountingRenderer
+{
+public:
+    explicit CountingRenderer(sCountingRendererConfig const& config);
+
+    void BeginFrame();
+    void EndFrame();
+
+    void BeginCamera(Camera const& camera);
+    void EndCamera(Camera const& camera);
+    void SetModelConstants(Mat44 const& modelToWorld = Mat44(), Rgba8 const& modelTint = Rgba8::WHITE);
+    void SetBlendMode(eBlendMode blendMode);
+    void SetRasterizerMode(eRasterizerMode rasterizerMode);
+    void SetSamplerMode(eSamplerMode samplerMode);
+    void SetDepthMode(eDepthMode depthMode);
+    void BindShader(Shader const* shader);
+    void BindTexture(Texture const* texture);
+    void DrawVertexArray(int vertexCount, Vertex_PCU const* vertexes);
+    void DrawVertexArray(VertexList_PCU const& vertexes);
+
+    void AddTransientBytes(uint64_t byteCount);
+
+    sRenderFrameStats const& GetCurrentFrame() const { return m_current; }
+    sRenderFrameStats const& GetFrame(uint32_t framesAgo) const;     // 0 = last completed frame
+    uint32_t                 GetHistoryCount() const { return m_historyCount; }
+    sRenderFrameStats        GetAverage() const;
+    std::string              ToScriptObjectString() const;          // Last frame and history average, for JS
+
+private:
+    sCountingRendererConfig        m_config;
+    sRenderFrameStats              m_current;
+    std::vector<sRenderFrameStats> m_history;
+    uint32_t                       m_historyNext  = 0;
+    uint32_t                       m_historyCount = 0;
+
+    // Last values set this frame, to spot redundant calls; reset by BeginFrame()
+    int            m_blendMode      = -1;
+    int            m_rasterizerMode = -1;
+    int            m_samplerMode    = -1;
+    int            m_depthMode      = -1;
+    Shader const*  m_shader         = nullptr;
+    Texture const* m_texture        = nullptr;
+    bool           m_isTextureBound = false;
+};
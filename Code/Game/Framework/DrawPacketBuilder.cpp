@@ -0,0 +1,163 @@
+//----------------------------------------------------------------------------------------------------
+// DrawPacketBuilder.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/DrawPacketBuilder.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Game/Framework/WorkerPool.hpp"
+
+//----------------------------------------------------------------------------------------------------
+static double GetMillisecondsSince(std::chrono::steady_clock::time_point const& startTime)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+//----------------------------------------------------------------------------------------------------
+static bool IsPacketBefore(sDrawPacket const& a, sDrawPacket const& b)
+{
+    return a.m_sortKey != b.m_sortKey ? a.m_sortKey < b.m_sortKey : a.m_itemIndex < b.m_itemIndex;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Non-negative floats order the same as their bit patterns, so depth needs no conversion.
+//
+STATIC uint64_t sDrawPacket::MakeSortKey(uint16_t const materialKey,
+                                         uint8_t const  meshKey,
+                                         uint8_t const  levelOfDetail,
+                                         float const    viewDepth)
+{
+    float const depth = viewDepth > 0.f ? viewDepth : 0.f;
+    uint32_t    depthBits;
+    std::memcpy(&depthBits, &depth, sizeof(depthBits));
+
+    return static_cast<uint64_t>(materialKey) << 48 | static_cast<uint64_t>(meshKey) << 40 | static_cast<uint64_t>(levelOfDetail) << 32 | depthBits;
+}
+
+//----------------------------------------------------------------------------------------------------
+DrawPacketBuilder::DrawPacketBuilder(WorkerPool* workerPool)
+    : m_workerPool(workerPool)
+{
+    m_workerBuffers.resize(workerPool != nullptr ? workerPool->GetWorkerCount() : 1);
+}
+
+//----------------------------------------------------------------------------------------------------
+void DrawPacketBuilder::Build(uint32_t const        itemCount,
+                              PacketFunction const& packetFunction)
+{
+    m_stats             = sDrawPacketStats();
+    m_stats.m_itemCount = itemCount;
+
+    // The pool may have been resized between frames.
+    m_workerBuffers.resize(m_workerPool != nullptr ? m_workerPool->GetWorkerCount() : 1);
+
+    for (sWorkerBuffer& buffer : m_workerBuffers)
+    {
+        buffer.m_packets.clear();
+    }
+
+    auto const buildStartTime = std::chrono::steady_clock::now();
+
+    uint32_t const chunkCount = (itemCount + CHUNK_SIZE - 1) / CHUNK_SIZE;
+
+    auto const buildChunk = [this, itemCount, &packetFunction](uint32_t const chunk, uint32_t const workerIndex)
+    {
+        std::vector<sDrawPacket>& packets  = m_workerBuffers[workerIndex].m_packets;
+        uint32_t const            lastItem = std::min(itemCount, (chunk + 1) * CHUNK_SIZE);
+
+        for (uint32_t item = chunk * CHUNK_SIZE; item < lastItem; ++item)
+        {
+            sDrawPacket packet;
+
+            if (packetFunction(item, packet))
+            {
+                packet.m_itemIndex = item;
+                packets.push_back(packet);
+            }
+        }
+    };
+
+    if (m_workerPool != nullptr)
+    {
+        m_workerPool->ParallelFor(chunkCount, buildChunk);
+    }
+    else
+    {
+        for (uint32_t chunk = 0; chunk < chunkCount; ++chunk)
+        {
+            buildChunk(chunk, 0);
+        }
+    }
+
+    m_stats.m_buildMilliseconds = GetMillisecondsSince(buildStartTime);
+
+    auto const sortStartTime = std::chrono::steady_clock::now();
+
+    auto const sortBuffer = [this](uint32_t const bufferIndex, uint32_t)
+    {
+        std::vector<sDrawPacket>& packets = m_workerBuffers[bufferIndex].m_packets;
+        std::sort(packets.begin(), packets.end(), IsPacketBefore);
+    };
+
+    if (m_workerPool != nullptr)
+    {
+        m_workerPool->ParallelFor(static_cast<uint32_t>(m_workerBuffers.size()), sortBuffer);
+    }
+    else
+    {
+        sortBuffer(0, 0);
+    }
+
+    m_stats.m_sortMilliseconds = GetMillisecondsSince(sortStartTime);
+
+    auto const mergeStartTime = std::chrono::steady_clock::now();
+
+    Merge();
+
+    m_stats.m_mergeMilliseconds = GetMillisecondsSince(mergeStartTime);
+    m_stats.m_packetCount       = static_cast<uint32_t>(m_packets.size());
+}
+
+//----------------------------------------------------------------------------------------------------
+// Repeatedly takes the smallest head among the sorted worker buffers; with a handful of workers a
+// linear scan over the heads beats a heap.
+//
+void DrawPacketBuilder::Merge()
+{
+    size_t totalCount = 0;
+
+    for (sWorkerBuffer const& buffer : m_workerBuffers)
+    {
+        totalCount += buffer.m_packets.size();
+    }
+
+    m_packets.clear();
+    m_packets.reserve(totalCount);
+
+    std::vector<size_t> cursors(m_workerBuffers.size(), 0);
+
+    for (size_t written = 0; written < totalCount; ++written)
+    {
+        sDrawPacket const* best       = nullptr;
+        size_t             bestBuffer = 0;
+
+        for (size_t bufferIndex = 0; bufferIndex < m_workerBuffers.size(); ++bufferIndex)
+        {
+            std::vector<sDrawPacket> const& packets = m_workerBuffers[bufferIndex].m_packets;
+
+            if (cursors[bufferIndex] < packets.size() && (best == nullptr || IsPacketBefore(packets[cursors[bufferIndex]], *best)))
+            {
+                best       = &packets[cursors[bufferIndex]];
+                bestBuffer = bufferIndex;
+            }
+        }
+
+        m_packets.push_back(*best);
+        ++cursors[bestBuffer];
+    }
+}
@@ -0,0 +1,84 @@
+//----------------------------------------------------------------------------------------------------
+// DrawPacketBuilder.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Renderer/VertexUtils.hpp"
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class Texture;
+class WorkerPool;
+
+//----------------------------------------------------------------------------------------------------
+// Everything the render thread needs to submit one draw.
+//
+// Sort key, most significant first: material (16 bits) | mesh (8) | LOD (8) | view depth (32), so
+// packets sharing a texture and mesh end up adjacent and each group is drawn front to back.
+//----------------------------------------------------------------------------------------------------
+struct sDrawPacket
+{
+    uint64_t          m_sortKey     = 0;
+    uint32_t          m_itemIndex   = 0;            // Ties are broken by item, so the order is deterministic
+    uint32_t          m_vertexCount = 0;
+    Vertex_PCU const* m_vertexes    = nullptr;
+    Texture const*    m_texture     = nullptr;
+    Mat44             m_modelToWorld;
+    Rgba8             m_color = Rgba8::WHITE;
+
+    static uint64_t MakeSortKey(uint16_t materialKey, uint8_t meshKey, uint8_t levelOfDetail, float viewDepth);
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sDrawPacketStats
+{
+    double   m_buildMilliseconds = 0.0;         // Parallel fill of the per-worker buffers
+    double   m_sortMilliseconds  = 0.0;         // Parallel sort of each buffer
+    double   m_mergeMilliseconds = 0.0;         // k-way merge into the submission list
+    uint32_t m_itemCount         = 0;
+    uint32_t m_packetCount       = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Builds the frame's draw packets on the WorkerPool and hands back one list sorted by key.
+//
+// Items are handed out in chunks; each worker appends to its own buffer (indexed by the pool's worker
+// index and padded to a cache line), so packet generation takes no lock and shares no cache lines.
+// The buffers are then sorted in parallel and k-way merged on the calling thread. The result does not
+// depend on the thread count or on how the chunks were scheduled.
+//
+// The packet function runs concurrently on several threads: it may only read shared data.
+//----------------------------------------------------------------------------------------------------
+class DrawPacketBuilder
+{
+public:
+    using PacketFunction = std::function<bool(uint32_t itemIndex, sDrawPacket& out_packet)>;     // false = no packet
+
+    explicit DrawPacketBuilder(WorkerPool* workerPool);      // nullptr builds on the calling thread
+
+    void Build(uint32_t itemCount, PacketFunction const& packetFunction);
+
+    std::vector<sDrawPacket> const& GetPackets() const { return m_packets; }
+    sDrawPacketStats const&         GetStats() const { return m_stats; }
+
+    static uint32_t constexpr CHUNK_SIZE = 256;
+
+private:
+    struct alignas(64) sWorkerBuffer
+    {
+        std::vector<sDrawPacket> m_packets;
+    };
+
+    void Merge();
+
+    WorkerPool*                m_workerPool = nullptr;
+    std::vector<sWorkerBuffer> m_workerBuffers;
+    std::vector<sDrawPacket>   m_packets;
+    sDrawPacketStats           m_stats;
+};
@@ -0,0 +1,121 @@
+//----------------------------------------------------------------------------------------------------
+// DrawPacketBuilderCheck.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/HeadlessRunner.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "Engine/Core/StringUtils.hpp"
+#include "Game/Prop.hpp"
+#include "Game/Framework/DrawPacketBuilder.hpp"
+#include "Game/Framework/HeadlessWorld.hpp"
+#include "Game/Framework/WorkerPool.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// Each thread count gets its own pool so the measurement is not limited by the shared pool's size.
+//
+bool RunDrawPacketsCheck(sHeadlessRunConfig const& config)
+{
+    uint32_t const maxPropCount = std::max(config.m_worldConfig.m_propCount, 1000u);
+    uint32_t const maxThreads   = std::max(std::thread::hardware_concurrency(), 1u);
+    uint32_t const frameCount   = config.m_packetFrameCount;
+
+    std::vector<uint32_t> propCounts;
+
+    for (uint32_t count = 1000; count < maxPropCount; count *= 4)
+    {
+        propCounts.push_back(count);
+    }
+
+    propCounts.push_back(maxPropCount);
+
+    std::vector<uint32_t> threadCounts;
+
+    for (uint32_t count = 1; count < maxThreads; count *= 2)
+    {
+        threadCounts.push_back(count);
+    }
+
+    threadCounts.push_back(maxThreads);
+
+    String report = Stringf("Draw packets: %u frames per measurement, up to %u threads\n", frameCount, maxThreads);
+    report += "props    threads  build ms  sort ms  merge ms  total ms  speedup\n";
+
+    bool isIdentical = true;
+
+    for (uint32_t const propCount : propCounts)
+    {
+        sHeadlessWorldConfig worldConfig = config.m_worldConfig;
+        worldConfig.m_propCount          = propCount;
+
+        HeadlessWorld world(worldConfig);
+        world.Step();
+
+        std::vector<Prop*> const& props          = world.GetProps();
+        Vec3 const                cameraPosition = world.GetCameraPosition();
+
+        auto const buildPacket = [&props, &cameraPosition](uint32_t const propIndex, sDrawPacket& out_packet)
+        {
+            Prop const& prop = *props[propIndex];
+            return prop.BuildDrawPacket(cameraPosition, prop.GetTexture() != nullptr ? 1 : 0, out_packet);
+        };
+
+        std::vector<sDrawPacket> referencePackets;
+        double                   baselineMilliseconds = 0.0;
+
+        for (uint32_t const threadCount : threadCounts)
+        {
+            std::unique_ptr<WorkerPool> pool = threadCount > 1 ? std::make_unique<WorkerPool>(threadCount - 1) : nullptr;
+            DrawPacketBuilder           builder(pool.get());
+            sDrawPacketStats            totals;
+
+            for (uint32_t frame = 0; frame < frameCount; ++frame)
+            {
+                builder.Build(static_cast<uint32_t>(props.size()), buildPacket);
+
+                totals.m_buildMilliseconds += builder.GetStats().m_buildMilliseconds;
+                totals.m_sortMilliseconds += builder.GetStats().m_sortMilliseconds;
+                totals.m_mergeMilliseconds += builder.GetStats().m_mergeMilliseconds;
+            }
+
+            std::vector<sDrawPacket> const& packets = builder.GetPackets();
+
+            if (threadCount == 1)
+            {
+                referencePackets = packets;
+            }
+            else
+            {
+                isIdentical = isIdentical && packets.size() == referencePackets.size() &&
+                              std::equal(packets.begin(), packets.end(), referencePackets.begin(), [](sDrawPacket const& a, sDrawPacket const& b)
+                              {
+                                  return a.m_sortKey == b.m_sortKey && a.m_itemIndex == b.m_itemIndex && a.m_vertexes == b.m_vertexes;
+                              });
+            }
+
+            double const buildMilliseconds = totals.m_buildMilliseconds / frameCount;
+            double const sortMilliseconds  = totals.m_sortMilliseconds / frameCount;
+            double const mergeMilliseconds = totals.m_mergeMilliseconds / frameCount;
+            double const totalMilliseconds = buildMilliseconds + sortMilliseconds + mergeMilliseconds;
+
+            if (threadCount == 1)
+            {
+                baselineMilliseconds = totalMilliseconds;
+            }
+
+            report += Stringf("%7u  %7u  %8.3f  %7.3f  %8.3f  %8.3f  %6.2fx\n", propCount, threadCount, buildMilliseconds, sortMilliseconds, mergeMilliseconds,
+                              totalMilliseconds, totalMilliseconds > 0.0 ? baselineMilliseconds / totalMilliseconds : 0.0);
+        }
+    }
+
+    report += Stringf("validation       %s\n", isIdentical ? "OK" : "FAILED (packet order depends on thread count)");
+
+    WriteHeadlessReport(config.m_packetReportPath, report);
+
+    return isIdentical;
+}
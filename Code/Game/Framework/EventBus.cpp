@@ -0,0 +1,210 @@
+//----------------------------------------------------------------------------------------------------
+// EventBus.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/EventBus.hpp"
+
+#include <algorithm>
+#include <bit>
+
+//----------------------------------------------------------------------------------------------------
+EventBus::EventBus(sEventBusConfig const& config)
+{
+    uint32_t const capacity = std::bit_ceil(std::max(config.m_capacity, 2u));
+
+    m_slots = std::make_unique<sSlot[]>(capacity);
+    m_mask  = capacity - 1;
+
+    for (uint32_t i = 0; i < capacity; ++i)
+    {
+        m_slots[i].m_sequence.store(i, std::memory_order_relaxed);
+    }
+
+    m_batch.reserve(capacity);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool EventBus::Post(sBusEvent const& event)
+{
+    uint64_t position = m_writeIndex.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        sSlot&         slot     = m_slots[position & m_mask];
+        uint64_t const sequence = slot.m_sequence.load(std::memory_order_acquire);
+        int64_t const  distance = static_cast<int64_t>(sequence - position);
+
+        if (distance == 0)
+        {
+            // Slot is free for this lap; claim it, or retry at whatever position another producer left.
+            if (m_writeIndex.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+            {
+                slot.m_event = event;
+                slot.m_sequence.store(position + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (distance < 0)
+        {
+            // The consumer has not released this slot from the previous lap: full.
+            m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        else
+        {
+            position = m_writeIndex.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+bool EventBus::Post(StringID const eventID,
+                    StringID const text,
+                    int64_t const  integer,
+                    double const   number)
+{
+    sBusEvent event;
+    event.m_eventID = eventID;
+    event.m_text    = text;
+    event.m_integer = integer;
+    event.m_number  = number;
+
+    return Post(event);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool EventBus::Pop(sBusEvent& out_event)
+{
+    sSlot& slot = m_slots[m_readIndex & m_mask];
+
+    // A producer may have claimed the slot but not finished writing it; that event waits a frame.
+    if (slot.m_sequence.load(std::memory_order_acquire) != m_readIndex + 1)
+    {
+        return false;
+    }
+
+    out_event = slot.m_event;
+    slot.m_sequence.store(m_readIndex + m_mask + 1, std::memory_order_release);
+    ++m_readIndex;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+EventBus::SubscriptionHandle EventBus::Subscribe(StringID const            eventID,
+                                                 EventBatchCallback const& callback)
+{
+    if (eventID == INVALID_STRING_ID || !callback)
+    {
+        return INVALID_SUBSCRIPTION;
+    }
+
+    sSubscription subscription;
+    subscription.m_handle   = m_nextHandle++;
+    subscription.m_callback = callback;
+
+    m_subscriptions[eventID].push_back(std::move(subscription));
+
+    return m_subscriptions[eventID].back().m_handle;
+}
+
+//----------------------------------------------------------------------------------------------------
+void EventBus::Unsubscribe(SubscriptionHandle const handle)
+{
+    for (auto& [eventID, subscriptions] : m_subscriptions)
+    {
+        for (sSubscription& subscription : subscriptions)
+        {
+            if (subscription.m_handle == handle)
+            {
+                // Mid-dispatch the list is being walked by index; clear now and compact afterwards.
+                subscription.m_callback = nullptr;
+                m_hasUnsubscribed       = true;
+
+                if (!m_isDispatching)
+                {
+                    RemoveUnsubscribed();
+                }
+
+                return;
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void EventBus::RemoveUnsubscribed()
+{
+    for (auto iter = m_subscriptions.begin(); iter != m_subscriptions.end();)
+    {
+        std::erase_if(iter->second, [](sSubscription const& subscription) { return !subscription.m_callback; });
+        iter = iter->second.empty() ? m_subscriptions.erase(iter) : std::next(iter);
+    }
+
+    m_hasUnsubscribed = false;
+}
+
+//----------------------------------------------------------------------------------------------------
+uint32_t EventBus::DispatchPending()
+{
+    // Drain first, so whatever the subscribers post below is left for next frame.
+    m_batch.clear();
+
+    sBusEvent event;
+
+    while (m_batch.size() <= m_mask && Pop(event))
+    {
+        m_batch.push_back(event);
+    }
+
+    if (m_batch.empty())
+    {
+        return 0;
+    }
+
+    std::stable_sort(m_batch.begin(), m_batch.end(), [](sBusEvent const& a, sBusEvent const& b) { return a.m_eventID < b.m_eventID; });
+
+    m_isDispatching = true;
+
+    for (size_t runStart = 0; runStart < m_batch.size();)
+    {
+        StringID const eventID = m_batch[runStart].m_eventID;
+        size_t         runEnd  = runStart + 1;
+
+        while (runEnd < m_batch.size() && m_batch[runEnd].m_eventID == eventID)
+        {
+            ++runEnd;
+        }
+
+        auto const iter = m_subscriptions.find(eventID);
+
+        if (iter != m_subscriptions.end())
+        {
+            // Subscribers may subscribe or unsubscribe from inside the callback: the count is fixed up
+            // front and the callback copied, so a reallocation never pulls the function out from under us.
+            size_t const subscriptionCount = iter->second.size();
+
+            for (size_t i = 0; i < subscriptionCount; ++i)
+            {
+                EventBatchCallback const callback = m_subscriptions[eventID][i].m_callback;
+
+                if (callback)
+                {
+                    callback(m_batch.data() + runStart, static_cast<uint32_t>(runEnd - runStart));
+                }
+            }
+        }
+
+        runStart = runEnd;
+    }
+
+    m_isDispatching = false;
+
+    if (m_hasUnsubscribed)
+    {
+        RemoveUnsubscribed();
+    }
+
+    return static_cast<uint32_t>(m_batch.size());
+}
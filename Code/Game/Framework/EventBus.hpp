@@ -0,0 +1,107 @@
+//----------------------------------------------------------------------------------------------------
+// EventBus.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "Game/Framework/StringTable.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// Fixed-size and trivially copyable, so posting never allocates. Text travels as an interned StringID;
+// the table never frees strings, so the ID stays readable on the main thread.
+//----------------------------------------------------------------------------------------------------
+struct sBusEvent
+{
+    StringID m_eventID = INVALID_STRING_ID;      // "fileChanged"_sid
+    StringID m_text    = INVALID_STRING_ID;      // e.g. the changed file's relative path
+    int64_t  m_integer = 0;
+    double   m_number  = 0.0;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sEventBusConfig
+{
+    uint32_t m_capacity = 4096;      // Rounded up to a power of two; events posted while full are dropped
+};
+
+//----------------------------------------------------------------------------------------------------
+// Hands events from any thread to the main thread. Post() goes through a bounded lock-free
+// multi-producer / single-consumer ring (one sequence number per slot), so posting never waits on the
+// main thread. Text travels as a StringID interned before the producer thread runs (FileWatcher in
+// AddWatchedFile(), WorldSnapshotWriter in SubmitAsync()), so producers at most share-lock the
+// StringTable, as the main thread's lookups do, and never take its exclusive lock or allocate there.
+// Their logging still goes through the engine log.
+//
+// DispatchPending() runs once per frame on the main thread: it drains what was posted so far, groups it
+// by event ID (posting order is kept within an ID) and calls each subscriber once with the whole batch.
+// Events posted by a subscriber go out next frame.
+//
+// Events in use:
+//   "fileChanged"           m_text = watched script path, relative to Run/ (FileWatcher thread)
+//   "worldSnapshotWritten"  m_text = snapshot path, m_integer = 1 on success (WorldSnapshotWriter thread)
+//   "asyncRequestCompleted" m_integer = AsyncBridge request ID (AsyncBridge threads)
+//
+// Scripts subscribe with game.subscribeEvent(name) and get every frame's events in one
+// JSEngine.dispatchEvents() call. EventSystem keeps the engine's own string-named commands.
+//----------------------------------------------------------------------------------------------------
+class EventBus
+{
+public:
+    using EventBatchCallback = std::function<void(sBusEvent const* events, uint32_t count)>;
+    using SubscriptionHandle = uint32_t;
+
+    static SubscriptionHandle constexpr INVALID_SUBSCRIPTION = 0;
+
+    explicit EventBus(sEventBusConfig const& config);
+
+    EventBus(EventBus const&)            = delete;
+    EventBus& operator=(EventBus const&) = delete;
+
+    // Any thread
+    bool Post(sBusEvent const& event);        // false (and counted as dropped) when the ring is full
+    bool Post(StringID eventID, StringID text = INVALID_STRING_ID, int64_t integer = 0, double number = 0.0);
+
+    // Main thread only
+    SubscriptionHandle Subscribe(StringID eventID, EventBatchCallback const& callback);
+    void               Unsubscribe(SubscriptionHandle handle);
+    uint32_t           DispatchPending();     // Number of events dispatched
+
+    uint32_t GetCapacity() const { return m_mask + 1; }
+    uint64_t GetDroppedCount() const { return m_droppedCount.load(std::memory_order_relaxed); }
+
+private:
+    struct sSlot
+    {
+        std::atomic<uint64_t> m_sequence{0};      // == index: free, == index + 1: holds an event
+        sBusEvent             m_event;
+    };
+
+    struct sSubscription
+    {
+        SubscriptionHandle m_handle = INVALID_SUBSCRIPTION;
+        EventBatchCallback m_callback;             // Empty once unsubscribed during a dispatch
+    };
+
+    bool Pop(sBusEvent& out_event);
+    void RemoveUnsubscribed();
+
+    std::unique_ptr<sSlot[]> m_slots;
+    uint32_t                 m_mask = 0;
+
+    alignas(64) std::atomic<uint64_t> m_writeIndex{0};      // Producers
+    alignas(64) uint64_t              m_readIndex = 0;       // Consumer only
+    std::atomic<uint64_t>             m_droppedCount{0};
+
+    std::unordered_map<StringID, std::vector<sSubscription>> m_subscriptions;
+    std::vector<sBusEvent>                                   m_batch;
+    SubscriptionHandle                                       m_nextHandle      = 1;
+    bool                                                     m_isDispatching   = false;
+    bool                                                     m_hasUnsubscribed = false;
+};
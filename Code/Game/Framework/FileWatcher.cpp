@@ -62,6 +62,7 @@ void FileWatcher::Shutdown()
             std::lock_guard<std::mutex> lock(m_watchedFilesMutex);
             m_watchedFiles.clear();
             m_lastWriteTimes.clear();
+            m_fullPaths.clear();
         }
         
         {
@@ -84,29 +85,58 @@ void FileWatcher::AddWatchedFile(const std::string& relativePath)
     try {
         std::lock_guard<std::mutex> lock(m_watchedFilesMutex);
         
-        // Check if already watching this file
-        auto it = std::find(m_watchedFiles.begin(), m_watchedFiles.end(), relativePath);
-        if (it != m_watchedFiles.end()) {
-            DAEMON_LOG(LogScript, eLogVerbosity::Log, StringFormat("FileWatcher: Already watching file: {}", relativePath));
-            return;
+        if (WatchFile(relativePath)) {
+            DAEMON_LOG(LogScript, eLogVerbosity::Log, StringFormat("FileWatcher: Added watched file: {}", relativePath));
         }
+    }
+    catch (const std::exception& e) {
+        DAEMON_LOG(LogScript, eLogVerbosity::Error, StringFormat("FileWatcher: Failed to add watched file {}: {}", relativePath, e.what()));
+    }
+}
+
+size_t FileWatcher::AddWatchedFiles(const std::vector<std::string>& relativePaths)
+{
+    size_t addedCount = 0;
+
+    try {
+        std::lock_guard<std::mutex> lock(m_watchedFilesMutex);
         
-        // Verify file exists
-        std::string fullPath = GetFullPath(relativePath);
-        if (!std::filesystem::exists(fullPath)) {
-            DAEMON_LOG(LogScript, eLogVerbosity::Error, StringFormat("FileWatcher: Cannot watch non-existent file: {}", fullPath));
-            return;
+        for (const std::string& relativePath : relativePaths) {
+            if (WatchFile(relativePath)) {
+                ++addedCount;
+            }
         }
         
-        // Add to watched files and record initial timestamp
-        m_watchedFiles.push_back(relativePath);
-        m_lastWriteTimes[relativePath] = std::filesystem::last_write_time(fullPath);
-        
-        DAEMON_LOG(LogScript, eLogVerbosity::Log, StringFormat("FileWatcher: Added watched file: {}", relativePath));
+        DAEMON_LOG(LogScript, eLogVerbosity::Log, StringFormat("FileWatcher: Added {} of {} watched files", addedCount, relativePaths.size()));
     }
     catch (const std::exception& e) {
-        DAEMON_LOG(LogScript, eLogVerbosity::Error, StringFormat("FileWatcher: Failed to add watched file {}: {}", relativePath, e.what()));
+        DAEMON_LOG(LogScript, eLogVerbosity::Error, StringFormat("FileWatcher: Failed to add watched files: {}", e.what()));
+    }
+
+    return addedCount;
+}
+
+bool FileWatcher::WatchFile(const std::string& relativePath)
+{
+    // Check if already watching this file
+    StringID const pathID = StringTable::Intern(relativePath);
+    if (m_lastWriteTimes.contains(pathID)) {
+        DAEMON_LOG(LogScript, eLogVerbosity::Log, StringFormat("FileWatcher: Already watching file: {}", relativePath));
+        return false;
     }
+    
+    // Verify file exists
+    std::filesystem::path fullPath = GetFullPath(relativePath);
+    if (!std::filesystem::exists(fullPath)) {
+        DAEMON_LOG(LogScript, eLogVerbosity::Error, StringFormat("FileWatcher: Cannot watch non-existent file: {}", fullPath.string()));
+        return false;
+    }
+    
+    // Add to watched files and record initial timestamp
+    m_watchedFiles.push_back(pathID);
+    m_lastWriteTimes[pathID] = std::filesystem::last_write_time(fullPath);
+    m_fullPaths[pathID]      = std::move(fullPath);
+    return true;
 }
 
 void FileWatcher::RemoveWatchedFile(const std::string& relativePath)
@@ -115,10 +145,12 @@ void FileWatcher::RemoveWatchedFile(const std::string& relativePath)
         std::lock_guard<std::mutex> lock(m_watchedFilesMutex);
         
         // Remove from watched files vector
-        auto it = std::find(m_watchedFiles.begin(), m_watchedFiles.end(), relativePath);
-        if (it != m_watchedFiles.end()) {
+        StringID const pathID = StringTable::Find(relativePath);
+        auto it = std::find(m_watchedFiles.begin(), m_watchedFiles.end(), pathID);
+        if (pathID != INVALID_STRING_ID && it != m_watchedFiles.end()) {
             m_watchedFiles.erase(it);
-            m_lastWriteTimes.erase(relativePath);
+            m_lastWriteTimes.erase(pathID);
+            m_fullPaths.erase(pathID);
             DAEMON_LOG(LogScript, eLogVerbosity::Log, StringFormat("FileWatcher: Removed watched file: {}", relativePath));
         }
         else {
@@ -215,7 +247,15 @@ void FileWatcher::SetBatchDelay(std::chrono::milliseconds delay)
 std::vector<std::string> FileWatcher::GetWatchedFiles() const
 {
     std::lock_guard<std::mutex> lock(m_watchedFilesMutex);
-    return m_watchedFiles; // Return copy
+
+    std::vector<std::string> watchedFiles;
+    watchedFiles.reserve(m_watchedFiles.size());
+
+    for (StringID const pathID : m_watchedFiles) {
+        watchedFiles.emplace_back(StringTable::GetString(pathID));
+    }
+
+    return watchedFiles;
 }
 
 void FileWatcher::WatchingThreadFunction()
@@ -246,9 +286,9 @@ void FileWatcher::CheckFileChanges()
     try {
         std::lock_guard<std::mutex> lock(m_watchedFilesMutex);
         
-        for (const auto& relativePath : m_watchedFiles) {
-            if (HasFileChanged(relativePath)) {
-                ProcessFileChange(relativePath);
+        for (StringID const pathID : m_watchedFiles) {
+            if (HasFileChanged(pathID)) {
+                ProcessFileChange(pathID);
             }
         }
     }
@@ -257,29 +297,36 @@ void FileWatcher::CheckFileChanges()
     }
 }
 
-bool FileWatcher::HasFileChanged(const std::string& relativePath)
+bool FileWatcher::HasPendingChanges() const
 {
+    std::lock_guard<std::mutex> lock(m_changesMutex);
+    return m_hasPendingChanges;
+}
+
+bool FileWatcher::HasFileChanged(StringID pathID)
+{
+    // Cached by WatchFile(); a poll neither copies the path string nor joins it again.
+    std::filesystem::path const& fullPath = m_fullPaths.at(pathID);
+
     try {
-        std::string fullPath = GetFullPath(relativePath);
-        
         if (!std::filesystem::exists(fullPath)) {
-            DAEMON_LOG(LogScript, eLogVerbosity::Warning, StringFormat("FileWatcher: Watched file no longer exists: {}", fullPath));
+            DAEMON_LOG(LogScript, eLogVerbosity::Warning, StringFormat("FileWatcher: Watched file no longer exists: {}", fullPath.string()));
             return false;
         }
         
         auto currentWriteTime = std::filesystem::last_write_time(fullPath);
-        auto lastWriteTime = m_lastWriteTimes[relativePath];
+        auto& lastWriteTime = m_lastWriteTimes[pathID];
         
         if (currentWriteTime != lastWriteTime) {
             // Update stored time
-            m_lastWriteTimes[relativePath] = currentWriteTime;
+            lastWriteTime = currentWriteTime;
             return true;
         }
         
         return false;
     }
     catch (const std::exception& e) {
-        DAEMON_LOG(LogScript, eLogVerbosity::Error, StringFormat("FileWatcher: Error checking file change for {}: {}", relativePath, e.what()));
+        DAEMON_LOG(LogScript, eLogVerbosity::Error, StringFormat("FileWatcher: Error checking file change for {}: {}", StringTable::GetString(pathID), e.what()));
         return false;
     }
 }
@@ -291,15 +338,17 @@ std::string FileWatcher::GetFullPath(const std::string& relativePath) const
     return fullPath.string();
 }
 
-void FileWatcher::ProcessFileChange(const std::string& filePath)
+void FileWatcher::ProcessFileChange(StringID pathID)
 {
+    std::string_view const filePath = StringTable::GetString(pathID);
+
     try {
         std::lock_guard<std::mutex> lock(m_changesMutex);
         
         // Add to pending changes for batching
-        auto it = std::find(m_pendingChanges.begin(), m_pendingChanges.end(), filePath);
+        auto it = std::find(m_pendingChanges.begin(), m_pendingChanges.end(), pathID);
         if (it == m_pendingChanges.end()) {
-            m_pendingChanges.push_back(filePath);
+            m_pendingChanges.push_back(pathID);
         }
         
         // Update timing for batching
@@ -330,9 +379,9 @@ void FileWatcher::FlushPendingChanges()
             // Process all pending changes
             DAEMON_LOG(LogScript, eLogVerbosity::Log, StringFormat("FileWatcher: Flushing %zu pending changes", m_pendingChanges.size()));
             
-            for (const auto& filePath : m_pendingChanges) {
+            for (StringID const pathID : m_pendingChanges) {
                 if (m_changeCallback) {
-                    m_changeCallback(filePath);
+                    m_changeCallback(pathID);
                 }
             }
             
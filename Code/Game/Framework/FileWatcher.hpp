@@ -11,6 +11,8 @@
 #include <atomic>
 #include <mutex>
 
+#include "Game/Framework/StringTable.hpp"
+
 /**
  * FileWatcher - C++ File System Monitoring for Hot-Reload
  * 
@@ -23,12 +25,15 @@
  * - Callback-based change notifications
  * - Thread-safe operation
  * - Batch change detection to avoid rapid fire reloads
+ * - Paths interned once (StringTable); polling and batching key on StringIDs
+ * - Full paths built once per watched file, so a poll only stats them
  */
 class FileWatcher
 {
 public:
-    using FileChangeCallback = std::function<void(const std::string& filePath)>;
-    using FileTimeMap = std::unordered_map<std::string, std::filesystem::file_time_type>;
+    using FileChangeCallback = std::function<void(StringID pathID)>;     // Interned relative path; watching thread
+    using FileTimeMap = std::unordered_map<StringID, std::filesystem::file_time_type>;
+    using FilePathMap = std::unordered_map<StringID, std::filesystem::path>;
 
     FileWatcher();
     ~FileWatcher();
@@ -39,6 +44,7 @@ public:
     
     // File monitoring
     void AddWatchedFile(const std::string& relativePath);
+    size_t AddWatchedFiles(const std::vector<std::string>& relativePaths);     // One log line for the batch; returns how many were added
     void RemoveWatchedFile(const std::string& relativePath);
     void SetChangeCallback(FileChangeCallback callback);
     
@@ -46,6 +52,8 @@ public:
     void StartWatching();
     void StopWatching();
     bool IsWatching() const { return m_isWatching; }
+    void CheckFileChanges();     // One scan on the calling thread; the watching thread runs it every interval
+    bool HasPendingChanges() const;
     
     // Configuration
     void SetPollingInterval(std::chrono::milliseconds interval);
@@ -59,12 +67,12 @@ public:
 private:
     // Internal monitoring logic
     void WatchingThreadFunction();
-    void CheckFileChanges();
-    bool HasFileChanged(const std::string& filePath);
+    bool WatchFile(const std::string& relativePath);     // Caller holds m_watchedFilesMutex; logs failures only
+    bool HasFileChanged(StringID pathID);
     std::string GetFullPath(const std::string& relativePath) const;
     
     // Change detection and batching
-    void ProcessFileChange(const std::string& filePath);
+    void ProcessFileChange(StringID pathID);
     void FlushPendingChanges();
 
 private:
@@ -74,8 +82,9 @@ private:
     std::chrono::milliseconds m_batchDelay{100};      // Default 100ms batch delay
     
     // File monitoring state
-    std::vector<std::string> m_watchedFiles;
+    std::vector<StringID> m_watchedFiles;      // Interned relative paths
     FileTimeMap m_lastWriteTimes;
+    FilePathMap m_fullPaths;                   // Root/Run/relative path, built when the file is watched
     FileChangeCallback m_changeCallback;
     
     // Threading and control
@@ -84,7 +93,7 @@ private:
     std::atomic<bool> m_shouldStop{false};
     
     // Batching for rapid changes
-    std::vector<std::string> m_pendingChanges;
+    std::vector<StringID> m_pendingChanges;
     std::chrono::steady_clock::time_point m_lastChangeTime;
     bool m_hasPendingChanges{false};
     
@@ -8,6 +8,14 @@
 #include "Engine/Renderer/Vertex_PCU.hpp"
 #include "Engine/Math/MathUtils.hpp"
 #include "Engine/Renderer/Renderer.hpp"
+#include "Game/Framework/CountingRenderer.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
 
 //-----------------------------------------------------------------------------------------------
 // DebugRender color-related
@@ -74,8 +82,8 @@ void DebugDrawRing(Vec2 const& center, float radius, float thickness, Rgba8 cons
         verts[vertIndexF].m_color    = color;
     }
 
-    g_renderer->BindTexture(nullptr);
-    g_renderer->DrawVertexArray(NUM_VERTS, &verts[0]);
+    g_countingRenderer->BindTexture(nullptr);
+    g_countingRenderer->DrawVertexArray(NUM_VERTS, &verts[0]);
 }
 
 //-----------------------------------------------------------------------------------------------
@@ -107,8 +115,8 @@ void DebugDrawLine(Vec2 const& start, Vec2 const& end, float thickness, Rgba8 co
     verts[4].m_color    = color;
     verts[5].m_color    = color;
 
-    g_renderer->BindTexture(nullptr);
-    g_renderer->DrawVertexArray(6, &verts[0]);
+    g_countingRenderer->BindTexture(nullptr);
+    g_countingRenderer->DrawVertexArray(6, &verts[0]);
 }
 
 //------------------------------------------------------------------------------------------------
@@ -157,7 +165,7 @@ void DebugDrawGlowCircle(Vec2 const& center, float radius, Rgba8 const& color, f
         verts[vertIndexC].m_color = glowColor;
     }
 
-    g_renderer->DrawVertexArray(NUM_VERTS, &verts[0]);
+    g_countingRenderer->DrawVertexArray(NUM_VERTS, &verts[0]);
 }
 
 void DebugDrawGlowBox(Vec2 const& center, Vec2 const& dimensions, Rgba8 const& color, float glowIntensity)
@@ -204,7 +212,7 @@ void DebugDrawGlowBox(Vec2 const& center, Vec2 const& dimensions, Rgba8 const& c
     }
 
     // Draw the vertex array
-    g_renderer->DrawVertexArray(NUM_VERTS, &verts[0]);
+    g_countingRenderer->DrawVertexArray(NUM_VERTS, &verts[0]);
 }
 
 
@@ -270,5 +278,278 @@ void DebugDrawBoxRing(Vec2 const& center, float radius, float thickness, Rgba8 c
         verts[i].m_color = color;
     }
 
-    g_renderer->DrawVertexArray(24, &verts[0]);
+    g_countingRenderer->DrawVertexArray(24, &verts[0]);
+}
+
+//-----------------------------------------------------------------------------------------------
+// Returns the position just past "-name=" in the command line, or npos if the switch is absent.
+//
+static size_t FindCommandLineValue(std::string const& commandLine, std::string const& name)
+{
+    std::string const key      = "-" + name + "=";
+    size_t const      position = commandLine.find(key);
+
+    return position == std::string::npos ? std::string::npos : position + key.size();
+}
+
+//-----------------------------------------------------------------------------------------------
+bool FindCommandLineUInt(std::string const& commandLine, std::string const& name, uint32_t& out_value)
+{
+    size_t const valuePosition = FindCommandLineValue(commandLine, name);
+
+    if (valuePosition == std::string::npos)
+    {
+        return false;
+    }
+
+    out_value = static_cast<uint32_t>(std::strtoul(commandLine.c_str() + valuePosition, nullptr, 10));
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------------------------
+bool FindCommandLineFloat(std::string const& commandLine, std::string const& name, float& out_value)
+{
+    size_t const valuePosition = FindCommandLineValue(commandLine, name);
+
+    if (valuePosition == std::string::npos)
+    {
+        return false;
+    }
+
+    out_value = std::strtof(commandLine.c_str() + valuePosition, nullptr);
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------------------------
+// The value runs to the next space, so paths with spaces must be avoided.
+//
+bool FindCommandLineString(std::string const& commandLine, std::string const& name, std::string& out_value)
+{
+    size_t const valuePosition = FindCommandLineValue(commandLine, name);
+
+    if (valuePosition == std::string::npos)
+    {
+        return false;
+    }
+
+    size_t const valueEnd = commandLine.find(' ', valuePosition);
+    out_value             = commandLine.substr(valuePosition, valueEnd == std::string::npos ? std::string::npos : valueEnd - valuePosition);
+
+    return !out_value.empty();
+}
+
+//-----------------------------------------------------------------------------------------------
+static void AppendJsonEscaped(std::string& out_json, std::string_view const text)
+{
+    for (char const c : text)
+    {
+        switch (c)
+        {
+        case '"':  out_json += "\\\""; break;
+        case '\\': out_json += "\\\\"; break;
+        case '\n': out_json += "\\n"; break;
+        case '\r': out_json += "\\r"; break;
+        case '\t': out_json += "\\t"; break;
+        default:
+            if (static_cast<uint8_t>(c) < 0x20)
+            {
+                char hex[8];
+                std::snprintf(hex, sizeof(hex), "\\u%04x", static_cast<unsigned>(c));
+                out_json += hex;
+            }
+            else
+            {
+                out_json += c;
+            }
+            break;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------------------------
+// Safe to splice into a script command as "..." whatever the text is: file contents, paths, errors.
+//
+std::string EscapeJsonString(std::string_view const text)
+{
+    std::string escaped;
+    escaped.reserve(text.size() + text.size() / 16);
+    AppendJsonEscaped(escaped, text);
+
+    return escaped;
+}
+
+//-----------------------------------------------------------------------------------------------
+void AppendJsonString(std::string& out_json, std::string_view const text)
+{
+    out_json += '"';
+    AppendJsonEscaped(out_json, text);
+    out_json += '"';
+}
+
+//-----------------------------------------------------------------------------------------------
+static void AppendUtf8(std::string& out_text, uint32_t const codePoint)
+{
+    if (codePoint < 0x80)
+    {
+        out_text += static_cast<char>(codePoint);
+    }
+    else if (codePoint < 0x800)
+    {
+        out_text += static_cast<char>(0xC0 | (codePoint >> 6));
+        out_text += static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+    else if (codePoint < 0x10000)
+    {
+        out_text += static_cast<char>(0xE0 | (codePoint >> 12));
+        out_text += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        out_text += static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+    else
+    {
+        out_text += static_cast<char>(0xF0 | (codePoint >> 18));
+        out_text += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+        out_text += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        out_text += static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+}
+
+//-----------------------------------------------------------------------------------------------
+static bool ReadJsonHex4(std::string_view const json, size_t& inout_pos, uint32_t& out_value)
+{
+    if (inout_pos + 4 > json.size())
+    {
+        return false;
+    }
+
+    std::from_chars_result const result = std::from_chars(json.data() + inout_pos, json.data() + inout_pos + 4, out_value, 16);
+
+    if (result.ec != std::errc() || result.ptr != json.data() + inout_pos + 4)
+    {
+        return false;
+    }
+
+    inout_pos += 4;
+    return true;
+}
+
+//-----------------------------------------------------------------------------------------------
+bool ReadJsonString(std::string_view const json, size_t& inout_pos, std::string& out_text)
+{
+    if (inout_pos >= json.size() || json[inout_pos] != '"')
+    {
+        return false;
+    }
+
+    out_text.clear();
+    ++inout_pos;
+
+    while (inout_pos < json.size())
+    {
+        char const c = json[inout_pos++];
+
+        if (c == '"')
+        {
+            return true;
+        }
+
+        if (c != '\\')
+        {
+            out_text += c;
+            continue;
+        }
+
+        if (inout_pos >= json.size())
+        {
+            return false;
+        }
+
+        char const escape = json[inout_pos++];
+
+        switch (escape)
+        {
+        case '"':  out_text += '"';  break;
+        case '\\': out_text += '\\'; break;
+        case '/':  out_text += '/';  break;
+        case 'b':  out_text += '\b'; break;
+        case 'f':  out_text += '\f'; break;
+        case 'n':  out_text += '\n'; break;
+        case 'r':  out_text += '\r'; break;
+        case 't':  out_text += '\t'; break;
+        case 'u':
+            {
+                uint32_t codePoint = 0;
+
+                if (!ReadJsonHex4(json, inout_pos, codePoint))
+                {
+                    return false;
+                }
+
+                // Surrogate pair: a second \uXXXX carries the low half.
+                if (codePoint >= 0xD800 && codePoint < 0xDC00 && json.substr(inout_pos, 2) == "\\u")
+                {
+                    inout_pos += 2;
+                    uint32_t lowSurrogate = 0;
+
+                    if (!ReadJsonHex4(json, inout_pos, lowSurrogate))
+                    {
+                        return false;
+                    }
+
+                    codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+                }
+
+                AppendUtf8(out_text, codePoint);
+                break;
+            }
+        default: return false;
+        }
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------------------------
+bool WriteTextFile(std::string const& path, std::string const& text)
+{
+    std::filesystem::path const filePath(path);
+
+    if (filePath.has_parent_path())
+    {
+        std::error_code errorCode;
+        std::filesystem::create_directories(filePath.parent_path(), errorCode);
+    }
+
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    file << text;
+    return static_cast<bool>(file);
+}
+
+//-----------------------------------------------------------------------------------------------
+double GetMedian(std::vector<double> values)
+{
+    if (values.empty())
+    {
+        return 0.0;
+    }
+
+    size_t const middle = values.size() / 2;
+    std::nth_element(values.begin(), values.begin() + middle, values.end());
+
+    if (values.size() % 2 == 1)
+    {
+        return values[middle];
+    }
+
+    double const upper = values[middle];
+    double const lower = *std::max_element(values.begin(), values.begin() + middle);
+
+    return (lower + upper) * 0.5;
 }
@@ -4,6 +4,10 @@
 
 //----------------------------------------------------------------------------------------------------
 #pragma once
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
 
 //-Forward-Declaration--------------------------------------------------------------------------------
 struct Rgba8;
@@ -11,20 +15,32 @@ struct Vec2;
 class App;
 class AudioSystem;
 class BitmapFont;
+class ConsoleScrollback;
+class CountingRenderer;
+class EventBus;
 class Game;
+class GameConfig;
+class InputEventQueue;
 class RandomNumberGenerator;
 class Renderer;
 class ResourceSubsystem;
+class TextLayoutCache;
 class V8Subsystem;
 
 // one-time declaration
 extern App*                   g_app;
 extern AudioSystem*           g_audio;
 extern BitmapFont*            g_bitmapFont;
+extern ConsoleScrollback*     g_consoleScrollback;
+extern CountingRenderer*      g_countingRenderer;
+extern EventBus*              g_eventBus;
 extern Game*                  g_game;
+extern GameConfig*            g_gameConfig;
+extern InputEventQueue*       g_inputEventQueue;
 extern RandomNumberGenerator* g_rng;
 extern Renderer*              g_renderer;
 extern ResourceSubsystem*     g_resourceSubsystem;
+extern TextLayoutCache*       g_textLayoutCache;
 extern V8Subsystem*           g_v8Subsystem;
 
 //-----------------------------------------------------------------------------------------------
@@ -36,6 +52,22 @@ void DebugDrawGlowCircle(Vec2 const& center, float radius, Rgba8 const& color, f
 void DebugDrawGlowBox(Vec2 const& center, Vec2 const& dimensions, Rgba8 const& color, float glowIntensity);
 void DebugDrawBoxRing(Vec2 const& center, float radius, float thickness, Rgba8 const& color);
 
+//-----------------------------------------------------------------------------------------------
+// Command-line helpers ("-name=value" switches passed to WinMain)
+//
+bool FindCommandLineUInt(std::string const& commandLine, std::string const& name, uint32_t& out_value);
+bool FindCommandLineFloat(std::string const& commandLine, std::string const& name, float& out_value);
+bool FindCommandLineString(std::string const& commandLine, std::string const& name, std::string& out_value);
+
+//-----------------------------------------------------------------------------------------------
+// JSON and report helpers (headless tools, the script bridge)
+//
+std::string EscapeJsonString(std::string_view text);                                        // Contents of a JSON / JS string literal, quotes not included
+void        AppendJsonString(std::string& out_json, std::string_view text);                 // Quoted and escaped
+bool        ReadJsonString(std::string_view json, size_t& inout_pos, std::string& out_text);  // From the opening quote to just past the closing one
+bool        WriteTextFile(std::string const& path, std::string const& text);                // Creates the parent directories
+double      GetMedian(std::vector<double> values);                                          // 0 when empty
+
 //----------------------------------------------------------------------------------------------------
 template <typename T>
 void GAME_SAFE_RELEASE(T*& pointer)
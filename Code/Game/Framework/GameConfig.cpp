@@ -0,0 +1,512 @@
+//----------------------------------------------------------------------------------------------------
+// GameConfig.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/GameConfig.hpp"
+
+#include <cctype>
+#include <charconv>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string_view>
+#include <type_traits>
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/LogSubsystem.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Game/Framework/StringTable.hpp"
+
+//----------------------------------------------------------------------------------------------------
+uint32_t constexpr GAME_CONFIG_CACHE_MAGIC   = 0x47464347;      // "GCFG"
+uint32_t constexpr GAME_CONFIG_CACHE_VERSION = 1;
+
+//----------------------------------------------------------------------------------------------------
+struct sGameConfigCacheHeader
+{
+    uint32_t m_magic           = GAME_CONFIG_CACHE_MAGIC;
+    uint32_t m_version         = GAME_CONFIG_CACHE_VERSION;
+    uint32_t m_schemaHash      = 0;
+    uint32_t m_payloadBytes    = 0;
+    int64_t  m_sourceWriteTime = 0;
+    uint64_t m_sourceSize      = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Types, names and defaults all feed the hash, so any edit to GAME_CONFIG_FIELDS invalidates old caches
+// (a cached default for an element missing from the XML would otherwise outlive a code change).
+//
+static constexpr uint32_t ComputeSchemaHash()
+{
+    uint32_t hash = HashStringID("GameConfig");
+
+#define GAME_CONFIG_SCHEMA(type, member, name, defaultValue, isHotReloadable) \
+    hash = hash * 31u + HashStringID(#type " " name " " #defaultValue " " #isHotReloadable);
+    GAME_CONFIG_FIELDS(GAME_CONFIG_SCHEMA)
+#undef GAME_CONFIG_SCHEMA
+
+    return hash;
+}
+
+//----------------------------------------------------------------------------------------------------
+static std::string_view TrimWhitespace(std::string_view text)
+{
+    while (!text.empty() && std::isspace(static_cast<unsigned char>(text.front()))) text.remove_prefix(1);
+    while (!text.empty() && std::isspace(static_cast<unsigned char>(text.back()))) text.remove_suffix(1);
+
+    return text;
+}
+
+//----------------------------------------------------------------------------------------------------
+static bool ParseValue(std::string_view const text, bool& out_value)
+{
+    if (text == "true" || text == "1") { out_value = true; return true; }
+    if (text == "false" || text == "0") { out_value = false; return true; }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------------------------------
+static bool ParseValue(std::string_view const text, uint32_t& out_value)
+{
+    auto const [end, errorCode] = std::from_chars(text.data(), text.data() + text.size(), out_value);
+
+    return errorCode == std::errc() && end == text.data() + text.size();
+}
+
+//----------------------------------------------------------------------------------------------------
+static bool ParseValue(std::string_view const text, float& out_value)
+{
+    std::string const terminated(text);
+    char*             end = nullptr;
+
+    out_value = std::strtof(terminated.c_str(), &end);
+
+    return !terminated.empty() && end == terminated.c_str() + terminated.size();
+}
+
+//----------------------------------------------------------------------------------------------------
+static bool ParseValue(std::string_view const text, std::string& out_value)
+{
+    out_value = text;
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+static void WriteValue(std::vector<uint8_t>& bytes, bool const value)
+{
+    bytes.push_back(value ? 1 : 0);
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+static void WriteValue(std::vector<uint8_t>& bytes, T const& value)
+{
+    if constexpr (std::is_same_v<T, std::string>)
+    {
+        WriteValue(bytes, static_cast<uint32_t>(value.size()));
+        bytes.insert(bytes.end(), value.begin(), value.end());
+    }
+    else
+    {
+        uint8_t const* const source = reinterpret_cast<uint8_t const*>(&value);
+        bytes.insert(bytes.end(), source, source + sizeof(T));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+static bool ReadValue(std::vector<uint8_t> const& bytes, size_t& cursor, bool& out_value)
+{
+    if (cursor + 1 > bytes.size()) return false;
+
+    out_value = bytes[cursor++] != 0;
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename T>
+static bool ReadValue(std::vector<uint8_t> const& bytes, size_t& cursor, T& out_value)
+{
+    if constexpr (std::is_same_v<T, std::string>)
+    {
+        uint32_t length = 0;
+
+        if (!ReadValue(bytes, cursor, length) || cursor + length > bytes.size()) return false;
+
+        out_value.assign(reinterpret_cast<char const*>(&bytes[cursor]), length);
+        cursor += length;
+    }
+    else
+    {
+        if (cursor + sizeof(T) > bytes.size()) return false;
+
+        std::memcpy(&out_value, &bytes[cursor], sizeof(T));
+        cursor += sizeof(T);
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+GameConfig::GameConfig(sGameConfigSettings const& settings)
+    : m_settings(settings)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+// Runs before the LogSubsystem exists, so problems go to the debugger output.
+//
+bool GameConfig::Load()
+{
+    sSourceStamp stamp;
+
+    if (!GetSourceStamp(stamp))
+    {
+        DebuggerPrintf("(GameConfig::Load)(%s not found, using defaults)\n", m_settings.m_sourcePath.c_str());
+        return false;
+    }
+
+    m_loadedStamp = stamp;
+
+    sGameConfig config;
+
+    if (ReadCache(stamp, config))
+    {
+        m_config             = config;
+        m_wasLoadedFromCache = true;
+        return true;
+    }
+
+    if (!ParseSource(config))
+    {
+        return false;
+    }
+
+    WriteCache(stamp, config);
+
+    m_config             = config;
+    m_wasLoadedFromCache = false;
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Only a stat per poll; the file is read again only when its write time or size moved.
+//
+bool GameConfig::ReloadIfChanged(float const deltaSeconds)
+{
+    m_pollSeconds += deltaSeconds;
+
+    if (m_pollSeconds < m_config.m_configPollSeconds)
+    {
+        return false;
+    }
+
+    m_pollSeconds = 0.f;
+
+    sSourceStamp stamp;
+
+    if (!GetSourceStamp(stamp) || stamp == m_loadedStamp)
+    {
+        return false;
+    }
+
+    // Remembered even when the parse fails, so a broken edit is reported once rather than every poll.
+    m_loadedStamp = stamp;
+
+    sGameConfig reloaded;
+
+    if (!ParseSource(reloaded))
+    {
+        DAEMON_LOG(LogGame, eLogVerbosity::Error, StringFormat("(GameConfig::ReloadIfChanged)({} is invalid, keeping current settings)", m_settings.m_sourcePath));
+        return false;
+    }
+
+    WriteCache(stamp, reloaded);
+
+    bool        hasHotChange = false;
+    std::string restartNames;
+
+#define GAME_CONFIG_APPLY(type, member, name, defaultValue, isHotReloadable) \
+    if (!(reloaded.member == m_config.member))                              \
+    {                                                                       \
+        if constexpr (isHotReloadable)                                      \
+        {                                                                   \
+            m_config.member = reloaded.member;                              \
+            hasHotChange    = true;                                         \
+        }                                                                   \
+        else                                                                \
+        {                                                                   \
+            restartNames += restartNames.empty() ? name : ", " name;        \
+        }                                                                   \
+    }
+    GAME_CONFIG_FIELDS(GAME_CONFIG_APPLY)
+#undef GAME_CONFIG_APPLY
+
+    if (!restartNames.empty())
+    {
+        DAEMON_LOG(LogGame, eLogVerbosity::Warning, StringFormat("(GameConfig::ReloadIfChanged)({} changed; takes effect after restart)", restartNames));
+    }
+
+    DAEMON_LOG(LogGame, eLogVerbosity::Log, StringFormat("(GameConfig::ReloadIfChanged)({} reloaded, tunables {})", m_settings.m_sourcePath, hasHotChange ? "applied" : "unchanged"));
+
+    return hasHotChange;
+}
+
+//----------------------------------------------------------------------------------------------------
+std::string GameConfig::GetProjectRoot() const
+{
+    std::string root = m_config.m_projectRoot;
+
+    if (root.empty())
+    {
+        std::error_code errorCode;
+        root = std::filesystem::current_path(errorCode).parent_path().generic_string();
+    }
+
+    if (!root.empty() && root.back() != '/' && root.back() != '\\')
+    {
+        root += '/';
+    }
+
+    return root;
+}
+
+//----------------------------------------------------------------------------------------------------
+// The file is a flat list of <element>value</element> under <GameConfig>; comments are skipped and a
+// self-closing <element/> is an empty value. Elements not in GAME_CONFIG_FIELDS are an error, so a
+// misspelled setting is not silently ignored. Settings left out keep their defaults.
+//
+STATIC bool GameConfig::ParseText(std::string const& text,
+                                  sGameConfig&       out_config,
+                                  std::string&       out_error)
+{
+    sGameConfig            config;
+    std::string_view const document = text;
+    size_t                 cursor   = 0;
+
+    while ((cursor = document.find('<', cursor)) != std::string_view::npos)
+    {
+        if (document.substr(cursor, 4) == "<!--")
+        {
+            size_t const commentEnd = document.find("-->", cursor + 4);
+            cursor                  = commentEnd != std::string_view::npos ? commentEnd + 3 : document.size();
+            continue;
+        }
+
+        size_t const tagEnd = document.find('>', cursor);
+
+        if (tagEnd == std::string_view::npos)
+        {
+            out_error = "unterminated element";
+            return false;
+        }
+
+        std::string_view elementName   = document.substr(cursor + 1, tagEnd - cursor - 1);
+        bool const       isSelfClosing = !elementName.empty() && elementName.back() == '/';
+        cursor                         = tagEnd + 1;
+
+        if (isSelfClosing)
+        {
+            elementName = TrimWhitespace(elementName.substr(0, elementName.size() - 1));
+        }
+
+        if (elementName.empty() || elementName.front() == '/' || elementName.front() == '?' || elementName == "GameConfig")
+        {
+            continue;
+        }
+
+        std::string_view value;
+
+        if (!isSelfClosing)
+        {
+            std::string const closingTag = "</" + std::string(elementName) + ">";
+            size_t const      valueEnd   = document.find(closingTag, cursor);
+
+            if (valueEnd == std::string_view::npos)
+            {
+                out_error = Stringf("<%s> is not closed", std::string(elementName).c_str());
+                return false;
+            }
+
+            value  = TrimWhitespace(document.substr(cursor, valueEnd - cursor));
+            cursor = valueEnd + closingTag.size();
+        }
+
+        bool isKnown = false;
+        bool isValid = false;
+
+#define GAME_CONFIG_PARSE(type, member, name, defaultValue, isHotReloadable) \
+    if (!isKnown && elementName == name)                                    \
+    {                                                                       \
+        isKnown = true;                                                     \
+        isValid = ParseValue(value, config.member);                         \
+    }
+        GAME_CONFIG_FIELDS(GAME_CONFIG_PARSE)
+#undef GAME_CONFIG_PARSE
+
+        if (!isKnown)
+        {
+            out_error = Stringf("unknown setting <%s>", std::string(elementName).c_str());
+            return false;
+        }
+
+        if (!isValid)
+        {
+            out_error = Stringf("<%s> has an invalid value \"%s\"", std::string(elementName).c_str(), std::string(value).c_str());
+            return false;
+        }
+    }
+
+    out_config = config;
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC void GameConfig::WriteBinary(sGameConfig const&    config,
+                                    std::vector<uint8_t>& out_bytes)
+{
+#define GAME_CONFIG_WRITE(type, member, name, defaultValue, isHotReloadable) WriteValue(out_bytes, config.member);
+    GAME_CONFIG_FIELDS(GAME_CONFIG_WRITE)
+#undef GAME_CONFIG_WRITE
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC bool GameConfig::ReadBinary(std::vector<uint8_t> const& bytes,
+                                   sGameConfig&                out_config)
+{
+    sGameConfig config;
+    size_t      cursor = 0;
+
+#define GAME_CONFIG_READ(type, member, name, defaultValue, isHotReloadable) \
+    if (!ReadValue(bytes, cursor, config.member)) return false;
+    GAME_CONFIG_FIELDS(GAME_CONFIG_READ)
+#undef GAME_CONFIG_READ
+
+    if (cursor != bytes.size())
+    {
+        return false;
+    }
+
+    out_config = config;
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC uint32_t GameConfig::GetSchemaHash()
+{
+    static uint32_t constexpr SCHEMA_HASH = ComputeSchemaHash();
+    return SCHEMA_HASH;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool GameConfig::GetSourceStamp(sSourceStamp& out_stamp) const
+{
+    std::error_code                       errorCode;
+    std::filesystem::file_time_type const writeTime = std::filesystem::last_write_time(m_settings.m_sourcePath, errorCode);
+
+    if (errorCode)
+    {
+        return false;
+    }
+
+    uintmax_t const size = std::filesystem::file_size(m_settings.m_sourcePath, errorCode);
+
+    if (errorCode)
+    {
+        return false;
+    }
+
+    out_stamp.m_writeTime = static_cast<int64_t>(writeTime.time_since_epoch().count());
+    out_stamp.m_size      = static_cast<uint64_t>(size);
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool GameConfig::ParseSource(sGameConfig& out_config) const
+{
+    std::ifstream file(m_settings.m_sourcePath);
+
+    if (!file.is_open())
+    {
+        DebuggerPrintf("(GameConfig::ParseSource)(cannot open %s)\n", m_settings.m_sourcePath.c_str());
+        return false;
+    }
+
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+
+    std::string error;
+
+    if (!ParseText(buffer.str(), out_config, error))
+    {
+        DebuggerPrintf("(GameConfig::ParseSource)(%s: %s)\n", m_settings.m_sourcePath.c_str(), error.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool GameConfig::ReadCache(sSourceStamp const& stamp,
+                           sGameConfig&        out_config) const
+{
+    std::ifstream file(m_settings.m_cachePath, std::ios::binary);
+
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    sGameConfigCacheHeader header;
+
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) || header.m_magic != GAME_CONFIG_CACHE_MAGIC ||
+        header.m_version != GAME_CONFIG_CACHE_VERSION || header.m_schemaHash != GetSchemaHash() ||
+        header.m_sourceWriteTime != stamp.m_writeTime || header.m_sourceSize != stamp.m_size)
+    {
+        return false;
+    }
+
+    std::vector<uint8_t> payload(header.m_payloadBytes);
+
+    if (!file.read(reinterpret_cast<char*>(payload.data()), static_cast<std::streamsize>(payload.size())))
+    {
+        return false;
+    }
+
+    return ReadBinary(payload, out_config);
+}
+
+//----------------------------------------------------------------------------------------------------
+// A failed write only costs the next startup a parse.
+//
+void GameConfig::WriteCache(sSourceStamp const& stamp,
+                            sGameConfig const&  config) const
+{
+    std::vector<uint8_t> payload;
+    WriteBinary(config, payload);
+
+    sGameConfigCacheHeader header;
+    header.m_schemaHash      = GetSchemaHash();
+    header.m_payloadBytes    = static_cast<uint32_t>(payload.size());
+    header.m_sourceWriteTime = stamp.m_writeTime;
+    header.m_sourceSize      = stamp.m_size;
+
+    std::filesystem::path const cachePath(m_settings.m_cachePath);
+    std::error_code             errorCode;
+
+    if (cachePath.has_parent_path())
+    {
+        std::filesystem::create_directories(cachePath.parent_path(), errorCode);
+    }
+
+    std::ofstream file(cachePath, std::ios::binary | std::ios::trunc);
+
+    if (file.is_open())
+    {
+        file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+        file.write(reinterpret_cast<char const*>(payload.data()), static_cast<std::streamsize>(payload.size()));
+    }
+}
@@ -0,0 +1,112 @@
+//----------------------------------------------------------------------------------------------------
+// GameConfig.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+// Every setting in Data/GameConfig.xml: X(type, member, element name, default, hot reloadable).
+// sGameConfig, the XML parser, the binary cache and the cache's schema hash are all generated from this
+// table, so adding a setting is one line here and one element in the XML.
+//----------------------------------------------------------------------------------------------------
+#define GAME_CONFIG_FIELDS(X)                                                                                              \
+    /* Window */                                                                                                           \
+    X(bool,        m_windowClose,                   "WindowClose",                   false,              false)            \
+    X(uint32_t,    m_screenSizeX,                   "screenSizeX",                   1600,               false)            \
+    X(uint32_t,    m_screenSizeY,                   "screenSizeY",                   800,                false)            \
+    X(uint32_t,    m_screenCenterX,                 "screenCenterX",                 800,                false)            \
+    X(uint32_t,    m_screenCenterY,                 "screenCenterY",                 400,                false)            \
+    /* Paths (empty project root = parent of the working directory, which is Run/) */                                      \
+    X(std::string, m_projectRoot,                   "projectRoot",                   "",                 false)            \
+    /* V8 */                                                                                                               \
+    X(uint32_t,    m_v8HeapSizeLimit,               "v8HeapSizeLimit",               256,                false)            \
+    X(bool,        m_v8EnableDebugging,             "v8EnableDebugging",             true,               false)            \
+    X(bool,        m_v8EnableInspector,             "v8EnableInspector",             true,               false)            \
+    X(uint32_t,    m_v8InspectorPort,               "v8InspectorPort",               9229,               false)            \
+    X(std::string, m_v8InspectorHost,               "v8InspectorHost",               "127.0.0.1",        false)            \
+    X(bool,        m_v8WaitForDebugger,             "v8WaitForDebugger",             false,              false)            \
+    /* Threads (the worker pool is resized between frames; resource threads are fixed at startup) */                       \
+    X(uint32_t,    m_resourceThreadCount,           "resourceThreadCount",           4,                  false)            \
+    X(uint32_t,    m_workerThreadCount,             "workerThreadCount",             0,                  true)             \
+    /* Log */                                                                                                              \
+    X(std::string, m_logFilePath,                   "logFilePath",                   "Logs/FirstV8.log", false)            \
+    X(bool,        m_logAsync,                      "logAsync",                      true,               false)            \
+    X(uint32_t,    m_logMaxEntries,                 "logMaxEntries",                 50000,              false)            \
+    X(bool,        m_logAutoFlush,                  "logAutoFlush",                  false,              false)            \
+    X(bool,        m_logMirrorToConsole,            "logMirrorToConsole",            false,              false)            \
+    /* Tunables, applied while running when the file changes */                                                            \
+    X(uint32_t,    m_audioMaxRealVoices,            "audioMaxRealVoices",            32,                 true)             \
+    X(float,       m_audioMinAudibility,            "audioMinAudibility",            0.001f,             true)             \
+    X(float,       m_configPollSeconds,             "configPollSeconds",             1.f,                true)             \
+    /* Frame budgets, also applied while running */                                                                        \
+    X(float,       m_asyncBudgetMilliseconds,       "asyncBudgetMilliseconds",       2.f,                true)             \
+    X(uint32_t,    m_asyncCompletionsPerCheckpoint, "asyncCompletionsPerCheckpoint", 16,                 true)             \
+    X(uint32_t,    m_asyncMaxCheckpointsPerFrame,   "asyncMaxCheckpointsPerFrame",   0,                  true)             \
+    X(uint32_t,    m_occlusionBufferWidth,          "occlusionBufferWidth",          256,                true)             \
+    X(uint32_t,    m_occlusionBufferHeight,         "occlusionBufferHeight",         128,                true)             \
+    X(float,       m_lodDetailScale,                "lodDetailScale",                1.f,                true)
+
+//----------------------------------------------------------------------------------------------------
+struct sGameConfig
+{
+#define GAME_CONFIG_MEMBER(type, member, name, defaultValue, isHotReloadable) type member = defaultValue;
+    GAME_CONFIG_FIELDS(GAME_CONFIG_MEMBER)
+#undef GAME_CONFIG_MEMBER
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sGameConfigSettings
+{
+    std::string m_sourcePath = "Data/GameConfig.xml";
+    std::string m_cachePath  = "Cache/GameConfig.bin";      // Rebuilt whenever the source or the schema changes
+};
+
+//----------------------------------------------------------------------------------------------------
+// Typed game configuration. Load() reads the binary cache when it was built from the current source file
+// (same write time and size) and the current field table, and otherwise parses the XML once and rewrites
+// the cache; either way game code reads plain struct members through Get(), never names.
+//
+// ReloadIfChanged() is polled from the main loop. A changed file is reparsed; hot reloadable fields take
+// effect at once and the rest are kept until restart (and logged as such).
+//----------------------------------------------------------------------------------------------------
+class GameConfig
+{
+public:
+    explicit GameConfig(sGameConfigSettings const& settings);
+
+    bool Load();                                  // false (defaults) if the source is missing or invalid
+    bool ReloadIfChanged(float deltaSeconds);     // true when hot reloadable fields changed
+
+    sGameConfig const& Get() const { return m_config; }
+    bool               WasLoadedFromCache() const { return m_wasLoadedFromCache; }
+    std::string        GetProjectRoot() const;      // Resolved, with a trailing slash
+
+    static bool     ParseText(std::string const& text, sGameConfig& out_config, std::string& out_error);
+    static void     WriteBinary(sGameConfig const& config, std::vector<uint8_t>& out_bytes);
+    static bool     ReadBinary(std::vector<uint8_t> const& bytes, sGameConfig& out_config);
+    static uint32_t GetSchemaHash();
+
+private:
+    struct sSourceStamp
+    {
+        int64_t  m_writeTime = 0;
+        uint64_t m_size      = 0;
+
+        bool operator==(sSourceStamp const&) const = default;
+    };
+
+    bool GetSourceStamp(sSourceStamp& out_stamp) const;
+    bool ParseSource(sGameConfig& out_config) const;
+    bool ReadCache(sSourceStamp const& stamp, sGameConfig& out_config) const;
+    void WriteCache(sSourceStamp const& stamp, sGameConfig const& config) const;
+
+    sGameConfigSettings m_settings;
+    sGameConfig         m_config;
+    sSourceStamp        m_loadedStamp;
+    bool                m_wasLoadedFromCache = false;
+    float               m_pollSeconds        = 0.f;
+};
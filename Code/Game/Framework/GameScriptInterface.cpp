@@ -6,7 +6,9 @@
 //----------------------------------------------------------------------------------------------------
 #include "Game/Framework/GameScriptInterface.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <filesystem>
 #include <iostream>
 #include <sstream>
@@ -21,7 +23,89 @@
 #include "Engine/Scripting/V8Subsystem.hpp"
 #include "Game/Game.hpp"
 #include "Game/Player.hpp"
+#include "Game/Framework/ActionMap.hpp"
+#include "Game/Framework/CountingRenderer.hpp"
+#include "Game/Framework/EventBus.hpp"
+#include "Game/Framework/GameConfig.hpp"
 #include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/InputEventQueue.hpp"
+#include "Game/Framework/StringTable.hpp"
+#include "Game/Subsystem/Audio/AudioVoicePool.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// Every name CallMethod() and GetProperty() switch on: X(name, method) and X(name, value). The case labels
+// and the names interned up front both come from these lists, so each name keeps the ID of its case label
+// and an unknown name from JS is never mistaken for one of them.
+//
+#define SCRIPT_METHODS(X)                                     \
+    X("createCube",            ExecuteCreateCube)             \
+    X("moveProp",              ExecuteMoveProp)               \
+    X("getPlayerPosition",     ExecuteGetPlayerPosition)      \
+    X("movePlayerCamera",      ExecuteMovePlayerCamera)       \
+    X("update",                ExecuteUpdate)                 \
+    X("render",                ExecuteRender)                 \
+    X("executeCommand",        ExecuteJavaScriptCommand)      \
+    X("executeFile",           ExecuteJavaScriptFile)         \
+    X("isAttractMode",         ExecuteIsAttractMode)          \
+    X("getGameState",          ExecuteGetGameState)           \
+    X("getFileTimestamp",      ExecuteGetFileTimestamp)       \
+    X("saveSnapshot",          ExecuteSaveSnapshot)           \
+    X("loadSnapshot",          ExecuteLoadSnapshot)           \
+    X("setFastForward",        ExecuteSetFastForward)         \
+    X("getFastForwardStats",   ExecuteGetFastForwardStats)    \
+    X("setOcclusionCulling",   ExecuteSetOcclusionCulling)    \
+    X("getRenderStats",        ExecuteGetRenderStats)         \
+    X("submitAudioCommands",   ExecuteSubmitAudioCommands)    \
+    X("getAudioStats",         ExecuteGetAudioStats)          \
+    X("getInputStats",         ExecuteGetInputStats)          \
+    X("getActionState",        ExecuteGetActionState)         \
+    X("getActionNames",        ExecuteGetActionNames)         \
+    X("enableHotReload",       ExecuteEnableHotReload)        \
+    X("disableHotReload",      ExecuteDisableHotReload)       \
+    X("isHotReloadEnabled",    ExecuteIsHotReloadEnabled)     \
+    X("addWatchedFile",        ExecuteAddWatchedFile)         \
+    X("removeWatchedFile",     ExecuteRemoveWatchedFile)      \
+    X("getWatchedFiles",       ExecuteGetWatchedFiles)        \
+    X("reloadScript",          ExecuteReloadScript)           \
+    X("recordStressStep",      ExecuteRecordStressStep)       \
+    X("finishStressScenario",  ExecuteFinishStressScenario)   \
+    X("subscribeEvent",        ExecuteSubscribeEvent)         \
+    X("unsubscribeEvent",      ExecuteUnsubscribeEvent)       \
+    X("readFileAsync",         ExecuteReadFileAsync)          \
+    X("getFileTimestampAsync", ExecuteGetFileTimestampAsync)  \
+    X("executeFileAsync",      ExecuteJavaScriptFileAsync)    \
+    X("getAsyncStats",         ExecuteGetAsyncStats)
+
+#define SCRIPT_PROPERTIES(X)                                                  \
+    X("attractMode",           m_game->IsAttractMode())                       \
+    X("gameState",             m_game->IsAttractMode() ? "attract" : "game")
+
+//----------------------------------------------------------------------------------------------------
+static char const* const SCRIPT_DISPATCH_NAMES[] = {
+#define SCRIPT_DISPATCH_NAME(name, target) name,
+    SCRIPT_METHODS(SCRIPT_DISPATCH_NAME)
+    SCRIPT_PROPERTIES(SCRIPT_DISPATCH_NAME)
+#undef SCRIPT_DISPATCH_NAME
+};
+
+//----------------------------------------------------------------------------------------------------
+// A double as a JS literal. %.17g round-trips every finite value but prints nan and inf, which JS reads
+// as unknown identifiers.
+//
+static std::string FormatScriptNumber(double const number)
+{
+    if (std::isnan(number))
+    {
+        return "NaN";
+    }
+
+    if (std::isinf(number))
+    {
+        return number > 0.0 ? "Infinity" : "-Infinity";
+    }
+
+    return Stringf("%.17g", number);
+}
 
 //----------------------------------------------------------------------------------------------------
 GameScriptInterface::GameScriptInterface(Game* game)
@@ -33,12 +117,28 @@ GameScriptInterface::GameScriptInterface(Game* game)
     {
         ERROR_AND_DIE("GameScriptInterface: Game pointer cannot be null")
     }
+
+    for (char const* const name : SCRIPT_DISPATCH_NAMES)
+    {
+        if (StringTable::Intern(name) != HashStringID(name))
+        {
+            ERROR_AND_DIE(Stringf("GameScriptInterface: '%s' collides with another interned string; rename it", name))
+        }
+    }
 }
 
 //----------------------------------------------------------------------------------------------------
 GameScriptInterface::~GameScriptInterface()
 {
     ShutdownHotReload();
+
+    if (g_eventBus != nullptr)
+    {
+        for (auto const& [eventID, handle] : m_scriptSubscriptions)
+        {
+            g_eventBus->Unsubscribe(handle);
+        }
+    }
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -103,7 +203,102 @@ std::vector<ScriptMethodInfo> GameScriptInterface::GetAvailableMethods() const
         ScriptMethodInfo("getFileTimestamp",
                          "取得檔案的最後修改時間戳記",
                          {"string"},
-                         "number")
+                         "number"),
+
+        ScriptMethodInfo("saveSnapshot",
+                         "非同步儲存世界快照（可選檔案路徑）",
+                         {"string"},
+                         "bool"),
+
+        ScriptMethodInfo("loadSnapshot",
+                         "載入世界快照（可選檔案路徑）",
+                         {"string"},
+                         "bool"),
+
+        ScriptMethodInfo("setFastForward",
+                         "開關快轉模式（每 N 步渲染一次，可選固定時間步長）",
+                         {"bool", "int", "float"},
+                         "string"),
+
+        ScriptMethodInfo("getFastForwardStats",
+                         "取得快轉統計（模擬秒數 / 實際秒數）",
+                         {},
+                         "object"),
+
+        ScriptMethodInfo("setOcclusionCulling",
+                         "開關軟體遮擋剔除",
+                         {"bool"},
+                         "string"),
+
+        ScriptMethodInfo("getRenderStats",
+                         "取得渲染統計（繪製呼叫、頂點、狀態切換、上傳位元組）",
+                         {},
+                         "object"),
+
+        ScriptMethodInfo("submitAudioCommands",
+                         "批次執行音效指令（play/stop/stopAll/volume/move，以換行或分號分隔）",
+                         {"string"},
+                         "object"),
+
+        ScriptMethodInfo("getAudioStats",
+                         "取得音效語音池統計（實體/虛擬語音數量）",
+                         {},
+                         "object"),
+
+        ScriptMethodInfo("getInputStats",
+                         "取得輸入事件延遲統計（事件到模擬步驟的毫秒數）",
+                         {},
+                         "object"),
+
+        ScriptMethodInfo("getActionState",
+                         "一次取得所有動作狀態 [按住位元, 按下位元, 放開位元, 類比軸...]",
+                         {},
+                         "object"),
+
+        ScriptMethodInfo("getActionNames",
+                         "取得動作與類比軸名稱（索引對應 getActionState 的位元與軸）",
+                         {},
+                         "object"),
+
+        ScriptMethodInfo("recordStressStep",
+                         "壓力測試：回報本階段實體數、新建數與 createCube 總耗時（毫秒），開始量測",
+                         {"int", "int", "float"},
+                         "string"),
+
+        ScriptMethodInfo("finishStressScenario",
+                         "壓力測試：結束並寫出擴展曲線（JSON / CSV）",
+                         {},
+                         "string"),
+
+        ScriptMethodInfo("subscribeEvent",
+                         "訂閱事件匯流排上的事件，每幀批次送到 JSEngine.dispatchEvents()",
+                         {"string"},
+                         "string"),
+
+        ScriptMethodInfo("unsubscribeEvent",
+                         "取消訂閱事件匯流排上的事件",
+                         {"string"},
+                         "string"),
+
+        ScriptMethodInfo("readFileAsync",
+                         "在背景執行緒讀取檔案，回傳請求 ID（由 JSEngine.readFileAsync() 包裝成 Promise）",
+                         {"string"},
+                         "number"),
+
+        ScriptMethodInfo("getFileTimestampAsync",
+                         "在背景執行緒取得檔案時間戳記，回傳請求 ID",
+                         {"string"},
+                         "number"),
+
+        ScriptMethodInfo("executeFileAsync",
+                         "在背景執行緒讀取 JavaScript 檔案，於主執行緒執行，回傳請求 ID",
+                         {"string"},
+                         "number"),
+
+        ScriptMethodInfo("getAsyncStats",
+                         "取得非同步橋接統計（進行中請求、每幀檢查點與耗時）",
+                         {},
+                         "object")
     };
 }
 
@@ -111,8 +306,9 @@ std::vector<ScriptMethodInfo> GameScriptInterface::GetAvailableMethods() const
 std::vector<std::string> GameScriptInterface::GetAvailableProperties() const
 {
     return {
-        "attractMode",
-        "gameState"
+#define SCRIPT_PROPERTY_NAME(name, value) name,
+        SCRIPT_PROPERTIES(SCRIPT_PROPERTY_NAME)
+#undef SCRIPT_PROPERTY_NAME
     };
 }
 
@@ -122,77 +318,14 @@ ScriptMethodResult GameScriptInterface::CallMethod(std::string const&
 {
     try
     {
-        if (methodName == "createCube")
+        // Unknown names are not interned, so they fall through to the error instead of matching a hash.
+        switch (StringTable::Find(methodName))
         {
-            return ExecuteCreateCube(args);
-        }
-        else if (methodName == "moveProp")
-        {
-            return ExecuteMoveProp(args);
-        }
-        else if (methodName == "getPlayerPosition")
-        {
-            return ExecuteGetPlayerPosition(args);
-        }
-        else if (methodName == "movePlayerCamera")
-        {
-            return ExecuteMovePlayerCamera(args);
-        }
-        else if (methodName == "update")
-        {
-            return ExecuteUpdate(args);
-        }
-        else if (methodName == "render")
-        {
-            return ExecuteRender(args);
-        }
-        else if (methodName == "executeCommand")
-        {
-            return ExecuteJavaScriptCommand(args);
-        }
-        else if (methodName == "executeFile")
-        {
-            return ExecuteJavaScriptFile(args);
-        }
-        else if (methodName == "isAttractMode")
-        {
-            return ExecuteIsAttractMode(args);
-        }
-        else if (methodName == "getGameState")
-        {
-            return ExecuteGetGameState(args);
-        }
-        else if (methodName == "getFileTimestamp")
-        {
-            return ExecuteGetFileTimestamp(args);
-        }
-        else if (methodName == "enableHotReload")
-        {
-            return ExecuteEnableHotReload(args);
-        }
-        else if (methodName == "disableHotReload")
-        {
-            return ExecuteDisableHotReload(args);
-        }
-        else if (methodName == "isHotReloadEnabled")
-        {
-            return ExecuteIsHotReloadEnabled(args);
-        }
-        else if (methodName == "addWatchedFile")
-        {
-            return ExecuteAddWatchedFile(args);
-        }
-        else if (methodName == "removeWatchedFile")
-        {
-            return ExecuteRemoveWatchedFile(args);
-        }
-        else if (methodName == "getWatchedFiles")
-        {
-            return ExecuteGetWatchedFiles(args);
-        }
-        else if (methodName == "reloadScript")
-        {
-            return ExecuteReloadScript(args);
+#define SCRIPT_METHOD_CASE(name, method) \
+        case HashStringID(name): return method(args);
+        SCRIPT_METHODS(SCRIPT_METHOD_CASE)
+#undef SCRIPT_METHOD_CASE
+        default: break;
         }
 
         return ScriptMethodResult::Error("未知的方法: " + methodName);
@@ -206,13 +339,13 @@ ScriptMethodResult GameScriptInterface::CallMethod(std::string const&
 //----------------------------------------------------------------------------------------------------
 std::any GameScriptInterface::GetProperty(const std::string& propertyName) const
 {
-    if (propertyName == "attractMode")
-    {
-        return m_game->IsAttractMode();
-    }
-    else if (propertyName == "gameState")
+    switch (StringTable::Find(propertyName))
     {
-        return m_game->IsAttractMode() ? "attract" : "game";
+#define SCRIPT_PROPERTY_CASE(name, value) \
+    case HashStringID(name): return value;
+    SCRIPT_PROPERTIES(SCRIPT_PROPERTY_CASE)
+#undef SCRIPT_PROPERTY_CASE
+    default: break;
     }
 
     return std::any{};
@@ -431,12 +564,466 @@ ScriptMethodResult GameScriptInterface::ExecuteGetGameState(const std::vector<st
     }
 }
 
+//----------------------------------------------------------------------------------------------------
+ScriptMethodResult GameScriptInterface::ExecuteSaveSnapshot(const std::vector<std::any>& args)
+{
+    auto result = ValidateArgCountRange(args, 0, 1, "saveSnapshot");
+    if (!result.success) return result;
+
+    try
+    {
+        std::string filePath = args.empty() ? "Saves/QuickSave.snapshot" : ExtractString(args[0]);
+        bool        success  = m_game->SaveSnapshot(filePath);
+        return ScriptMethodResult::Success(success);
+    }
+    catch (const std::exception& e)
+    {
+        return ScriptMethodResult::Error("儲存世界快照失敗: " + std::string(e.what()));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+ScriptMethodResult GameScriptInterface::ExecuteLoadSnapshot(const std::vector<std::any>& args)
+{
+    auto result = ValidateArgCountRange(args, 0, 1, "loadSnapshot");
+    if (!result.success) return result;
+
+    try
+    {
+        std::string filePath = args.empty() ? "Saves/QuickSave.snapshot" : ExtractString(args[0]);
+        bool        success  = m_game->LoadSnapshot(filePath);
+        return ScriptMethodResult::Success(success);
+    }
+    catch (const std::exception& e)
+    {
+        return ScriptMethodResult::Error("載入世界快照失敗: " + std::string(e.what()));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+ScriptMethodResult GameScriptInterface::ExecuteSetFastForward(const std::vector<std::any>& args)
+{
+    auto result = ValidateArgCountRange(args, 1, 3, "setFastForward");
+    if (!result.success) return result;
+
+    try
+    {
+        bool               isEnabled = ExtractBool(args[0]);
+        sFastForwardConfig config    = m_game->GetFastForwardConfig();
+
+        if (args.size() > 1) config.m_renderEveryNthFrame = static_cast<uint32_t>(std::max(ExtractInt(args[1]), 0));
+        if (args.size() > 2) config.m_fixedDeltaSeconds = ExtractFloat(args[2]);
+
+        m_game->SetFastForward(isEnabled, config);
+        return ScriptMethodResult::Success(std::string(isEnabled ? "快轉模式已開啟" : "快轉模式已關閉"));
+    }
+    catch (const std::exception& e)
+    {
+        return ScriptMethodResult::Error("設定快轉模式失敗: " + std::string(e.what()));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+ScriptMethodResult GameScriptInterface::ExecuteGetFastForwardStats(const std::vector<std::any>& args)
+{
+    auto result = ValidateArgCount(args, 0, "getFastForwardStats");
+    if (!result.success) return result;
+
+    try
+    {
+        sFastForwardStats const& stats = m_game->GetFastForwardStats();
+
+        std::string statsStr = "{ enabled: " + std::string(m_game->IsFastForwarding() ? "true" : "false") +
+        ", steps: " + std::to_string(stats.m_stepCount) +
+        ", simulatedSeconds: " + std::to_string(stats.m_simulatedSeconds) +
+        ", wallSeconds: " + std::to_string(stats.m_wallSeconds) +
+        ", simSecondsPerWallSecond: " + std::to_string(stats.m_simSecondsPerWallSecond) + " }";
+
+        return ScriptMethodResult::Success(statsStr);
+    }
+    catch (const std::exception& e)
+    {
+        return ScriptMethodResult::Error("取得快轉統計失敗: " + std::string(e.what()));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+ScriptMethodResult GameScriptInterface::ExecuteSetOcclusionCulling(const std::vector<std::any>& args)
+{
+    auto result = ValidateArgCount(args, 1, "setOcclusionCulling");
+    if (!result.success) return result;
+
+    try
+    {
+        bool isEnabled = ExtractBool(args[0]);
+        m_game->SetOcclusionCulling(isEnabled);
+        return ScriptMethodResult::Success(std::string(isEnabled ? "遮擋剔除已開啟" : "遮擋剔除已關閉"));
+    }
+    catch (const std::exception& e)
+    {
+        return ScriptMethodResult::Error("設定遮擋剔除失敗: " + std::string(e.what()));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+ScriptMethodResult GameScriptInterface::ExecuteGetRenderStats(const std::vector<std::any>& args)
+{
+    auto result = ValidateArgCount(args, 0, "getRenderStats");
+    if (!result.success) return result;
+
+    try
+    {
+        return ScriptMethodResult::Success(g_countingRenderer->ToScriptObjectString());
+    }
+    catch (const std::exception& e)
+    {
+        return ScriptMethodResult::Error("取得渲染統計失敗: " + std::string(e.what()));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+ScriptMethodResult GameScriptInterface::ExecuteSubmitAudioCommands(const std::vector<std::any>& args)
+{
+    auto result = ValidateArgCount(args, 1, "submitAudioCommands");
+    if (!result.success) return result;
+
+    try
+    {
+        std::string         commands      = ExtractString(args[0]);
+        sAudioCommandResult commandResult = m_game->GetAudioVoicePool()->ExecuteCommands(commands);
+
+        std::string handlesStr;
+
+        for (AudioVoiceHandle const handle : commandResult.m_playedHandles)
+        {
+            handlesStr += (handlesStr.empty() ? "" : ", ") + std::to_string(handle);
+        }
+
+        std::string resultStr = "{ commands: " + std::to_string(commandResult.m_commandCount) +
+        ", errors: " + std::to_string(commandResult.m_errorCount) +
+        ", handles: [" + handlesStr + "] }";
+
+        return ScriptMethodResult::Success(resultStr);
+    }
+    catch (const std::exception& e)
+    {
+        return ScriptMethodResult::Error("執行音效指令失敗: " + std::string(e.what()));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+ScriptMethodResult GameScriptInterface::ExecuteGetAudioStats(const std::vector<std::any>& args)
+{
+    auto result = ValidateArgCount(args, 0, "getAudioStats");
+    if (!result.success) return result;
+
+    try
+    {
+        sAudioVoicePoolStats const& stats = m_game->GetAudioVoicePool()->GetStats();
+
+        std::string statsStr = "{ activeVoices: " + std::to_string(stats.m_activeVoiceCount) +
+        ", realVoices: " + std::to_string(stats.m_realVoiceCount) +
+        ", realized: " + std::to_string(stats.m_realizeCount) +
+        ", virtualized: " + std::to_string(stats.m_virtualizeCount) +
+        ", evicted: " + std::to_string(stats.m_evictedCount) +
+        ", rejected: " + std::to_string(stats.m_rejectedCount) +
+        ", updateMicroseconds: " + std::to_string(stats.m_updateMicroseconds) + " }";
+
+        return ScriptMethodResult::Success(statsStr);
+    }
+    catch (const std::exception& e)
+    {
+        return ScriptMethodResult::Error("取得音效統計失敗: " + std::string(e.what()));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+ScriptMethodResult GameScriptInterface::ExecuteGetInputStats(const std::vector<std::any>& args)
+{
+    auto result = ValidateArgCount(args, 0, "getInputStats");
+    if (!result.success) return result;
+
+    try
+    {
+        sInputLatencyStats const stats = g_inputEventQueue->GetLatencyStats();
+
+        std::string statsStr = "{ events: " + std::to_string(stats.m_eventCount) +
+        ", dropped: " + std::to_string(stats.m_droppedCount) +
+        ", lastStepEvents: " + std::to_string(stats.m_stepEventCount) +
+        ", averageLatencyMs: " + std::to_string(stats.GetAverageSeconds() * 1000.0) +
+        ", maxLatencyMs: " + std::to_string(stats.m_maxSeconds * 1000.0) +
+        ", lastLatencyMs: " + std::to_string(stats.m_lastSeconds * 1000.0) + " }";
+
+        return ScriptMethodResult::Success(statsStr);
+    }
+    catch (const std::exception& e)
+    {
+        return ScriptMethodResult::Error("取得輸入統計失敗: " + std::string(e.what()));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Every action and axis in one call: bit i of the first three values is action i (see getActionNames).
+//
+ScriptMethodResult GameScriptInterface::ExecuteGetActionState(const std::vector<std::any>& args)
+{
+    auto result = ValidateArgCount(args, 0, "getActionState");
+    if (!result.success) return result;
+
+    try
+    {
+        sActionState const& state = m_game->GetActionMap()->GetState();
+
+        std::string stateStr = "[" + std::to_string(state.m_down) +
+        ", " + std::to_string(state.m_pressed) +
+        ", " + std::to_string(state.m_released);
+
+        for (float const axis : state.m_axes)
+        {
+            stateStr += ", " + std::to_string(axis);
+        }
+
+        stateStr += "]";
+
+        return ScriptMethodResult::Success(stateStr);
+    }
+    catch (const std::exception& e)
+    {
+        return ScriptMethodResult::Error("取得動作狀態失敗: " + std::string(e.what()));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+ScriptMethodResult GameScriptInterface::ExecuteGetActionNames(const std::vector<std::any>& args)
+{
+    auto result = ValidateArgCount(args, 0, "getActionNames");
+    if (!result.success) return result;
+
+    try
+    {
+        std::string namesStr = "{ \"actions\": [";
+
+        for (uint8_t action = 0; action < static_cast<uint8_t>(eAction::COUNT); ++action)
+        {
+            namesStr += std::string(action > 0 ? ", " : "") + "\"" + ActionMap::GetActionName(static_cast<eAction>(action)) + "\"";
+        }
+
+        namesStr += "], \"axes\": [";
+
+        for (uint8_t axis = 0; axis < static_cast<uint8_t>(eActionAxis::COUNT); ++axis)
+        {
+            namesStr += std::string(axis > 0 ? ", " : "") + "\"" + ActionMap::GetAxisName(static_cast<eActionAxis>(axis)) + "\"";
+        }
+
+        namesStr += "] }";
+
+        return ScriptMethodResult::Success(namesStr);
+    }
+    catch (const std::exception& e)
+    {
+        return ScriptMethodResult::Error("取得動作名稱失敗: " + std::string(e.what()));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+ScriptMethodResult GameScriptInterface::ExecuteRecordStressStep(const std::vector<std::any>& args)
+{
+    auto result = ValidateArgCount(args, 3, "recordStressStep");
+    if (!result.success) return result;
+
+    try
+    {
+        int const   entityCount        = ExtractInt(args[0]);
+        int const   spawnedCount       = ExtractInt(args[1]);
+        float const bridgeMilliseconds = ExtractFloat(args[2]);
+
+        if (!m_game->RecordStressStep(static_cast<uint32_t>(std::max(entityCount, 0)), static_cast<uint32_t>(std::max(spawnedCount, 0)), bridgeMilliseconds))
+        {
+            return ScriptMethodResult::Error("壓力測試未啟動（-stressScenario=MAX）");
+        }
+
+        return ScriptMethodResult::Success(std::string("壓力測試階段開始量測: ") + std::to_string(entityCount) + " 個實體");
+    }
+    catch (const std::exception& e)
+    {
+        return ScriptMethodResult::Error("記錄壓力測試階段失敗: " + std::string(e.what()));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+ScriptMethodResult GameScriptInterface::ExecuteFinishStressScenario(const std::vector<std::any>& args)
+{
+    auto result = ValidateArgCount(args, 0, "finishStressScenario");
+    if (!result.success) return result;
+
+    try
+    {
+        std::string superlinearSubsystem;
+
+        if (!m_game->FinishStressScenario(superlinearSubsystem))
+        {
+            return ScriptMethodResult::Error("壓力測試未啟動或寫出結果失敗");
+        }
+
+        return ScriptMethodResult::Success(superlinearSubsystem.empty() ? std::string("壓力測試完成：沒有超線性成長的子系統")
+                                                                        : "壓力測試完成：最先超線性成長的子系統為 " + superlinearSubsystem);
+    }
+    catch (const std::exception& e)
+    {
+        return ScriptMethodResult::Error("結束壓力測試失敗: " + std::string(e.what()));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+ScriptMethodResult GameScriptInterface::ExecuteSubscribeEvent(const std::vector<std::any>& args)
+{
+    auto result = ValidateArgCount(args, 1, "subscribeEvent");
+    if (!result.success) return result;
+
+    try
+    {
+        std::string const eventName = ExtractString(args[0]);
+        StringID const    eventID   = StringTable::Intern(eventName);
+
+        if (g_eventBus == nullptr || eventID == INVALID_STRING_ID)
+        {
+            return ScriptMethodResult::Error("事件匯流排不可用或事件名稱無效: " + eventName);
+        }
+
+        // One bus subscription per event however many JS handlers listen; JSEngine fans out.
+        if (!m_scriptSubscriptions.contains(eventID))
+        {
+            m_scriptSubscriptions[eventID] = g_eventBus->Subscribe(eventID, [this](sBusEvent const* events, uint32_t const count) {
+                OnScriptEvents(events, count);
+            });
+        }
+
+        return ScriptMethodResult::Success(std::string("已訂閱事件: ") + eventName);
+    }
+    catch (const std::exception& e)
+    {
+        return ScriptMethodResult::Error("訂閱事件失敗: " + std::string(e.what()));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+ScriptMethodResult GameScriptInterface::ExecuteUnsubscribeEvent(const std::vector<std::any>& args)
+{
+    auto result = ValidateArgCount(args, 1, "unsubscribeEvent");
+    if (!result.success) return result;
+
+    try
+    {
+        std::string const eventName = ExtractString(args[0]);
+        auto const        iter      = m_scriptSubscriptions.find(StringTable::Find(eventName));
+
+        if (iter == m_scriptSubscriptions.end())
+        {
+            return ScriptMethodResult::Error("未訂閱的事件: " + eventName);
+        }
+
+        g_eventBus->Unsubscribe(iter->second);
+        m_scriptSubscriptions.erase(iter);
+
+        return ScriptMethodResult::Success(std::string("已取消訂閱事件: ") + eventName);
+    }
+    catch (const std::exception& e)
+    {
+        return ScriptMethodResult::Error("取消訂閱事件失敗: " + std::string(e.what()));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Shared by the async methods: queue the work and hand the request ID back at once. JSEngine keeps the
+// Promise under that ID until ResolveAsyncCompletions() settles it.
+//
+ScriptMethodResult GameScriptInterface::SubmitAsyncRequest(const std::vector<std::any>& args,
+                                                           eAsyncRequestType const      requestType,
+                                                           const std::string&           methodName)
+{
+    auto result = ValidateArgCount(args, 1, methodName);
+    if (!result.success) return result;
+
+    try
+    {
+        std::string const filePath = ExtractString(args[0]);
+
+        if (m_asyncBridge == nullptr)
+        {
+            if (g_eventBus == nullptr)
+            {
+                return ScriptMethodResult::Error("事件匯流排不可用，無法執行非同步請求");
+            }
+
+            sGameConfig const& gameConfig = g_gameConfig->Get();
+
+            sAsyncBridgeConfig asyncBridgeConfig;
+            asyncBridgeConfig.m_eventBus                 = g_eventBus;
+            asyncBridgeConfig.m_rootPath                 = g_gameConfig->GetProjectRoot() + "Run/";
+            asyncBridgeConfig.m_budgetMilliseconds       = gameConfig.m_asyncBudgetMilliseconds;
+            asyncBridgeConfig.m_completionsPerCheckpoint = gameConfig.m_asyncCompletionsPerCheckpoint;
+            asyncBridgeConfig.m_maxCheckpointsPerFrame   = gameConfig.m_asyncMaxCheckpointsPerFrame;
+            m_asyncBridge                                = std::make_unique<AsyncBridge>(asyncBridgeConfig);
+        }
+
+        return ScriptMethodResult::Success(static_cast<double>(m_asyncBridge->Submit(requestType, filePath)));
+    }
+    catch (const std::exception& e)
+    {
+        return ScriptMethodResult::Error("非同步請求失敗: " + std::string(e.what()));
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+ScriptMethodResult GameScriptInterface::ExecuteReadFileAsync(const std::vector<std::any>& args)
+{
+    return SubmitAsyncRequest(args, eAsyncRequestType::READ_FILE, "readFileAsync");
+}
+
+//----------------------------------------------------------------------------------------------------
+ScriptMethodResult GameScriptInterface::ExecuteGetFileTimestampAsync(const std::vector<std::any>& args)
+{
+    return SubmitAsyncRequest(args, eAsyncRequestType::GET_FILE_TIMESTAMP, "getFileTimestampAsync");
+}
+
+//----------------------------------------------------------------------------------------------------
+ScriptMethodResult GameScriptInterface::ExecuteJavaScriptFileAsync(const std::vector<std::any>& args)
+{
+    return SubmitAsyncRequest(args, eAsyncRequestType::EXECUTE_FILE, "executeFileAsync");
+}
+
+//----------------------------------------------------------------------------------------------------
+ScriptMethodResult GameScriptInterface::ExecuteGetAsyncStats(const std::vector<std::any>& args)
+{
+    auto result = ValidateArgCount(args, 0, "getAsyncStats");
+    if (!result.success) return result;
+
+    try
+    {
+        sAsyncBridgeStats const stats = m_asyncBridge != nullptr ? m_asyncBridge->GetStats() : sAsyncBridgeStats();
+
+        std::string statsStr = "{ submitted: " + std::to_string(stats.m_submittedCount) +
+        ", resolved: " + std::to_string(stats.m_resolvedCount) +
+        ", inFlight: " + std::to_string(stats.m_inFlightCount) +
+        ", ready: " + std::to_string(stats.m_readyCount) +
+        ", deferredFrames: " + std::to_string(stats.m_deferredFrameCount) +
+        ", lastCheckpoints: " + std::to_string(stats.m_lastCheckpointCount) +
+        ", lastFrameMs: " + std::to_string(stats.m_lastFrameMilliseconds) + " }";
+
+        return ScriptMethodResult::Success(statsStr);
+    }
+    catch (const std::exception& e)
+    {
+        return ScriptMethodResult::Error("取得非同步統計失敗: " + std::string(e.what()));
+    }
+}
+
 //----------------------------------------------------------------------------------------------------
 // 輔助方法實作
 //----------------------------------------------------------------------------------------------------
 
 template <typename T>
-T GameScriptInterface::ExtractArg(const std::any& arg, const std::string& expectedType) const
+T GameScriptInterface::ExtractArg(const std::any& arg, const std::string& expectedType)
 {
     // Use type-safe extraction to avoid std::bad_any_cast exceptions
     if (HasType<T>(arg))
@@ -451,7 +1038,7 @@ T GameScriptInterface::ExtractArg(const std::any& arg, const std::string& expect
 }
 
 //----------------------------------------------------------------------------------------------------
-Vec3 GameScriptInterface::ExtractVec3(const std::vector<std::any>& args, size_t startIndex) const
+Vec3 GameScriptInterface::ExtractVec3(const std::vector<std::any>& args, size_t startIndex)
 {
     if (startIndex + 2 >= args.size())
     {
@@ -466,7 +1053,7 @@ Vec3 GameScriptInterface::ExtractVec3(const std::vector<std::any>& args, size_t
 }
 
 //----------------------------------------------------------------------------------------------------
-float GameScriptInterface::ExtractFloat(const std::any& arg) const
+float GameScriptInterface::ExtractFloat(const std::any& arg)
 {
     try
     {
@@ -518,7 +1105,7 @@ float GameScriptInterface::ExtractFloat(const std::any& arg) const
 }
 
 //----------------------------------------------------------------------------------------------------
-int GameScriptInterface::ExtractInt(const std::any& arg) const
+int GameScriptInterface::ExtractInt(const std::any& arg)
 {
     try
     {
@@ -570,7 +1157,7 @@ int GameScriptInterface::ExtractInt(const std::any& arg) const
 }
 
 //----------------------------------------------------------------------------------------------------
-std::string GameScriptInterface::ExtractString(const std::any& arg) const
+std::string GameScriptInterface::ExtractString(const std::any& arg)
 {
     try
     {
@@ -609,7 +1196,7 @@ std::string GameScriptInterface::ExtractString(const std::any& arg) const
 }
 
 //----------------------------------------------------------------------------------------------------
-bool GameScriptInterface::ExtractBool(const std::any& arg) const
+bool GameScriptInterface::ExtractBool(const std::any& arg)
 {
     try
     {
@@ -695,7 +1282,7 @@ ScriptMethodResult GameScriptInterface::ExecuteGetFileTimestamp(const std::vecto
 
         // The filePath comes from HotReloader as 'Data/Scripts/filename.js'
         // Build absolute path from the known project structure
-        std::string projectRoot = "C:/p4/Personal/SD/ProtogameJS2D/";
+        std::string projectRoot = g_gameConfig->GetProjectRoot();
         std::string fullPath    = projectRoot + "Run/" + filePath;
 
         // Debug: Log the paths being used
@@ -751,14 +1338,21 @@ bool GameScriptInterface::InitializeHotReload(V8Subsystem*       v8System,
         }
 
         // Set up callbacks
-        m_fileWatcher->SetChangeCallback([this](const std::string& filePath) {
-            OnFileChanged(filePath);
+        m_fileWatcher->SetChangeCallback([this](StringID const pathID) {
+            OnFileChanged(pathID);
         });
 
         m_scriptReloader->SetReloadCompleteCallback([this](bool success, const std::string& error) {
             OnReloadComplete(success, error);
         });
 
+        if (g_eventBus != nullptr && m_fileChangedSubscription == EventBus::INVALID_SUBSCRIPTION)
+        {
+            m_fileChangedSubscription = g_eventBus->Subscribe("fileChanged"_sid, [this](sBusEvent const* events, uint32_t const count) {
+                OnFileChangedEvents(events, count);
+            });
+        }
+
         // Add default watched files
         m_fileWatcher->AddWatchedFile("Data/Scripts/JSEngine.js");
         m_fileWatcher->AddWatchedFile("Data/Scripts/JSGame.js");
@@ -790,6 +1384,11 @@ void GameScriptInterface::ShutdownHotReload()
         {
             m_scriptReloader->Shutdown();
         }
+        if (g_eventBus != nullptr)
+        {
+            g_eventBus->Unsubscribe(m_fileChangedSubscription);
+            m_fileChangedSubscription = EventBus::INVALID_SUBSCRIPTION;
+        }
         m_hotReloadEnabled = false;
         DAEMON_LOG(LogScript, eLogVerbosity::Log, StringFormat("GameScriptInterface: Hot-reload system shutdown completed"));
     }
@@ -799,17 +1398,17 @@ void GameScriptInterface::ShutdownHotReload()
     }
 }
 
-void GameScriptInterface::OnFileChanged(const std::string& filePath)
+void GameScriptInterface::OnFileChanged(StringID const pathID)
 {
     try
     {
-        DAEMON_LOG(LogScript, eLogVerbosity::Log, StringFormat("GameScriptInterface: File changed (queuing for main thread): {}", filePath));
+        DAEMON_LOG(LogScript, eLogVerbosity::Log, StringFormat("GameScriptInterface: File changed (posting for main thread): {}", StringTable::GetString(pathID)));
 
-        // Queue the file change for main thread processing (thread-safe)
-        if (m_hotReloadEnabled)
+        // Lock-free post of the ID FileWatcher interned when the file was added; the reload itself runs in
+        // OnFileChangedEvents() during the next dispatch
+        if (m_hotReloadEnabled && g_eventBus != nullptr)
         {
-            std::lock_guard<std::mutex> lock(m_fileChangeQueueMutex);
-            m_pendingFileChanges.push(filePath);
+            g_eventBus->Post("fileChanged"_sid, pathID);
         }
     }
     catch (const std::exception& e)
@@ -830,41 +1429,87 @@ void GameScriptInterface::OnReloadComplete(bool success, const std::string& erro
     }
 }
 
-void GameScriptInterface::ProcessPendingHotReloadEvents()
+void GameScriptInterface::OnFileChangedEvents(sBusEvent const* const events,
+                                              uint32_t const         count)
 {
     try
     {
-        // Process all pending file changes on the main thread (V8-safe)
-        std::queue<std::string> filesToProcess;
-
-        // Get all pending changes under lock
+        for (uint32_t i = 0; i < count; ++i)
         {
-            std::lock_guard<std::mutex> lock(m_fileChangeQueueMutex);
-            filesToProcess.swap(m_pendingFileChanges); // Efficiently move all items
-        }
-
-        // Process all file changes outside the lock
-        while (!filesToProcess.empty())
-        {
-            const std::string& filePath = filesToProcess.front();
+            std::string const filePath(StringTable::GetString(events[i].m_text));
 
             DAEMON_LOG(LogScript, eLogVerbosity::Log, StringFormat("GameScriptInterface: Processing file change on main thread: {}", filePath));
 
-            // Convert relative path to absolute path for ScriptReloader
-            std::string absolutePath = GetAbsoluteScriptPath(filePath);
-
             // Now safe to call V8 from main thread
             if (m_scriptReloader && m_hotReloadEnabled)
             {
-                m_scriptReloader->ReloadScript(absolutePath);
+                m_scriptReloader->ReloadScript(GetAbsoluteScriptPath(filePath));
             }
-
-            filesToProcess.pop();
         }
     }
     catch (const std::exception& e)
     {
-        DAEMON_LOG(LogScript, eLogVerbosity::Error, StringFormat("GameScriptInterface: Error processing pending hot-reload events: {}", e.what()));
+        DAEMON_LOG(LogScript, eLogVerbosity::Error, StringFormat("GameScriptInterface: Error processing file change events: {}", e.what()));
+    }
+}
+
+void GameScriptInterface::OnScriptEvents(sBusEvent const* const events,
+                                         uint32_t const         count)
+{
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        sBusEvent const& event = events[i];
+
+        m_scriptEventBatch += m_scriptEventBatch.empty() ? "" : ", ";
+        m_scriptEventBatch += Stringf("{ event: \"%s\", text: \"%s\", integer: %lld, number: %s }",
+                                      EscapeJsonString(StringTable::GetString(event.m_eventID)).c_str(),
+                                      EscapeJsonString(StringTable::GetString(event.m_text)).c_str(),
+                                      static_cast<long long>(event.m_integer),
+                                      FormatScriptNumber(event.m_number).c_str());
+    }
+}
+
+void GameScriptInterface::DeliverScriptEvents()
+{
+    if (m_scriptEventBatch.empty() || m_game == nullptr)
+    {
+        return;
+    }
+
+    // Swap out first: a handler that triggers another dispatch must not see this batch again.
+    std::string batch;
+    batch.swap(m_scriptEventBatch);
+
+    m_game->ExecuteJavaScriptCommand(StringFormat("globalThis.JSEngine.dispatchEvents([{}]);", batch));
+}
+
+void GameScriptInterface::ResolveAsyncCompletions()
+{
+    if (m_asyncBridge == nullptr || g_v8Subsystem == nullptr || !g_v8Subsystem->IsInitialized())
+    {
+        return;
+    }
+
+    m_asyncBridge->ResolveCompletions([](std::string const& script, std::string const& scriptName, std::string& out_error) {
+        // Named scripts are executeFileAsync files: registered so DevTools shows them like executeFile's.
+        bool const success = scriptName.empty() ? g_v8Subsystem->ExecuteScript(script)
+                                                : g_v8Subsystem->ExecuteRegisteredScript(script, scriptName);
+
+        if (!success)
+        {
+            out_error = g_v8Subsystem->HasError() ? g_v8Subsystem->GetLastError() : std::string("script failed");
+        }
+
+        return success;
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+void GameScriptInterface::ApplyConfig(sGameConfig const& config)
+{
+    if (m_asyncBridge != nullptr)
+    {
+        m_asyncBridge->SetFrameBudget(config.m_asyncBudgetMilliseconds, config.m_asyncCompletionsPerCheckpoint, config.m_asyncMaxCheckpointsPerFrame);
     }
 }
 
@@ -5,16 +5,18 @@
 //----------------------------------------------------------------------------------------------------
 #pragma once
 #include "Engine/Scripting/IScriptableObject.hpp"
+#include "AsyncBridge.hpp"
+#include "EventBus.hpp"
 #include "FileWatcher.hpp"
 #include "ScriptReloader.hpp"
 #include <memory>
-#include <queue>
-#include <mutex>
+#include <unordered_map>
 
 //-Forward-Declaration--------------------------------------------------------------------------------
 class Game;
 class Player;
 class V8Subsystem;
+struct sGameConfig;
 struct Vec3;
 
 //----------------------------------------------------------------------------------------------------
@@ -41,49 +43,37 @@ public:
     bool InitializeHotReload(V8Subsystem* v8System, const std::string& projectRoot);
     void ShutdownHotReload();
 
-    // Thread-safe method to process pending hot-reload events on main thread
-    void ProcessPendingHotReloadEvents();
+    // Hands this frame's script-subscribed bus events to JSEngine.dispatchEvents(); main thread, after
+    // EventBus::DispatchPending()
+    void DeliverScriptEvents();
 
-private:
-    Game* m_game; // 不擁有，只是參考
-
-    // Hot-reload system components
-    std::unique_ptr<FileWatcher>    m_fileWatcher;
-    std::unique_ptr<ScriptReloader> m_scriptReloader;
-    bool                            m_hotReloadEnabled{false};
-    std::string                     m_projectRoot; // Store project root for path construction
+    // Settles the promises of finished async bridge calls, within the frame's budget; right after
+    // DeliverScriptEvents(), before JSEngine.update()
+    void ResolveAsyncCompletions();
 
-    // Thread-safe event queue for main thread processing
-    std::queue<std::string> m_pendingFileChanges;
-    mutable std::mutex      m_fileChangeQueueMutex;
+    // Hot reloadable async bridge budgets from GameConfig.xml; between frames
+    void ApplyConfig(sGameConfig const& config);
 
-    // Hot-reload callbacks
-    void OnFileChanged(const std::string& filePath);
-    void OnReloadComplete(bool success, const std::string& error);
-
-    // Helper method to construct absolute paths (same logic as FileWatcher)
-    std::string GetAbsoluteScriptPath(const std::string& relativePath) const;
-
-    // 輔助方法來處理類型轉換和錯誤檢查
+    // 輔助方法來處理類型轉換和錯誤檢查 (stateless, so callable without a Game)
     template <typename T>
-    T ExtractArg(const std::any& arg, const std::string& expectedType = "") const;
+    static T ExtractArg(const std::any& arg, const std::string& expectedType = "");
 
     // 專門的類型提取方法 (optimized for V8 integration)
-    Vec3        ExtractVec3(const std::vector<std::any>& args, size_t startIndex) const;
-    float       ExtractFloat(const std::any& arg) const;
-    int         ExtractInt(const std::any& arg) const;
-    std::string ExtractString(const std::any& arg) const;
-    bool        ExtractBool(const std::any& arg) const;
+    static Vec3        ExtractVec3(const std::vector<std::any>& args, size_t startIndex);
+    static float       ExtractFloat(const std::any& arg);
+    static int         ExtractInt(const std::any& arg);
+    static std::string ExtractString(const std::any& arg);
+    static bool        ExtractBool(const std::any& arg);
 
     // TypeSafe extraction utilities (eliminates std::bad_any_cast exceptions)
     template <typename T>
-    bool HasType(std::any const& arg) const
+    static bool HasType(std::any const& arg)
     {
         return arg.type() == typeid(T);
     }
 
     template <typename T>
-    T SafeCast(const std::any& arg) const
+    static T SafeCast(const std::any& arg)
     {
         try
         {
@@ -100,6 +90,34 @@ private:
         }
     }
 
+private:
+    Game* m_game; // 不擁有，只是參考
+
+    // Hot-reload system components
+    std::unique_ptr<FileWatcher>    m_fileWatcher;
+    std::unique_ptr<ScriptReloader> m_scriptReloader;
+    bool                            m_hotReloadEnabled{false};
+    std::string                     m_projectRoot; // Store project root for path construction
+
+    // File changes reach the main thread as "fileChanged" bus events
+    EventBus::SubscriptionHandle m_fileChangedSubscription = EventBus::INVALID_SUBSCRIPTION;
+
+    // Events scripts asked for with subscribeEvent(), batched per frame as JSON objects
+    std::unordered_map<StringID, EventBus::SubscriptionHandle> m_scriptSubscriptions;
+    std::string                                                m_scriptEventBatch;
+
+    // readFileAsync() and friends; created on the first async call
+    std::unique_ptr<AsyncBridge> m_asyncBridge;
+
+    // Hot-reload callbacks
+    void OnFileChanged(StringID pathID);                                 // FileWatcher thread
+    void OnFileChangedEvents(sBusEvent const* events, uint32_t count);    // Main thread
+    void OnReloadComplete(bool success, const std::string& error);
+    void OnScriptEvents(sBusEvent const* events, uint32_t count);
+
+    // Helper method to construct absolute paths (same logic as FileWatcher)
+    std::string GetAbsoluteScriptPath(const std::string& relativePath) const;
+
     // 參數驗證輔助方法
     ScriptMethodResult ValidateArgCount(const std::vector<std::any>& args,
                                         size_t                       expectedCount,
@@ -122,6 +140,26 @@ private:
     ScriptMethodResult ExecuteIsAttractMode(const std::vector<std::any>& args);
     ScriptMethodResult ExecuteGetGameState(const std::vector<std::any>& args);
     ScriptMethodResult ExecuteGetFileTimestamp(const std::vector<std::any>& args);
+    ScriptMethodResult ExecuteSaveSnapshot(const std::vector<std::any>& args);
+    ScriptMethodResult ExecuteLoadSnapshot(const std::vector<std::any>& args);
+    ScriptMethodResult ExecuteSetFastForward(const std::vector<std::any>& args);
+    ScriptMethodResult ExecuteGetFastForwardStats(const std::vector<std::any>& args);
+    ScriptMethodResult ExecuteSetOcclusionCulling(const std::vector<std::any>& args);
+    ScriptMethodResult ExecuteGetRenderStats(const std::vector<std::any>& args);
+    ScriptMethodResult ExecuteSubmitAudioCommands(const std::vector<std::any>& args);
+    ScriptMethodResult ExecuteGetAudioStats(const std::vector<std::any>& args);
+    ScriptMethodResult ExecuteGetInputStats(const std::vector<std::any>& args);
+    ScriptMethodResult ExecuteGetActionState(const std::vector<std::any>& args);
+    ScriptMethodResult ExecuteGetActionNames(const std::vector<std::any>& args);
+    ScriptMethodResult ExecuteRecordStressStep(const std::vector<std::any>& args);
+    ScriptMethodResult ExecuteFinishStressScenario(const std::vector<std::any>& args);
+    ScriptMethodResult ExecuteSubscribeEvent(const std::vector<std::any>& args);
+    ScriptMethodResult ExecuteUnsubscribeEvent(const std::vector<std::any>& args);
+    ScriptMethodResult ExecuteReadFileAsync(const std::vector<std::any>& args);
+    ScriptMethodResult ExecuteGetFileTimestampAsync(const std::vector<std::any>& args);
+    ScriptMethodResult ExecuteJavaScriptFileAsync(const std::vector<std::any>& args);
+    ScriptMethodResult ExecuteGetAsyncStats(const std::vector<std::any>& args);
+    ScriptMethodResult SubmitAsyncRequest(const std::vector<std::any>& args, eAsyncRequestType requestType, const std::string& methodName);
 
     // Hot-reload methods
     ScriptMethodResult ExecuteEnableHotReload(const std::vector<std::any>& args);
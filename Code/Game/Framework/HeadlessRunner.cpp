@@ -0,0 +1,147 @@
+//----------------------------------------------------------------------------------------------------
+// HeadlessRunner.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/HeadlessRunner.hpp"
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/WorkerPool.hpp"
+
+//----------------------------------------------------------------------------------------------------
+void WriteHeadlessReport(std::string const& path, std::string const& report)
+{
+    DebuggerPrintf("%s", report.c_str());
+    WriteTextFile(path, report);
+}
+
+//----------------------------------------------------------------------------------------------------
+HeadlessRunner::HeadlessRunner(sHeadlessRunConfig const& config)
+    : m_config(config)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC bool HeadlessRunner::ParseCommandLine(std::string const&  commandLine,
+                                             sHeadlessRunConfig& out_config)
+{
+    FindCommandLineUInt(commandLine, "headless", out_config.m_instanceCount);
+    FindCommandLineUInt(commandLine, "headlessLights", out_config.m_lightCount);
+    FindCommandLineUInt(commandLine, "headlessRender", out_config.m_renderFrameCount);
+    FindCommandLineUInt(commandLine, "headlessOcclusion", out_config.m_occlusionFrameCount);
+    FindCommandLineUInt(commandLine, "headlessVertexFormats", out_config.m_vertexFormatCheck);
+    FindCommandLineUInt(commandLine, "headlessAtlas", out_config.m_atlasTextureCount);
+    FindCommandLineUInt(commandLine, "headlessPackets", out_config.m_packetFrameCount);
+    FindCommandLineUInt(commandLine, "headlessAudio", out_config.m_audioVoiceCount);
+    FindCommandLineUInt(commandLine, "headlessInput", out_config.m_inputEventCount);
+    FindCommandLineUInt(commandLine, "headlessStrings", out_config.m_stringCount);
+    FindCommandLineUInt(commandLine, "headlessScriptBuffers", out_config.m_scriptBufferFrameCount);
+    FindCommandLineUInt(commandLine, "headlessBundle", out_config.m_bundleBuildCount);
+    FindCommandLineUInt(commandLine, "headlessStress", out_config.m_stressMaxEntityCount);
+
+    if (out_config.m_instanceCount == 0 && out_config.m_lightCount == 0 && out_config.m_renderFrameCount == 0 && out_config.m_occlusionFrameCount == 0 &&
+        out_config.m_vertexFormatCheck == 0 && out_config.m_atlasTextureCount == 0 && out_config.m_packetFrameCount == 0 && out_config.m_audioVoiceCount == 0 &&
+        out_config.m_inputEventCount == 0 && out_config.m_stringCount == 0 && out_config.m_scriptBufferFrameCount == 0 &&
+        out_config.m_bundleBuildCount == 0 && out_config.m_stressMaxEntityCount == 0)
+    {
+        return false;
+    }
+
+    FindCommandLineUInt(commandLine, "stressStart", out_config.m_stressConfig.m_startEntityCount);
+    FindCommandLineUInt(commandLine, "stressGrowth", out_config.m_stressConfig.m_growthFactor);
+    FindCommandLineUInt(commandLine, "stressFrames", out_config.m_stressConfig.m_framesPerStep);
+    FindCommandLineFloat(commandLine, "stressExponent", out_config.m_stressConfig.m_superlinearExponent);
+
+    FindCommandLineString(commandLine, "headlessAudioFile", out_config.m_audioFilePath);
+
+    FindCommandLineUInt(commandLine, "headlessRenderWidth", out_config.m_renderWidth);
+    FindCommandLineUInt(commandLine, "headlessRenderHeight", out_config.m_renderHeight);
+    FindCommandLineString(commandLine, "headlessGolden", out_config.m_goldenImagePath);
+
+    FindCommandLineUInt(commandLine, "headlessProps", out_config.m_worldConfig.m_propCount);
+    FindCommandLineFloat(commandLine, "headlessScalingFloor", out_config.m_minScalingEfficiency);
+    FindCommandLineUInt(commandLine, "headlessFrames", out_config.m_frameCount);
+
+    uint32_t levelOfDetail = 1;
+    FindCommandLineUInt(commandLine, "headlessLod", levelOfDetail);
+    out_config.m_worldConfig.m_isLevelOfDetailEnabled = levelOfDetail != 0;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+int HeadlessRunner::Run()
+{
+    WorkerPool workerPool;
+    bool       isValid = true;
+
+    if (m_config.m_instanceCount > 0)
+    {
+        isValid = RunWorldScalingCheck(m_config, workerPool) && isValid;
+    }
+
+    if (m_config.m_lightCount > 0)
+    {
+        isValid = RunLightCullingCheck(m_config, workerPool) && isValid;
+    }
+
+    if (m_config.m_renderFrameCount > 0)
+    {
+        isValid = RunSoftwareRenderCheck(m_config, workerPool) && isValid;
+    }
+
+    if (m_config.m_occlusionFrameCount > 0)
+    {
+        isValid = RunOcclusionCullingCheck(m_config, workerPool) && isValid;
+    }
+
+    if (m_config.m_vertexFormatCheck > 0)
+    {
+        isValid = RunVertexFormatsCheck(m_config) && isValid;
+    }
+
+    if (m_config.m_atlasTextureCount > 0)
+    {
+        isValid = RunTextureAtlasCheck(m_config, workerPool) && isValid;
+    }
+
+    if (m_config.m_packetFrameCount > 0)
+    {
+        isValid = RunDrawPacketsCheck(m_config) && isValid;
+    }
+
+    if (m_config.m_audioVoiceCount > 0)
+    {
+        isValid = RunAudioCheck(m_config) && isValid;
+    }
+
+    if (m_config.m_inputEventCount > 0)
+    {
+        isValid = RunInputEventsCheck(m_config) && isValid;
+    }
+
+    if (m_config.m_stringCount > 0)
+    {
+        isValid = RunStringTableCheck(m_config) && isValid;
+    }
+
+    if (m_config.m_scriptBufferFrameCount > 0)
+    {
+        isValid = RunScriptBuffersCheck(m_config) && isValid;
+    }
+
+    if (m_config.m_bundleBuildCount > 0)
+    {
+        isValid = RunScriptBundleCheck(m_config) && isValid;
+    }
+
+    if (m_config.m_stressMaxEntityCount > 0)
+    {
+        isValid = RunStressScenarioCheck(m_config, workerPool) && isValid;
+    }
+
+    return isValid ? 0 : 1;
+}
@@ -0,0 +1,159 @@
+//----------------------------------------------------------------------------------------------------
+// HeadlessRunner.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <string>
+
+#include "Game/Framework/HeadlessWorld.hpp"
+#include "Game/Framework/StressScenario.hpp"
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class WorkerPool;
+
+//----------------------------------------------------------------------------------------------------
+struct sHeadlessRunConfig
+{
+    uint32_t             m_instanceCount = 0;
+    uint32_t             m_frameCount    = 600;
+    sHeadlessWorldConfig m_worldConfig;
+    std::string          m_reportPath = "Logs/HeadlessScaling.txt";
+    float                m_minScalingEfficiency = 0.5f;    // Fails below this fraction of min(instances, workers) speed-up
+
+    uint32_t    m_lightCount          = 0;     // > 0 runs the clustered light culling benchmark
+    std::string m_lightCullReportPath = "Logs/LightCulling.txt";
+
+    uint32_t    m_renderFrameCount = 0;         // > 0 runs the software renderer benchmark
+    uint32_t    m_renderWidth      = 1920;
+    uint32_t    m_renderHeight     = 1080;
+    std::string m_renderImagePath  = "Logs/SoftwareRender.tga";
+    std::string m_renderReportPath = "Logs/SoftwareRender.txt";
+    std::string m_goldenImagePath;              // Compared against the last rendered frame when set
+
+    uint32_t    m_occlusionFrameCount = 0;      // > 0 runs the occlusion culling validation
+    std::string m_occlusionReportPath = "Logs/OcclusionCulling.txt";
+
+    uint32_t    m_vertexFormatCheck      = 0;      // > 0 runs the quantized vertex round-trip check
+    std::string m_vertexFormatReportPath = "Logs/VertexFormats.txt";
+
+    uint32_t    m_atlasTextureCount = 0;        // > 0 runs the texture atlas packing validation
+    std::string m_atlasReportPath   = "Logs/TextureAtlas.txt";
+
+    uint32_t    m_packetFrameCount = 0;         // > 0 runs the draw packet build benchmark
+    std::string m_packetReportPath = "Logs/DrawPackets.txt";
+
+    uint32_t    m_audioVoiceCount = 0;          // > 0 runs the audio stream and voice pool validation
+    std::string m_audioFilePath   = "Data/Audio/TestSound.mp3";
+    std::string m_audioReportPath = "Logs/Audio.txt";
+
+    uint32_t    m_inputEventCount = 0;          // > 0 runs the input event queue validation
+    std::string m_inputReportPath = "Logs/InputEvents.txt";
+
+    uint32_t    m_stringCount      = 0;         // > 0 runs the string table validation
+    std::string m_stringReportPath = "Logs/StringTable.txt";
+
+    uint32_t    m_scriptBufferFrameCount = 0;      // > 0 runs the script buffer allocator benchmark
+    std::string m_scriptBufferReportPath = "Logs/ScriptBuffers.txt";
+
+    uint32_t    m_bundleBuildCount = 0;         // > 0 builds the production script bundle and validates its source map
+    std::string m_bundleReportPath = "Logs/ScriptBundle.txt";
+
+    uint32_t              m_stressMaxEntityCount = 0;     // > 0 ramps the stress scenario up to this many entities
+    sStressScenarioConfig m_stressConfig;
+    std::string           m_stressReportPath     = "Logs/StressScenario.txt";
+};
+
+//----------------------------------------------------------------------------------------------------
+// Runs every headless mode the command line asked for, without starting the window, renderer or V8, and
+// exits with 1 when any of them failed its validation. Each mode writes its own report and lives next to
+// the code it checks (e.g. Subsystem/Audio/AudioCheck.cpp); this class only parses and dispatches.
+//
+// Started from the command line with one or more of the -headless* options below.
+//----------------------------------------------------------------------------------------------------
+class HeadlessRunner
+{
+public:
+    explicit HeadlessRunner(sHeadlessRunConfig const& config);
+
+    int Run();     // Process exit code: 0 when every mode that ran passed its validation
+
+    static bool ParseCommandLine(std::string const& commandLine, sHeadlessRunConfig& out_config);
+
+private:
+    sHeadlessRunConfig m_config;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Headless modes: each returns false when its validation failed.
+//----------------------------------------------------------------------------------------------------
+
+// -headless=N [-headlessProps=P] [-headlessFrames=F] [-headlessLod=0|1] runs N HeadlessWorld instances in
+// parallel on the pool and reports aggregate frames per second at 1, 2, 4, ... N instances. Only C++ props
+// are stepped, so this measures the prop update, not a game frame. Fails when a speed-up falls below
+// -headlessScalingFloor (default 0.5) of min(instances, workers). (Framework/HeadlessWorldCheck.cpp)
+bool RunWorldScalingCheck(sHeadlessRunConfig const& config, WorkerPool& workerPool);
+
+// -headlessLights=L runs LightClusterCuller over L random point/spot lights for F frames, single-threaded
+// and on the pool, checks both results against a brute-force sphere/cluster test and reports timings.
+bool RunLightCullingCheck(sHeadlessRunConfig const& config, WorkerPool& workerPool);
+
+// -headlessRender=F steps one world for F frames and draws each through the SoftwareRenderer
+// [-headlessRenderWidth=W -headlessRenderHeight=H], reporting per-pass timings and saving the last
+// frame as a TGA; -headlessGolden=path compares that frame against a reference image.
+bool RunSoftwareRenderCheck(sHeadlessRunConfig const& config, WorkerPool& workerPool);
+
+// -headlessOcclusion=F steps one world with a ring of occluder pillars for F frames, culls every prop
+// against the OcclusionCuller depth pyramid and checks each result against a per-pixel brute-force test.
+bool RunOcclusionCullingCheck(sHeadlessRunConfig const& config, WorkerPool& workerPool);
+
+// -headlessVertexFormats=1 round-trips every cached prop mesh level through Vertex_PCUQ and reports the
+// memory saved and the worst position/UV error against the format's tolerance.
+bool RunVertexFormatsCheck(sHeadlessRunConfig const& config);
+
+// -headlessAtlas=T packs T random-sized textures into TextureAtlas pages, single-threaded and on the pool,
+// and checks that both layouts are identical, regions never overlap and every texel (gutters included)
+// reads back through the remapped UVs.
+bool RunTextureAtlasCheck(sHeadlessRunConfig const& config, WorkerPool& workerPool);
+
+// -headlessPackets=F builds every prop's draw packet with DrawPacketBuilder for F frames at several prop
+// counts (up to -headlessProps) and thread counts, and checks every result against the single-thread order.
+bool RunDrawPacketsCheck(sHeadlessRunConfig const& config);
+
+// -headlessAudio=V streams -headlessAudioFile (default Data/Audio/TestSound.mp3) through AudioStream at
+// several buffer pool sizes and checks each against a whole-file frame count, then drives an
+// AudioVoicePool of V voices against the NullAudioOutput for F frames with batched commands, checking
+// each frame that exactly the most audible voices are real.
+bool RunAudioCheck(sHeadlessRunConfig const& config);
+
+// -headlessInput=N injects N synthetic key events with timestamps from a producer thread into an
+// InputEventQueue and consumes them in fixed 60 Hz steps, checking every step's key states and edges
+// against a replay of the event list and counting the sub-step taps that per-step polling would miss.
+bool RunInputEventsCheck(sHeadlessRunConfig const& config);
+
+// -headlessStrings=N interns N generated paths from every hardware thread at once, checks that all threads
+// got the same ID for each string and that IDs round-trip, and times a script-method-style lookup as a
+// string compare chain against one hash plus a switch on "..."_sid literals.
+bool RunStringTableCheck(sHeadlessRunConfig const& config);
+
+// -headlessScriptBuffers=F replays F frames of a synthetic typed-array-shaped trace (per-frame
+// temporaries, buffers living a few frames, large uninitialized blocks) through ScriptArrayBufferAllocator
+// and through calloc / malloc as V8's default allocator does, checking every buffer's contents and zero
+// fill, then replays it from every hardware thread at once on one shared allocator. No script runs: the
+// timings compare allocators, not JS workloads.
+bool RunScriptBuffersCheck(sHeadlessRunConfig const& config);
+
+// -headlessBundle=B builds the production script bundle and source map B times with ScriptBundler, then
+// checks every mapped segment against the original file text, the map's VLQ round-trip and reload, error
+// message remapping and that every dev log statement was either stripped or deliberately kept.
+bool RunScriptBundleCheck(sHeadlessRunConfig const& config);
+
+// -headlessStress=MAX ramps StressScenario from 1000 entities geometrically up to MAX
+// [-stressStart=N -stressGrowth=G -stressFrames=F -stressExponent=K], timing the C++ prop spawn,
+// entity update and draw packet build at every step, and writes the scalability curve as JSON and CSV
+// with the first subsystem whose cost grows superlinearly.
+bool RunStressScenarioCheck(sHeadlessRunConfig const& config, WorkerPool& workerPool);
+
+// Prints the report to the debugger and writes it to path.
+void WriteHeadlessReport(std::string const& path, std::string const& report);
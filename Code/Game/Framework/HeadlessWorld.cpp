@@ -0,0 +1,197 @@
+//----------------------------------------------------------------------------------------------------
+// HeadlessWorld.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/HeadlessWorld.hpp"
+
+#include <cmath>
+
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/RandomNumberGenerator.hpp"
+#include "Engine/Renderer/Camera.hpp"
+#include "Game/Player.hpp"
+#include "Game/Prop.hpp"
+#include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/SoftwareRenderer.hpp"
+
+//----------------------------------------------------------------------------------------------------
+HeadlessWorld::HeadlessWorld(sHeadlessWorldConfig const& config)
+    : m_config(config)
+{
+    SpawnProps();
+    SpawnOccluders();
+}
+
+//----------------------------------------------------------------------------------------------------
+HeadlessWorld::~HeadlessWorld()
+{
+    for (Prop* prop : m_props)
+    {
+        delete prop;
+    }
+
+    m_props.clear();
+}
+
+//----------------------------------------------------------------------------------------------------
+void HeadlessWorld::Step()
+{
+    float const deltaSeconds = m_config.m_fixedDeltaSeconds;
+
+    for (Prop* prop : m_props)
+    {
+        prop->Update(deltaSeconds);
+    }
+
+    m_submittedVertexCount = 0;
+
+    float const orbitRadians = static_cast<float>(m_simulatedSeconds) * 0.25f;
+    m_cameraPosition         = Vec3(20.f * cosf(orbitRadians), 20.f * sinf(orbitRadians), 5.f);
+
+    if (m_config.m_isLevelOfDetailEnabled)
+    {
+        for (Prop* prop : m_props)
+        {
+            prop->UpdateLevelOfDetail(m_cameraPosition, m_config.m_pixelsPerUnitAtUnitDistance);
+            m_submittedVertexCount += prop->GetVertexCount();
+        }
+    }
+    else
+    {
+        m_submittedVertexCount = m_fullDetailVertexCount;
+    }
+
+    m_simulatedSeconds += deltaSeconds;
+    ++m_frameCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+static sSoftwareTexture MakeCheckerTexture()
+{
+    sSoftwareTexture texture;
+    texture.m_dimensions = IntVec2(8, 8);
+
+    for (int y = 0; y < 8; ++y)
+    {
+        for (int x = 0; x < 8; ++x)
+        {
+            texture.m_texels.push_back((x + y) % 2 == 0 ? Rgba8(200, 200, 200) : Rgba8(60, 60, 60));
+        }
+    }
+
+    return texture;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Mirrors Game::Render: a Player-style perspective camera for the props, then a screen camera for the
+// attract-mode disc drawn without depth.
+//
+void HeadlessWorld::Render(SoftwareRenderer& renderer) const
+{
+    Vec2 const dimensions(static_cast<float>(renderer.GetDimensions().x), static_cast<float>(renderer.GetDimensions().y));
+
+    Camera worldCamera;
+    SetupWorldCamera(worldCamera, dimensions.x / dimensions.y);
+
+    renderer.BeginCamera(worldCamera);
+
+    // Textured ground plane under the props, so the sampler path is covered too.
+    static sSoftwareTexture const s_checkerTexture = MakeCheckerTexture();
+
+    VertexList_PCU groundVerts;
+    AddVertsForQuad3D(groundVerts, Vec3(-60.f, -60.f, -1.f), Vec3(60.f, -60.f, -1.f), Vec3(60.f, 60.f, -1.f), Vec3(-60.f, 60.f, -1.f), Rgba8::WHITE, AABB2(0.f, 0.f, 15.f, 15.f));
+
+    renderer.SetModelConstants();
+    renderer.SetBlendMode(eBlendMode::OPAQUE);
+    renderer.SetRasterizerMode(eRasterizerMode::SOLID_CULL_BACK);
+    renderer.SetSamplerMode(eSamplerMode::BILINEAR_WRAP);
+    renderer.SetDepthMode(eDepthMode::READ_WRITE_LESS_EQUAL);
+    renderer.BindTexture(&s_checkerTexture);
+    renderer.DrawVertexArray(groundVerts);
+
+    renderer.BindTexture(nullptr);
+    renderer.DrawVertexArray(m_occluderVerts);
+
+    for (Prop const* prop : m_props)
+    {
+        prop->Render(renderer);
+    }
+
+    renderer.EndCamera(worldCamera);
+
+    Camera screenCamera;
+    screenCamera.SetOrthoGraphicView(Vec2::ZERO, dimensions);
+
+    VertexList_PCU verts;
+    AddVertsForDisc2D(verts, dimensions * 0.5f, 300.f, 10.f, Rgba8::YELLOW);
+
+    renderer.BeginCamera(screenCamera);
+    renderer.SetModelConstants();
+    renderer.SetBlendMode(eBlendMode::OPAQUE);
+    renderer.SetRasterizerMode(eRasterizerMode::SOLID_CULL_BACK);
+    renderer.SetSamplerMode(eSamplerMode::BILINEAR_CLAMP);
+    renderer.SetDepthMode(eDepthMode::DISABLED);
+    renderer.BindTexture(nullptr);
+    renderer.DrawVertexArray(verts);
+    renderer.EndCamera(screenCamera);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Player-style perspective camera on the orbit, looking at the origin.
+//
+void HeadlessWorld::SetupWorldCamera(Camera&     out_camera,
+                                     float const aspect) const
+{
+    out_camera.SetPerspectiveGraphicView(aspect, Player::CAMERA_FOV_DEGREES, 0.1f, 100.f);
+
+    Mat44 c2r;
+
+    c2r.m_values[Mat44::Ix] = 0.f;
+    c2r.m_values[Mat44::Iz] = 1.f;
+    c2r.m_values[Mat44::Jx] = -1.f;
+    c2r.m_values[Mat44::Jy] = 0.f;
+    c2r.m_values[Mat44::Ky] = 1.f;
+    c2r.m_values[Mat44::Kz] = 0.f;
+
+    out_camera.SetCameraToRenderTransform(c2r);
+
+    float const horizontalDistance = sqrtf(m_cameraPosition.x * m_cameraPosition.x + m_cameraPosition.y * m_cameraPosition.y);
+    out_camera.SetPositionAndOrientation(m_cameraPosition, EulerAngles(Atan2Degrees(-m_cameraPosition.y, -m_cameraPosition.x), Atan2Degrees(m_cameraPosition.z, horizontalDistance), 0.f));
+}
+
+//----------------------------------------------------------------------------------------------------
+// Worlds are created on the main thread, so using a local RNG here never races with other worlds.
+//
+void HeadlessWorld::SpawnProps()
+{
+    RandomNumberGenerator rng;
+
+    m_props.reserve(m_config.m_propCount);
+
+    for (uint32_t i = 0; i < m_config.m_propCount; ++i)
+    {
+        Prop* prop = new Prop(nullptr);
+
+        prop->SetMeshType(i % 4 == 0 ? ePropMeshType::SPHERE : ePropMeshType::CUBE);
+        prop->m_position        = Vec3(rng.RollRandomFloatInRange(-50.f, 50.f), rng.RollRandomFloatInRange(-50.f, 50.f), 0.f);
+        prop->m_angularVelocity = EulerAngles(rng.RollRandomFloatInRange(-90.f, 90.f), rng.RollRandomFloatInRange(-90.f, 90.f), 0.f);
+
+        m_props.push_back(prop);
+        m_fullDetailVertexCount += prop->GetVertexCount();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void HeadlessWorld::SpawnOccluders()
+{
+    for (uint32_t i = 0; i < m_config.m_occluderCount; ++i)
+    {
+        float const degrees = 360.f * static_cast<float>(i) / static_cast<float>(m_config.m_occluderCount);
+        Vec3 const  center(12.f * CosDegrees(degrees), 12.f * SinDegrees(degrees), 3.f);
+
+        AddVertsForAABB3D(m_occluderVerts, AABB3(center - Vec3(2.f, 2.f, 4.f), center + Vec3(2.f, 2.f, 4.f)), Rgba8(120, 120, 140));
+    }
+}
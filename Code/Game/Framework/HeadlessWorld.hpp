@@ -0,0 +1,73 @@
+//----------------------------------------------------------------------------------------------------
+// HeadlessWorld.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Engine/Math/Vec3.hpp"
+#include "Engine/Renderer/VertexUtils.hpp"
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class Camera;
+class Prop;
+class SoftwareRenderer;
+
+//----------------------------------------------------------------------------------------------------
+struct sHeadlessWorldConfig
+{
+    uint32_t m_propCount                   = 10000;
+    float    m_fixedDeltaSeconds           = 1.f / 60.f;
+    bool     m_isLevelOfDetailEnabled      = true;
+    float    m_pixelsPerUnitAtUnitDistance = 779.4f;     // 900 px viewport, 60 degree vertical FOV
+    uint32_t m_occluderCount               = 0;          // Pillars in a ring between the camera orbit and the props
+};
+
+//----------------------------------------------------------------------------------------------------
+// One self-contained simulation: its own props and its own fixed-step clock, with no renderer, input
+// or V8 access. Nothing in Step() touches process-wide globals, so different worlds can be stepped on
+// different threads at the same time. Prop meshes come from the shared, read-only PropMeshCache.
+// A virtual camera orbits the origin so LOD selection and submitted-vertex counts can be checked
+// without a renderer; Render() draws the same view through the SoftwareRenderer.
+//----------------------------------------------------------------------------------------------------
+class HeadlessWorld
+{
+public:
+    explicit HeadlessWorld(sHeadlessWorldConfig const& config);
+    ~HeadlessWorld();
+
+    HeadlessWorld(HeadlessWorld const&)            = delete;
+    HeadlessWorld& operator=(HeadlessWorld const&) = delete;
+
+    void Step();
+    void Render(SoftwareRenderer& renderer) const;      // Props from the orbiting camera, plus a screen overlay
+    void SetupWorldCamera(Camera& out_camera, float aspect) const;
+
+    uint64_t GetFrameCount() const { return m_frameCount; }
+    double   GetSimulatedSeconds() const { return m_simulatedSeconds; }
+    size_t   GetPropCount() const { return m_props.size(); }
+    Vec3     GetCameraPosition() const { return m_cameraPosition; }
+
+    std::vector<Prop*> const& GetProps() const { return m_props; }
+    VertexList_PCU const&     GetOccluderVerts() const { return m_occluderVerts; }     // World space
+
+    // Vertices the props would submit this frame at their selected LOD, and at full detail
+    uint64_t GetSubmittedVertexCount() const { return m_submittedVertexCount; }
+    uint64_t GetFullDetailVertexCount() const { return m_fullDetailVertexCount; }
+
+private:
+    void SpawnProps();
+    void SpawnOccluders();
+
+    sHeadlessWorldConfig m_config;
+    std::vector<Prop*>   m_props;
+    VertexList_PCU       m_occluderVerts;
+    Vec3                 m_cameraPosition;
+    uint64_t             m_frameCount            = 0;
+    double               m_simulatedSeconds      = 0.0;
+    uint64_t             m_submittedVertexCount  = 0;
+    uint64_t             m_fullDetailVertexCount = 0;
+};
@@ -0,0 +1,118 @@
+//----------------------------------------------------------------------------------------------------
+// HeadlessWorldCheck.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/HeadlessRunner.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include "Engine/Core/StringUtils.hpp"
+#include "Game/Framework/HeadlessWorld.hpp"
+#include "Game/Framework/WorkerPool.hpp"
+
+//----------------------------------------------------------------------------------------------------
+struct sWorldMeasurement
+{
+    double   m_aggregateFramesPerSecond = 0.0;
+    uint64_t m_submittedVertexCount     = 0;     // Last frame, summed over all worlds
+    uint64_t m_fullDetailVertexCount    = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+static sWorldMeasurement Measure(sHeadlessRunConfig const& config,
+                                 WorkerPool&               workerPool,
+                                 uint32_t const            instanceCount)
+{
+    std::vector<std::unique_ptr<HeadlessWorld>> worlds;
+    worlds.reserve(instanceCount);
+
+    for (uint32_t i = 0; i < instanceCount; ++i)
+    {
+        worlds.push_back(std::make_unique<HeadlessWorld>(config.m_worldConfig));
+    }
+
+    uint32_t const frameCount = config.m_frameCount;
+    auto const     startTime  = std::chrono::steady_clock::now();
+
+    // Worlds never share mutable state, so each job runs its world to completion without a per-frame barrier.
+    workerPool.ParallelFor(instanceCount, [&worlds, frameCount](uint32_t const index, uint32_t)
+    {
+        for (uint32_t frame = 0; frame < frameCount; ++frame)
+        {
+            worlds[index]->Step();
+        }
+    });
+
+    std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - startTime;
+
+    sWorldMeasurement measurement;
+
+    if (elapsed.count() > 0.0)
+    {
+        measurement.m_aggregateFramesPerSecond = static_cast<double>(instanceCount) * frameCount / elapsed.count();
+    }
+
+    for (std::unique_ptr<HeadlessWorld> const& world : worlds)
+    {
+        measurement.m_submittedVertexCount += world->GetSubmittedVertexCount();
+        measurement.m_fullDetailVertexCount += world->GetFullDetailVertexCount();
+    }
+
+    return measurement;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool RunWorldScalingCheck(sHeadlessRunConfig const& config,
+                          WorkerPool&               workerPool)
+{
+    std::vector<uint32_t> instanceCounts;
+
+    for (uint32_t count = 1; count < config.m_instanceCount; count *= 2)
+    {
+        instanceCounts.push_back(count);
+    }
+
+    instanceCounts.push_back(config.m_instanceCount);
+
+    uint32_t const workerCount = workerPool.GetWorkerCount();
+
+    // HeadlessWorld steps C++ props only; the game, V8 and the JS frame are not in these numbers.
+    String report = Stringf("Headless scaling (C++ prop microbenchmark: no Game, V8 or JS): %u props/world, %u frames/world, %u workers\n",
+                            config.m_worldConfig.m_propCount, config.m_frameCount, workerCount);
+    report += Stringf("floor            %.2f of min(instances, workers)\n", config.m_minScalingEfficiency);
+    report += "instances  aggregateFPS  perInstanceFPS  scaling    floor  vertsPerFrame  fullDetailVerts\n";
+
+    double baselineFramesPerSecond = 0.0;
+    bool   isValid                 = true;
+
+    for (uint32_t const instanceCount : instanceCounts)
+    {
+        sWorldMeasurement const measurement = Measure(config, workerPool, instanceCount);
+
+        if (baselineFramesPerSecond == 0.0)
+        {
+            baselineFramesPerSecond = measurement.m_aggregateFramesPerSecond;
+        }
+
+        double const scaling      = baselineFramesPerSecond > 0.0 ? measurement.m_aggregateFramesPerSecond / baselineFramesPerSecond : 0.0;
+        double const scalingFloor = config.m_minScalingEfficiency * std::min(instanceCount, workerCount);
+        bool const   isAboveFloor = scaling >= scalingFloor;
+
+        isValid = isValid && isAboveFloor;
+
+        report += Stringf("%9u  %12.1f  %14.1f  %6.2fx  %6.2fx  %13llu  %15llu%s\n", instanceCount,
+                          measurement.m_aggregateFramesPerSecond, measurement.m_aggregateFramesPerSecond / instanceCount, scaling, scalingFloor,
+                          static_cast<unsigned long long>(measurement.m_submittedVertexCount), static_cast<unsigned long long>(measurement.m_fullDetailVertexCount),
+                          isAboveFloor ? "" : "  below floor");
+    }
+
+    report += Stringf("validation       %s\n", isValid ? "OK" : "FAILED");
+
+    WriteHeadlessReport(config.m_reportPath, report);
+
+    return isValid;
+}
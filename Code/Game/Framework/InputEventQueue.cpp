@@ -0,0 +1,318 @@
+//----------------------------------------------------------------------------------------------------
+// InputEventQueue.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/InputEventQueue.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <chrono>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#endif
+
+#include "Engine/Core/EngineCommon.hpp"
+
+#if defined(_WIN32)
+//----------------------------------------------------------------------------------------------------
+// The engine window owns its window procedure; the hook sits in front of it and forwards everything.
+//
+static InputEventQueue* s_hookedQueue        = nullptr;
+static WNDPROC          s_previousWindowProc = nullptr;
+static int64_t          s_lastMessageTime    = 0;
+
+//----------------------------------------------------------------------------------------------------
+// When the message was posted, in GetTimestamp() ticks. GetMessageTime() is GetTickCount() milliseconds
+// (10-16 ms resolution), so its age is measured against GetTickCount() and taken off the current tick.
+// The wrap-safe 32-bit difference covers the 49.7-day rollover; clamping to the last result keeps the
+// coarse clock from putting an event before the one pushed ahead of it.
+//
+static int64_t GetMessageTimestamp()
+{
+    int32_t const ageMilliseconds = std::max(static_cast<int32_t>(GetTickCount() - static_cast<DWORD>(GetMessageTime())), 0);
+    int64_t const ageTicks        = static_cast<int64_t>(ageMilliseconds * 0.001 / InputEventQueue::GetSecondsPerTick());
+
+    s_lastMessageTime = std::max(InputEventQueue::GetTimestamp() - ageTicks, s_lastMessageTime);
+
+    return s_lastMessageTime;
+}
+
+//----------------------------------------------------------------------------------------------------
+static LRESULT CALLBACK InputEventWindowProc(HWND const   windowHandle,
+                                             UINT const   message,
+                                             WPARAM const wParam,
+                                             LPARAM const lParam)
+{
+    if (s_hookedQueue != nullptr)
+    {
+        sInputEvent event;
+        event.m_timestamp = GetMessageTimestamp();
+
+        bool isInputMessage = true;
+
+        switch (message)
+        {
+        case WM_KEYDOWN:
+        case WM_SYSKEYDOWN:
+            // Bit 30 is set for auto-repeat; only the first press is an edge.
+            isInputMessage  = (lParam & (1 << 30)) == 0;
+            event.m_keyCode = static_cast<uint8_t>(wParam);
+            event.m_type    = eInputEventType::KEY_DOWN;
+            break;
+        case WM_KEYUP:
+        case WM_SYSKEYUP:
+            event.m_keyCode = static_cast<uint8_t>(wParam);
+            event.m_type    = eInputEventType::KEY_UP;
+            break;
+        case WM_LBUTTONDOWN: event.m_keyCode = VK_LBUTTON; event.m_type = eInputEventType::KEY_DOWN; break;
+        case WM_LBUTTONUP:   event.m_keyCode = VK_LBUTTON; event.m_type = eInputEventType::KEY_UP;   break;
+        case WM_RBUTTONDOWN: event.m_keyCode = VK_RBUTTON; event.m_type = eInputEventType::KEY_DOWN; break;
+        case WM_RBUTTONUP:   event.m_keyCode = VK_RBUTTON; event.m_type = eInputEventType::KEY_UP;   break;
+        case WM_MBUTTONDOWN: event.m_keyCode = VK_MBUTTON; event.m_type = eInputEventType::KEY_DOWN; break;
+        case WM_MBUTTONUP:   event.m_keyCode = VK_MBUTTON; event.m_type = eInputEventType::KEY_UP;   break;
+        case WM_ACTIVATE:
+            if (LOWORD(wParam) == WA_INACTIVE)
+            {
+                s_hookedQueue->ReleaseAllKeys(event.m_timestamp);
+            }
+            isInputMessage = false;
+            break;
+        case WM_KILLFOCUS:
+            // The ups for keys held now go to whichever window gets focus, never to this one.
+            s_hookedQueue->ReleaseAllKeys(event.m_timestamp);
+            isInputMessage = false;
+            break;
+        default:
+            isInputMessage = false;
+            break;
+        }
+
+        if (isInputMessage)
+        {
+            s_hookedQueue->Push(event);
+        }
+    }
+
+    return CallWindowProc(s_previousWindowProc, windowHandle, message, wParam, lParam);
+}
+#endif
+
+//----------------------------------------------------------------------------------------------------
+InputEventQueue::InputEventQueue(sInputEventQueueConfig const& config)
+{
+    uint32_t const capacity = std::bit_ceil(std::max(config.m_capacity, 2u));
+
+    m_events.resize(capacity);
+    m_mask = capacity - 1;
+}
+
+//----------------------------------------------------------------------------------------------------
+InputEventQueue::~InputEventQueue()
+{
+    RemoveWindowHook();
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputEventQueue::Push(sInputEvent const& event)
+{
+    uint64_t const writeIndex = m_writeIndex.load(std::memory_order_relaxed);
+
+    if (writeIndex - m_readIndex.load(std::memory_order_acquire) > m_mask)
+    {
+        m_droppedCount.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    m_events[writeIndex & m_mask] = event;
+    m_writeIndex.store(writeIndex + 1, std::memory_order_release);
+
+    m_pushedKeyDown[event.m_keyCode] = event.m_type == eInputEventType::KEY_DOWN;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Called again for the same focus loss (WM_ACTIVATE then WM_KILLFOCUS), it finds nothing held and
+// pushes nothing.
+//
+uint32_t InputEventQueue::ReleaseAllKeys(int64_t const timestamp)
+{
+    uint32_t releasedCount = 0;
+
+    for (uint32_t keyCode = 0; keyCode < m_pushedKeyDown.size(); ++keyCode)
+    {
+        if (!m_pushedKeyDown[keyCode])
+        {
+            continue;
+        }
+
+        sInputEvent release;
+        release.m_timestamp = timestamp;
+        release.m_keyCode   = static_cast<uint8_t>(keyCode);
+        release.m_type      = eInputEventType::KEY_UP;
+
+        releasedCount += Push(release) ? 1 : 0;
+    }
+
+    return releasedCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Events stamped after stepTimestamp stay queued for a later step. Latency is measured from the event
+// timestamp to the step that applies it.
+//
+void InputEventQueue::ConsumeStep(int64_t const stepTimestamp)
+{
+    m_justPressed.reset();
+    m_justReleased.reset();
+    m_latencyStats.m_stepEventCount = 0;
+
+    uint64_t const writeIndex     = m_writeIndex.load(std::memory_order_acquire);
+    uint64_t       readIndex      = m_readIndex.load(std::memory_order_relaxed);
+    double const   secondsPerTick = GetSecondsPerTick();
+
+    while (readIndex != writeIndex)
+    {
+        sInputEvent const& event = m_events[readIndex & m_mask];
+
+        if (event.m_timestamp > stepTimestamp)
+        {
+            break;
+        }
+
+        if (event.m_type == eInputEventType::KEY_DOWN)
+        {
+            // A repeated down without an up in between (focus loss, a missed message) is not a new edge.
+            if (!m_keyDown[event.m_keyCode])
+            {
+                m_justPressed[event.m_keyCode] = true;
+            }
+
+            m_keyDown[event.m_keyCode] = true;
+        }
+        else
+        {
+            if (m_keyDown[event.m_keyCode])
+            {
+                m_justReleased[event.m_keyCode] = true;
+            }
+
+            m_keyDown[event.m_keyCode] = false;
+        }
+
+        double const latencySeconds = static_cast<double>(stepTimestamp - event.m_timestamp) * secondsPerTick;
+
+        ++m_latencyStats.m_eventCount;
+        ++m_latencyStats.m_stepEventCount;
+        m_latencyStats.m_totalSeconds += latencySeconds;
+        m_latencyStats.m_maxSeconds  = std::max(m_latencyStats.m_maxSeconds, latencySeconds);
+        m_latencyStats.m_lastSeconds = latencySeconds;
+
+        ++readIndex;
+    }
+
+    m_readIndex.store(readIndex, std::memory_order_release);
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputEventQueue::ResetLatencyStats()
+{
+    m_latencyStats = sInputLatencyStats();
+    m_droppedCount.store(0, std::memory_order_relaxed);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputEventQueue::IsKeyDown(uint8_t const keyCode) const
+{
+    return m_keyDown[keyCode];
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputEventQueue::WasKeyJustPressed(uint8_t const keyCode) const
+{
+    return m_justPressed[keyCode];
+}
+
+//----------------------------------------------------------------------------------------------------
+bool InputEventQueue::WasKeyJustReleased(uint8_t const keyCode) const
+{
+    return m_justReleased[keyCode];
+}
+
+//----------------------------------------------------------------------------------------------------
+sInputLatencyStats InputEventQueue::GetLatencyStats() const
+{
+    sInputLatencyStats stats = m_latencyStats;
+    stats.m_droppedCount     = m_droppedCount.load(std::memory_order_relaxed);
+
+    return stats;
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputEventQueue::InstallWindowHook(void* const windowHandle)
+{
+#if defined(_WIN32)
+    if (windowHandle == nullptr || s_hookedQueue != nullptr)
+    {
+        return;
+    }
+
+    s_hookedQueue        = this;
+    s_previousWindowProc = reinterpret_cast<WNDPROC>(SetWindowLongPtr(static_cast<HWND>(windowHandle), GWLP_WNDPROC,
+                                                                       reinterpret_cast<LONG_PTR>(InputEventWindowProc)));
+    m_hookedWindowHandle = windowHandle;
+#else
+    UNUSED(windowHandle)
+#endif
+}
+
+//----------------------------------------------------------------------------------------------------
+void InputEventQueue::RemoveWindowHook()
+{
+#if defined(_WIN32)
+    if (m_hookedWindowHandle == nullptr)
+    {
+        return;
+    }
+
+    SetWindowLongPtr(static_cast<HWND>(m_hookedWindowHandle), GWLP_WNDPROC, reinterpret_cast<LONG_PTR>(s_previousWindowProc));
+
+    s_hookedQueue        = nullptr;
+    s_previousWindowProc = nullptr;
+    m_hookedWindowHandle = nullptr;
+#endif
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC int64_t InputEventQueue::GetTimestamp()
+{
+#if defined(_WIN32)
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+
+    return counter.QuadPart;
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC double InputEventQueue::GetSecondsPerTick()
+{
+#if defined(_WIN32)
+    static double const secondsPerTick = []()
+    {
+        LARGE_INTEGER frequency;
+        QueryPerformanceFrequency(&frequency);
+
+        return 1.0 / static_cast<double>(frequency.QuadPart);
+    }();
+
+    return secondsPerTick;
+#else
+    return 1e-9;
+#endif
+}
@@ -0,0 +1,100 @@
+//----------------------------------------------------------------------------------------------------
+// InputEventQueue.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <atomic>
+#include <bitset>
+#include <cstdint>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+enum class eInputEventType : uint8_t
+{
+    KEY_DOWN,
+    KEY_UP
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sInputEvent
+{
+    int64_t         m_timestamp = 0;      // InputEventQueue::GetTimestamp() ticks when the message was posted
+    uint8_t         m_keyCode   = 0;      // Same codes as the engine KEYCODE_* values (mouse buttons too)
+    eInputEventType m_type      = eInputEventType::KEY_DOWN;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sInputEventQueueConfig
+{
+    uint32_t m_capacity = 1024;      // Rounded up to a power of two
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sInputLatencyStats
+{
+    uint64_t m_eventCount     = 0;      // Consumed by a sim step
+    uint64_t m_droppedCount   = 0;      // Pushed while the ring was full
+    uint32_t m_stepEventCount = 0;      // Consumed by the most recent step
+    double   m_totalSeconds   = 0.0;    // Sum of event-to-step latencies
+    double   m_maxSeconds     = 0.0;
+    double   m_lastSeconds    = 0.0;    // Most recent consumed event
+
+    double GetAverageSeconds() const { return m_eventCount > 0 ? m_totalSeconds / static_cast<double>(m_eventCount) : 0.0; }
+};
+
+//----------------------------------------------------------------------------------------------------
+// Key and mouse button events, timestamped when Windows posted them and handed to the simulation
+// through a lock-free single-producer / single-consumer ring. Each sim step calls ConsumeStep() with its
+// own timestamp and applies every event up to it, so a tap shorter than a frame still shows up as a
+// press and a release, and an edge is seen by exactly one step however many steps a frame runs.
+//
+// Push() and ReleaseAllKeys() are the producer side (the window message handler, or a test thread
+// injecting synthetic events); everything else belongs to the consumer. Timestamps must not go backwards.
+//
+// A window that loses focus gets no key-up for keys still held, so the hook answers WM_KILLFOCUS and
+// WM_ACTIVATE (WA_INACTIVE) with ReleaseAllKeys(): one synthetic up per key the producer last pushed down.
+//----------------------------------------------------------------------------------------------------
+class InputEventQueue
+{
+public:
+    explicit InputEventQueue(sInputEventQueueConfig const& config);
+    ~InputEventQueue();
+
+    InputEventQueue(InputEventQueue const&)            = delete;
+    InputEventQueue& operator=(InputEventQueue const&) = delete;
+
+    bool     Push(sInputEvent const& event);        // false (and counted as dropped) when the ring is full
+    uint32_t ReleaseAllKeys(int64_t timestamp);     // Key-ups pushed; a key whose up was dropped stays held
+
+    void ConsumeStep(int64_t stepTimestamp);
+    void ResetLatencyStats();
+
+    bool IsKeyDown(uint8_t keyCode) const;
+    bool WasKeyJustPressed(uint8_t keyCode) const;       // Pressed during the last consumed step
+    bool WasKeyJustReleased(uint8_t keyCode) const;
+
+    sInputLatencyStats GetLatencyStats() const;
+
+    // Feeds window key and mouse button messages into this queue (Windows only; no-op elsewhere).
+    void InstallWindowHook(void* windowHandle);
+    void RemoveWindowHook();
+
+    static int64_t GetTimestamp();
+    static double  GetSecondsPerTick();
+
+private:
+    std::vector<sInputEvent> m_events;
+    uint32_t                 m_mask = 0;
+    std::atomic<uint64_t>    m_writeIndex{0};      // Producer only
+    std::atomic<uint64_t>    m_readIndex{0};       // Consumer only
+    std::atomic<uint64_t>    m_droppedCount{0};
+    std::bitset<256>         m_pushedKeyDown;      // Producer only: down as of the last pushed event per key
+
+    std::bitset<256>   m_keyDown;
+    std::bitset<256>   m_justPressed;
+    std::bitset<256>   m_justReleased;
+    sInputLatencyStats m_latencyStats;
+
+    void* m_hookedWindowHandle = nullptr;
+};
@@ -0,0 +1,194 @@
+//----------------------------------------------------------------------------------------------------
+// InputEventQueueCheck.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/HeadlessRunner.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bitset>
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Math/RandomNumberGenerator.hpp"
+#include "Game/Framework/InputEventQueue.hpp"
+
+//----------------------------------------------------------------------------------------------------
+bool RunInputEventsCheck(sHeadlessRunConfig const& config)
+{
+    uint32_t const eventCount     = config.m_inputEventCount;
+    double const   ticksPerSecond = 1.0 / InputEventQueue::GetSecondsPerTick();
+    int64_t const  stepTicks      = static_cast<int64_t>(ticksPerSecond / 60.0);
+
+    // Random presses on a handful of keys; about half are taps shorter than one step. Gaps of at least
+    // 0.5 ms keep a step under the ring capacity, so the consumer never waits on a full ring.
+    uint8_t const            keyCodes[] = {'W', 'A', 'S', 'D', 'Q', 'E', 'H', ' '};
+    std::vector<sInputEvent> events;
+    std::bitset<256>         isHeld;
+    RandomNumberGenerator    rng;
+    int64_t                  timestamp = stepTicks;
+
+    events.reserve(eventCount + 1);
+
+    while (events.size() < eventCount)
+    {
+        timestamp += static_cast<int64_t>(rng.RollRandomFloatInRange(0.0005f, 0.008f) * ticksPerSecond);
+
+        sInputEvent event;
+        event.m_timestamp = timestamp;
+        event.m_keyCode   = keyCodes[rng.RollRandomIntInRange(0, static_cast<int>(std::size(keyCodes)) - 1)];
+        event.m_type      = isHeld[event.m_keyCode] ? eInputEventType::KEY_UP : eInputEventType::KEY_DOWN;
+
+        isHeld[event.m_keyCode] = !isHeld[event.m_keyCode];
+        events.push_back(event);
+
+        if (event.m_type == eInputEventType::KEY_DOWN && rng.RollRandomFloatZeroToOne() < 0.5f)
+        {
+            sInputEvent release = event;
+            release.m_timestamp = timestamp + static_cast<int64_t>(rng.RollRandomFloatInRange(0.0005f, 0.005f) * ticksPerSecond);
+            release.m_type      = eInputEventType::KEY_UP;
+            timestamp           = release.m_timestamp;
+
+            isHeld[event.m_keyCode] = false;
+            events.push_back(release);
+        }
+    }
+
+    // A small ring, so the producer regularly finds it full and has to retry.
+    sInputEventQueueConfig queueConfig;
+    queueConfig.m_capacity = 64;
+
+    InputEventQueue       queue(queueConfig);
+    std::atomic<int64_t>  publishedTimestamp{0};      // Everything stamped at or before this has been pushed
+    std::atomic<uint32_t> retryCount{0};
+
+    auto const startTime = std::chrono::steady_clock::now();
+
+    std::thread producer([&]()
+    {
+        for (sInputEvent const& event : events)
+        {
+            publishedTimestamp.store(event.m_timestamp - 1, std::memory_order_release);
+
+            while (!queue.Push(event))
+            {
+                retryCount.fetch_add(1, std::memory_order_relaxed);
+                std::this_thread::yield();
+            }
+        }
+
+        publishedTimestamp.store(INT64_MAX, std::memory_order_release);
+    });
+
+    // Replay of the same list: per step, the expected held keys and edges.
+    std::bitset<256> expectedDown;
+    size_t           replayIndex     = 0;
+    uint64_t         stepCount       = 0;
+    uint32_t         mismatchCount   = 0;
+    uint32_t         tapEdgeCount    = 0;     // Press and release inside one step, seen by the queue
+    uint32_t         pollingMissed   = 0;     // The same taps, invisible to a once-per-step key poll
+    double           expectedLatency = 0.0;
+
+    while (replayIndex < events.size())
+    {
+        int64_t const stepTimestamp = static_cast<int64_t>(stepCount + 1) * stepTicks;
+
+        while (publishedTimestamp.load(std::memory_order_acquire) < stepTimestamp && publishedTimestamp.load(std::memory_order_acquire) != INT64_MAX)
+        {
+            std::this_thread::yield();
+        }
+
+        queue.ConsumeStep(stepTimestamp);
+
+        std::bitset<256> const wasDown = expectedDown;
+        std::bitset<256>       expectedPressed;
+        std::bitset<256>       expectedReleased;
+
+        for (; replayIndex < events.size() && events[replayIndex].m_timestamp <= stepTimestamp; ++replayIndex)
+        {
+            sInputEvent const& event   = events[replayIndex];
+            bool const         isPress = event.m_type == eInputEventType::KEY_DOWN;
+
+            if (isPress && !expectedDown[event.m_keyCode]) expectedPressed[event.m_keyCode] = true;
+            if (!isPress && expectedDown[event.m_keyCode]) expectedReleased[event.m_keyCode] = true;
+
+            expectedDown[event.m_keyCode] = isPress;
+            expectedLatency += static_cast<double>(stepTimestamp - event.m_timestamp) * InputEventQueue::GetSecondsPerTick();
+        }
+
+        for (uint8_t const keyCode : keyCodes)
+        {
+            if (queue.IsKeyDown(keyCode) != expectedDown[keyCode] || queue.WasKeyJustPressed(keyCode) != expectedPressed[keyCode] ||
+                queue.WasKeyJustReleased(keyCode) != expectedReleased[keyCode])
+            {
+                ++mismatchCount;
+            }
+
+            if (queue.WasKeyJustPressed(keyCode) && queue.WasKeyJustReleased(keyCode) && !queue.IsKeyDown(keyCode))
+            {
+                ++tapEdgeCount;
+                pollingMissed += !wasDown[keyCode] ? 1 : 0;
+            }
+        }
+
+        ++stepCount;
+    }
+
+    producer.join();
+
+    double const             wallMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+    sInputLatencyStats const stats            = queue.GetLatencyStats();
+
+    // Focus loss: keys held when the window deactivates get synthetic ups, stamped with the loss, so the
+    // step that consumes it sees them released. The WM_KILLFOCUS that follows WM_ACTIVATE finds nothing.
+    InputEventQueue focusQueue(queueConfig);
+    uint8_t const   heldKeyCodes[] = {'W', 'D', ' '};
+    int64_t const   lossTimestamp  = stepTicks + stepTicks / 2;
+
+    for (uint8_t const keyCode : heldKeyCodes)
+    {
+        sInputEvent press;
+        press.m_timestamp = stepTicks / 2;
+        press.m_keyCode   = keyCode;
+        press.m_type      = eInputEventType::KEY_DOWN;
+
+        focusQueue.Push(press);
+    }
+
+    focusQueue.ConsumeStep(stepTicks);
+
+    uint32_t const releasedCount       = focusQueue.ReleaseAllKeys(lossTimestamp);
+    uint32_t const secondReleasedCount = focusQueue.ReleaseAllKeys(lossTimestamp);
+    uint32_t       focusMismatchCount  = 0;
+
+    focusQueue.ConsumeStep(stepTicks * 2);
+
+    for (uint8_t const keyCode : heldKeyCodes)
+    {
+        focusMismatchCount += focusQueue.IsKeyDown(keyCode) || !focusQueue.WasKeyJustReleased(keyCode) ? 1 : 0;
+    }
+
+    bool const isFocusLossValid = releasedCount == std::size(heldKeyCodes) && secondReleasedCount == 0 && focusMismatchCount == 0;
+
+    bool const isLatencyMatch = std::fabs(stats.m_totalSeconds - expectedLatency) <= 1e-6 * std::max(expectedLatency, 1.0);
+    bool const isValid        = mismatchCount == 0 && stats.m_eventCount == events.size() && stats.m_droppedCount == retryCount.load() && isLatencyMatch &&
+                                isFocusLossValid;
+
+    String report = Stringf("Input events: %u over %llu steps of 1/60 s, ring of %u\n", static_cast<uint32_t>(events.size()), stepCount, queueConfig.m_capacity);
+    report += Stringf("consumed         %llu, %llu push retries on a full ring\n", stats.m_eventCount, stats.m_droppedCount);
+    report += Stringf("latency ms       avg %.3f, max %.3f (event to consuming step)\n", stats.GetAverageSeconds() * 1000.0, stats.m_maxSeconds * 1000.0);
+    report += Stringf("sub-step taps    %u seen as press + release in one step, %u missed by per-step polling\n", tapEdgeCount, pollingMissed);
+    report += Stringf("step mismatches  %u\n", mismatchCount);
+    report += Stringf("focus loss       %u of %u held keys released, %u on the repeat, %u wrong after the step\n", releasedCount,
+                      static_cast<uint32_t>(std::size(heldKeyCodes)), secondReleasedCount, focusMismatchCount);
+    report += Stringf("wall ms          %.3f\n", wallMilliseconds);
+    report += Stringf("validation       %s\n", isValid ? "OK" : "FAILED");
+
+    WriteHeadlessReport(config.m_inputReportPath, report);
+
+    return isValid;
+}
@@ -5,15 +5,53 @@
 #include "Engine/Core/EngineCommon.hpp"
 #include "Game/Framework/App.hpp"
 #include "Game/Framework/GameCommon.hpp"
+#include "Game/Game.hpp"
+#include "Game/Framework/HeadlessRunner.hpp"
+#include "Game/Framework/PerfComparator.hpp"
+#include "Game/Framework/StressScenario.hpp"
 
 //-----------------------------------------------------------------------------------------------
 int WINAPI WinMain(HINSTANCE const applicationInstanceHandle, HINSTANCE, LPSTR const commandLineString, int)
 {
     UNUSED(applicationInstanceHandle)
-    UNUSED(commandLineString)
+
+    // Regression check: benchmark / scenario JSON against the checked-in baseline; exit code 1 on regression.
+    sPerfCompareConfig perfCompareConfig;
+
+    if (commandLineString != nullptr && PerfComparator::ParseCommandLine(commandLineString, perfCompareConfig))
+    {
+        PerfComparator perfComparator(perfCompareConfig);
+        return perfComparator.Run();
+    }
+
+    // Headless multi-instance mode: no window, renderer or V8, just parallel simulation throughput.
+    // Exit code 1 when any mode's validation failed.
+    sHeadlessRunConfig headlessConfig;
+
+    if (commandLineString != nullptr && HeadlessRunner::ParseCommandLine(commandLineString, headlessConfig))
+    {
+        HeadlessRunner headlessRunner(headlessConfig);
+        return headlessRunner.Run();
+    }
 
     g_app = new App();
     g_app->Startup();
+
+    sFastForwardConfig fastForwardConfig;
+
+    if (commandLineString != nullptr && Game::ParseFastForwardCommandLine(commandLineString, fastForwardConfig))
+    {
+        g_game->SetFastForward(true, fastForwardConfig);
+    }
+
+    // Scalability run: Data/Scripts/StressScenario.js ramps the entity count through the real bridge.
+    sStressScenarioConfig stressConfig;
+
+    if (commandLineString != nullptr && StressScenario::ParseCommandLine(commandLineString, stressConfig))
+    {
+        g_game->StartStressScenario(stressConfig);
+    }
+
     g_app->RunMainLoop();
     g_app->Shutdown();
 
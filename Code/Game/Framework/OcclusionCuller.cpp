@@ -0,0 +1,252 @@
+//----------------------------------------------------------------------------------------------------
+// OcclusionCuller.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/OcclusionCuller.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <cmath>
+
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/Vec4.hpp"
+#include "Engine/Renderer/Camera.hpp"
+
+//----------------------------------------------------------------------------------------------------
+static sSoftwareRendererConfig MakeRendererConfig(sOcclusionCullerConfig const& config)
+{
+    sSoftwareRendererConfig rendererConfig;
+    rendererConfig.m_dimensions = config.m_dimensions;
+    rendererConfig.m_workerPool = config.m_workerPool;
+
+    return rendererConfig;
+}
+
+//----------------------------------------------------------------------------------------------------
+OcclusionCuller::OcclusionCuller(sOcclusionCullerConfig const& config)
+    : m_renderer(MakeRendererConfig(config))
+{
+    IntVec2 dimensions = m_renderer.GetDimensions();
+
+    while (true)
+    {
+        m_levelDimensions.push_back(dimensions);
+        m_levels.emplace_back(static_cast<size_t>(dimensions.x) * dimensions.y, 1.f);
+
+        if (dimensions.x == 1 && dimensions.y == 1)
+        {
+            break;
+        }
+
+        dimensions = IntVec2((dimensions.x + 1) / 2, (dimensions.y + 1) / 2);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void OcclusionCuller::BeginFrame(Camera const& camera)
+{
+    m_stats = sOcclusionCullerStats();
+
+    m_renderer.BeginFrame();
+    m_renderer.ClearScreen(Rgba8::BLACK);
+    m_renderer.BeginCamera(camera);
+    m_worldToClip = m_renderer.GetWorldToClip();
+
+    // Both faces are rasterized so open occluders (walls, ground grids) work as well as closed meshes.
+    m_renderer.SetBlendMode(eBlendMode::OPAQUE);
+    m_renderer.SetRasterizerMode(eRasterizerMode::SOLID_CULL_NONE);
+    m_renderer.SetDepthMode(eDepthMode::READ_WRITE_LESS_EQUAL);
+    m_renderer.BindTexture(nullptr);
+    m_renderer.SetColorWriteEnabled(false);
+}
+
+//----------------------------------------------------------------------------------------------------
+void OcclusionCuller::AddOccluder(VertexList_PCU const& vertexes,
+                                  Mat44 const&          modelToWorld)
+{
+    m_renderer.SetModelConstants(modelToWorld);
+    m_renderer.DrawVertexArray(vertexes);
+}
+
+//----------------------------------------------------------------------------------------------------
+void OcclusionCuller::EndOccluders()
+{
+    auto const startTime = std::chrono::steady_clock::now();
+
+    m_renderer.EndFrame();
+    BuildDepthPyramid();
+
+    sSoftwareRenderStats const& rendererStats = m_renderer.GetStats();
+
+    m_stats.m_occluderTriangleCount = rendererStats.m_submittedTriangleCount;
+    m_stats.m_rasterMilliseconds    = rendererStats.m_vertexMilliseconds + rendererStats.m_binMilliseconds +
+                                      std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+//----------------------------------------------------------------------------------------------------
+bool OcclusionCuller::IsOccluded(AABB3 const& worldBounds)
+{
+    bool const isOccluded = TestOccluded(worldBounds);
+
+    AddTestCounts(1, isOccluded ? 1 : 0);
+
+    return isOccluded;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool OcclusionCuller::TestOccluded(AABB3 const& worldBounds) const
+{
+    sScreenRect rect;
+
+    if (!ProjectBounds(worldBounds, rect))
+    {
+        return false;
+    }
+
+    // Coarsest level at which the rectangle still touches no more than 2x2 texels.
+    int level = 0;
+
+    while (level + 1 < static_cast<int>(m_levels.size()) &&
+           (((rect.m_maxX - 1) >> level) - (rect.m_minX >> level) > 1 || ((rect.m_maxY - 1) >> level) - (rect.m_minY >> level) > 1))
+    {
+        ++level;
+    }
+
+    std::vector<float> const& depths = m_levels[level];
+    int const                 width  = m_levelDimensions[level].x;
+
+    for (int y = rect.m_minY >> level; y <= (rect.m_maxY - 1) >> level; ++y)
+    {
+        for (int x = rect.m_minX >> level; x <= (rect.m_maxX - 1) >> level; ++x)
+        {
+            if (depths[static_cast<size_t>(y) * width + x] >= rect.m_nearestDepth)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void OcclusionCuller::AddTestCounts(uint32_t const testedCount,
+                                    uint32_t const occludedCount)
+{
+    m_stats.m_testedCount += testedCount;
+    m_stats.m_occludedCount += occludedCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool OcclusionCuller::IsOccludedReference(AABB3 const& worldBounds) const
+{
+    sScreenRect rect;
+
+    if (!ProjectBounds(worldBounds, rect))
+    {
+        return false;
+    }
+
+    for (int y = rect.m_minY; y < rect.m_maxY; ++y)
+    {
+        for (int x = rect.m_minX; x < rect.m_maxX; ++x)
+        {
+            if (m_renderer.GetDepth(x, y) >= rect.m_nearestDepth)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Returns false when the box cannot be tested and must be treated as visible.
+//
+bool OcclusionCuller::ProjectBounds(AABB3 const& worldBounds,
+                                    sScreenRect& out_rect) const
+{
+    IntVec2 const dimensions = m_renderer.GetDimensions();
+
+    float minX         = FLT_MAX;
+    float minY         = FLT_MAX;
+    float maxX         = -FLT_MAX;
+    float maxY         = -FLT_MAX;
+    float nearestDepth = FLT_MAX;
+
+    for (int corner = 0; corner < 8; ++corner)
+    {
+        Vec4 const position((corner & 1) ? worldBounds.m_maxs.x : worldBounds.m_mins.x,
+                            (corner & 2) ? worldBounds.m_maxs.y : worldBounds.m_mins.y,
+                            (corner & 4) ? worldBounds.m_maxs.z : worldBounds.m_mins.z,
+                            1.f);
+        Vec4 const clip = m_worldToClip.TransformHomogeneous3D(position);
+
+        // Crossing the near plane: the box surrounds or touches the camera.
+        if (clip.w <= 0.f || clip.z < 0.f)
+        {
+            return false;
+        }
+
+        float const inverseW = 1.f / clip.w;
+        float const screenX  = (clip.x * inverseW * 0.5f + 0.5f) * static_cast<float>(dimensions.x);
+        float const screenY  = (0.5f - clip.y * inverseW * 0.5f) * static_cast<float>(dimensions.y);
+
+        minX         = std::min(minX, screenX);
+        minY         = std::min(minY, screenY);
+        maxX         = std::max(maxX, screenX);
+        maxY         = std::max(maxY, screenY);
+        nearestDepth = std::min(nearestDepth, clip.z * inverseW);
+    }
+
+    out_rect.m_minX         = std::max(static_cast<int>(std::floor(minX)), 0);
+    out_rect.m_minY         = std::max(static_cast<int>(std::floor(minY)), 0);
+    out_rect.m_maxX         = std::min(static_cast<int>(std::ceil(maxX)), dimensions.x);
+    out_rect.m_maxY         = std::min(static_cast<int>(std::ceil(maxY)), dimensions.y);
+    out_rect.m_nearestDepth = nearestDepth;
+
+    // Fully off-screen boxes are left to frustum culling.
+    return out_rect.m_minX < out_rect.m_maxX && out_rect.m_minY < out_rect.m_maxY;
+}
+
+//----------------------------------------------------------------------------------------------------
+void OcclusionCuller::BuildDepthPyramid()
+{
+    IntVec2 const dimensions = m_levelDimensions[0];
+
+    for (int y = 0; y < dimensions.y; ++y)
+    {
+        for (int x = 0; x < dimensions.x; ++x)
+        {
+            m_levels[0][static_cast<size_t>(y) * dimensions.x + x] = m_renderer.GetDepth(x, y);
+        }
+    }
+
+    for (size_t level = 1; level < m_levels.size(); ++level)
+    {
+        std::vector<float> const& source     = m_levels[level - 1];
+        IntVec2 const             sourceSize = m_levelDimensions[level - 1];
+        IntVec2 const             size       = m_levelDimensions[level];
+
+        for (int y = 0; y < size.y; ++y)
+        {
+            // Odd source sizes: the last texel covers a single row or column.
+            int const y0 = y * 2;
+            int const y1 = std::min(y0 + 1, sourceSize.y - 1);
+
+            for (int x = 0; x < size.x; ++x)
+            {
+                int const x0 = x * 2;
+                int const x1 = std::min(x0 + 1, sourceSize.x - 1);
+
+                m_levels[level][static_cast<size_t>(y) * size.x + x] = std::max({source[static_cast<size_t>(y0) * sourceSize.x + x0],
+                                                                                 source[static_cast<size_t>(y0) * sourceSize.x + x1],
+                                                                                 source[static_cast<size_t>(y1) * sourceSize.x + x0],
+                                                                                 source[static_cast<size_t>(y1) * sourceSize.x + x1]});
+            }
+        }
+    }
+}
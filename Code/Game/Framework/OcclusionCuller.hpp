@@ -0,0 +1,87 @@
+//----------------------------------------------------------------------------------------------------
+// OcclusionCuller.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "Engine/Math/IntVec2.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Renderer/VertexUtils.hpp"
+#include "Game/Framework/SoftwareRenderer.hpp"
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class Camera;
+class WorkerPool;
+struct AABB3;
+
+//----------------------------------------------------------------------------------------------------
+struct sOcclusionCullerConfig
+{
+    IntVec2     m_dimensions = IntVec2(256, 128);     // Depth buffer resolution, independent of the window
+    WorkerPool* m_workerPool = nullptr;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Per-frame counts and timings, reset by BeginFrame().
+//----------------------------------------------------------------------------------------------------
+struct sOcclusionCullerStats
+{
+    uint32_t m_occluderTriangleCount = 0;
+    uint32_t m_testedCount           = 0;
+    uint32_t m_occludedCount         = 0;
+    double   m_rasterMilliseconds    = 0.0;     // Occluder rasterization and pyramid build
+};
+
+//----------------------------------------------------------------------------------------------------
+// Software occlusion culling against a low-resolution depth buffer.
+//
+// Each frame the designated occluders are rasterized depth-only through a small SoftwareRenderer (tile
+// parallel on the WorkerPool), then a max-depth pyramid is built over the result. A bounding box is
+// occluded when its nearest projected depth lies behind the farthest occluder depth of every texel it
+// covers; the test reads the coarsest pyramid level where the box spans at most 2x2 texels, so it costs
+// the same for small and large boxes.
+//
+// The test is conservative: boxes that cross the near plane, leave the screen or touch uncovered pixels
+// are always reported visible. IsOccludedReference() runs the same test pixel by pixel at full
+// resolution and is used to validate the pyramid path.
+//
+// Usage per frame: BeginFrame(camera), AddOccluder(...) for each occluder, EndOccluders(), then any
+// number of IsOccluded() calls. TestOccluded() is the same test without the stats update and may be
+// called from several worker threads at once; callers report their totals through AddTestCounts().
+//----------------------------------------------------------------------------------------------------
+class OcclusionCuller
+{
+public:
+    explicit OcclusionCuller(sOcclusionCullerConfig const& config);
+
+    void BeginFrame(Camera const& camera);
+    void AddOccluder(VertexList_PCU const& vertexes, Mat44 const& modelToWorld);
+    void EndOccluders();
+
+    bool IsOccluded(AABB3 const& worldBounds);
+    bool TestOccluded(AABB3 const& worldBounds) const;
+    bool IsOccludedReference(AABB3 const& worldBounds) const;
+    void AddTestCounts(uint32_t testedCount, uint32_t occludedCount);
+
+    IntVec2                      GetDimensions() const { return m_renderer.GetDimensions(); }
+    sOcclusionCullerStats const& GetStats() const { return m_stats; }
+
+private:
+    struct sScreenRect
+    {
+        int   m_minX, m_minY, m_maxX, m_maxY;     // Pixels, max exclusive
+        float m_nearestDepth;
+    };
+
+    bool ProjectBounds(AABB3 const& worldBounds, sScreenRect& out_rect) const;
+    void BuildDepthPyramid();
+
+    SoftwareRenderer                m_renderer;
+    Mat44                           m_worldToClip;
+    std::vector<IntVec2>            m_levelDimensions;
+    std::vector<std::vector<float>> m_levels;            // Level 0 = full resolution, each texel the max of its 2x2 children
+    sOcclusionCullerStats           m_stats;
+};
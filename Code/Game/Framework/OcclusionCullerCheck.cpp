@@ -0,0 +1,100 @@
+//----------------------------------------------------------------------------------------------------
+// OcclusionCullerCheck.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/HeadlessRunner.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Renderer/Camera.hpp"
+#include "Game/Prop.hpp"
+#include "Game/Framework/HeadlessWorld.hpp"
+#include "Game/Framework/OcclusionCuller.hpp"
+#include "Game/Framework/WorkerPool.hpp"
+
+//----------------------------------------------------------------------------------------------------
+bool RunOcclusionCullingCheck(sHeadlessRunConfig const& config,
+                              WorkerPool&               workerPool)
+{
+    sHeadlessWorldConfig worldConfig = config.m_worldConfig;
+    worldConfig.m_occluderCount      = std::max(worldConfig.m_occluderCount, 16u);
+
+    HeadlessWorld world(worldConfig);
+
+    sOcclusionCullerConfig cullerConfig;
+    cullerConfig.m_workerPool = &workerPool;
+
+    OcclusionCuller culler(cullerConfig);
+    IntVec2 const   dimensions = culler.GetDimensions();
+
+    uint32_t const frameCount             = config.m_occlusionFrameCount;
+    double         rasterMilliseconds     = 0.0;
+    double         testMilliseconds       = 0.0;
+    uint64_t       testedCount            = 0;
+    uint64_t       occludedCount          = 0;
+    uint64_t       referenceOccludedCount = 0;
+    uint64_t       falseOccludedCount     = 0;     // Pyramid says hidden, per-pixel test says visible: must stay 0
+
+    std::vector<AABB3> bounds;
+    std::vector<bool>  isOccluded;
+
+    for (uint32_t frame = 0; frame < frameCount; ++frame)
+    {
+        world.Step();
+
+        Camera camera;
+        world.SetupWorldCamera(camera, static_cast<float>(dimensions.x) / static_cast<float>(dimensions.y));
+
+        culler.BeginFrame(camera);
+        culler.AddOccluder(world.GetOccluderVerts(), Mat44());
+        culler.EndOccluders();
+
+        rasterMilliseconds += culler.GetStats().m_rasterMilliseconds;
+
+        std::vector<Prop*> const& props = world.GetProps();
+        bounds.resize(props.size());
+        isOccluded.resize(props.size());
+
+        for (size_t i = 0; i < props.size(); ++i)
+        {
+            bounds[i] = props[i]->GetWorldBounds();
+        }
+
+        auto const testStartTime = std::chrono::steady_clock::now();
+
+        for (size_t i = 0; i < props.size(); ++i)
+        {
+            isOccluded[i] = culler.IsOccluded(bounds[i]);
+        }
+
+        testMilliseconds += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - testStartTime).count();
+
+        for (size_t i = 0; i < props.size(); ++i)
+        {
+            bool const isReferenceOccluded = culler.IsOccludedReference(bounds[i]);
+
+            referenceOccludedCount += isReferenceOccluded ? 1 : 0;
+            falseOccludedCount += isOccluded[i] && !isReferenceOccluded ? 1 : 0;
+        }
+
+        testedCount += culler.GetStats().m_testedCount;
+        occludedCount += culler.GetStats().m_occludedCount;
+    }
+
+    String report = Stringf("Occlusion culling: %dx%d depth buffer, %u props, %u occluders, %u frames, %u workers\n", dimensions.x, dimensions.y,
+                            worldConfig.m_propCount, worldConfig.m_occluderCount, frameCount, workerPool.GetWorkerCount());
+    report += Stringf("occluder raster  %8.3f ms/frame  (%u triangles)\n", rasterMilliseconds / frameCount, culler.GetStats().m_occluderTriangleCount);
+    report += Stringf("bounds tests     %8.3f ms/frame\n", testMilliseconds / frameCount);
+    report += Stringf("occluded         %8.2f %%  (per-pixel reference %.2f %%)\n", testedCount > 0 ? 100.0 * occludedCount / testedCount : 0.0,
+                      testedCount > 0 ? 100.0 * referenceOccludedCount / testedCount : 0.0);
+    report += Stringf("validation       %s (%llu falsely occluded)\n", falseOccludedCount == 0 ? "OK" : "FAILED", static_cast<unsigned long long>(falseOccludedCount));
+
+    WriteHeadlessReport(config.m_occlusionReportPath, report);
+
+    return falseOccludedCount == 0;
+}
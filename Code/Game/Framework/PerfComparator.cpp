@@ -0,0 +1,853 @@
+//----------------------------------------------------------------------------------------------------
+// PerfComparator.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/PerfComparator.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string_view>
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Game/Framework/GameCommon.hpp"
+
+//----------------------------------------------------------------------------------------------------
+static float constexpr    STRESS_TIME_THRESHOLD       = 0.25f;     // One sample per run, so no test backs the threshold
+static double constexpr   STRESS_TIME_FLOOR           = 0.05;      // Milliseconds, as StressScenario's noise floor
+static double constexpr   STRESS_MEMORY_FLOOR         = 1024.0 * 1024.0;
+static uint32_t constexpr MIN_TESTED_SAMPLE_COUNT     = 3;
+static uint32_t constexpr MAX_EXACT_MANN_WHITNEY_SIZE = 20;        // Per side; larger or tied samples use the normal approximation
+static int constexpr      MAX_JSON_DEPTH              = 64;
+
+//----------------------------------------------------------------------------------------------------
+// Just enough JSON for the files this tool reads: the benchmark, scenario and baseline outputs.
+//
+struct sJsonValue
+{
+    enum class eType : uint8_t
+    {
+        NUL,
+        BOOLEAN,
+        NUMBER,
+        STRING,
+        ARRAY,
+        OBJECT
+    };
+
+    eType                    m_type    = eType::NUL;
+    bool                     m_boolean = false;
+    double                   m_number  = 0.0;
+    std::string              m_string;
+    std::vector<std::string> m_keys;          // Objects only, parallel to m_elements
+    std::vector<sJsonValue>  m_elements;      // Array elements or object member values
+
+    sJsonValue const* Find(std::string_view const key) const
+    {
+        for (size_t index = 0; index < m_keys.size(); ++index)
+        {
+            if (m_keys[index] == key)
+            {
+                return &m_elements[index];
+            }
+        }
+
+        return nullptr;
+    }
+
+    double GetNumber(std::string_view const key, double const defaultValue) const
+    {
+        sJsonValue const* const value = Find(key);
+        return value != nullptr && value->m_type == eType::NUMBER ? value->m_number : defaultValue;
+    }
+
+    std::string GetString(std::string_view const key) const
+    {
+        sJsonValue const* const value = Find(key);
+        return value != nullptr && value->m_type == eType::STRING ? value->m_string : std::string();
+    }
+};
+
+//----------------------------------------------------------------------------------------------------
+static void SkipJsonWhitespace(std::string_view const json, size_t& inout_pos)
+{
+    while (inout_pos < json.size() && (json[inout_pos] == ' ' || json[inout_pos] == '\t' || json[inout_pos] == '\n' || json[inout_pos] == '\r'))
+    {
+        ++inout_pos;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+static bool ParseJsonValue(std::string_view const json, size_t& inout_pos, sJsonValue& out_value, int const depth)
+{
+    SkipJsonWhitespace(json, inout_pos);
+
+    if (inout_pos >= json.size() || depth > MAX_JSON_DEPTH)
+    {
+        return false;
+    }
+
+    char const c = json[inout_pos];
+
+    if (c == '{' || c == '[')
+    {
+        bool const isObject = c == '{';
+        char const closing  = isObject ? '}' : ']';
+
+        out_value.m_type = isObject ? sJsonValue::eType::OBJECT : sJsonValue::eType::ARRAY;
+        ++inout_pos;
+        SkipJsonWhitespace(json, inout_pos);
+
+        if (inout_pos < json.size() && json[inout_pos] == closing)
+        {
+            ++inout_pos;
+            return true;
+        }
+
+        for (;;)
+        {
+            if (isObject)
+            {
+                SkipJsonWhitespace(json, inout_pos);
+                std::string key;
+
+                if (inout_pos >= json.size() || json[inout_pos] != '"' || !ReadJsonString(json, inout_pos, key))
+                {
+                    return false;
+                }
+
+                SkipJsonWhitespace(json, inout_pos);
+
+                if (inout_pos >= json.size() || json[inout_pos] != ':')
+                {
+                    return false;
+                }
+
+                ++inout_pos;
+                out_value.m_keys.push_back(std::move(key));
+            }
+
+            out_value.m_elements.emplace_back();
+
+            if (!ParseJsonValue(json, inout_pos, out_value.m_elements.back(), depth + 1))
+            {
+                return false;
+            }
+
+            SkipJsonWhitespace(json, inout_pos);
+
+            if (inout_pos >= json.size())
+            {
+                return false;
+            }
+
+            if (json[inout_pos] == closing)
+            {
+                ++inout_pos;
+                return true;
+            }
+
+            if (json[inout_pos] != ',')
+            {
+                return false;
+            }
+
+            ++inout_pos;
+        }
+    }
+
+    if (c == '"')
+    {
+        out_value.m_type = sJsonValue::eType::STRING;
+        return ReadJsonString(json, inout_pos, out_value.m_string);
+    }
+
+    for (std::string_view const literal : {std::string_view("true"), std::string_view("false"), std::string_view("null")})
+    {
+        if (json.substr(inout_pos, literal.size()) == literal)
+        {
+            out_value.m_type    = literal == "null" ? sJsonValue::eType::NUL : sJsonValue::eType::BOOLEAN;
+            out_value.m_boolean = literal == "true";
+            inout_pos += literal.size();
+            return true;
+        }
+    }
+
+    std::from_chars_result const result = std::from_chars(json.data() + inout_pos, json.data() + json.size(), out_value.m_number);
+
+    if (result.ec != std::errc())
+    {
+        return false;
+    }
+
+    out_value.m_type = sJsonValue::eType::NUMBER;
+    inout_pos        = static_cast<size_t>(result.ptr - json.data());
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+static bool ReadJsonFile(std::string const& path, sJsonValue& out_root)
+{
+    std::ifstream file(path, std::ios::binary);
+
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    std::ostringstream stream;
+    stream << file.rdbuf();
+    std::string const json = stream.str();
+
+    size_t pos = 0;
+
+    if (!ParseJsonValue(json, pos, out_root, 0))
+    {
+        return false;
+    }
+
+    SkipJsonWhitespace(json, pos);
+    return pos == json.size() && out_root.m_type == sJsonValue::eType::OBJECT;
+}
+
+//----------------------------------------------------------------------------------------------------
+static sPerfMetric& FindOrAddMetric(std::vector<sPerfMetric>& metrics,
+                                    std::string const&        name,
+                                    std::string const&        unit,
+                                    float const               threshold,
+                                    double const              floor)
+{
+    for (sPerfMetric& metric : metrics)
+    {
+        if (metric.m_name == name)
+        {
+            return metric;
+        }
+    }
+
+    sPerfMetric& metric = metrics.emplace_back();
+    metric.m_name       = name;
+    metric.m_unit       = unit;
+    metric.m_threshold  = threshold;
+    metric.m_floor      = floor;
+
+    return metric;
+}
+
+//----------------------------------------------------------------------------------------------------
+static double GetNanosecondsPerUnit(std::string const& timeUnit)
+{
+    if (timeUnit == "us") return 1e3;
+    if (timeUnit == "ms") return 1e6;
+    if (timeUnit == "s") return 1e9;
+
+    return 1.0;
+}
+
+//----------------------------------------------------------------------------------------------------
+static char const* GetVerdictName(ePerfVerdict const verdict)
+{
+    switch (verdict)
+    {
+    case ePerfVerdict::UNCHANGED:   return "unchanged";
+    case ePerfVerdict::IMPROVED:    return "improved";
+    case ePerfVerdict::REGRESSED:   return "REGRESSED";
+    case ePerfVerdict::BELOW_FLOOR: return "below floor";
+    case ePerfVerdict::NEW:         return "new";
+    case ePerfVerdict::MISSING:     return "missing";
+    }
+
+    return "?";
+}
+
+//----------------------------------------------------------------------------------------------------
+// P(B <= k) for B ~ Binomial(n, 1/2).
+//
+static double GetHalfBinomialCdf(uint32_t const n, uint32_t const k)
+{
+    double cdf = 0.0;
+
+    for (uint32_t i = 0; i <= std::min(k, n); ++i)
+    {
+        cdf += std::exp(std::lgamma(n + 1.0) - std::lgamma(i + 1.0) - std::lgamma(n - i + 1.0) - n * std::log(2.0));
+    }
+
+    return cdf;
+}
+
+//----------------------------------------------------------------------------------------------------
+PerfComparator::PerfComparator(sPerfCompareConfig const& config)
+    : m_config(config)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+// -perfCompare=a.json,b.json | -perfBaselineUpdate=a.json,b.json
+// [-perfBaseline=path -perfReport=path -perfLabel=text -perfThreshold=0.1 -perfAlpha=0.05]
+//
+STATIC bool PerfComparator::ParseCommandLine(std::string const&  commandLine,
+                                             sPerfCompareConfig& out_config)
+{
+    std::string resultPaths;
+
+    if (FindCommandLineString(commandLine, "perfBaselineUpdate", resultPaths))
+    {
+        out_config.m_isUpdatingBaseline = true;
+    }
+    else if (!FindCommandLineString(commandLine, "perfCompare", resultPaths))
+    {
+        return false;
+    }
+
+    out_config.m_resultPaths.clear();
+
+    for (size_t start = 0; start < resultPaths.size();)
+    {
+        size_t const end = std::min(resultPaths.find(',', start), resultPaths.size());
+
+        if (end > start)
+        {
+            out_config.m_resultPaths.push_back(resultPaths.substr(start, end - start));
+        }
+
+        start = end + 1;
+    }
+
+    FindCommandLineString(commandLine, "perfBaseline", out_config.m_baselinePath);
+    FindCommandLineString(commandLine, "perfReport", out_config.m_reportPath);
+    FindCommandLineString(commandLine, "perfLabel", out_config.m_label);
+    FindCommandLineFloat(commandLine, "perfThreshold", out_config.m_defaultThreshold);
+    FindCommandLineFloat(commandLine, "perfAlpha", out_config.m_alpha);
+
+    return !out_config.m_resultPaths.empty();
+}
+
+//----------------------------------------------------------------------------------------------------
+int PerfComparator::Run()
+{
+    return m_config.m_isUpdatingBaseline ? RunUpdate() : RunCompare();
+}
+
+//----------------------------------------------------------------------------------------------------
+int PerfComparator::RunCompare()
+{
+    std::vector<sPerfMetric> baseline;
+    std::vector<sPerfMetric> current;
+    std::string              label;
+    std::string              report = Stringf("Performance comparison: %s\n", m_config.m_baselinePath.c_str());
+    bool                     isRead = LoadBaseline(m_config.m_baselinePath, baseline, label);
+
+    if (!isRead)
+    {
+        report += "baseline         unreadable; create it with -perfBaselineUpdate\n";
+    }
+
+    for (std::string const& path : m_config.m_resultPaths)
+    {
+        std::vector<sPerfMetric> fileMetrics;
+
+        if (!LoadResults(path, m_config.m_defaultThreshold, fileMetrics))
+        {
+            report += Stringf("results          %s unreadable\n", path.c_str());
+            isRead = false;
+            continue;
+        }
+
+        for (sPerfMetric const& fileMetric : fileMetrics)
+        {
+            sPerfMetric& metric = FindOrAddMetric(current, fileMetric.m_name, fileMetric.m_unit, fileMetric.m_threshold, fileMetric.m_floor);
+            metric.m_samples.insert(metric.m_samples.end(), fileMetric.m_samples.begin(), fileMetric.m_samples.end());
+        }
+    }
+
+    if (!isRead)
+    {
+        report += "result           ERROR\n";
+        DebuggerPrintf("%s", report.c_str());
+        WriteTextFile(m_config.m_reportPath, report);
+        return 2;
+    }
+
+    std::vector<sPerfComparison> const comparisons = Compare(baseline, current);
+
+    report += Stringf("baseline label   %s\n", label.empty() ? "(none)" : label.c_str());
+    report += ToReport(comparisons);
+
+    uint32_t const regressionCount = static_cast<uint32_t>(std::count_if(comparisons.begin(), comparisons.end(),
+                                                                         [](sPerfComparison const& comparison) { return comparison.m_verdict == ePerfVerdict::REGRESSED; }));
+
+    report += Stringf("result           %s\n", regressionCount == 0 ? "PASS" : Stringf("FAIL (%u regressions)", regressionCount).c_str());
+
+    DebuggerPrintf("%s", report.c_str());
+    WriteTextFile(m_config.m_reportPath, report);
+
+    return regressionCount == 0 ? 0 : 1;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Samples are replaced; thresholds and floors someone tuned by hand in the old baseline are kept.
+//
+int PerfComparator::RunUpdate()
+{
+    std::vector<sPerfMetric> previous;
+    std::vector<sPerfMetric> metrics;
+    std::string              previousLabel;
+
+    LoadBaseline(m_config.m_baselinePath, previous, previousLabel);
+
+    std::string report = Stringf("Performance baseline update: %s\n", m_config.m_baselinePath.c_str());
+
+    for (std::string const& path : m_config.m_resultPaths)
+    {
+        std::vector<sPerfMetric> fileMetrics;
+
+        if (!LoadResults(path, m_config.m_defaultThreshold, fileMetrics))
+        {
+            report += Stringf("results          %s unreadable\nresult           ERROR (baseline unchanged)\n", path.c_str());
+            DebuggerPrintf("%s", report.c_str());
+            WriteTextFile(m_config.m_reportPath, report);
+            return 2;
+        }
+
+        for (sPerfMetric const& fileMetric : fileMetrics)
+        {
+            float  threshold = fileMetric.m_threshold;
+            double floor     = fileMetric.m_floor;
+
+            for (sPerfMetric const& previousMetric : previous)
+            {
+                if (previousMetric.m_name == fileMetric.m_name)
+                {
+                    threshold = previousMetric.m_threshold;
+                    floor     = previousMetric.m_floor;
+                }
+            }
+
+            sPerfMetric& metric = FindOrAddMetric(metrics, fileMetric.m_name, fileMetric.m_unit, threshold, floor);
+            metric.m_samples.insert(metric.m_samples.end(), fileMetric.m_samples.begin(), fileMetric.m_samples.end());
+        }
+    }
+
+    bool const isWritten = SaveBaseline(m_config.m_baselinePath, metrics, m_config.m_label);
+
+    report += Stringf("metrics          %u (was %u)\n", static_cast<uint32_t>(metrics.size()), static_cast<uint32_t>(previous.size()));
+    report += Stringf("label            %s (was %s)\n", m_config.m_label.empty() ? "(none)" : m_config.m_label.c_str(),
+                      previousLabel.empty() ? "(none)" : previousLabel.c_str());
+    report += Stringf("result           %s\n", isWritten ? "OK" : "ERROR (write failed)");
+
+    DebuggerPrintf("%s", report.c_str());
+    WriteTextFile(m_config.m_reportPath, report);
+
+    return isWritten ? 0 : 2;
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC bool PerfComparator::LoadResults(std::string const&        path,
+                                        float const               defaultThreshold,
+                                        std::vector<sPerfMetric>& inout_metrics)
+{
+    sJsonValue root;
+
+    if (!ReadJsonFile(path, root))
+    {
+        return false;
+    }
+
+    // MicroBenchmarkRunner / Google Benchmark: repetitions are the samples, aggregates are skipped.
+    if (sJsonValue const* const benchmarks = root.Find("benchmarks"); benchmarks != nullptr && benchmarks->m_type == sJsonValue::eType::ARRAY)
+    {
+        for (sJsonValue const& entry : benchmarks->m_elements)
+        {
+            sJsonValue const* const error = entry.Find("error_occurred");
+
+            if (entry.m_type != sJsonValue::eType::OBJECT || (error != nullptr && error->m_boolean) || entry.Find("real_time") == nullptr)
+            {
+                continue;
+            }
+
+            std::string const runType = entry.GetString("run_type");
+
+            if (!runType.empty() && runType != "iteration")
+            {
+                continue;
+            }
+
+            std::string name = entry.GetString("run_name");
+
+            if (name.empty())
+            {
+                name = entry.GetString("name");
+            }
+
+            double const nanoseconds = entry.GetNumber("real_time", 0.0) * GetNanosecondsPerUnit(entry.GetString("time_unit"));
+            FindOrAddMetric(inout_metrics, "bench/" + name, "ns", defaultThreshold, 0.0).m_samples.push_back(nanoseconds);
+        }
+
+        return true;
+    }
+
+    // StressScenario: one sample per step and subsystem.
+    if (sJsonValue const* const steps = root.Find("steps"); steps != nullptr && steps->m_type == sJsonValue::eType::ARRAY)
+    {
+        for (sJsonValue const& step : steps->m_elements)
+        {
+            uint32_t const    entityCount = static_cast<uint32_t>(step.GetNumber("entityCount", 0.0));
+            std::string const suffix      = Stringf("@%u", entityCount);
+            float const       threshold   = std::max(defaultThreshold, STRESS_TIME_THRESHOLD);
+
+            FindOrAddMetric(inout_metrics, "stress/bridge" + suffix, "ns", threshold, 0.0).m_samples.push_back(step.GetNumber("bridgeNsPerEntity", 0.0));
+            FindOrAddMetric(inout_metrics, "stress/update" + suffix, "ms", threshold, STRESS_TIME_FLOOR).m_samples.push_back(step.GetNumber("updateMs", 0.0));
+            FindOrAddMetric(inout_metrics, "stress/renderBuild" + suffix, "ms", threshold, STRESS_TIME_FLOOR).m_samples.push_back(step.GetNumber("renderBuildMs", 0.0));
+            FindOrAddMetric(inout_metrics, "stress/memory" + suffix, "B", defaultThreshold, STRESS_MEMORY_FLOOR).m_samples.push_back(step.GetNumber("memoryBytes", 0.0));
+        }
+
+        return true;
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC bool PerfComparator::LoadBaseline(std::string const&        path,
+                                         std::vector<sPerfMetric>& out_metrics,
+                                         std::string&              out_label)
+{
+    out_metrics.clear();
+    out_label.clear();
+
+    sJsonValue root;
+
+    if (!ReadJsonFile(path, root))
+    {
+        return false;
+    }
+
+    sJsonValue const* const metrics = root.Find("metrics");
+
+    if (metrics == nullptr || metrics->m_type != sJsonValue::eType::ARRAY)
+    {
+        return false;
+    }
+
+    out_label = root.GetString("label");
+
+    for (sJsonValue const& entry : metrics->m_elements)
+    {
+        sJsonValue const* const samples = entry.Find("samples");
+
+        if (samples == nullptr || samples->m_type != sJsonValue::eType::ARRAY || entry.GetString("name").empty())
+        {
+            continue;
+        }
+
+        sPerfMetric& metric = out_metrics.emplace_back();
+        metric.m_name       = entry.GetString("name");
+        metric.m_unit       = entry.GetString("unit");
+        metric.m_threshold  = static_cast<float>(entry.GetNumber("threshold", metric.m_threshold));
+        metric.m_floor      = entry.GetNumber("floor", 0.0);
+
+        for (sJsonValue const& sample : samples->m_elements)
+        {
+            if (sample.m_type == sJsonValue::eType::NUMBER)
+            {
+                metric.m_samples.push_back(sample.m_number);
+            }
+        }
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC bool PerfComparator::SaveBaseline(std::string const&              path,
+                                         std::vector<sPerfMetric> const& metrics,
+                                         std::string const&              label)
+{
+    auto const                        now = std::chrono::system_clock::now();
+    auto const                        day = std::chrono::floor<std::chrono::days>(now);
+    std::chrono::year_month_day const date(day);
+
+    std::string json = "{\n  \"label\": ";
+    AppendJsonString(json, label);
+    json += Stringf(",\n  \"date\": \"%04d-%02u-%02u\",\n  \"metrics\": [", static_cast<int>(date.year()), static_cast<unsigned>(date.month()),
+                    static_cast<unsigned>(date.day()));
+
+    for (size_t metricIndex = 0; metricIndex < metrics.size(); ++metricIndex)
+    {
+        sPerfMetric const& metric = metrics[metricIndex];
+
+        json += metricIndex == 0 ? "\n    {\"name\": " : ",\n    {\"name\": ";
+        AppendJsonString(json, metric.m_name);
+        json += ", \"unit\": ";
+        AppendJsonString(json, metric.m_unit);
+        json += Stringf(", \"threshold\": %.3f, \"floor\": %.9g, \"samples\": [", metric.m_threshold, metric.m_floor);
+
+        for (size_t sampleIndex = 0; sampleIndex < metric.m_samples.size(); ++sampleIndex)
+        {
+            json += Stringf(sampleIndex == 0 ? "%.9g" : ", %.9g", metric.m_samples[sampleIndex]);
+        }
+
+        json += "]}";
+    }
+
+    json += "\n  ]\n}\n";
+
+    return WriteTextFile(path, json);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Order statistics x(j) .. x(n+1-j) with the widest j that keeps coverage at 95%, from the binomial
+// count of samples below the median; below 6 samples this is just [min, max].
+//
+STATIC void PerfComparator::GetMedianConfidenceInterval(std::vector<double> samples,
+                                                        double&             out_low,
+                                                        double&             out_high)
+{
+    if (samples.empty())
+    {
+        out_low  = 0.0;
+        out_high = 0.0;
+        return;
+    }
+
+    std::sort(samples.begin(), samples.end());
+
+    uint32_t const count = static_cast<uint32_t>(samples.size());
+    uint32_t       j     = 1;
+
+    while (j + 1 <= (count + 1) / 2 && GetHalfBinomialCdf(count, j) <= 0.025)
+    {
+        ++j;
+    }
+
+    out_low  = samples[j - 1];
+    out_high = samples[count - j];
+}
+
+//----------------------------------------------------------------------------------------------------
+// One-sided: P(U >= observed) for "higher" against "lower". Exact when both sides are small and
+// untied, otherwise the normal approximation with tie and continuity corrections.
+//
+STATIC double PerfComparator::GetMannWhitneyPValue(std::vector<double> const& lower,
+                                                   std::vector<double> const& higher)
+{
+    size_t const lowerCount  = lower.size();
+    size_t const higherCount = higher.size();
+
+    if (lowerCount == 0 || higherCount == 0)
+    {
+        return 1.0;
+    }
+
+    // Mid-ranks over the pooled samples; tie groups also feed the variance correction.
+    std::vector<std::pair<double, bool>> pooled;
+    pooled.reserve(lowerCount + higherCount);
+
+    for (double const sample : lower) pooled.emplace_back(sample, false);
+    for (double const sample : higher) pooled.emplace_back(sample, true);
+
+    std::sort(pooled.begin(), pooled.end(), [](auto const& a, auto const& b) { return a.first < b.first; });
+
+    double higherRankSum = 0.0;
+    double tieTerm       = 0.0;
+
+    for (size_t start = 0; start < pooled.size();)
+    {
+        size_t end = start + 1;
+
+        while (end < pooled.size() && pooled[end].first == pooled[start].first)
+        {
+            ++end;
+        }
+
+        double const tieCount = static_cast<double>(end - start);
+        double const midRank  = (static_cast<double>(start + 1) + static_cast<double>(end)) * 0.5;
+        tieTerm += tieCount * tieCount * tieCount - tieCount;
+
+        for (size_t index = start; index < end; ++index)
+        {
+            if (pooled[index].second)
+            {
+                higherRankSum += midRank;
+            }
+        }
+
+        start = end;
+    }
+
+    double const u = higherRankSum - static_cast<double>(higherCount * (higherCount + 1)) * 0.5;
+
+    if (tieTerm == 0.0 && lowerCount <= MAX_EXACT_MANN_WHITNEY_SIZE && higherCount <= MAX_EXACT_MANN_WHITNEY_SIZE)
+    {
+        // counts[h][l][k]: orderings of h "higher" and l "lower" samples where higher beats lower k times.
+        // The largest sample is either a "higher" one (beats all l) or a "lower" one (beats nothing).
+        size_t const maxU = lowerCount * higherCount;
+
+        std::vector<std::vector<std::vector<double>>> counts(higherCount + 1, std::vector<std::vector<double>>(lowerCount + 1));
+
+        for (size_t h = 0; h <= higherCount; ++h)
+        {
+            for (size_t l = 0; l <= lowerCount; ++l)
+            {
+                std::vector<double>& distribution = counts[h][l];
+                distribution.assign(h * l + 1, 0.0);
+
+                if (h == 0 || l == 0)
+                {
+                    distribution[0] = 1.0;
+                    continue;
+                }
+
+                for (size_t k = 0; k <= h * l; ++k)
+                {
+                    double const higherLast = k >= l && k - l < counts[h - 1][l].size() ? counts[h - 1][l][k - l] : 0.0;
+                    double const lowerLast  = k < counts[h][l - 1].size() ? counts[h][l - 1][k] : 0.0;
+
+                    distribution[k] = higherLast + lowerLast;
+                }
+            }
+        }
+
+        std::vector<double> const& distribution = counts[higherCount][lowerCount];
+        double                     total        = 0.0;
+        double                     tail         = 0.0;
+
+        for (size_t k = 0; k <= maxU; ++k)
+        {
+            total += distribution[k];
+
+            if (static_cast<double>(k) >= u - 1e-9)
+            {
+                tail += distribution[k];
+            }
+        }
+
+        return total > 0.0 ? tail / total : 1.0;
+    }
+
+    double const totalCount = static_cast<double>(lowerCount + higherCount);
+    double const mean       = static_cast<double>(lowerCount * higherCount) * 0.5;
+    double const variance   = static_cast<double>(lowerCount * higherCount) / 12.0 * ((totalCount + 1.0) - tieTerm / (totalCount * (totalCount - 1.0)));
+
+    if (variance <= 0.0)
+    {
+        return 1.0;
+    }
+
+    double const z = (u - mean - 0.5) / std::sqrt(variance);
+
+    return 0.5 * std::erfc(z / std::sqrt(2.0));
+}
+
+//----------------------------------------------------------------------------------------------------
+std::vector<sPerfComparison> PerfComparator::Compare(std::vector<sPerfMetric> const& baseline,
+                                                     std::vector<sPerfMetric> const& current) const
+{
+    std::vector<sPerfComparison> comparisons;
+
+    auto const findMetric = [](std::vector<sPerfMetric> const& metrics, std::string const& name) -> sPerfMetric const*
+    {
+        for (sPerfMetric const& metric : metrics)
+        {
+            if (metric.m_name == name)
+            {
+                return &metric;
+            }
+        }
+
+        return nullptr;
+    };
+
+    for (sPerfMetric const& baselineMetric : baseline)
+    {
+        sPerfComparison& comparison = comparisons.emplace_back();
+        comparison.m_name           = baselineMetric.m_name;
+        comparison.m_unit           = baselineMetric.m_unit;
+        comparison.m_baselineMedian = GetMedian(baselineMetric.m_samples);
+        GetMedianConfidenceInterval(baselineMetric.m_samples, comparison.m_baselineLow, comparison.m_baselineHigh);
+
+        sPerfMetric const* const currentMetric = findMetric(current, baselineMetric.m_name);
+
+        if (currentMetric == nullptr || currentMetric->m_samples.empty())
+        {
+            comparison.m_verdict = ePerfVerdict::MISSING;
+            continue;
+        }
+
+        comparison.m_currentMedian = GetMedian(currentMetric->m_samples);
+        GetMedianConfidenceInterval(currentMetric->m_samples, comparison.m_currentLow, comparison.m_currentHigh);
+
+        comparison.m_relativeChange = comparison.m_baselineMedian > 0.0 ? (comparison.m_currentMedian - comparison.m_baselineMedian) / comparison.m_baselineMedian : 0.0;
+        comparison.m_isTested       = baselineMetric.m_samples.size() >= MIN_TESTED_SAMPLE_COUNT && currentMetric->m_samples.size() >= MIN_TESTED_SAMPLE_COUNT;
+        comparison.m_pValue         = comparison.m_relativeChange >= 0.0 ? GetMannWhitneyPValue(baselineMetric.m_samples, currentMetric->m_samples)
+                                                                         : GetMannWhitneyPValue(currentMetric->m_samples, baselineMetric.m_samples);
+
+        if (comparison.m_baselineMedian < baselineMetric.m_floor && comparison.m_currentMedian < baselineMetric.m_floor)
+        {
+            comparison.m_verdict = ePerfVerdict::BELOW_FLOOR;
+            continue;
+        }
+
+        bool const isMoved       = std::abs(comparison.m_relativeChange) > baselineMetric.m_threshold;
+        bool const isSignificant = !comparison.m_isTested || comparison.m_pValue <= m_config.m_alpha;
+
+        if (isMoved && isSignificant)
+        {
+            comparison.m_verdict = comparison.m_relativeChange > 0.0 ? ePerfVerdict::REGRESSED : ePerfVerdict::IMPROVED;
+        }
+    }
+
+    for (sPerfMetric const& currentMetric : current)
+    {
+        if (findMetric(baseline, currentMetric.m_name) == nullptr)
+        {
+            sPerfComparison& comparison = comparisons.emplace_back();
+            comparison.m_name           = currentMetric.m_name;
+            comparison.m_unit           = currentMetric.m_unit;
+            comparison.m_currentMedian  = GetMedian(currentMetric.m_samples);
+            comparison.m_verdict        = ePerfVerdict::NEW;
+            GetMedianConfidenceInterval(currentMetric.m_samples, comparison.m_currentLow, comparison.m_currentHigh);
+        }
+    }
+
+    return comparisons;
+}
+
+//----------------------------------------------------------------------------------------------------
+std::string PerfComparator::ToReport(std::vector<sPerfComparison> const& comparisons) const
+{
+    std::string report = Stringf("alpha            %.3f (one-sided Mann-Whitney, 95%% median intervals)\n", m_config.m_alpha);
+    report += "metric                                              baseline [95% CI]                current [95% CI]                  change      p  verdict\n";
+
+    uint32_t verdictCounts[static_cast<size_t>(ePerfVerdict::MISSING) + 1] = {};
+
+    for (sPerfComparison const& comparison : comparisons)
+    {
+        ++verdictCounts[static_cast<size_t>(comparison.m_verdict)];
+
+        std::string const baselineText = comparison.m_verdict == ePerfVerdict::NEW ? std::string("-")
+                                                                                   : Stringf("%.4g [%.4g, %.4g]", comparison.m_baselineMedian, comparison.m_baselineLow, comparison.m_baselineHigh);
+        std::string const currentText  = comparison.m_verdict == ePerfVerdict::MISSING ? std::string("-")
+                                                                                       : Stringf("%.4g [%.4g, %.4g]", comparison.m_currentMedian, comparison.m_currentLow, comparison.m_currentHigh);
+        bool const        isCompared   = comparison.m_verdict != ePerfVerdict::NEW && comparison.m_verdict != ePerfVerdict::MISSING;
+
+        report += Stringf("%-50s  %-30s   %-30s   %+7.1f%%  %5s  %s\n", (comparison.m_name + " (" + comparison.m_unit + ")").c_str(), baselineText.c_str(),
+                          currentText.c_str(), isCompared ? comparison.m_relativeChange * 100.0 : 0.0,
+                          isCompared && comparison.m_isTested ? Stringf("%.3f", comparison.m_pValue).c_str() : "-", GetVerdictName(comparison.m_verdict));
+    }
+
+    report += Stringf("regressed        %u\n", verdictCounts[static_cast<size_t>(ePerfVerdict::REGRESSED)]);
+    report += Stringf("improved         %u\n", verdictCounts[static_cast<size_t>(ePerfVerdict::IMPROVED)]);
+    report += Stringf("unchanged        %u (+%u below floor)\n", verdictCounts[static_cast<size_t>(ePerfVerdict::UNCHANGED)],
+                      verdictCounts[static_cast<size_t>(ePerfVerdict::BELOW_FLOOR)]);
+    report += Stringf("new / missing    %u / %u\n", verdictCounts[static_cast<size_t>(ePerfVerdict::NEW)], verdictCounts[static_cast<size_t>(ePerfVerdict::MISSING)]);
+
+    return report;
+}
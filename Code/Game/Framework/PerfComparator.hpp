@@ -0,0 +1,104 @@
+//----------------------------------------------------------------------------------------------------
+// PerfComparator.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+struct sPerfCompareConfig
+{
+    std::vector<std::string> m_resultPaths;                                       // MicroBenchmarks.json / StressScenario.json outputs
+    std::string              m_baselinePath       = "Data/PerfBaseline.json";     // Checked in under Run/
+    std::string              m_reportPath         = "Logs/PerfCompare.txt";
+    std::string              m_label;                                             // Stored in the baseline on update, e.g. the commit
+    bool                     m_isUpdatingBaseline = false;                        // Rewrite the baseline instead of comparing
+    float                    m_defaultThreshold   = 0.10f;                        // Relative slowdown that counts, for metrics new to the baseline
+    float                    m_alpha              = 0.05f;                        // Mann-Whitney significance level
+};
+
+//----------------------------------------------------------------------------------------------------
+// Lower is better for every metric (nanoseconds, milliseconds, bytes). Threshold and floor are per
+// metric and hand-editable in the baseline; a baseline update keeps them.
+//----------------------------------------------------------------------------------------------------
+struct sPerfMetric
+{
+    std::string         m_name;
+    std::string         m_unit;
+    float               m_threshold = 0.10f;     // Relative change past which the median counts as moved
+    double              m_floor     = 0.0;       // Both medians below this: timer noise, never a regression
+    std::vector<double> m_samples;
+};
+
+//----------------------------------------------------------------------------------------------------
+enum class ePerfVerdict : uint8_t
+{
+    UNCHANGED,
+    IMPROVED,
+    REGRESSED,
+    BELOW_FLOOR,
+    NEW,            // In the results only
+    MISSING         // In the baseline only, e.g. filtered out of this run
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sPerfComparison
+{
+    std::string  m_name;
+    std::string  m_unit;
+    double       m_baselineMedian   = 0.0;
+    double       m_baselineLow      = 0.0;     // 95% distribution-free confidence interval of the median
+    double       m_baselineHigh     = 0.0;
+    double       m_currentMedian    = 0.0;
+    double       m_currentLow       = 0.0;
+    double       m_currentHigh      = 0.0;
+    double       m_relativeChange   = 0.0;     // (current - baseline) / baseline; positive is slower
+    double       m_pValue           = 1.0;     // One-sided Mann-Whitney in the direction of the change
+    bool         m_isTested         = false;   // Fewer than 3 samples on a side: threshold alone decides
+    ePerfVerdict m_verdict          = ePerfVerdict::UNCHANGED;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Compares benchmark and scenario JSON against a baseline checked into the repo, so a regression
+// fails the run instead of waiting for someone to read a report:
+//
+//   MicroBenchmarks.json   Google Benchmark format; every "iteration" entry's real_time is one sample
+//                          of "bench/<name>" (ns)
+//   StressScenario.json    one sample per step and subsystem, "stress/<subsystem>@<entities>"
+//
+// A metric regresses when its median slowed past its threshold and, with at least 3 samples on each
+// side, Mann-Whitney says the shift is significant at alpha. Several result files may name the same
+// metric; their samples are pooled.
+//
+// -perfCompare=a.json,b.json [-perfBaseline=path] returns exit code 1 on any regression, 2 when a file
+// cannot be read. -perfBaselineUpdate=a.json,b.json [-perfLabel=commit] is the only way the baseline
+// changes.
+//----------------------------------------------------------------------------------------------------
+class PerfComparator
+{
+public:
+    explicit PerfComparator(sPerfCompareConfig const& config);
+
+    int Run();          // Process exit code
+
+    static bool ParseCommandLine(std::string const& commandLine, sPerfCompareConfig& out_config);
+
+    // Building blocks, public for the report and for reuse
+    static bool   LoadResults(std::string const& path, float defaultThreshold, std::vector<sPerfMetric>& inout_metrics);
+    static bool   LoadBaseline(std::string const& path, std::vector<sPerfMetric>& out_metrics, std::string& out_label);
+    static bool   SaveBaseline(std::string const& path, std::vector<sPerfMetric> const& metrics, std::string const& label);
+    static void   GetMedianConfidenceInterval(std::vector<double> samples, double& out_low, double& out_high);
+    static double GetMannWhitneyPValue(std::vector<double> const& lower, std::vector<double> const& higher);    // H1: "higher" is stochastically larger
+
+    std::vector<sPerfComparison> Compare(std::vector<sPerfMetric> const& baseline, std::vector<sPerfMetric> const& current) const;
+    std::string                  ToReport(std::vector<sPerfComparison> const& comparisons) const;
+
+private:
+    int RunCompare();
+    int RunUpdate();
+
+    sPerfCompareConfig m_config;
+};
@@ -0,0 +1,210 @@
+//----------------------------------------------------------------------------------------------------
+// QuantizedVertex.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/QuantizedVertex.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+//----------------------------------------------------------------------------------------------------
+static float constexpr UNORM16_MAX = 65535.f;
+
+//----------------------------------------------------------------------------------------------------
+Mat44 sQuantizedMesh::GetDecodeTransform() const
+{
+    Mat44 transform;
+
+    transform.m_values[Mat44::Ix] = m_boundsSize.x;
+    transform.m_values[Mat44::Jy] = m_boundsSize.y;
+    transform.m_values[Mat44::Kz] = m_boundsSize.z;
+    transform.m_values[Mat44::Tx] = m_boundsMins.x;
+    transform.m_values[Mat44::Ty] = m_boundsMins.y;
+    transform.m_values[Mat44::Tz] = m_boundsMins.z;
+
+    return transform;
+}
+
+//----------------------------------------------------------------------------------------------------
+Vec3 sQuantizedMesh::GetMaxPositionError() const
+{
+    return Vec3(0.5f * m_boundsSize.x / UNORM16_MAX, 0.5f * m_boundsSize.y / UNORM16_MAX, 0.5f * m_boundsSize.z / UNORM16_MAX);
+}
+
+//----------------------------------------------------------------------------------------------------
+static uint16_t QuantizeUnorm16(float const value,
+                                float const mins,
+                                float const size)
+{
+    if (size <= 0.f)
+    {
+        return 0;
+    }
+
+    float const normalized = std::clamp((value - mins) / size, 0.f, 1.f);
+
+    return static_cast<uint16_t>(std::lround(normalized * UNORM16_MAX));
+}
+
+//----------------------------------------------------------------------------------------------------
+void QuantizeVertexes(VertexList_PCU const& vertexes,
+                      sQuantizedMesh&       out_mesh)
+{
+    Vec3 mins(FLT_MAX, FLT_MAX, FLT_MAX);
+    Vec3 maxs(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+
+    for (Vertex_PCU const& vertex : vertexes)
+    {
+        mins.x = std::min(mins.x, vertex.m_position.x);
+        mins.y = std::min(mins.y, vertex.m_position.y);
+        mins.z = std::min(mins.z, vertex.m_position.z);
+        maxs.x = std::max(maxs.x, vertex.m_position.x);
+        maxs.y = std::max(maxs.y, vertex.m_position.y);
+        maxs.z = std::max(maxs.z, vertex.m_position.z);
+    }
+
+    if (vertexes.empty())
+    {
+        mins = Vec3(0.f, 0.f, 0.f);
+        maxs = Vec3(0.f, 0.f, 0.f);
+    }
+
+    out_mesh.m_boundsMins = mins;
+    out_mesh.m_boundsSize = Vec3(maxs.x - mins.x, maxs.y - mins.y, maxs.z - mins.z);
+    out_mesh.m_vertexes.resize(vertexes.size());
+
+    for (size_t i = 0; i < vertexes.size(); ++i)
+    {
+        Vertex_PCU const& source = vertexes[i];
+        Vertex_PCUQ&      target = out_mesh.m_vertexes[i];
+
+        target.m_position[0]    = QuantizeUnorm16(source.m_position.x, mins.x, out_mesh.m_boundsSize.x);
+        target.m_position[1]    = QuantizeUnorm16(source.m_position.y, mins.y, out_mesh.m_boundsSize.y);
+        target.m_position[2]    = QuantizeUnorm16(source.m_position.z, mins.z, out_mesh.m_boundsSize.z);
+        target.m_position[3]    = 0;
+        target.m_color          = source.m_color;
+        target.m_uvTexCoords[0] = FloatToHalf(source.m_uvTexCoords.x);
+        target.m_uvTexCoords[1] = FloatToHalf(source.m_uvTexCoords.y);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+Vertex_PCU DecodeVertexUnitSpace(Vertex_PCUQ const& vertex)
+{
+    Vertex_PCU decoded;
+
+    decoded.m_position      = Vec3(vertex.m_position[0] / UNORM16_MAX, vertex.m_position[1] / UNORM16_MAX, vertex.m_position[2] / UNORM16_MAX);
+    decoded.m_color         = vertex.m_color;
+    decoded.m_uvTexCoords.x = HalfToFloat(vertex.m_uvTexCoords[0]);
+    decoded.m_uvTexCoords.y = HalfToFloat(vertex.m_uvTexCoords[1]);
+
+    return decoded;
+}
+
+//----------------------------------------------------------------------------------------------------
+void DequantizeVertexes(sQuantizedMesh const& mesh,
+                        VertexList_PCU&       out_vertexes)
+{
+    out_vertexes.resize(mesh.m_vertexes.size());
+
+    for (size_t i = 0; i < mesh.m_vertexes.size(); ++i)
+    {
+        Vertex_PCU& vertex = out_vertexes[i];
+        vertex             = DecodeVertexUnitSpace(mesh.m_vertexes[i]);
+
+        vertex.m_position.x = mesh.m_boundsMins.x + vertex.m_position.x * mesh.m_boundsSize.x;
+        vertex.m_position.y = mesh.m_boundsMins.y + vertex.m_position.y * mesh.m_boundsSize.y;
+        vertex.m_position.z = mesh.m_boundsMins.z + vertex.m_position.z * mesh.m_boundsSize.z;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// IEEE 754 binary16, round to nearest even. Out-of-range values become infinity, NaN stays NaN.
+//
+uint16_t FloatToHalf(float const value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    uint32_t const sign           = (bits >> 16) & 0x8000u;
+    uint32_t const floatExponent  = (bits >> 23) & 0xFFu;
+    uint32_t       mantissa       = bits & 0x7FFFFFu;
+    int const      halfExponent   = static_cast<int>(floatExponent) - 127 + 15;
+
+    if (floatExponent == 0xFFu)
+    {
+        return static_cast<uint16_t>(sign | 0x7C00u | (mantissa != 0 ? 0x200u : 0u));
+    }
+
+    if (halfExponent >= 31)
+    {
+        return static_cast<uint16_t>(sign | 0x7C00u);
+    }
+
+    if (halfExponent <= 0)
+    {
+        // Subnormal half (or zero).
+        if (halfExponent < -10)
+        {
+            return static_cast<uint16_t>(sign);
+        }
+
+        mantissa |= 0x800000u;
+
+        uint32_t const shift     = static_cast<uint32_t>(14 - halfExponent);
+        uint32_t       half      = mantissa >> shift;
+        uint32_t const remainder = mantissa & ((1u << shift) - 1u);
+        uint32_t const halfway   = 1u << (shift - 1u);
+
+        if (remainder > halfway || (remainder == halfway && (half & 1u) != 0))
+        {
+            ++half;
+        }
+
+        return static_cast<uint16_t>(sign | half);
+    }
+
+    // A carry out of the mantissa correctly bumps the exponent (up to infinity).
+    uint32_t       half      = sign | (static_cast<uint32_t>(halfExponent) << 10) | (mantissa >> 13);
+    uint32_t const remainder = mantissa & 0x1FFFu;
+
+    if (remainder > 0x1000u || (remainder == 0x1000u && (half & 1u) != 0))
+    {
+        ++half;
+    }
+
+    return static_cast<uint16_t>(half);
+}
+
+//----------------------------------------------------------------------------------------------------
+float HalfToFloat(uint16_t const value)
+{
+    uint32_t const sign     = (static_cast<uint32_t>(value) & 0x8000u) << 16;
+    uint32_t const exponent = (value >> 10) & 0x1Fu;
+    uint32_t const mantissa = value & 0x3FFu;
+
+    if (exponent == 0)
+    {
+        float const magnitude = std::ldexp(static_cast<float>(mantissa), -24);
+        return sign != 0 ? -magnitude : magnitude;
+    }
+
+    uint32_t bits;
+
+    if (exponent == 31)
+    {
+        bits = sign | 0x7F800000u | (mantissa << 13);
+    }
+    else
+    {
+        bits = sign | ((exponent - 15u + 127u) << 23) | (mantissa << 13);
+    }
+
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+
+    return result;
+}
@@ -0,0 +1,55 @@
+//----------------------------------------------------------------------------------------------------
+// QuantizedVertex.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Math/Vec3.hpp"
+#include "Engine/Renderer/VertexUtils.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// 16-byte compressed Vertex_PCU (24 bytes) for static meshes.
+//
+// Matching D3D11 input layout:
+//   VERTEX_POSITION     DXGI_FORMAT_R16G16B16A16_UNORM   offset 0   (w unused)
+//   VERTEX_COLOR        DXGI_FORMAT_R8G8B8A8_UNORM       offset 8
+//   VERTEX_UVTEXCOORDS  DXGI_FORMAT_R16G16_FLOAT         offset 12
+//
+// Positions are unorm16 within the mesh bounds, so the shader sees them in [0,1]^3; folding
+// sQuantizedMesh::GetDecodeTransform() into the model matrix lets Default.hlsl draw them unchanged.
+// UVs are half floats, which keeps tiling UVs outside [0,1] exact to about 1/2048 of their magnitude.
+//----------------------------------------------------------------------------------------------------
+struct Vertex_PCUQ
+{
+    uint16_t m_position[4];
+    Rgba8    m_color;
+    uint16_t m_uvTexCoords[2];
+};
+
+static_assert(sizeof(Vertex_PCUQ) == 16, "Vertex_PCUQ must stay 16 bytes to match its input layout");
+
+//----------------------------------------------------------------------------------------------------
+struct sQuantizedMesh
+{
+    Vec3                     m_boundsMins;
+    Vec3                     m_boundsSize;
+    std::vector<Vertex_PCUQ> m_vertexes;
+
+    Mat44  GetDecodeTransform() const;      // [0,1]^3 to mesh space
+    Vec3   GetMaxPositionError() const;     // Half a quantization step per axis
+    size_t GetByteSize() const { return m_vertexes.size() * sizeof(Vertex_PCUQ); }
+};
+
+//----------------------------------------------------------------------------------------------------
+void       QuantizeVertexes(VertexList_PCU const& vertexes, sQuantizedMesh& out_mesh);
+void       DequantizeVertexes(sQuantizedMesh const& mesh, VertexList_PCU& out_vertexes);
+Vertex_PCU DecodeVertexUnitSpace(Vertex_PCUQ const& vertex);     // Position left in [0,1]^3
+
+uint16_t FloatToHalf(float value);
+float    HalfToFloat(uint16_t value);
@@ -0,0 +1,95 @@
+//----------------------------------------------------------------------------------------------------
+// QuantizedVertexCheck.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/HeadlessRunner.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "Engine/Core/StringUtils.hpp"
+#include "Game/PropMeshCache.hpp"
+#include "Game/Framework/QuantizedVertex.hpp"
+
+//----------------------------------------------------------------------------------------------------
+bool RunVertexFormatsCheck(sHeadlessRunConfig const& config)
+{
+    struct sNamedMesh
+    {
+        char const*   m_name;
+        ePropMeshType m_type;
+    };
+
+    sNamedMesh const meshes[] = {{"cube", ePropMeshType::CUBE}, {"sphere", ePropMeshType::SPHERE}, {"grid", ePropMeshType::GRID}};
+
+    String report = Stringf("Vertex formats: Vertex_PCU %u bytes, Vertex_PCUQ %u bytes\n", static_cast<uint32_t>(sizeof(Vertex_PCU)), static_cast<uint32_t>(sizeof(Vertex_PCUQ)));
+    report += "mesh    lod    verts   pcuBytes  pcuqBytes  ratio  maxPosError  posTolerance  maxUvError  colors\n";
+
+    size_t         totalPcuBytes  = 0;
+    size_t         totalPcuqBytes = 0;
+    bool           isWithinBounds = true;
+    VertexList_PCU decoded;
+
+    for (sNamedMesh const& namedMesh : meshes)
+    {
+        sPropMesh const& mesh = PropMeshCache::GetMesh(namedMesh.m_type);
+
+        for (uint8_t level = 0; level < mesh.GetLevelCount(); ++level)
+        {
+            VertexList_PCU const& source    = mesh.m_levels[level];
+            sQuantizedMesh const& quantized = mesh.m_quantizedLevels[level];
+
+            DequantizeVertexes(quantized, decoded);
+
+            // Error is measured per axis; UVs are compared relative to their magnitude (half floats).
+            Vec3 const tolerance      = quantized.GetMaxPositionError();
+            float      maxPosError    = 0.f;
+            float      maxUvError     = 0.f;
+            bool       isColorExact   = true;
+            bool       isLevelInBound = decoded.size() == source.size();
+
+            for (size_t i = 0; i < source.size() && isLevelInBound; ++i)
+            {
+                Vec3 const error(std::fabs(decoded[i].m_position.x - source[i].m_position.x),
+                                 std::fabs(decoded[i].m_position.y - source[i].m_position.y),
+                                 std::fabs(decoded[i].m_position.z - source[i].m_position.z));
+
+                maxPosError    = std::max(maxPosError, std::max(error.x, std::max(error.y, error.z)));
+                isLevelInBound = isLevelInBound && error.x <= tolerance.x * 1.01f + 1e-6f && error.y <= tolerance.y * 1.01f + 1e-6f &&
+                                 error.z <= tolerance.z * 1.01f + 1e-6f;
+
+                float const uvErrorX = std::fabs(decoded[i].m_uvTexCoords.x - source[i].m_uvTexCoords.x);
+                float const uvErrorY = std::fabs(decoded[i].m_uvTexCoords.y - source[i].m_uvTexCoords.y);
+
+                maxUvError     = std::max(maxUvError, std::max(uvErrorX, uvErrorY));
+                isLevelInBound = isLevelInBound && uvErrorX <= std::fabs(source[i].m_uvTexCoords.x) / 2048.f + 1e-7f &&
+                                 uvErrorY <= std::fabs(source[i].m_uvTexCoords.y) / 2048.f + 1e-7f;
+
+                Rgba8 const& decodedColor = decoded[i].m_color;
+                Rgba8 const& sourceColor  = source[i].m_color;
+                isColorExact = isColorExact && decodedColor.r == sourceColor.r && decodedColor.g == sourceColor.g && decodedColor.b == sourceColor.b &&
+                               decodedColor.a == sourceColor.a;
+            }
+
+            isWithinBounds = isWithinBounds && isLevelInBound && isColorExact;
+
+            size_t const pcuBytes  = source.size() * sizeof(Vertex_PCU);
+            size_t const pcuqBytes = quantized.GetByteSize();
+            totalPcuBytes += pcuBytes;
+            totalPcuqBytes += pcuqBytes;
+
+            report += Stringf("%-6s  %3u  %7u  %9u  %9u  %5.2f  %11.6f  %12.6f  %10.6f  %s\n", namedMesh.m_name, level, static_cast<uint32_t>(source.size()),
+                              static_cast<uint32_t>(pcuBytes), static_cast<uint32_t>(pcuqBytes), pcuBytes > 0 ? static_cast<double>(pcuqBytes) / pcuBytes : 0.0,
+                              maxPosError, std::max(tolerance.x, std::max(tolerance.y, tolerance.z)), maxUvError, isColorExact ? "exact" : "CHANGED");
+        }
+    }
+
+    report += Stringf("total             %9u  %9u  %5.2f\n", static_cast<uint32_t>(totalPcuBytes), static_cast<uint32_t>(totalPcuqBytes),
+                      totalPcuBytes > 0 ? static_cast<double>(totalPcuqBytes) / totalPcuBytes : 0.0);
+    report += Stringf("validation       %s\n", isWithinBounds ? "OK" : "FAILED");
+
+    WriteHeadlessReport(config.m_vertexFormatReportPath, report);
+
+    return isWithinBounds;
+}
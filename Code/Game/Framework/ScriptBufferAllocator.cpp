@@ -0,0 +1,267 @@
+//----------------------------------------------------------------------------------------------------
+// ScriptBufferAllocator.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/ScriptBufferAllocator.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdlib>
+#include <cstring>
+
+//----------------------------------------------------------------------------------------------------
+ScriptBufferAllocator::ScriptBufferAllocator(sScriptBufferAllocatorConfig const& config)
+    : m_config(config)
+{
+    m_config.m_minBlockBytes  = std::bit_ceil(std::max(m_config.m_minBlockBytes, static_cast<uint32_t>(sizeof(void*))));
+    m_config.m_maxBlockBytes  = std::bit_ceil(std::max(m_config.m_maxBlockBytes, m_config.m_minBlockBytes));
+    m_config.m_slabBytes      = std::max(m_config.m_slabBytes, m_config.m_maxBlockBytes);
+    m_config.m_largePageBytes = std::max(m_config.m_largePageBytes, 1u);
+
+    uint32_t const classCount = std::countr_zero(m_config.m_maxBlockBytes) - std::countr_zero(m_config.m_minBlockBytes) + 1;
+
+    // Mutexes cannot move, so the classes are built in place.
+    std::vector<sSizeClass>(classCount).swap(m_sizeClasses);
+
+    for (uint32_t index = 0; index < classCount; ++index)
+    {
+        m_sizeClasses[index].m_blockBytes         = m_config.m_minBlockBytes << index;
+        m_sizeClasses[index].m_stats.m_blockBytes = m_sizeClasses[index].m_blockBytes;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+ScriptBufferAllocator::~ScriptBufferAllocator()
+{
+    for (sSizeClass& sizeClass : m_sizeClasses)
+    {
+        for (void* const slab : sizeClass.m_slabs)
+        {
+            std::free(slab);
+        }
+    }
+
+    for (auto& [blockBytes, blocks] : m_cachedLargeBlocks)
+    {
+        for (void* const block : blocks)
+        {
+            std::free(block);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void* ScriptBufferAllocator::Allocate(size_t const length)
+{
+    return AllocateBlock(length, true);
+}
+
+//----------------------------------------------------------------------------------------------------
+void* ScriptBufferAllocator::AllocateUninitialized(size_t const length)
+{
+    return AllocateBlock(length, false);
+}
+
+//----------------------------------------------------------------------------------------------------
+void ScriptBufferAllocator::Free(void* const data, size_t const length)
+{
+    if (data == nullptr)
+    {
+        return;
+    }
+
+    int const classIndex = GetSizeClassIndex(length);
+
+    if (classIndex >= 0)
+    {
+        sSizeClass&                 sizeClass = m_sizeClasses[classIndex];
+        std::lock_guard<std::mutex> lock(sizeClass.m_mutex);
+
+        *static_cast<void**>(data) = sizeClass.m_freeList;
+        sizeClass.m_freeList       = data;
+        --sizeClass.m_stats.m_liveCount;
+
+        return;
+    }
+
+    size_t const blockBytes = GetLargeBlockBytes(length);
+
+    {
+        std::lock_guard<std::mutex> lock(m_largeMutex);
+
+        m_largeLiveBytes -= blockBytes;
+
+        if (m_largeCachedBytes + blockBytes <= m_config.m_maxCachedLargeBytes)
+        {
+            m_cachedLargeBlocks[blockBytes].push_back(data);
+            m_largeCachedBytes += blockBytes;
+
+            return;
+        }
+    }
+
+    std::free(data);
+}
+
+//----------------------------------------------------------------------------------------------------
+sScriptBufferStats ScriptBufferAllocator::GetStats() const
+{
+    sScriptBufferStats stats;
+    stats.m_sizeClasses.reserve(m_sizeClasses.size());
+
+    for (sSizeClass const& sizeClass : m_sizeClasses)
+    {
+        std::lock_guard<std::mutex> lock(sizeClass.m_mutex);
+        stats.m_sizeClasses.push_back(sizeClass.m_stats);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_largeMutex);
+
+        stats.m_largeAllocationCount = m_largeAllocationCount;
+        stats.m_largeReuseCount      = m_largeReuseCount;
+        stats.m_largeLiveBytes       = m_largeLiveBytes;
+        stats.m_largeCachedBytes     = m_largeCachedBytes;
+    }
+
+    stats.m_zeroFilledBytes     = m_zeroFilledBytes.load(std::memory_order_relaxed);
+    stats.m_zeroFillElidedBytes = m_zeroFillElidedBytes.load(std::memory_order_relaxed);
+
+    return stats;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Only the requested length is cleared; the rest of a pooled block is never visible to script.
+//
+void* ScriptBufferAllocator::AllocateBlock(size_t const length,
+                                           bool const   isZeroFilled)
+{
+    void*     block      = nullptr;
+    int const classIndex = GetSizeClassIndex(length);
+
+    if (classIndex >= 0)
+    {
+        sSizeClass&                 sizeClass = m_sizeClasses[classIndex];
+        std::lock_guard<std::mutex> lock(sizeClass.m_mutex);
+
+        if (sizeClass.m_freeList == nullptr)
+        {
+            uint32_t const blockCount = m_config.m_slabBytes / sizeClass.m_blockBytes;
+            uint8_t* const slab       = static_cast<uint8_t*>(std::malloc(static_cast<size_t>(blockCount) * sizeClass.m_blockBytes));
+
+            if (slab == nullptr)
+            {
+                return nullptr;
+            }
+
+            // Thread the new blocks onto the free list back to front, so they are handed out in address order.
+            for (uint32_t blockIndex = blockCount; blockIndex-- > 0;)
+            {
+                void* const freeBlock           = slab + static_cast<size_t>(blockIndex) * sizeClass.m_blockBytes;
+                *static_cast<void**>(freeBlock) = sizeClass.m_freeList;
+                sizeClass.m_freeList            = freeBlock;
+            }
+
+            sizeClass.m_slabs.push_back(slab);
+            sizeClass.m_stats.m_reservedBytes += static_cast<uint64_t>(blockCount) * sizeClass.m_blockBytes;
+        }
+
+        block                = sizeClass.m_freeList;
+        sizeClass.m_freeList = *static_cast<void**>(block);
+
+        ++sizeClass.m_stats.m_allocationCount;
+        ++sizeClass.m_stats.m_liveCount;
+        sizeClass.m_stats.m_peakLiveCount = std::max(sizeClass.m_stats.m_peakLiveCount, sizeClass.m_stats.m_liveCount);
+    }
+    else
+    {
+        size_t const blockBytes = GetLargeBlockBytes(length);
+
+        {
+            std::lock_guard<std::mutex> lock(m_largeMutex);
+
+            ++m_largeAllocationCount;
+            m_largeLiveBytes += blockBytes;
+
+            auto const it = m_cachedLargeBlocks.find(blockBytes);
+
+            if (it != m_cachedLargeBlocks.end() && !it->second.empty())
+            {
+                block = it->second.back();
+                it->second.pop_back();
+                m_largeCachedBytes -= blockBytes;
+                ++m_largeReuseCount;
+            }
+        }
+
+        if (block == nullptr)
+        {
+            block = std::malloc(blockBytes);
+
+            if (block == nullptr)
+            {
+                std::lock_guard<std::mutex> lock(m_largeMutex);
+                m_largeLiveBytes -= blockBytes;
+
+                return nullptr;
+            }
+        }
+    }
+
+    if (isZeroFilled)
+    {
+        std::memset(block, 0, length);
+        m_zeroFilledBytes.fetch_add(length, std::memory_order_relaxed);
+    }
+    else
+    {
+        m_zeroFillElidedBytes.fetch_add(length, std::memory_order_relaxed);
+    }
+
+    return block;
+}
+
+//----------------------------------------------------------------------------------------------------
+int ScriptBufferAllocator::GetSizeClassIndex(size_t const length) const
+{
+    if (length > m_config.m_maxBlockBytes)
+    {
+        return -1;
+    }
+
+    size_t const blockBytes = std::bit_ceil(std::max(length, static_cast<size_t>(m_config.m_minBlockBytes)));
+
+    return std::countr_zero(blockBytes) - std::countr_zero(m_config.m_minBlockBytes);
+}
+
+//----------------------------------------------------------------------------------------------------
+size_t ScriptBufferAllocator::GetLargeBlockBytes(size_t const length) const
+{
+    return (length + m_config.m_largePageBytes - 1) / m_config.m_largePageBytes * m_config.m_largePageBytes;
+}
+
+//----------------------------------------------------------------------------------------------------
+ScriptArrayBufferAllocator::ScriptArrayBufferAllocator(ScriptBufferAllocator& allocator)
+    : m_allocator(allocator)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+void* ScriptArrayBufferAllocator::Allocate(size_t const length)
+{
+    return m_allocator.Allocate(length);
+}
+
+//----------------------------------------------------------------------------------------------------
+void* ScriptArrayBufferAllocator::AllocateUninitialized(size_t const length)
+{
+    return m_allocator.AllocateUninitialized(length);
+}
+
+//----------------------------------------------------------------------------------------------------
+void ScriptArrayBufferAllocator::Free(void* const data,
+                                      size_t const length)
+{
+    m_allocator.Free(data, length);
+}
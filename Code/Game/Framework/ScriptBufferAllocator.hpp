@@ -0,0 +1,120 @@
+//----------------------------------------------------------------------------------------------------
+// ScriptBufferAllocator.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include <v8-array-buffer.h>
+
+//----------------------------------------------------------------------------------------------------
+struct sScriptBufferAllocatorConfig
+{
+    uint32_t m_minBlockBytes       = 16;                   // Smallest size class (power of two)
+    uint32_t m_maxBlockBytes       = 64 * 1024;            // Largest pooled size class; bigger requests are large blocks
+    uint32_t m_slabBytes           = 256 * 1024;           // Carved into blocks of one size class at a time
+    uint32_t m_largePageBytes      = 64 * 1024;            // Large blocks are rounded up to whole pages
+    uint64_t m_maxCachedLargeBytes = 32ull * 1024 * 1024;  // Freed large blocks kept for reuse, beyond which they go back to the OS
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sScriptBufferSizeClassStats
+{
+    uint32_t m_blockBytes      = 0;
+    uint64_t m_allocationCount = 0;
+    uint64_t m_liveCount       = 0;
+    uint64_t m_peakLiveCount   = 0;
+    uint64_t m_reservedBytes   = 0;      // Slabs owned by this class
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sScriptBufferStats
+{
+    std::vector<sScriptBufferSizeClassStats> m_sizeClasses;
+
+    uint64_t m_largeAllocationCount = 0;
+    uint64_t m_largeReuseCount      = 0;      // Served from a cached block instead of the OS
+    uint64_t m_largeLiveBytes       = 0;
+    uint64_t m_largeCachedBytes     = 0;
+    uint64_t m_zeroFilledBytes      = 0;      // Cleared for Allocate()
+    uint64_t m_zeroFillElidedBytes  = 0;      // Handed out by AllocateUninitialized() without clearing
+};
+
+//----------------------------------------------------------------------------------------------------
+// Backing store allocator for script ArrayBuffers and typed arrays, with the same contract as
+// v8::ArrayBuffer::Allocator: Allocate() returns zeroed memory, AllocateUninitialized() is for buffers
+// the caller overwrites at once, and Free() is given the original length back.
+//
+// Requests up to m_maxBlockBytes come from power-of-two size classes, each a free list over slabs it
+// never returns, so per-frame Float32Array churn reuses the same memory instead of going through the
+// heap. Larger requests are rounded up to whole pages and cached by page count on Free(), up to
+// m_maxCachedLargeBytes, so repeated big buffers (vertex batches, audio blocks) reuse the same blocks.
+//
+// Safe to call from any thread; each size class and the large-block cache have their own lock.
+//----------------------------------------------------------------------------------------------------
+class ScriptBufferAllocator
+{
+public:
+    explicit ScriptBufferAllocator(sScriptBufferAllocatorConfig const& config);
+    ~ScriptBufferAllocator();
+
+    ScriptBufferAllocator(ScriptBufferAllocator const&)            = delete;
+    ScriptBufferAllocator& operator=(ScriptBufferAllocator const&) = delete;
+
+    void* Allocate(size_t length);
+    void* AllocateUninitialized(size_t length);
+    void  Free(void* data, size_t length);
+
+    sScriptBufferStats GetStats() const;
+
+private:
+    struct sSizeClass
+    {
+        mutable std::mutex          m_mutex;
+        uint32_t                    m_blockBytes = 0;
+        void*                       m_freeList   = nullptr;      // Next pointer stored in each free block
+        std::vector<void*>          m_slabs;
+        sScriptBufferSizeClassStats m_stats;
+    };
+
+    void*  AllocateBlock(size_t length, bool isZeroFilled);
+    int    GetSizeClassIndex(size_t length) const;      // -1 for a large block
+    size_t GetLargeBlockBytes(size_t length) const;
+
+    sScriptBufferAllocatorConfig m_config;
+    std::vector<sSizeClass>      m_sizeClasses;
+
+    mutable std::mutex                   m_largeMutex;
+    std::map<size_t, std::vector<void*>> m_cachedLargeBlocks;      // Keyed by rounded block bytes
+    uint64_t                             m_largeAllocationCount = 0;
+    uint64_t                             m_largeReuseCount      = 0;
+    uint64_t                             m_largeLiveBytes       = 0;
+    uint64_t                             m_largeCachedBytes     = 0;
+
+    std::atomic<uint64_t> m_zeroFilledBytes{0};
+    std::atomic<uint64_t> m_zeroFillElidedBytes{0};
+};
+
+//----------------------------------------------------------------------------------------------------
+// The ScriptBufferAllocator behind V8's own interface, for v8::Isolate::CreateParams::
+// array_buffer_allocator. Both must outlive the isolate. The engine V8Subsystem does not take one yet,
+// so until it does the game's isolate keeps V8's default allocator.
+//----------------------------------------------------------------------------------------------------
+class ScriptArrayBufferAllocator final : public v8::ArrayBuffer::Allocator
+{
+public:
+    explicit ScriptArrayBufferAllocator(ScriptBufferAllocator& allocator);
+
+    void* Allocate(size_t length) override;
+    void* AllocateUninitialized(size_t length) override;
+    void  Free(void* data, size_t length) override;
+
+private:
+    ScriptBufferAllocator& m_allocator;
+};
@@ -0,0 +1,222 @@
+//----------------------------------------------------------------------------------------------------
+// ScriptBufferAllocatorCheck.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/HeadlessRunner.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Math/RandomNumberGenerator.hpp"
+#include "Game/Framework/ScriptBufferAllocator.hpp"
+
+//----------------------------------------------------------------------------------------------------
+bool RunScriptBuffersCheck(sHeadlessRunConfig const& config)
+{
+    struct sBufferOp
+    {
+        uint32_t m_length       = 0;
+        uint32_t m_freeFrame    = 0;
+        bool     m_isZeroFilled = true;
+    };
+
+    // Per frame: Float32Array temporaries for vector math that die the same frame, medium buffers (vertex
+    // batches, JSON payloads) living up to 30 frames, and a few large uninitialized blocks filled from C++.
+    uint32_t const                      frameCount = config.m_scriptBufferFrameCount;
+    std::vector<std::vector<sBufferOp>> frames(frameCount);
+    RandomNumberGenerator               rng;
+    uint64_t                            opCount = 0;
+
+    for (uint32_t frame = 0; frame < frameCount; ++frame)
+    {
+        for (int index = 0; index < 2000; ++index)
+        {
+            frames[frame].push_back({static_cast<uint32_t>(rng.RollRandomIntInRange(1, 16) * 16), frame, true});
+        }
+
+        for (int index = 0; index < 100; ++index)
+        {
+            bool const isCopied = rng.RollRandomFloatZeroToOne() < 0.5f;
+            frames[frame].push_back({static_cast<uint32_t>(rng.RollRandomIntInRange(1024, 32 * 1024)), frame + rng.RollRandomIntInRange(1, 30), !isCopied});
+        }
+
+        for (int index = 0; index < 4; ++index)
+        {
+            frames[frame].push_back({static_cast<uint32_t>(rng.RollRandomIntInRange(128, 2048) * 1024), frame + rng.RollRandomIntInRange(0, 3), false});
+        }
+
+        opCount += frames[frame].size();
+    }
+
+    // Tags at both ends of every buffer catch overlapping blocks; zero-filled buffers must read zero first.
+    auto const replay = [&](auto const& allocate, auto const& allocateUninitialized, auto const& free, uint32_t const seed)
+    {
+        struct sLiveBuffer
+        {
+            uint8_t* m_data   = nullptr;
+            uint32_t m_length = 0;
+            uint32_t m_tag    = 0;
+        };
+
+        std::vector<std::vector<sLiveBuffer>> freeAtFrame(frameCount + 1);      // The last slot outlives the trace
+        uint32_t                              errorCount = 0;
+        uint32_t                              tag        = seed;
+
+        auto const release = [&](sLiveBuffer const& buffer)
+        {
+            uint32_t head;
+            uint32_t tail;
+            std::memcpy(&head, buffer.m_data, sizeof(head));
+            std::memcpy(&tail, buffer.m_data + buffer.m_length - sizeof(tail), sizeof(tail));
+
+            errorCount += head != buffer.m_tag || tail != ~buffer.m_tag ? 1 : 0;
+            free(buffer.m_data, buffer.m_length);
+        };
+
+        for (uint32_t frame = 0; frame < frameCount; ++frame)
+        {
+            for (sBufferOp const& op : frames[frame])
+            {
+                uint8_t* const data = static_cast<uint8_t*>(op.m_isZeroFilled ? allocate(op.m_length) : allocateUninitialized(op.m_length));
+
+                if (data == nullptr)
+                {
+                    ++errorCount;
+                    continue;
+                }
+
+                if (op.m_isZeroFilled)
+                {
+                    uint32_t const checkBytes = std::min(op.m_length, 64u);
+                    errorCount += std::any_of(data, data + checkBytes, [](uint8_t const value) { return value != 0; }) ||
+                                  std::any_of(data + op.m_length - checkBytes, data + op.m_length, [](uint8_t const value) { return value != 0; }) ? 1 : 0;
+                }
+                else
+                {
+                    std::memset(data, 0xA5, std::min(op.m_length, 4096u));
+                }
+
+                sLiveBuffer const buffer{data, op.m_length, ++tag};
+                uint32_t const    tail = ~buffer.m_tag;
+                std::memcpy(data, &buffer.m_tag, sizeof(buffer.m_tag));
+                std::memcpy(data + op.m_length - sizeof(tail), &tail, sizeof(tail));
+
+                freeAtFrame[std::min(op.m_freeFrame, frameCount)].push_back(buffer);
+            }
+
+            for (sLiveBuffer const& buffer : freeAtFrame[frame])
+            {
+                release(buffer);
+            }
+
+            freeAtFrame[frame].clear();
+        }
+
+        for (std::vector<sLiveBuffer>& buffers : freeAtFrame)
+        {
+            for (sLiveBuffer const& buffer : buffers)
+            {
+                release(buffer);
+            }
+        }
+
+        return errorCount;
+    };
+
+    // What V8's default allocator does: calloc for Allocate, malloc for AllocateUninitialized.
+    auto const defaultStart  = std::chrono::steady_clock::now();
+    uint32_t   defaultErrors = replay([](size_t const length) { return std::calloc(length, 1); },
+                                      [](size_t const length) { return std::malloc(length); },
+                                      [](void* const data, size_t) { std::free(data); }, 0);
+    double const defaultMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - defaultStart).count();
+
+    // Through the v8::ArrayBuffer::Allocator interface, virtual calls included, as an isolate would call it.
+    sScriptBufferAllocatorConfig const allocatorConfig;
+    ScriptBufferAllocator              allocator(allocatorConfig);
+    ScriptArrayBufferAllocator         v8Allocator(allocator);
+    v8::ArrayBuffer::Allocator&        isolateAllocator = v8Allocator;
+
+    auto const pooledStart  = std::chrono::steady_clock::now();
+    uint32_t   pooledErrors = replay([&](size_t const length) { return isolateAllocator.Allocate(length); },
+                                     [&](size_t const length) { return isolateAllocator.AllocateUninitialized(length); },
+                                     [&](void* const data, size_t const length) { isolateAllocator.Free(data, length); }, 0);
+    double const pooledMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - pooledStart).count();
+
+    // A second pass on the warm pool: slabs already reserved, large blocks cached.
+    auto const warmStart = std::chrono::steady_clock::now();
+    pooledErrors += replay([&](size_t const length) { return isolateAllocator.Allocate(length); },
+                           [&](size_t const length) { return isolateAllocator.AllocateUninitialized(length); },
+                           [&](void* const data, size_t const length) { isolateAllocator.Free(data, length); }, 0);
+    double const warmMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - warmStart).count();
+
+    sScriptBufferStats const stats = allocator.GetStats();
+
+    // Every thread replays the trace on one shared allocator, with distinct tags.
+    uint32_t const           threadCount = std::max(std::thread::hardware_concurrency(), 2u);
+    ScriptBufferAllocator    sharedAllocator(allocatorConfig);
+    std::atomic<uint32_t>    threadErrors{0};
+    std::vector<std::thread> threads;
+
+    auto const threadedStart = std::chrono::steady_clock::now();
+
+    for (uint32_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+    {
+        threads.emplace_back([&, threadIndex]()
+        {
+            threadErrors += replay([&](size_t const length) { return sharedAllocator.Allocate(length); },
+                                   [&](size_t const length) { return sharedAllocator.AllocateUninitialized(length); },
+                                   [&](void* const data, size_t const length) { sharedAllocator.Free(data, length); }, threadIndex << 28);
+        });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    double const threadedMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - threadedStart).count();
+
+    uint64_t liveCount = stats.m_largeLiveBytes;
+
+    for (sScriptBufferSizeClassStats const& sizeClass : stats.m_sizeClasses)
+    {
+        liveCount += sizeClass.m_liveCount;
+    }
+
+    bool const isValid = defaultErrors == 0 && pooledErrors == 0 && threadErrors.load() == 0 && liveCount == 0;
+
+    String report = Stringf("Script buffers: %u frames, %llu allocations per pass\n", frameCount, opCount);
+    report += "Synthetic C++ allocation trace, no V8 or JS: allocator cost only, not a script speedup\n";
+    report += Stringf("calloc/malloc    %.3f ms\n", defaultMilliseconds);
+    report += Stringf("pooled           %.3f ms cold, %.3f ms warm (%.2fx / %.2fx)\n", pooledMilliseconds, warmMilliseconds,
+                      defaultMilliseconds / std::max(pooledMilliseconds, 1e-6), defaultMilliseconds / std::max(warmMilliseconds, 1e-6));
+    report += Stringf("pooled %2u thr    %.3f ms on one shared allocator\n", threadCount, threadedMilliseconds);
+    report += Stringf("zero fill        %.1f MB cleared, %.1f MB elided (uninitialized)\n",
+                      static_cast<double>(stats.m_zeroFilledBytes) / (1024.0 * 1024.0), static_cast<double>(stats.m_zeroFillElidedBytes) / (1024.0 * 1024.0));
+    report += Stringf("large blocks     %llu allocations, %llu reused, %.1f MB cached\n", stats.m_largeAllocationCount, stats.m_largeReuseCount,
+                      static_cast<double>(stats.m_largeCachedBytes) / (1024.0 * 1024.0));
+    report += "size class       allocations  peak live  reserved KB\n";
+
+    for (sScriptBufferSizeClassStats const& sizeClass : stats.m_sizeClasses)
+    {
+        if (sizeClass.m_allocationCount > 0)
+        {
+            report += Stringf("%10u B     %11llu  %9llu  %11llu\n", sizeClass.m_blockBytes, sizeClass.m_allocationCount, sizeClass.m_peakLiveCount,
+                              sizeClass.m_reservedBytes / 1024);
+        }
+    }
+
+    report += Stringf("buffer errors    %u default, %u pooled, %u threaded\n", defaultErrors, pooledErrors, threadErrors.load());
+    report += Stringf("validation       %s\n", isValid ? "OK" : "FAILED");
+
+    WriteHeadlessReport(config.m_scriptBufferReportPath, report);
+
+    return isValid;
+}
@@ -0,0 +1,972 @@
+//----------------------------------------------------------------------------------------------------
+// ScriptBundler.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/ScriptBundler.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string_view>
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include "Engine/Core/LogSubsystem.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Game/Framework/GameCommon.hpp"
+
+//----------------------------------------------------------------------------------------------------
+enum eScriptCharKind : uint8_t
+{
+    SCRIPT_CHAR_CODE,
+    SCRIPT_CHAR_COMMENT,
+    SCRIPT_CHAR_LITERAL,      // Strings, template text and regular expressions; never altered
+    SCRIPT_CHAR_STRIPPED      // Dev logging
+};
+
+//----------------------------------------------------------------------------------------------------
+enum class eScriptTokenType : uint8_t
+{
+    IDENTIFIER,
+    NUMBER,
+    LITERAL,
+    PUNCTUATOR,
+    TEMPLATE_OPEN             // The "${" that starts an expression inside a template literal
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sScriptToken
+{
+    uint32_t         m_begin      = 0;
+    uint32_t         m_end        = 0;
+    uint32_t         m_braceDepth = 0;
+    eScriptTokenType m_type       = eScriptTokenType::PUNCTUATOR;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sScannedScript
+{
+    std::string               m_path;
+    std::string               m_text;
+    std::vector<uint8_t>      m_kinds;      // One eScriptCharKind per character
+    std::vector<sScriptToken> m_tokens;
+    uint32_t                  m_devLogCount = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+static char constexpr BASE64_DIGITS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+//----------------------------------------------------------------------------------------------------
+static bool IsIdentifierStart(char const c)
+{
+    return std::isalpha(static_cast<unsigned char>(c)) || c == '_' || c == '$' || static_cast<unsigned char>(c) >= 0x80;
+}
+
+//----------------------------------------------------------------------------------------------------
+static bool IsIdentifierChar(char const c)
+{
+    return IsIdentifierStart(c) || std::isdigit(static_cast<unsigned char>(c));
+}
+
+//----------------------------------------------------------------------------------------------------
+static std::string_view GetTokenText(std::string_view const text, sScriptToken const& token)
+{
+    return text.substr(token.m_begin, token.m_end - token.m_begin);
+}
+
+//----------------------------------------------------------------------------------------------------
+static bool IsPunctuator(std::string_view const text, sScriptToken const& token, char const c)
+{
+    return token.m_type == eScriptTokenType::PUNCTUATOR && text[token.m_begin] == c;
+}
+
+//----------------------------------------------------------------------------------------------------
+// A '/' starts a regular expression unless it follows something that ends an operand.
+//
+static bool IsRegexAllowed(std::string_view const text, std::vector<sScriptToken> const& tokens)
+{
+    if (tokens.empty())
+    {
+        return true;
+    }
+
+    sScriptToken const& last = tokens.back();
+
+    switch (last.m_type)
+    {
+    case eScriptTokenType::NUMBER:
+    case eScriptTokenType::LITERAL:
+        return false;
+
+    case eScriptTokenType::TEMPLATE_OPEN:
+        return true;
+
+    case eScriptTokenType::IDENTIFIER:
+    {
+        static std::set<std::string_view> const keywords = {"return", "typeof", "instanceof", "in", "of", "new", "delete", "void",
+                                                            "throw", "case", "do", "else", "yield", "await"};
+        return keywords.contains(GetTokenText(text, last));
+    }
+
+    case eScriptTokenType::PUNCTUATOR:
+    {
+        char const c = text[last.m_begin];
+        return c != ')' && c != ']' && c != '}';
+    }
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+static void MarkKind(sScannedScript& script, size_t const begin, size_t const end, eScriptCharKind const kind)
+{
+    std::fill(script.m_kinds.begin() + static_cast<ptrdiff_t>(begin), script.m_kinds.begin() + static_cast<ptrdiff_t>(end), kind);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Scans template text from 'begin' (the opening backtick or an expression's closing brace) up to the
+// closing backtick or the next "${"; returns the position after it.
+//
+static size_t ScanTemplateText(sScannedScript& script, size_t const begin, uint32_t const braceDepth, std::vector<uint32_t>& templateDepths)
+{
+    std::string const& text = script.m_text;
+    size_t             pos  = begin + 1;
+
+    while (pos < text.size())
+    {
+        if (text[pos] == '\\')
+        {
+            pos += 2;
+        }
+        else if (text[pos] == '`')
+        {
+            MarkKind(script, begin, pos + 1, SCRIPT_CHAR_LITERAL);
+            script.m_tokens.push_back({static_cast<uint32_t>(begin), static_cast<uint32_t>(pos + 1), braceDepth, eScriptTokenType::LITERAL});
+            return pos + 1;
+        }
+        else if (text[pos] == '$' && pos + 1 < text.size() && text[pos + 1] == '{')
+        {
+            MarkKind(script, begin, pos + 2, SCRIPT_CHAR_LITERAL);
+            script.m_tokens.push_back({static_cast<uint32_t>(pos), static_cast<uint32_t>(pos + 2), braceDepth, eScriptTokenType::TEMPLATE_OPEN});
+            templateDepths.push_back(braceDepth);
+            return pos + 2;
+        }
+        else
+        {
+            ++pos;
+        }
+    }
+
+    MarkKind(script, begin, text.size(), SCRIPT_CHAR_LITERAL);
+    return text.size();
+}
+
+//----------------------------------------------------------------------------------------------------
+// Classifies every character as code, comment or literal and splits the code into tokens. Enough of the
+// grammar to never mistake a string, template or regular expression for code; nothing is parsed.
+//
+static void ScanScript(sScannedScript& script)
+{
+    std::string const& text = script.m_text;
+
+    script.m_kinds.assign(text.size(), SCRIPT_CHAR_CODE);
+    script.m_tokens.clear();
+
+    std::vector<uint32_t> templateDepths;     // Brace depth at each open "${"
+    uint32_t              braceDepth = 0;
+    size_t                pos        = 0;
+
+    while (pos < text.size())
+    {
+        char const c    = text[pos];
+        char const next = pos + 1 < text.size() ? text[pos + 1] : '\0';
+
+        if (std::isspace(static_cast<unsigned char>(c)))
+        {
+            ++pos;
+        }
+        else if (c == '/' && next == '/')
+        {
+            size_t const end = std::min(text.find('\n', pos), text.size());
+            MarkKind(script, pos, end, SCRIPT_CHAR_COMMENT);
+            pos = end;
+        }
+        else if (c == '/' && next == '*')
+        {
+            size_t const close = text.find("*/", pos + 2);
+            size_t const end   = close == std::string::npos ? text.size() : close + 2;
+            MarkKind(script, pos, end, SCRIPT_CHAR_COMMENT);
+            pos = end;
+        }
+        else if (c == '\'' || c == '"')
+        {
+            size_t end = pos + 1;
+
+            while (end < text.size() && text[end] != c && text[end] != '\n')
+            {
+                end += text[end] == '\\' ? 2 : 1;
+            }
+
+            end = std::min(end + 1, text.size());
+            MarkKind(script, pos, end, SCRIPT_CHAR_LITERAL);
+            script.m_tokens.push_back({static_cast<uint32_t>(pos), static_cast<uint32_t>(end), braceDepth, eScriptTokenType::LITERAL});
+            pos = end;
+        }
+        else if (c == '`')
+        {
+            pos = ScanTemplateText(script, pos, braceDepth, templateDepths);
+        }
+        else if (c == '}' && !templateDepths.empty() && templateDepths.back() == braceDepth)
+        {
+            templateDepths.pop_back();
+            pos = ScanTemplateText(script, pos, braceDepth, templateDepths);
+        }
+        else if (c == '/' && IsRegexAllowed(text, script.m_tokens))
+        {
+            size_t end     = pos + 1;
+            bool   inClass = false;
+
+            while (end < text.size() && text[end] != '\n')
+            {
+                char const regexChar = text[end];
+                end += regexChar == '\\' ? 2 : 1;
+
+                if (regexChar == '[') inClass = true;
+                else if (regexChar == ']') inClass = false;
+                else if (regexChar == '/' && !inClass) break;
+            }
+
+            end = std::min(end, text.size());
+            MarkKind(script, pos, end, SCRIPT_CHAR_LITERAL);
+            script.m_tokens.push_back({static_cast<uint32_t>(pos), static_cast<uint32_t>(end), braceDepth, eScriptTokenType::LITERAL});
+            pos = end;
+        }
+        else if (IsIdentifierStart(c) || std::isdigit(static_cast<unsigned char>(c)))
+        {
+            size_t end = pos + 1;
+
+            while (end < text.size() && (IsIdentifierChar(text[end]) || (text[end] == '.' && std::isdigit(static_cast<unsigned char>(c)))))
+            {
+                ++end;
+            }
+
+            eScriptTokenType const type = IsIdentifierStart(c) ? eScriptTokenType::IDENTIFIER : eScriptTokenType::NUMBER;
+            script.m_tokens.push_back({static_cast<uint32_t>(pos), static_cast<uint32_t>(end), braceDepth, type});
+            pos = end;
+        }
+        else
+        {
+            if (c == '}' && braceDepth > 0)
+            {
+                --braceDepth;
+            }
+
+            script.m_tokens.push_back({static_cast<uint32_t>(pos), static_cast<uint32_t>(pos + 1), braceDepth, eScriptTokenType::PUNCTUATOR});
+
+            if (c == '{')
+            {
+                ++braceDepth;
+            }
+
+            ++pos;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// console.log( / console.debug( as code tokens; returns the index of the '(' or 0 when it is not one.
+//
+static size_t MatchDevLogCall(std::string_view const text, std::vector<sScriptToken> const& tokens, size_t const index)
+{
+    if (index + 3 >= tokens.size() || tokens[index].m_type != eScriptTokenType::IDENTIFIER || GetTokenText(text, tokens[index]) != "console")
+    {
+        return 0;
+    }
+
+    std::string_view const method = GetTokenText(text, tokens[index + 2]);
+
+    if (!IsPunctuator(text, tokens[index + 1], '.') || tokens[index + 2].m_type != eScriptTokenType::IDENTIFIER ||
+        (method != "log" && method != "debug") || !IsPunctuator(text, tokens[index + 3], '('))
+    {
+        return 0;
+    }
+
+    return index + 3;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Only calls that start a statement after '{', '}' or ';' go; "if (x) console.log(y)" or an arrow body
+// would otherwise change meaning, and those are left in place.
+//
+static void StripDevLogging(sScannedScript& script)
+{
+    std::string_view const           text   = script.m_text;
+    std::vector<sScriptToken> const& tokens = script.m_tokens;
+
+    for (size_t index = 0; index < tokens.size(); ++index)
+    {
+        size_t const openIndex = MatchDevLogCall(text, tokens, index);
+
+        if (openIndex == 0)
+        {
+            continue;
+        }
+
+        bool const isStatementStart = index == 0 || IsPunctuator(text, tokens[index - 1], '{') || IsPunctuator(text, tokens[index - 1], '}') ||
+                                      IsPunctuator(text, tokens[index - 1], ';');
+
+        if (!isStatementStart)
+        {
+            continue;
+        }
+
+        size_t   closeIndex = openIndex;
+        uint32_t depth      = 0;
+
+        for (; closeIndex < tokens.size(); ++closeIndex)
+        {
+            if (IsPunctuator(text, tokens[closeIndex], '(')) ++depth;
+            else if (IsPunctuator(text, tokens[closeIndex], ')') && --depth == 0) break;
+        }
+
+        if (closeIndex == tokens.size())
+        {
+            return;
+        }
+
+        if (closeIndex + 1 < tokens.size() && IsPunctuator(text, tokens[closeIndex + 1], ';'))
+        {
+            ++closeIndex;
+        }
+
+        MarkKind(script, tokens[index].m_begin, tokens[closeIndex].m_end, SCRIPT_CHAR_STRIPPED);
+        ++script.m_devLogCount;
+        index = closeIndex;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Top-level class / function names and let / const / var bindings, and every other bare identifier.
+//
+static void CollectNames(sScannedScript const& script, std::set<std::string>& out_declared, std::set<std::string>& out_referenced)
+{
+    std::string_view const           text   = script.m_text;
+    std::vector<sScriptToken> const& tokens = script.m_tokens;
+
+    for (size_t index = 0; index < tokens.size(); ++index)
+    {
+        sScriptToken const& token = tokens[index];
+
+        if (token.m_type != eScriptTokenType::IDENTIFIER || script.m_kinds[token.m_begin] == SCRIPT_CHAR_STRIPPED)
+        {
+            continue;
+        }
+
+        std::string_view const name = GetTokenText(text, token);
+
+        if (token.m_braceDepth == 0 && index + 1 < tokens.size() && tokens[index + 1].m_type == eScriptTokenType::IDENTIFIER &&
+            (name == "class" || name == "function" || name == "const" || name == "let" || name == "var"))
+        {
+            bool const isStatementStart = index == 0 || IsPunctuator(text, tokens[index - 1], ';') || IsPunctuator(text, tokens[index - 1], '}') ||
+                                          tokens[index - 1].m_type == eScriptTokenType::IDENTIFIER;
+
+            if (isStatementStart)
+            {
+                out_declared.emplace(GetTokenText(text, tokens[index + 1]));
+                ++index;
+                continue;
+            }
+        }
+
+        if (index == 0 || !IsPunctuator(text, tokens[index - 1], '.'))
+        {
+            out_referenced.emplace(name);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Kahn's algorithm, always taking the earliest configured file that is ready; a cycle releases the
+// earliest remaining file as is.
+//
+static std::vector<size_t> OrderByDependency(std::vector<sScannedScript> const& scripts, bool& out_hasCycle)
+{
+    size_t const                       count = scripts.size();
+    std::vector<std::set<std::string>> declared(count);
+    std::vector<std::set<std::string>> referenced(count);
+    std::map<std::string, size_t>      declaringScript;
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        CollectNames(scripts[index], declared[index], referenced[index]);
+
+        for (std::string const& name : declared[index])
+        {
+            declaringScript.emplace(name, index);
+        }
+    }
+
+    std::vector<std::set<size_t>> dependencies(count);
+
+    for (size_t index = 0; index < count; ++index)
+    {
+        for (std::string const& name : referenced[index])
+        {
+            auto const it = declaringScript.find(name);
+
+            if (it != declaringScript.end() && it->second != index)
+            {
+                dependencies[index].insert(it->second);
+            }
+        }
+    }
+
+    std::vector<size_t> order;
+    std::vector<bool>   isPlaced(count, false);
+
+    out_hasCycle = false;
+
+    while (order.size() < count)
+    {
+        size_t chosen = count;
+
+        for (size_t index = 0; index < count && chosen == count; ++index)
+        {
+            if (!isPlaced[index] && std::ranges::all_of(dependencies[index], [&](size_t const dependency) { return isPlaced[dependency]; }))
+            {
+                chosen = index;
+            }
+        }
+
+        if (chosen == count)
+        {
+            chosen       = static_cast<size_t>(std::ranges::find(isPlaced, false) - isPlaced.begin());
+            out_hasCycle = true;
+        }
+
+        isPlaced[chosen] = true;
+        order.push_back(chosen);
+    }
+
+    return order;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Appends the kept characters of one source line by line. A line starts a new mapping segment at its
+// first kept character and again after every stripped run; whitespace that only indented or separated
+// stripped text goes too, and one space keeps the neighbouring tokens apart.
+//
+static void AppendToBundle(sScannedScript const& script,
+                           uint32_t const        sourceIndex,
+                           std::string&          out_bundle,
+                           ScriptMappingLines&   out_mappings,
+                           sScriptBundleStats&   out_stats)
+{
+    std::string const& text      = script.m_text;
+    size_t             lineBegin = 0;
+    uint32_t           lineIndex = 0;
+    size_t const       firstLine = out_mappings.size();
+
+    while (lineBegin <= text.size())
+    {
+        size_t const lineEnd = std::min(text.find('\n', lineBegin), text.size());
+
+        std::string                        line;
+        std::vector<sScriptMappingSegment> segments;
+        size_t                             keptLength = 0;
+        bool                               isAfterGap = true;
+
+        for (size_t pos = lineBegin; pos < lineEnd; ++pos)
+        {
+            uint8_t const kind = script.m_kinds[pos];
+            char const    c    = text[pos];
+
+            if (kind == SCRIPT_CHAR_COMMENT || kind == SCRIPT_CHAR_STRIPPED)
+            {
+                out_stats.m_strippedCommentBytes += kind == SCRIPT_CHAR_COMMENT ? 1 : 0;
+                isAfterGap = true;
+                continue;
+            }
+
+            bool const isCodeSpace = kind == SCRIPT_CHAR_CODE && (c == ' ' || c == '\t');
+
+            if (isAfterGap && isCodeSpace)
+            {
+                continue;
+            }
+
+            if (isAfterGap)
+            {
+                if (!line.empty() && line.back() != ' ' && line.back() != '\t')
+                {
+                    line += ' ';
+                }
+
+                segments.push_back({static_cast<uint32_t>(line.size()), sourceIndex, lineIndex, static_cast<uint32_t>(pos - lineBegin)});
+                isAfterGap = false;
+            }
+
+            line += c;
+            keptLength = isCodeSpace ? keptLength : line.size();
+        }
+
+        line.resize(keptLength);
+
+        bool const isInsideLiteral = lineEnd < text.size() && script.m_kinds[lineEnd] == SCRIPT_CHAR_LITERAL;
+
+        if (!line.empty() || isInsideLiteral)
+        {
+            if (segments.empty())
+            {
+                segments.push_back({0, sourceIndex, lineIndex, 0});
+            }
+
+            out_bundle += line;
+            out_bundle += '\n';
+            out_mappings.push_back(std::move(segments));
+        }
+
+        lineBegin = lineEnd + 1;
+        ++lineIndex;
+    }
+
+    // Separate scripts cannot run into each other; concatenated ones can ("a = b" + "(c)()"), so each file
+    // ends its last statement explicitly.
+    if (out_mappings.size() > firstLine && out_bundle.size() >= 2 && out_bundle[out_bundle.size() - 2] != ';')
+    {
+        out_bundle.insert(out_bundle.size() - 1, 1, ';');
+    }
+
+    out_stats.m_sourceLines += lineIndex;
+}
+
+//----------------------------------------------------------------------------------------------------
+static void AppendVlq(std::string& out_text, int32_t const value)
+{
+    uint32_t vlq = value < 0 ? (static_cast<uint32_t>(-value) << 1) | 1u : static_cast<uint32_t>(value) << 1;
+
+    do
+    {
+        uint32_t digit = vlq & 31u;
+        vlq >>= 5;
+        digit |= vlq > 0 ? 32u : 0u;
+        out_text += BASE64_DIGITS[digit];
+    }
+    while (vlq > 0);
+}
+
+//----------------------------------------------------------------------------------------------------
+static bool ReadVlq(std::string_view const text, size_t& inout_pos, int32_t& out_value)
+{
+    uint32_t vlq   = 0;
+    uint32_t shift = 0;
+
+    while (inout_pos < text.size() && shift < 32)
+    {
+        char const* const digitPos = std::strchr(BASE64_DIGITS, text[inout_pos]);
+
+        if (digitPos == nullptr || *digitPos == '\0')
+        {
+            return false;
+        }
+
+        uint32_t const digit = static_cast<uint32_t>(digitPos - BASE64_DIGITS);
+        ++inout_pos;
+        vlq |= (digit & 31u) << shift;
+        shift += 5;
+
+        if ((digit & 32u) == 0)
+        {
+            out_value = (vlq & 1u) != 0 ? -static_cast<int32_t>(vlq >> 1) : static_cast<int32_t>(vlq >> 1);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------------------------------
+static bool ReadTextFile(std::string const& path, std::string& out_text)
+{
+    std::ifstream file(path, std::ios::binary);
+
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    out_text = buffer.str();
+
+    // Line feeds only, so a CR never lands inside the bundle's template literals; columns are unchanged.
+    std::erase(out_text, '\r');
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+ScriptBundler::ScriptBundler(sScriptBundleConfig const& config)
+    : m_config(config)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+bool ScriptBundler::Build()
+{
+    std::vector<sScannedScript> scripts(m_config.m_sourcePaths.size());
+    sScriptBundleStats          stats;
+
+    for (size_t index = 0; index < scripts.size(); ++index)
+    {
+        scripts[index].m_path = m_config.m_sourcePaths[index];
+
+        if (!ReadTextFile(scripts[index].m_path, scripts[index].m_text))
+        {
+            DAEMON_LOG(LogGame, eLogVerbosity::Error, StringFormat("(ScriptBundler::Build)(cannot read {})", scripts[index].m_path));
+            return false;
+        }
+
+        ScanScript(scripts[index]);
+
+        if (m_config.m_stripDevLogging)
+        {
+            StripDevLogging(scripts[index]);
+        }
+
+        stats.m_sourceBytes += scripts[index].m_text.size();
+        stats.m_strippedLogCount += scripts[index].m_devLogCount;
+    }
+
+    std::vector<size_t> const order = OrderByDependency(scripts, stats.m_hasDependencyCycle);
+
+    if (stats.m_hasDependencyCycle)
+    {
+        DAEMON_LOG(LogGame, eLogVerbosity::Warning, StringFormat("(ScriptBundler::Build)(dependency cycle between scripts; configured order kept for it)"));
+    }
+
+    std::filesystem::path const mapDirectory = std::filesystem::path(m_config.m_sourceMapPath).parent_path();
+
+    std::string        bundle;
+    ScriptMappingLines mappings;
+    std::string        sourcesJson;
+    std::string        contentsJson;
+
+    m_orderedSources.clear();
+
+    for (size_t const index : order)
+    {
+        sScannedScript const& script = scripts[index];
+
+        AppendToBundle(script, static_cast<uint32_t>(m_orderedSources.size()), bundle, mappings, stats);
+        m_orderedSources.push_back(script.m_path);
+
+        sourcesJson += sourcesJson.empty() ? "" : ",";
+        contentsJson += contentsJson.empty() ? "" : ",";
+        AppendJsonString(sourcesJson, std::filesystem::path(script.m_path).lexically_relative(mapDirectory).generic_string());
+        AppendJsonString(contentsJson, script.m_text);
+    }
+
+    stats.m_sourceCount = static_cast<uint32_t>(scripts.size());
+    stats.m_bundleBytes = bundle.size();
+    stats.m_bundleLines = static_cast<uint32_t>(mappings.size());
+
+    std::string sourceMap = "{\"version\":3,\"file\":";
+    AppendJsonString(sourceMap, std::filesystem::path(m_config.m_bundlePath).filename().generic_string());
+    sourceMap += ",\"sourceRoot\":\"\",\"sources\":[" + sourcesJson + "],\"names\":[],\"mappings\":";
+    AppendJsonString(sourceMap, EncodeMappings(mappings));
+    sourceMap += ",\"sourcesContent\":[" + contentsJson + "]}\n";
+
+    std::filesystem::path const bundleDirectory = std::filesystem::path(m_config.m_bundlePath).parent_path();
+    bundle += "//# sourceMappingURL=" + std::filesystem::path(m_config.m_sourceMapPath).lexically_relative(bundleDirectory).generic_string() + "\n";
+
+    // The map first: a bundle newer than its map would count as fresh with stale line numbers.
+    if (!WriteTextFile(m_config.m_sourceMapPath, sourceMap) || !WriteTextFile(m_config.m_bundlePath, bundle))
+    {
+        DAEMON_LOG(LogGame, eLogVerbosity::Error, StringFormat("(ScriptBundler::Build)(cannot write {})", m_config.m_bundlePath));
+        return false;
+    }
+
+    m_mappings = std::move(mappings);
+    m_stats    = stats;
+
+    DAEMON_LOG(LogGame, eLogVerbosity::Log, StringFormat("(ScriptBundler::Build)({} files, {} -> {} bytes, {} dev log statements stripped)",
+                                                         stats.m_sourceCount, stats.m_sourceBytes, stats.m_bundleBytes, stats.m_strippedLogCount));
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool ScriptBundler::BuildIfStale()
+{
+    return IsBundleStale() ? Build() : LoadSourceMap();
+}
+
+//----------------------------------------------------------------------------------------------------
+bool ScriptBundler::LoadSourceMap()
+{
+    std::string json;
+
+    if (!ReadTextFile(m_config.m_sourceMapPath, json))
+    {
+        return false;
+    }
+
+    std::filesystem::path const mapDirectory = std::filesystem::path(m_config.m_sourceMapPath).parent_path();
+    std::vector<std::string>    sources;
+    std::string                 mappings;
+
+    size_t pos = json.find("\"sources\":[");
+
+    if (pos == std::string::npos)
+    {
+        return false;
+    }
+
+    pos += std::strlen("\"sources\":[");
+
+    while (pos < json.size() && json[pos] != ']')
+    {
+        std::string source;
+
+        if (!ReadJsonString(json, pos, source))
+        {
+            return false;
+        }
+
+        sources.push_back((mapDirectory / source).lexically_normal().generic_string());
+        pos += pos < json.size() && json[pos] == ',' ? 1 : 0;
+    }
+
+    pos = json.find("\"mappings\":");
+
+    if (pos == std::string::npos)
+    {
+        return false;
+    }
+
+    pos += std::strlen("\"mappings\":");
+
+    ScriptMappingLines lines;
+
+    if (!ReadJsonString(json, pos, mappings) || !DecodeMappings(mappings, lines))
+    {
+        DAEMON_LOG(LogGame, eLogVerbosity::Error, StringFormat("(ScriptBundler::LoadSourceMap)({} is malformed)", m_config.m_sourceMapPath));
+        return false;
+    }
+
+    m_orderedSources = std::move(sources);
+    m_mappings       = std::move(lines);
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool ScriptBundler::MapLocation(uint32_t const         bundleLine,
+                                uint32_t const         bundleColumn,
+                                sScriptSourceLocation& out_location) const
+{
+    if (bundleLine == 0 || bundleLine > m_mappings.size() || m_mappings[bundleLine - 1].empty())
+    {
+        return false;
+    }
+
+    std::vector<sScriptMappingSegment> const& segments = m_mappings[bundleLine - 1];
+    uint32_t const                            column   = bundleColumn > 0 ? bundleColumn - 1 : 0;
+
+    auto const after = std::ranges::upper_bound(segments, column, {}, &sScriptMappingSegment::m_bundleColumn);
+    sScriptMappingSegment const& segment = after == segments.begin() ? segments.front() : *(after - 1);
+
+    if (segment.m_sourceIndex >= m_orderedSources.size())
+    {
+        return false;
+    }
+
+    out_location.m_sourcePath = m_orderedSources[segment.m_sourceIndex];
+    out_location.m_line       = segment.m_sourceLine + 1;
+    out_location.m_column     = segment.m_sourceColumn + (column >= segment.m_bundleColumn ? column - segment.m_bundleColumn : 0) + 1;
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Rewrites every "<path>/Framework.bundle.js:line[:column]" in a V8 message or stack trace.
+//
+std::string ScriptBundler::MapErrorMessage(std::string const& message) const
+{
+    std::string const fileName = std::filesystem::path(m_config.m_bundlePath).filename().generic_string();
+    std::string       result;
+    size_t            copied = 0;
+    size_t            found  = message.find(fileName);
+
+    while (found != std::string::npos)
+    {
+        size_t   end    = found + fileName.size();
+        uint32_t line   = 0;
+        uint32_t column = 0;
+
+        auto const readNumber = [&](uint32_t& out_number)
+        {
+            size_t digitEnd = end + 1;
+
+            while (digitEnd < message.size() && std::isdigit(static_cast<unsigned char>(message[digitEnd])))
+            {
+                out_number = out_number * 10 + static_cast<uint32_t>(message[digitEnd++] - '0');
+            }
+
+            bool const hasNumber = end < message.size() && message[end] == ':' && digitEnd > end + 1;
+            end                  = hasNumber ? digitEnd : end;
+            return hasNumber;
+        };
+
+        sScriptSourceLocation location;
+        bool const            hasLine = readNumber(line);
+
+        if (hasLine)
+        {
+            readNumber(column);     // Optional; column 0 maps to the start of the line's first segment
+        }
+
+        if (hasLine && MapLocation(line, column, location))
+        {
+            // Back over the directory in front of the file name, up to the delimiter V8 put before it.
+            size_t begin = found;
+
+            while (begin > copied && !std::isspace(static_cast<unsigned char>(message[begin - 1])) && message[begin - 1] != '(' &&
+                   message[begin - 1] != '"' && message[begin - 1] != '\'')
+            {
+                --begin;
+            }
+
+            result += message.substr(copied, begin - copied);
+            result += StringFormat("{}:{}:{}", location.m_sourcePath, location.m_line, location.m_column);
+            copied = end;
+        }
+
+        found = message.find(fileName, end);
+    }
+
+    result += message.substr(copied);
+    return result;
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC std::string ScriptBundler::EncodeMappings(ScriptMappingLines const& lines)
+{
+    std::string           mappings;
+    sScriptMappingSegment previous;
+
+    for (size_t lineIndex = 0; lineIndex < lines.size(); ++lineIndex)
+    {
+        mappings += lineIndex > 0 ? ";" : "";
+        previous.m_bundleColumn = 0;
+
+        for (size_t segmentIndex = 0; segmentIndex < lines[lineIndex].size(); ++segmentIndex)
+        {
+            sScriptMappingSegment const& segment = lines[lineIndex][segmentIndex];
+
+            mappings += segmentIndex > 0 ? "," : "";
+            AppendVlq(mappings, static_cast<int32_t>(segment.m_bundleColumn - previous.m_bundleColumn));
+            AppendVlq(mappings, static_cast<int32_t>(segment.m_sourceIndex - previous.m_sourceIndex));
+            AppendVlq(mappings, static_cast<int32_t>(segment.m_sourceLine - previous.m_sourceLine));
+            AppendVlq(mappings, static_cast<int32_t>(segment.m_sourceColumn - previous.m_sourceColumn));
+            previous = segment;
+        }
+    }
+
+    return mappings;
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC bool ScriptBundler::DecodeMappings(std::string const& mappings,
+                                          ScriptMappingLines& out_lines)
+{
+    out_lines.assign(1, {});
+
+    sScriptMappingSegment previous;
+    size_t                pos = 0;
+
+    while (pos < mappings.size())
+    {
+        if (mappings[pos] == ';')
+        {
+            out_lines.emplace_back();
+            previous.m_bundleColumn = 0;
+            ++pos;
+            continue;
+        }
+
+        if (mappings[pos] == ',')
+        {
+            ++pos;
+            continue;
+        }
+
+        int32_t fields[4] = {};
+
+        for (int32_t& field : fields)
+        {
+            if (!ReadVlq(mappings, pos, field))
+            {
+                return false;
+            }
+        }
+
+        sScriptMappingSegment segment;
+        segment.m_bundleColumn = previous.m_bundleColumn + static_cast<uint32_t>(fields[0]);
+        segment.m_sourceIndex  = previous.m_sourceIndex + static_cast<uint32_t>(fields[1]);
+        segment.m_sourceLine   = previous.m_sourceLine + static_cast<uint32_t>(fields[2]);
+        segment.m_sourceColumn = previous.m_sourceColumn + static_cast<uint32_t>(fields[3]);
+
+        out_lines.back().push_back(segment);
+        previous = segment;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC uint32_t ScriptBundler::CountDevLogStatements(std::string const& text)
+{
+    sScannedScript script;
+    script.m_text = text;
+    ScanScript(script);
+
+    uint32_t count = 0;
+
+    for (size_t index = 0; index < script.m_tokens.size(); ++index)
+    {
+        count += MatchDevLogCall(script.m_text, script.m_tokens, index) != 0 ? 1 : 0;
+    }
+
+    return count;
+}
+
+//----------------------------------------------------------------------------------------------------
+// A shipped build may carry only the bundle, so missing sources leave it fresh.
+//
+bool ScriptBundler::IsBundleStale() const
+{
+    std::error_code                      errorCode;
+    std::filesystem::file_time_type const bundleTime = std::filesystem::last_write_time(m_config.m_bundlePath, errorCode);
+
+    if (errorCode || !std::filesystem::exists(m_config.m_sourceMapPath, errorCode))
+    {
+        return true;
+    }
+
+    for (std::string const& sourcePath : m_config.m_sourcePaths)
+    {
+        std::filesystem::file_time_type const sourceTime = std::filesystem::last_write_time(sourcePath, errorCode);
+
+        if (!errorCode && sourceTime > bundleTime)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
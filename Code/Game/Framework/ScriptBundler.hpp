@@ -0,0 +1,101 @@
+//----------------------------------------------------------------------------------------------------
+// ScriptBundler.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+struct sScriptBundleConfig
+{
+    std::vector<std::string> m_sourcePaths = {      // Preferred order; a file moves earlier when another one needs it
+        "Data/Scripts/JSEngine.js",
+        "Data/Scripts/InputSystem.js",
+        "Data/Scripts/JSGame.js"};
+    std::string m_bundlePath      = "Data/Scripts/Bundle/Framework.bundle.js";
+    std::string m_sourceMapPath   = "Data/Scripts/Bundle/Framework.bundle.js.map";
+    bool        m_stripDevLogging = true;           // Whole console.log / console.debug statements
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sScriptBundleStats
+{
+    uint32_t m_sourceCount          = 0;
+    uint64_t m_sourceBytes          = 0;
+    uint32_t m_sourceLines          = 0;
+    uint64_t m_bundleBytes          = 0;         // Without the sourceMappingURL comment
+    uint32_t m_bundleLines          = 0;
+    uint64_t m_strippedCommentBytes = 0;
+    uint32_t m_strippedLogCount     = 0;
+    bool     m_hasDependencyCycle   = false;     // Configured order kept for the files in the cycle
+};
+
+//----------------------------------------------------------------------------------------------------
+// One run of bundle text copied verbatim from a source; a bundle line starts a new run after every
+// stripped comment or statement.
+//----------------------------------------------------------------------------------------------------
+struct sScriptMappingSegment
+{
+    uint32_t m_bundleColumn = 0;
+    uint32_t m_sourceIndex  = 0;
+    uint32_t m_sourceLine   = 0;     // Zero-based, as in the source map
+    uint32_t m_sourceColumn = 0;
+
+    bool operator==(sScriptMappingSegment const&) const = default;
+};
+
+using ScriptMappingLines = std::vector<std::vector<sScriptMappingSegment>>;
+
+//----------------------------------------------------------------------------------------------------
+struct sScriptSourceLocation
+{
+    std::string m_sourcePath;
+    uint32_t    m_line   = 0;     // One-based
+    uint32_t    m_column = 0;     // One-based
+};
+
+//----------------------------------------------------------------------------------------------------
+// Concatenates the framework scripts into one bundle so production startup compiles a single script,
+// and writes a version 3 source map next to it.
+//
+// Files are ordered by the top-level classes, functions and bindings they declare and reference, falling
+// back to the configured order. Comments (and with them commented-out code) and blank lines are dropped;
+// with m_stripDevLogging, console.log / console.debug statements that start a statement are dropped too.
+// Everything else is copied verbatim and every line keeps its line break, so semicolon insertion and
+// template literals are unaffected.
+//
+// The map carries the original text (sourcesContent), so DevTools shows the real files through the
+// inspector, and MapErrorMessage() rewrites bundle line numbers in V8 errors back to file:line:column.
+//----------------------------------------------------------------------------------------------------
+class ScriptBundler
+{
+public:
+    explicit ScriptBundler(sScriptBundleConfig const& config);
+
+    bool Build();             // Reads the sources, writes the bundle and the source map
+    bool BuildIfStale();      // Build() when a source is newer than the bundle, else LoadSourceMap()
+    bool LoadSourceMap();
+
+    bool        MapLocation(uint32_t bundleLine, uint32_t bundleColumn, sScriptSourceLocation& out_location) const;
+    std::string MapErrorMessage(std::string const& message) const;
+
+    std::string const&              GetBundlePath() const { return m_config.m_bundlePath; }
+    std::vector<std::string> const& GetOrderedSources() const { return m_orderedSources; }
+    ScriptMappingLines const&       GetMappings() const { return m_mappings; }
+    sScriptBundleStats const&       GetStats() const { return m_stats; }
+
+    static std::string EncodeMappings(ScriptMappingLines const& lines);
+    static bool        DecodeMappings(std::string const& mappings, ScriptMappingLines& out_lines);
+    static uint32_t    CountDevLogStatements(std::string const& text);
+
+private:
+    bool IsBundleStale() const;
+
+    sScriptBundleConfig      m_config;
+    std::vector<std::string> m_orderedSources;
+    ScriptMappingLines       m_mappings;
+    sScriptBundleStats       m_stats;
+};
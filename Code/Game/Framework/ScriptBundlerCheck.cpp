@@ -0,0 +1,142 @@
+//----------------------------------------------------------------------------------------------------
+// ScriptBundlerCheck.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/HeadlessRunner.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+#include "Engine/Core/StringUtils.hpp"
+#include "Game/Framework/ScriptBundler.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// Line feeds only, as ScriptBundler reads its sources.
+//
+static std::vector<std::string> ReadScriptLines(std::string const& path, std::string& out_text)
+{
+    std::ifstream     file(path, std::ios::binary);
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+
+    out_text = buffer.str();
+    std::erase(out_text, '\r');
+
+    std::vector<std::string> lines;
+    size_t                   lineBegin = 0;
+
+    while (lineBegin <= out_text.size())
+    {
+        size_t const lineEnd = std::min(out_text.find('\n', lineBegin), out_text.size());
+        lines.push_back(out_text.substr(lineBegin, lineEnd - lineBegin));
+        lineBegin = lineEnd + 1;
+    }
+
+    return lines;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool RunScriptBundleCheck(sHeadlessRunConfig const& config)
+{
+    sScriptBundleConfig const bundleConfig;
+    ScriptBundler             bundler(bundleConfig);
+    uint32_t const            buildCount   = config.m_bundleBuildCount;
+    uint32_t                  failedBuilds = 0;
+
+    auto const buildStart = std::chrono::steady_clock::now();
+
+    for (uint32_t build = 0; build < buildCount; ++build)
+    {
+        failedBuilds += bundler.Build() ? 0 : 1;
+    }
+
+    double const buildMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - buildStart).count() / buildCount;
+
+    ScriptMappingLines const& mappings = bundler.GetMappings();
+    sScriptBundleStats const& stats    = bundler.GetStats();
+
+    // The map on disk must describe the bundle just built, and survive its own VLQ encoding.
+    ScriptBundler reloaded(bundleConfig);
+    bool const    isMapReloaded = reloaded.LoadSourceMap() && reloaded.GetMappings() == mappings && reloaded.GetOrderedSources() == bundler.GetOrderedSources();
+
+    ScriptMappingLines decoded;
+    bool const         isRoundTrip = ScriptBundler::DecodeMappings(ScriptBundler::EncodeMappings(mappings), decoded) && decoded == mappings;
+
+    std::string                           bundleText;
+    std::vector<std::string> const        bundleLines = ReadScriptLines(bundleConfig.m_bundlePath, bundleText);
+    std::vector<std::vector<std::string>> sourceLines;
+    uint32_t                              sourceLogCount = 0;
+    std::string                           order;
+
+    for (std::string const& sourcePath : bundler.GetOrderedSources())
+    {
+        std::string sourceText;
+        sourceLines.push_back(ReadScriptLines(sourcePath, sourceText));
+        sourceLogCount += ScriptBundler::CountDevLogStatements(sourceText);
+        order += (order.empty() ? "" : ", ") + std::filesystem::path(sourcePath).filename().generic_string();
+    }
+
+    // Every segment must be the source text at the position it maps to (less the space that separates
+    // it from the next one), and an error at its start must read back as that position.
+    uint32_t segmentCount     = 0;
+    uint32_t segmentMismatch  = 0;
+    uint32_t errorMapFailures = 0;
+
+    for (size_t lineIndex = 0; lineIndex < mappings.size() && lineIndex < bundleLines.size(); ++lineIndex)
+    {
+        std::vector<sScriptMappingSegment> const& segments = mappings[lineIndex];
+
+        for (size_t segmentIndex = 0; segmentIndex < segments.size(); ++segmentIndex)
+        {
+            sScriptMappingSegment const& segment = segments[segmentIndex];
+            size_t const                 end     = segmentIndex + 1 < segments.size() ? segments[segmentIndex + 1].m_bundleColumn : bundleLines[lineIndex].size();
+            std::string                  piece   = bundleLines[lineIndex].substr(segment.m_bundleColumn, end - segment.m_bundleColumn);
+
+            bool const isLastOfSource = segmentIndex + 1 == segments.size() &&
+                                        (lineIndex + 1 == mappings.size() || mappings[lineIndex + 1].front().m_sourceIndex != segment.m_sourceIndex);
+
+            if (!piece.empty() && ((segmentIndex + 1 < segments.size() && piece.back() == ' ') || (isLastOfSource && piece.back() == ';')))
+            {
+                piece.pop_back();     // Separator before the next segment, or the terminator added at a file boundary
+            }
+
+            bool const isMatch = segment.m_sourceIndex < sourceLines.size() && segment.m_sourceLine < sourceLines[segment.m_sourceIndex].size() &&
+                                 sourceLines[segment.m_sourceIndex][segment.m_sourceLine].compare(segment.m_sourceColumn, piece.size(), piece) == 0;
+
+            std::string const message  = StringFormat("at f ({}:{}:{})", bundleConfig.m_bundlePath, lineIndex + 1, segment.m_bundleColumn + 1);
+            std::string const expected = segment.m_sourceIndex < sourceLines.size()
+                                             ? StringFormat("at f ({}:{}:{})", bundler.GetOrderedSources()[segment.m_sourceIndex], segment.m_sourceLine + 1, segment.m_sourceColumn + 1)
+                                             : std::string();
+
+            ++segmentCount;
+            segmentMismatch += isMatch ? 0 : 1;
+            errorMapFailures += bundler.MapErrorMessage(message) == expected ? 0 : 1;
+        }
+    }
+
+    uint32_t const bundleLogCount    = ScriptBundler::CountDevLogStatements(bundleText);
+    bool const     isLoggingStripped = !bundleConfig.m_stripDevLogging || bundleLogCount + stats.m_strippedLogCount == sourceLogCount;
+    bool const     isValid           = failedBuilds == 0 && isMapReloaded && isRoundTrip && segmentMismatch == 0 && errorMapFailures == 0 &&
+                                       isLoggingStripped && !stats.m_hasDependencyCycle && bundleLines.size() > mappings.size();
+
+    String report = Stringf("Script bundle: %u sources -> %s\n", stats.m_sourceCount, bundleConfig.m_bundlePath.c_str());
+    report += Stringf("order            %s%s\n", order.c_str(), stats.m_hasDependencyCycle ? " (dependency cycle)" : "");
+    report += Stringf("source           %llu bytes, %u lines\n", stats.m_sourceBytes, stats.m_sourceLines);
+    report += Stringf("bundle           %llu bytes, %u lines (%.1f%% of the source bytes)\n", stats.m_bundleBytes, stats.m_bundleLines,
+                      stats.m_sourceBytes > 0 ? 100.0 * static_cast<double>(stats.m_bundleBytes) / static_cast<double>(stats.m_sourceBytes) : 0.0);
+    report += Stringf("stripped         %llu comment bytes, %u of %u dev log statements\n", stats.m_strippedCommentBytes, stats.m_strippedLogCount, sourceLogCount);
+    report += Stringf("build ms         %.3f (average of %u)\n", buildMilliseconds, buildCount);
+    report += Stringf("mappings         %u segments, %u text mismatches, round-trip %s, reloaded map %s\n", segmentCount, segmentMismatch,
+                      isRoundTrip ? "OK" : "FAILED", isMapReloaded ? "OK" : "FAILED");
+    report += Stringf("error mapping    %u failures\n", errorMapFailures);
+    report += Stringf("validation       %s\n", isValid ? "OK" : "FAILED");
+
+    WriteHeadlessReport(config.m_bundleReportPath, report);
+
+    return isValid;
+}
@@ -36,6 +36,7 @@ public:
     // Reload operations
     bool ReloadScript(const std::string& scriptPath);
     bool ReloadScripts(const std::vector<std::string>& scriptPaths);
+    bool ReadScriptFile(const std::string& scriptPath, std::string& content);     // Whole file; false and GetLastError() on failure
     void SetReloadCompleteCallback(ReloadCompleteCallback callback);
     
     // State management
@@ -56,7 +57,6 @@ private:
     // Internal reload logic
     bool PerformReload(const std::vector<std::string>& scriptPaths);
     bool ExecuteScript(const std::string& scriptPath);
-    bool ReadScriptFile(const std::string& scriptPath, std::string& content);
     
     // Special reload strategies for different script types
     bool ReloadInputSystemScript(const std::string& scriptContent);
@@ -0,0 +1,753 @@
+//----------------------------------------------------------------------------------------------------
+// SoftwareRenderer.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/SoftwareRenderer.hpp"
+
+#include <emmintrin.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Math/Vec4.hpp"
+#include "Engine/Renderer/Camera.hpp"
+#include "Game/Framework/QuantizedVertex.hpp"
+#include "Game/Framework/WorkerPool.hpp"
+
+//----------------------------------------------------------------------------------------------------
+static double GetMillisecondsSince(std::chrono::steady_clock::time_point const startTime)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+//----------------------------------------------------------------------------------------------------
+SoftwareRenderer::SoftwareRenderer(sSoftwareRendererConfig const& config)
+    : m_config(config)
+{
+    m_config.m_dimensions.x = std::max(m_config.m_dimensions.x, 1);
+    m_config.m_dimensions.y = std::max(m_config.m_dimensions.y, 1);
+
+    m_stride = (m_config.m_dimensions.x + 3) & ~3;
+    m_colorBuffer.resize(static_cast<size_t>(m_stride) * m_config.m_dimensions.y, Rgba8::BLACK);
+    m_depthBuffer.resize(static_cast<size_t>(m_stride) * m_config.m_dimensions.y, 1.f);
+
+    m_tileCountX = (m_config.m_dimensions.x + TILE_SIZE - 1) / TILE_SIZE;
+    m_tileCountY = (m_config.m_dimensions.y + TILE_SIZE - 1) / TILE_SIZE;
+    m_tileBins.resize(static_cast<size_t>(m_tileCountX) * m_tileCountY);
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRenderer::BeginFrame()
+{
+    m_stats = sSoftwareRenderStats();
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRenderer::EndFrame()
+{
+    Flush();
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRenderer::ClearScreen(Rgba8 const& clearColor)
+{
+    Flush();
+
+    std::fill(m_colorBuffer.begin(), m_colorBuffer.end(), clearColor);
+    std::fill(m_depthBuffer.begin(), m_depthBuffer.end(), 1.f);
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRenderer::BeginCamera(Camera const& camera)
+{
+    m_worldToClip = camera.GetRenderToClipTransform();
+    m_worldToClip.Append(camera.GetCameraToRenderTransform());
+    m_worldToClip.Append(camera.GetWorldToCameraTransform());
+
+    SetModelConstants();
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRenderer::EndCamera(Camera const& camera)
+{
+    UNUSED(camera)
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRenderer::SetModelConstants(Mat44 const& modelToWorld,
+                                         Rgba8 const& modelTint)
+{
+    m_modelToWorld = modelToWorld;
+    m_modelTint    = modelTint;
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRenderer::SetBlendMode(eBlendMode const blendMode)
+{
+    m_state.m_blendMode = blendMode;
+    m_isStateDirty      = true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRenderer::SetRasterizerMode(eRasterizerMode const rasterizerMode)
+{
+    // Wireframe is drawn solid; only the cull mode is honoured.
+    m_isBackfaceCulled = rasterizerMode == eRasterizerMode::SOLID_CULL_BACK || rasterizerMode == eRasterizerMode::WIREFRAME_CULL_BACK;
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRenderer::SetSamplerMode(eSamplerMode const samplerMode)
+{
+    m_state.m_samplerMode = samplerMode;
+    m_isStateDirty        = true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRenderer::SetDepthMode(eDepthMode const depthMode)
+{
+    m_state.m_isDepthRead  = depthMode == eDepthMode::READ_ONLY_LESS_EQUAL || depthMode == eDepthMode::READ_WRITE_LESS_EQUAL;
+    m_state.m_isDepthWrite = depthMode == eDepthMode::READ_WRITE_LESS_EQUAL;
+    m_isStateDirty         = true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRenderer::BindTexture(sSoftwareTexture const* texture)
+{
+    m_state.m_texture = texture;
+    m_isStateDirty    = true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRenderer::SetColorWriteEnabled(bool const isEnabled)
+{
+    m_state.m_isColorWrite = isEnabled;
+    m_isStateDirty         = true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRenderer::DrawVertexArray(VertexList_PCU const& vertexes)
+{
+    DrawVertexArray(static_cast<int>(vertexes.size()), vertexes.data());
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRenderer::DrawVertexArray(int const         vertexCount,
+                                       Vertex_PCU const* vertexes)
+{
+    Mat44 modelToClip = m_worldToClip;
+    modelToClip.Append(m_modelToWorld);
+
+    DrawTriangles(vertexCount, modelToClip, [vertexes](int const index) { return vertexes[index]; });
+}
+
+//----------------------------------------------------------------------------------------------------
+// Positions are decoded to [0,1]^3 only; the mesh's decode transform is folded into modelToClip,
+// the same way the GPU path folds it into the model constants.
+//
+void SoftwareRenderer::DrawQuantizedMesh(sQuantizedMesh const& mesh)
+{
+    Mat44 modelToClip = m_worldToClip;
+    modelToClip.Append(m_modelToWorld);
+    modelToClip.Append(mesh.GetDecodeTransform());
+
+    Vertex_PCUQ const* vertexes = mesh.m_vertexes.data();
+
+    DrawTriangles(static_cast<int>(mesh.m_vertexes.size()), modelToClip, [vertexes](int const index) { return DecodeVertexUnitSpace(vertexes[index]); });
+}
+
+//----------------------------------------------------------------------------------------------------
+template <typename FetchVertex>
+void SoftwareRenderer::DrawTriangles(int const          vertexCount,
+                                     Mat44 const&       modelToClip,
+                                     FetchVertex const& fetchVertex)
+{
+    auto const vertexStartTime = std::chrono::steady_clock::now();
+
+    uint32_t const firstTriangle = static_cast<uint32_t>(m_triangles.size());
+
+    float const tint[4] = {m_modelTint.r / 255.f, m_modelTint.g / 255.f, m_modelTint.b / 255.f, m_modelTint.a / 255.f};
+
+    for (int first = 0; first + 2 < vertexCount; first += 3)
+    {
+        ++m_stats.m_submittedTriangleCount;
+
+        sClipVertex corners[3];
+
+        for (int i = 0; i < 3; ++i)
+        {
+            Vertex_PCU const  vertex   = fetchVertex(first + i);
+            Vec4 const        clip     = modelToClip.TransformHomogeneous3D(Vec4(vertex.m_position.x, vertex.m_position.y, vertex.m_position.z, 1.f));
+            sClipVertex&      corner   = corners[i];
+            corner.m_position[0]       = clip.x;
+            corner.m_position[1]       = clip.y;
+            corner.m_position[2]       = clip.z;
+            corner.m_position[3]       = clip.w;
+            corner.m_attributes[0]     = vertex.m_color.r * tint[0];
+            corner.m_attributes[1]     = vertex.m_color.g * tint[1];
+            corner.m_attributes[2]     = vertex.m_color.b * tint[2];
+            corner.m_attributes[3]     = vertex.m_color.a * tint[3];
+            corner.m_attributes[4]     = vertex.m_uvTexCoords.x;
+            corner.m_attributes[5]     = vertex.m_uvTexCoords.y;
+        }
+
+        // Clip against the near plane (D3D clip space: z >= 0); the other planes are handled by the
+        // screen-space bounding box and the far-depth test.
+        sClipVertex polygon[4];
+        int         polygonCount = 0;
+
+        for (int i = 0; i < 3; ++i)
+        {
+            sClipVertex const& current     = corners[i];
+            sClipVertex const& next        = corners[(i + 1) % 3];
+            bool const         isCurrentIn = current.m_position[2] >= 0.f;
+            bool const         isNextIn    = next.m_position[2] >= 0.f;
+
+            if (isCurrentIn)
+            {
+                polygon[polygonCount++] = current;
+            }
+
+            if (isCurrentIn != isNextIn)
+            {
+                float const t = current.m_position[2] / (current.m_position[2] - next.m_position[2]);
+
+                sClipVertex& clipped = polygon[polygonCount++];
+
+                for (int k = 0; k < 4; ++k)
+                {
+                    clipped.m_position[k] = current.m_position[k] + t * (next.m_position[k] - current.m_position[k]);
+                }
+
+                for (int k = 0; k < 6; ++k)
+                {
+                    clipped.m_attributes[k] = current.m_attributes[k] + t * (next.m_attributes[k] - current.m_attributes[k]);
+                }
+            }
+        }
+
+        for (int i = 1; i + 1 < polygonCount; ++i)
+        {
+            SetupTriangle(polygon[0], polygon[i], polygon[i + 1]);
+        }
+    }
+
+    m_stats.m_vertexMilliseconds += GetMillisecondsSince(vertexStartTime);
+
+    auto const binStartTime = std::chrono::steady_clock::now();
+
+    for (uint32_t triangleIndex = firstTriangle; triangleIndex < static_cast<uint32_t>(m_triangles.size()); ++triangleIndex)
+    {
+        sTriangle const& triangle = m_triangles[triangleIndex];
+
+        int const firstTileX = triangle.m_minX / TILE_SIZE;
+        int const firstTileY = triangle.m_minY / TILE_SIZE;
+        int const lastTileX  = (triangle.m_maxX - 1) / TILE_SIZE;
+        int const lastTileY  = (triangle.m_maxY - 1) / TILE_SIZE;
+
+        for (int tileY = firstTileY; tileY <= lastTileY; ++tileY)
+        {
+            for (int tileX = firstTileX; tileX <= lastTileX; ++tileX)
+            {
+                m_tileBins[tileY * m_tileCountX + tileX].push_back(triangleIndex);
+                ++m_stats.m_binEntryCount;
+            }
+        }
+    }
+
+    m_stats.m_binMilliseconds += GetMillisecondsSince(binStartTime);
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRenderer::SetupTriangle(sClipVertex const& v0,
+                                     sClipVertex const& v1,
+                                     sClipVertex const& v2)
+{
+    sClipVertex const* vertexes[3] = {&v0, &v1, &v2};
+
+    float screenX[3];
+    float screenY[3];
+    float depth[3];
+    float inverseW[3];
+
+    for (int i = 0; i < 3; ++i)
+    {
+        float const* position = vertexes[i]->m_position;
+
+        if (position[3] <= 0.f)
+        {
+            return;
+        }
+
+        inverseW[i] = 1.f / position[3];
+        screenX[i]  = (position[0] * inverseW[i] * 0.5f + 0.5f) * static_cast<float>(m_config.m_dimensions.x);
+        screenY[i]  = (0.5f - position[1] * inverseW[i] * 0.5f) * static_cast<float>(m_config.m_dimensions.y);      // Rows go down
+        depth[i]    = position[2] * inverseW[i];
+    }
+
+    // Counter-clockwise (front-facing) triangles have negative area once y points down.
+    float const area = (screenX[1] - screenX[0]) * (screenY[2] - screenY[0]) - (screenX[2] - screenX[0]) * (screenY[1] - screenY[0]);
+
+    if (area == 0.f || (m_isBackfaceCulled && area > 0.f))
+    {
+        return;
+    }
+
+    int order[3] = {0, 1, 2};
+
+    if (area < 0.f)
+    {
+        std::swap(order[1], order[2]);
+    }
+
+    float const minX = std::min({screenX[0], screenX[1], screenX[2]});
+    float const maxX = std::max({screenX[0], screenX[1], screenX[2]});
+    float const minY = std::min({screenY[0], screenY[1], screenY[2]});
+    float const maxY = std::max({screenY[0], screenY[1], screenY[2]});
+
+    sTriangle triangle;
+    triangle.m_minX = std::max(static_cast<int>(std::floor(minX)), 0);
+    triangle.m_minY = std::max(static_cast<int>(std::floor(minY)), 0);
+    triangle.m_maxX = std::min(static_cast<int>(std::ceil(maxX)) + 1, m_config.m_dimensions.x);
+    triangle.m_maxY = std::min(static_cast<int>(std::ceil(maxY)) + 1, m_config.m_dimensions.y);
+
+    if (triangle.m_minX >= triangle.m_maxX || triangle.m_minY >= triangle.m_maxY)
+    {
+        return;
+    }
+
+    triangle.m_inverseArea = 1.f / std::fabs(area);
+    triangle.m_stateIndex  = GetCurrentStateIndex();
+
+    for (int i = 0; i < 3; ++i)
+    {
+        int const vertex = order[i];
+
+        triangle.m_depth[i]    = depth[vertex];
+        triangle.m_inverseW[i] = inverseW[vertex];
+
+        for (int k = 0; k < 6; ++k)
+        {
+            triangle.m_attributes[i][k] = vertexes[vertex]->m_attributes[k] * inverseW[vertex];
+        }
+    }
+
+    // Edge i is opposite vertex i, so its value at a pixel divided by the area is that vertex's weight.
+    for (int i = 0; i < 3; ++i)
+    {
+        int const from = order[(i + 1) % 3];
+        int const to   = order[(i + 2) % 3];
+
+        float const a = screenY[from] - screenY[to];
+        float const b = screenX[to] - screenX[from];
+
+        triangle.m_edgeA[i]           = a;
+        triangle.m_edgeB[i]           = b;
+        triangle.m_edgeC[i]           = -(a * screenX[from] + b * screenY[from]);
+        triangle.m_isEdgeInclusive[i] = a > 0.f || (a == 0.f && b < 0.f);
+    }
+
+    m_triangles.push_back(triangle);
+    ++m_stats.m_rasterizedTriangleCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+uint32_t SoftwareRenderer::GetCurrentStateIndex()
+{
+    if (m_isStateDirty || m_drawStates.empty())
+    {
+        m_drawStates.push_back(m_state);
+        m_isStateDirty = false;
+    }
+
+    return static_cast<uint32_t>(m_drawStates.size() - 1);
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRenderer::Flush()
+{
+    if (m_triangles.empty())
+    {
+        return;
+    }
+
+    auto const rasterStartTime = std::chrono::steady_clock::now();
+
+    uint32_t const tileCount = static_cast<uint32_t>(m_tileBins.size());
+
+    if (m_config.m_workerPool != nullptr)
+    {
+        m_config.m_workerPool->ParallelFor(tileCount, [this](uint32_t const tileIndex, uint32_t) { RasterizeTile(tileIndex); });
+    }
+    else
+    {
+        for (uint32_t tileIndex = 0; tileIndex < tileCount; ++tileIndex)
+        {
+            RasterizeTile(tileIndex);
+        }
+    }
+
+    m_stats.m_rasterMilliseconds += GetMillisecondsSince(rasterStartTime);
+
+    for (std::vector<uint32_t>& bin : m_tileBins)
+    {
+        bin.clear();
+    }
+
+    m_triangles.clear();
+    m_drawStates.clear();
+    m_isStateDirty = true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRenderer::RasterizeTile(uint32_t const tileIndex)
+{
+    std::vector<uint32_t> const& bin = m_tileBins[tileIndex];
+
+    if (bin.empty())
+    {
+        return;
+    }
+
+    int const tileMinX = static_cast<int>(tileIndex % m_tileCountX) * TILE_SIZE;
+    int const tileMinY = static_cast<int>(tileIndex / m_tileCountX) * TILE_SIZE;
+    int const tileMaxX = std::min(tileMinX + TILE_SIZE, m_config.m_dimensions.x);
+    int const tileMaxY = std::min(tileMinY + TILE_SIZE, m_config.m_dimensions.y);
+
+    __m128 const laneOffsets = _mm_set_ps(3.5f, 2.5f, 1.5f, 0.5f);
+    __m128 const zero        = _mm_setzero_ps();
+    __m128 const one         = _mm_set1_ps(1.f);
+
+    alignas(16) float weights[3][4];
+
+    for (uint32_t const triangleIndex : bin)
+    {
+        sTriangle const&  triangle = m_triangles[triangleIndex];
+        sDrawState const& state    = m_drawStates[triangle.m_stateIndex];
+
+        // Spans start on a multiple of 4; the row stride is padded, so the last span never leaves the row.
+        int const minX = std::max(triangle.m_minX, tileMinX) & ~3;
+        int const maxX = std::min(triangle.m_maxX, tileMaxX);
+        int const minY = std::max(triangle.m_minY, tileMinY);
+        int const maxY = std::min(triangle.m_maxY, tileMaxY);
+
+        __m128 edgeA[3];
+        __m128 inclusiveMask[3];
+
+        for (int i = 0; i < 3; ++i)
+        {
+            edgeA[i]         = _mm_set1_ps(triangle.m_edgeA[i]);
+            inclusiveMask[i] = _mm_castsi128_ps(_mm_set1_epi32(triangle.m_isEdgeInclusive[i] ? -1 : 0));
+        }
+
+        __m128 const inverseArea = _mm_set1_ps(triangle.m_inverseArea);
+        __m128 const depth0      = _mm_set1_ps(triangle.m_depth[0]);
+        __m128 const depth1      = _mm_set1_ps(triangle.m_depth[1]);
+        __m128 const depth2      = _mm_set1_ps(triangle.m_depth[2]);
+
+        for (int y = minY; y < maxY; ++y)
+        {
+            float const pixelY = static_cast<float>(y) + 0.5f;
+            float*      depthRow = &m_depthBuffer[static_cast<size_t>(y) * m_stride];
+
+            for (int x = minX; x < maxX; x += 4)
+            {
+                __m128 const pixelX = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), laneOffsets);
+                __m128       edges[3];
+                __m128       coverage = _mm_castsi128_ps(_mm_set1_epi32(-1));
+
+                for (int i = 0; i < 3; ++i)
+                {
+                    edges[i] = _mm_add_ps(_mm_mul_ps(edgeA[i], pixelX), _mm_set1_ps(triangle.m_edgeB[i] * pixelY + triangle.m_edgeC[i]));
+
+                    __m128 const isInside = _mm_or_ps(_mm_cmpgt_ps(edges[i], zero), _mm_and_ps(_mm_cmpeq_ps(edges[i], zero), inclusiveMask[i]));
+                    coverage              = _mm_and_ps(coverage, isInside);
+                }
+
+                if (_mm_movemask_ps(coverage) == 0)
+                {
+                    continue;
+                }
+
+                __m128 const weight0    = _mm_mul_ps(edges[0], inverseArea);
+                __m128 const weight1    = _mm_mul_ps(edges[1], inverseArea);
+                __m128 const weight2    = _mm_mul_ps(edges[2], inverseArea);
+                __m128 const pixelDepth = _mm_add_ps(_mm_add_ps(_mm_mul_ps(weight0, depth0), _mm_mul_ps(weight1, depth1)), _mm_mul_ps(weight2, depth2));
+
+                coverage = _mm_and_ps(coverage, _mm_cmple_ps(pixelDepth, one));
+
+                __m128 const storedDepth = _mm_loadu_ps(depthRow + x);
+
+                if (state.m_isDepthRead)
+                {
+                    coverage = _mm_and_ps(coverage, _mm_cmple_ps(pixelDepth, storedDepth));
+                }
+
+                int const laneMask = _mm_movemask_ps(coverage);
+
+                if (laneMask == 0)
+                {
+                    continue;
+                }
+
+                if (state.m_isDepthWrite)
+                {
+                    _mm_storeu_ps(depthRow + x, _mm_or_ps(_mm_and_ps(coverage, pixelDepth), _mm_andnot_ps(coverage, storedDepth)));
+                }
+
+                if (!state.m_isColorWrite)
+                {
+                    continue;
+                }
+
+                _mm_store_ps(weights[0], weight0);
+                _mm_store_ps(weights[1], weight1);
+                _mm_store_ps(weights[2], weight2);
+
+                for (int lane = 0; lane < 4; ++lane)
+                {
+                    if ((laneMask & (1 << lane)) != 0)
+                    {
+                        float const laneWeights[3] = {weights[0][lane], weights[1][lane], weights[2][lane]};
+                        ShadePixel(triangle, state, laneWeights, y * m_stride + x + lane);
+                    }
+                }
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+static void SampleTexture(sSoftwareTexture const& texture,
+                          eSamplerMode const      samplerMode,
+                          float const             u,
+                          float const             v,
+                          float                   out_texel[4])
+{
+    int const width  = texture.m_dimensions.x;
+    int const height = texture.m_dimensions.y;
+
+    bool const isWrapped = samplerMode == eSamplerMode::BILINEAR_WRAP;
+
+    auto const fetch = [&](int x, int y, float weight)
+    {
+        if (isWrapped)
+        {
+            x = ((x % width) + width) % width;
+            y = ((y % height) + height) % height;
+        }
+        else
+        {
+            x = std::clamp(x, 0, width - 1);
+            y = std::clamp(y, 0, height - 1);
+        }
+
+        Rgba8 const& texel = texture.m_texels[static_cast<size_t>(y) * width + x];
+        out_texel[0] += texel.r * weight;
+        out_texel[1] += texel.g * weight;
+        out_texel[2] += texel.b * weight;
+        out_texel[3] += texel.a * weight;
+    };
+
+    out_texel[0] = out_texel[1] = out_texel[2] = out_texel[3] = 0.f;
+
+    // Texel rows are stored top-down while v points up.
+    float const texelX = u * static_cast<float>(width);
+    float const texelY = (1.f - v) * static_cast<float>(height);
+
+    if (samplerMode == eSamplerMode::POINT_CLAMP)
+    {
+        fetch(static_cast<int>(std::floor(texelX)), static_cast<int>(std::floor(texelY)), 1.f);
+        return;
+    }
+
+    float const x0 = std::floor(texelX - 0.5f);
+    float const y0 = std::floor(texelY - 0.5f);
+    float const fx = texelX - 0.5f - x0;
+    float const fy = texelY - 0.5f - y0;
+    int const   ix = static_cast<int>(x0);
+    int const   iy = static_cast<int>(y0);
+
+    fetch(ix, iy, (1.f - fx) * (1.f - fy));
+    fetch(ix + 1, iy, fx * (1.f - fy));
+    fetch(ix, iy + 1, (1.f - fx) * fy);
+    fetch(ix + 1, iy + 1, fx * fy);
+}
+
+//----------------------------------------------------------------------------------------------------
+void SoftwareRenderer::ShadePixel(sTriangle const&  triangle,
+                                  sDrawState const& state,
+                                  float const       weights[3],
+                                  int const         pixelIndex)
+{
+    float const inverseW = weights[0] * triangle.m_inverseW[0] + weights[1] * triangle.m_inverseW[1] + weights[2] * triangle.m_inverseW[2];
+    float const w        = 1.f / inverseW;
+
+    // Perspective-correct attributes
+    float attributes[6];
+
+    for (int k = 0; k < 6; ++k)
+    {
+        attributes[k] = (weights[0] * triangle.m_attributes[0][k] + weights[1] * triangle.m_attributes[1][k] + weights[2] * triangle.m_attributes[2][k]) * w;
+    }
+
+    float color[4] = {attributes[0], attributes[1], attributes[2], attributes[3]};
+
+    if (state.m_texture != nullptr && !state.m_texture->m_texels.empty())
+    {
+        float texel[4];
+        SampleTexture(*state.m_texture, state.m_samplerMode, attributes[4], attributes[5], texel);
+
+        for (int k = 0; k < 4; ++k)
+        {
+            color[k] *= texel[k] / 255.f;
+        }
+    }
+
+    Rgba8&      destination = m_colorBuffer[pixelIndex];
+    float const alpha       = std::clamp(color[3] / 255.f, 0.f, 1.f);
+
+    auto const toByte = [](float const value) { return static_cast<unsigned char>(std::clamp(value + 0.5f, 0.f, 255.f)); };
+
+    switch (state.m_blendMode)
+    {
+    case eBlendMode::ALPHA:
+        destination.r = toByte(color[0] * alpha + destination.r * (1.f - alpha));
+        destination.g = toByte(color[1] * alpha + destination.g * (1.f - alpha));
+        destination.b = toByte(color[2] * alpha + destination.b * (1.f - alpha));
+        destination.a = toByte(color[3] + destination.a * (1.f - alpha));
+        break;
+
+    case eBlendMode::ADDITIVE:
+        destination.r = toByte(color[0] + destination.r);
+        destination.g = toByte(color[1] + destination.g);
+        destination.b = toByte(color[2] + destination.b);
+        destination.a = toByte(color[3] + destination.a);
+        break;
+
+    default:
+        destination = Rgba8(toByte(color[0]), toByte(color[1]), toByte(color[2]), toByte(color[3]));
+        break;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+Rgba8 SoftwareRenderer::GetPixel(int const x,
+                                 int const y) const
+{
+    return m_colorBuffer[static_cast<size_t>(y) * m_stride + x];
+}
+
+//----------------------------------------------------------------------------------------------------
+float SoftwareRenderer::GetDepth(int const x,
+                                 int const y) const
+{
+    return m_depthBuffer[static_cast<size_t>(y) * m_stride + x];
+}
+
+//----------------------------------------------------------------------------------------------------
+// Uncompressed 32-bit TGA with a top-left origin.
+//----------------------------------------------------------------------------------------------------
+bool SoftwareRenderer::SaveToTGA(std::string const& filePath) const
+{
+    std::filesystem::path const path(filePath);
+
+    if (path.has_parent_path())
+    {
+        std::error_code errorCode;
+        std::filesystem::create_directories(path.parent_path(), errorCode);
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    int const     width      = m_config.m_dimensions.x;
+    int const     height     = m_config.m_dimensions.y;
+    uint8_t const header[18] = {0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+                                static_cast<uint8_t>(width & 0xFF), static_cast<uint8_t>(width >> 8),
+                                static_cast<uint8_t>(height & 0xFF), static_cast<uint8_t>(height >> 8),
+                                32, 0x28};
+
+    file.write(reinterpret_cast<char const*>(header), sizeof(header));
+
+    std::vector<uint8_t> row(static_cast<size_t>(width) * 4);
+
+    for (int y = 0; y < height; ++y)
+    {
+        for (int x = 0; x < width; ++x)
+        {
+            Rgba8 const& pixel = m_colorBuffer[static_cast<size_t>(y) * m_stride + x];
+            row[x * 4 + 0]     = pixel.b;
+            row[x * 4 + 1]     = pixel.g;
+            row[x * 4 + 2]     = pixel.r;
+            row[x * 4 + 3]     = pixel.a;
+        }
+
+        file.write(reinterpret_cast<char const*>(row.data()), static_cast<std::streamsize>(row.size()));
+    }
+
+    return file.good();
+}
+
+//----------------------------------------------------------------------------------------------------
+// Reads the uncompressed 24/32-bit TGAs written by SaveToTGA (and most tools).
+//----------------------------------------------------------------------------------------------------
+STATIC bool SoftwareRenderer::LoadTGA(std::string const& filePath,
+                                      sSoftwareTexture&  out_texture)
+{
+    std::ifstream file(filePath, std::ios::binary);
+
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    uint8_t header[18] = {};
+    file.read(reinterpret_cast<char*>(header), sizeof(header));
+
+    int const bytesPerPixel = header[16] / 8;
+
+    if (!file.good() || header[2] != 2 || (bytesPerPixel != 3 && bytesPerPixel != 4))
+    {
+        return false;
+    }
+
+    int const  width       = header[12] | (header[13] << 8);
+    int const  height      = header[14] | (header[15] << 8);
+    bool const isTopOrigin = (header[17] & 0x20) != 0;
+
+    file.seekg(header[0], std::ios::cur);
+
+    std::vector<uint8_t> data(static_cast<size_t>(width) * height * bytesPerPixel);
+    file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()));
+
+    if (!file.good())
+    {
+        return false;
+    }
+
+    out_texture.m_dimensions = IntVec2(width, height);
+    out_texture.m_texels.resize(static_cast<size_t>(width) * height);
+
+    for (int y = 0; y < height; ++y)
+    {
+        int const sourceRow = isTopOrigin ? y : height - 1 - y;
+
+        for (int x = 0; x < width; ++x)
+        {
+            uint8_t const* source = &data[(static_cast<size_t>(sourceRow) * width + x) * bytesPerPixel];
+
+            out_texture.m_texels[static_cast<size_t>(y) * width + x] = Rgba8(source[2], source[1], source[0], bytesPerPixel == 4 ? source[3] : 255);
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,156 @@
+//----------------------------------------------------------------------------------------------------
+// SoftwareRenderer.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Math/IntVec2.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Renderer/Renderer.hpp"
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class Camera;
+class WorkerPool;
+struct sQuantizedMesh;
+
+//----------------------------------------------------------------------------------------------------
+// CPU-side texture for the software renderer; texels are row-major, row 0 at the top (v = 1).
+//----------------------------------------------------------------------------------------------------
+struct sSoftwareTexture
+{
+    IntVec2            m_dimensions;
+    std::vector<Rgba8> m_texels;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sSoftwareRendererConfig
+{
+    IntVec2     m_dimensions = IntVec2(1920, 1080);
+    WorkerPool* m_workerPool = nullptr;                 // nullptr rasterizes all tiles on the calling thread
+};
+
+//----------------------------------------------------------------------------------------------------
+// Per-frame timings and counts, reset by BeginFrame().
+//----------------------------------------------------------------------------------------------------
+struct sSoftwareRenderStats
+{
+    double   m_vertexMilliseconds      = 0.0;     // Transform, near clip, cull, triangle setup
+    double   m_binMilliseconds         = 0.0;
+    double   m_rasterMilliseconds      = 0.0;     // Tile-parallel rasterization, depth test, shading
+    uint32_t m_submittedTriangleCount  = 0;
+    uint32_t m_rasterizedTriangleCount = 0;       // Survived clipping and culling
+    uint32_t m_binEntryCount           = 0;       // Triangle-tile pairs
+};
+
+//----------------------------------------------------------------------------------------------------
+// Renderer replacement for machines without a GPU (headless agents, golden-image and timing tests).
+//
+// It mirrors the subset of the Renderer calls used by Prop::Render and Game::RenderAttractMode, with the
+// engine's render-state enums, so draw code reads the same against either backend. Only Vertex_PCU (and its
+// quantized Vertex_PCUQ form) is supported: vertex color x model tint x optional texture, depth test and
+// OPAQUE/ALPHA/ADDITIVE blending.
+//
+// Draw calls are transformed, clipped and binned into 64x64 pixel tiles right away; EndFrame() (or a
+// ClearScreen()) rasterizes all tiles, in parallel on the WorkerPool when one is given. Each tile is owned
+// by a single worker and walks its triangles in submission order, so the image does not depend on the
+// thread count. Spans are rasterized four pixels at a time with SSE2.
+//----------------------------------------------------------------------------------------------------
+class SoftwareRenderer
+{
+public:
+    explicit SoftwareRenderer(sSoftwareRendererConfig const& config);
+
+    void BeginFrame();
+    void EndFrame();
+    void ClearScreen(Rgba8 const& clearColor);
+    void BeginCamera(Camera const& camera);
+    void EndCamera(Camera const& camera);
+
+    void SetModelConstants(Mat44 const& modelToWorld = Mat44(), Rgba8 const& modelTint = Rgba8::WHITE);
+    void SetBlendMode(eBlendMode blendMode);
+    void SetRasterizerMode(eRasterizerMode rasterizerMode);
+    void SetSamplerMode(eSamplerMode samplerMode);
+    void SetDepthMode(eDepthMode depthMode);
+    void BindTexture(sSoftwareTexture const* texture);
+    void SetColorWriteEnabled(bool isEnabled);      // Off = depth-only, e.g. for occluder rasterization
+
+    void DrawVertexArray(int vertexCount, Vertex_PCU const* vertexes);
+    void DrawVertexArray(VertexList_PCU const& vertexes);
+    void DrawQuantizedMesh(sQuantizedMesh const& mesh);
+
+    IntVec2                     GetDimensions() const { return m_config.m_dimensions; }
+    Rgba8                       GetPixel(int x, int y) const;
+    float                       GetDepth(int x, int y) const;       // Valid after EndFrame()
+    Mat44 const&                GetWorldToClip() const { return m_worldToClip; }
+    sSoftwareRenderStats const& GetStats() const { return m_stats; }
+
+    bool        SaveToTGA(std::string const& filePath) const;
+    static bool LoadTGA(std::string const& filePath, sSoftwareTexture& out_texture);
+
+    static int constexpr TILE_SIZE = 64;
+
+private:
+    struct sDrawState
+    {
+        eBlendMode              m_blendMode    = eBlendMode::OPAQUE;
+        eSamplerMode            m_samplerMode  = eSamplerMode::POINT_CLAMP;
+        bool                    m_isDepthRead  = true;
+        bool                    m_isDepthWrite = true;
+        bool                    m_isColorWrite = true;
+        sSoftwareTexture const* m_texture      = nullptr;
+    };
+
+    // Screen-space triangle ready for rasterization; attributes are pre-divided by w.
+    struct sTriangle
+    {
+        float    m_edgeA[3];
+        float    m_edgeB[3];
+        float    m_edgeC[3];
+        bool     m_isEdgeInclusive[3];          // Top-left rule, so shared edges are drawn exactly once
+        float    m_inverseArea;
+        float    m_depth[3];
+        float    m_inverseW[3];
+        float    m_attributes[3][6];            // r, g, b, a (0-255), u, v
+        int      m_minX, m_minY, m_maxX, m_maxY;
+        uint32_t m_stateIndex;
+    };
+
+    struct sClipVertex
+    {
+        float m_position[4];                    // Clip space
+        float m_attributes[6];
+    };
+
+    template <typename FetchVertex>
+    void DrawTriangles(int vertexCount, Mat44 const& modelToClip, FetchVertex const& fetchVertex);
+    void Flush();
+    void SetupTriangle(sClipVertex const& v0, sClipVertex const& v1, sClipVertex const& v2);
+    void RasterizeTile(uint32_t tileIndex);
+    void ShadePixel(sTriangle const& triangle, sDrawState const& state, float const weights[3], int pixelIndex);
+    uint32_t GetCurrentStateIndex();
+
+    sSoftwareRendererConfig m_config;
+    int                     m_stride = 0;                   // Row pitch in pixels, rounded up to 4 for SIMD spans
+    std::vector<Rgba8>      m_colorBuffer;
+    std::vector<float>      m_depthBuffer;
+
+    Mat44      m_worldToClip;
+    Mat44      m_modelToWorld;
+    Rgba8      m_modelTint        = Rgba8::WHITE;
+    bool       m_isBackfaceCulled = true;
+    sDrawState m_state;
+    bool       m_isStateDirty     = true;
+
+    std::vector<sDrawState>            m_drawStates;
+    std::vector<sTriangle>             m_triangles;
+    int                                m_tileCountX = 0;
+    int                                m_tileCountY = 0;
+    std::vector<std::vector<uint32_t>> m_tileBins;
+
+    sSoftwareRenderStats m_stats;
+};
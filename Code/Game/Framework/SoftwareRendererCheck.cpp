@@ -0,0 +1,117 @@
+//----------------------------------------------------------------------------------------------------
+// SoftwareRendererCheck.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/HeadlessRunner.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include "Engine/Core/StringUtils.hpp"
+#include "Game/Framework/HeadlessWorld.hpp"
+#include "Game/Framework/SoftwareRenderer.hpp"
+#include "Game/Framework/WorkerPool.hpp"
+
+//----------------------------------------------------------------------------------------------------
+bool RunSoftwareRenderCheck(sHeadlessRunConfig const& config,
+                            WorkerPool&               workerPool)
+{
+    HeadlessWorld world(config.m_worldConfig);
+
+    sSoftwareRendererConfig rendererConfig;
+    rendererConfig.m_dimensions = IntVec2(static_cast<int>(config.m_renderWidth), static_cast<int>(config.m_renderHeight));
+    rendererConfig.m_workerPool = &workerPool;
+
+    SoftwareRenderer renderer(rendererConfig);
+    sSoftwareRenderStats totals;
+
+    uint32_t const frameCount = config.m_renderFrameCount;
+    auto const     startTime  = std::chrono::steady_clock::now();
+
+    for (uint32_t frame = 0; frame < frameCount; ++frame)
+    {
+        world.Step();
+
+        renderer.BeginFrame();
+        renderer.ClearScreen(Rgba8::BLACK);
+        world.Render(renderer);
+        renderer.EndFrame();
+
+        sSoftwareRenderStats const& stats = renderer.GetStats();
+        totals.m_vertexMilliseconds += stats.m_vertexMilliseconds;
+        totals.m_binMilliseconds += stats.m_binMilliseconds;
+        totals.m_rasterMilliseconds += stats.m_rasterMilliseconds;
+    }
+
+    std::chrono::duration<double, std::milli> const elapsed = std::chrono::steady_clock::now() - startTime;
+
+    sSoftwareRenderStats const& lastFrame = renderer.GetStats();
+
+    String report = Stringf("Software render: %ux%u, %u props, %u frames, %u workers\n", config.m_renderWidth, config.m_renderHeight,
+                            config.m_worldConfig.m_propCount, frameCount, workerPool.GetWorkerCount());
+    report += Stringf("vertex   %8.3f ms/frame\n", totals.m_vertexMilliseconds / frameCount);
+    report += Stringf("bin      %8.3f ms/frame\n", totals.m_binMilliseconds / frameCount);
+    report += Stringf("raster   %8.3f ms/frame\n", totals.m_rasterMilliseconds / frameCount);
+    report += Stringf("frame    %8.3f ms/frame  (%.1f FPS, including simulation)\n", elapsed.count() / frameCount,
+                      elapsed.count() > 0.0 ? 1000.0 * frameCount / elapsed.count() : 0.0);
+    report += Stringf("triangles %u submitted, %u rasterized, %u tile bin entries (last frame)\n",
+                      lastFrame.m_submittedTriangleCount, lastFrame.m_rasterizedTriangleCount, lastFrame.m_binEntryCount);
+
+    bool isValid = true;
+
+    if (!renderer.SaveToTGA(config.m_renderImagePath))
+    {
+        report += Stringf("could not write %s\n", config.m_renderImagePath.c_str());
+        isValid = false;
+    }
+
+    if (!config.m_goldenImagePath.empty())
+    {
+        sSoftwareTexture golden;
+
+        if (!SoftwareRenderer::LoadTGA(config.m_goldenImagePath, golden))
+        {
+            report += Stringf("golden   FAILED (cannot read %s)\n", config.m_goldenImagePath.c_str());
+            isValid = false;
+        }
+        else if (golden.m_dimensions.x != renderer.GetDimensions().x || golden.m_dimensions.y != renderer.GetDimensions().y)
+        {
+            report += Stringf("golden   FAILED (size %dx%d)\n", golden.m_dimensions.x, golden.m_dimensions.y);
+            isValid = false;
+        }
+        else
+        {
+            // Small per-channel differences are tolerated so the comparison survives compiler and
+            // floating-point mode changes; anything visible fails.
+            uint32_t differingPixelCount = 0;
+
+            for (int y = 0; y < golden.m_dimensions.y; ++y)
+            {
+                for (int x = 0; x < golden.m_dimensions.x; ++x)
+                {
+                    Rgba8 const expected = golden.m_texels[static_cast<size_t>(y) * golden.m_dimensions.x + x];
+                    Rgba8 const actual   = renderer.GetPixel(x, y);
+
+                    int const difference = std::max({std::abs(expected.r - actual.r), std::abs(expected.g - actual.g), std::abs(expected.b - actual.b)});
+
+                    if (difference > 2)
+                    {
+                        ++differingPixelCount;
+                    }
+                }
+            }
+
+            uint32_t const pixelCount = static_cast<uint32_t>(golden.m_dimensions.x) * golden.m_dimensions.y;
+            bool const     isMatch    = differingPixelCount <= pixelCount / 1000;
+            isValid                   = isMatch;
+
+            report += Stringf("golden   %s (%u of %u pixels differ)\n", isMatch ? "OK" : "FAILED", differingPixelCount, pixelCount);
+        }
+    }
+
+    WriteHeadlessReport(config.m_renderReportPath, report);
+
+    return isValid;
+}
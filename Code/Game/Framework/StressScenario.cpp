@@ -0,0 +1,420 @@
+//----------------------------------------------------------------------------------------------------
+// StressScenario.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/StressScenario.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <memory>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Math/RandomNumberGenerator.hpp"
+#include "Engine/Math/Vec3.hpp"
+#include "Game/Prop.hpp"
+#include "Game/Framework/DrawPacketBuilder.hpp"
+#include "Game/Framework/GameCommon.hpp"
+
+//----------------------------------------------------------------------------------------------------
+static double constexpr   NOISE_FLOOR_MILLISECONDS = 0.05;
+static uint64_t constexpr NOISE_FLOOR_BYTES        = 1024ull * 1024ull;
+static float constexpr    HEADLESS_FIELD_HALF_SIZE = 500.f;
+
+//----------------------------------------------------------------------------------------------------
+// k in cost ~ N^k between two steps; 0 when either cost is below the floor, where timer noise decides.
+//
+static float GetGrowthExponent(double const   previousCost,
+                               uint32_t const previousCount,
+                               double const   cost,
+                               uint32_t const count,
+                               double const   noiseFloor)
+{
+    if (previousCost < noiseFloor || cost < noiseFloor || count <= previousCount || previousCount == 0)
+    {
+        return 0.f;
+    }
+
+    return static_cast<float>(std::log(cost / previousCost) / std::log(static_cast<double>(count) / static_cast<double>(previousCount)));
+}
+
+//----------------------------------------------------------------------------------------------------
+static double GetMilliseconds(std::chrono::steady_clock::time_point const startTime)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+//----------------------------------------------------------------------------------------------------
+StressScenario::StressScenario(sStressScenarioConfig const& config)
+    : m_config(config),
+      m_baselineMemoryBytes(GetProcessMemoryBytes())
+{
+    m_config.m_startEntityCount = std::max(m_config.m_startEntityCount, 1u);
+    m_config.m_growthFactor     = std::max(m_config.m_growthFactor, 2u);
+    m_config.m_maxEntityCount   = std::max(m_config.m_maxEntityCount, m_config.m_startEntityCount);
+    m_config.m_framesPerStep    = std::max(m_config.m_framesPerStep, 1u);
+}
+
+//----------------------------------------------------------------------------------------------------
+// -stressScenario=MAX [-stressStart=N] [-stressGrowth=G] [-stressFrames=F] [-stressExponent=K]
+//
+STATIC bool StressScenario::ParseCommandLine(std::string const&     commandLine,
+                                             sStressScenarioConfig& out_config)
+{
+    if (!FindCommandLineUInt(commandLine, "stressScenario", out_config.m_maxEntityCount))
+    {
+        return false;
+    }
+
+    FindCommandLineUInt(commandLine, "stressStart", out_config.m_startEntityCount);
+    FindCommandLineUInt(commandLine, "stressGrowth", out_config.m_growthFactor);
+    FindCommandLineUInt(commandLine, "stressFrames", out_config.m_framesPerStep);
+    FindCommandLineFloat(commandLine, "stressExponent", out_config.m_superlinearExponent);
+
+    return out_config.m_maxEntityCount > 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+std::vector<uint32_t> StressScenario::GetStepEntityCounts() const
+{
+    std::vector<uint32_t> entityCounts;
+
+    for (uint64_t count = m_config.m_startEntityCount; count < m_config.m_maxEntityCount; count *= m_config.m_growthFactor)
+    {
+        entityCounts.push_back(static_cast<uint32_t>(count));
+    }
+
+    entityCounts.push_back(m_config.m_maxEntityCount);
+
+    return entityCounts;
+}
+
+//----------------------------------------------------------------------------------------------------
+void StressScenario::BeginStep(uint32_t const entityCount,
+                               uint32_t const spawnedCount,
+                               double const   bridgeMilliseconds)
+{
+    if (m_isMeasuring)
+    {
+        EndStep();
+    }
+
+    uint64_t const memoryBytes = GetProcessMemoryBytes();
+
+    m_currentStep                     = sStressStep();
+    m_currentStep.m_entityCount       = entityCount;
+    m_currentStep.m_spawnedCount      = spawnedCount;
+    m_currentStep.m_bridgeNsPerEntity = spawnedCount > 0 ? bridgeMilliseconds * 1000000.0 / spawnedCount : 0.0;
+    m_currentStep.m_memoryBytes       = memoryBytes > m_baselineMemoryBytes ? memoryBytes - m_baselineMemoryBytes : 0;
+
+    m_updateSamples.clear();
+    m_renderBuildSamples.clear();
+    m_isMeasuring = true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void StressScenario::AddUpdateSample(double const milliseconds)
+{
+    if (!m_isMeasuring || m_updateSamples.size() >= m_config.m_framesPerStep)
+    {
+        return;
+    }
+
+    m_updateSamples.push_back(milliseconds);
+
+    if (m_renderBuildSamples.size() >= m_config.m_framesPerStep && m_updateSamples.size() >= m_config.m_framesPerStep)
+    {
+        EndStep();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void StressScenario::AddRenderBuildSample(double const milliseconds)
+{
+    if (!m_isMeasuring || m_renderBuildSamples.size() >= m_config.m_framesPerStep)
+    {
+        return;
+    }
+
+    m_renderBuildSamples.push_back(milliseconds);
+
+    if (m_renderBuildSamples.size() >= m_config.m_framesPerStep && m_updateSamples.size() >= m_config.m_framesPerStep)
+    {
+        EndStep();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void StressScenario::EndStep()
+{
+    m_currentStep.m_updateMilliseconds      = GetMedian(m_updateSamples);
+    m_currentStep.m_renderBuildMilliseconds = GetMedian(m_renderBuildSamples);
+
+    m_steps.push_back(m_currentStep);
+    m_isMeasuring = false;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Spawns each cube the way Game::CreateCube() does. There is no script call or argument marshalling
+// behind it (those need V8 and a Game), so the bridge column is the C++ spawn alone.
+//
+void StressScenario::RunHeadless(WorkerPool* const workerPool)
+{
+    m_mode = "headless";
+
+    DrawPacketBuilder                  builder(workerPool);
+    RandomNumberGenerator              rng;
+    std::vector<std::unique_ptr<Prop>> props;
+    Vec3 const                         cameraPosition(-HEADLESS_FIELD_HALF_SIZE, 0.f, 10.f);
+    float constexpr                    deltaSeconds = 1.f / 60.f;
+
+    auto const buildPacket = [&props, &cameraPosition](uint32_t const propIndex, sDrawPacket& out_packet)
+    {
+        Prop const& prop = *props[propIndex];
+        return prop.BuildDrawPacket(cameraPosition, prop.GetTexture() != nullptr ? 1 : 0, out_packet);
+    };
+
+    for (uint32_t const entityCount : GetStepEntityCounts())
+    {
+        uint32_t const spawnedCount = entityCount - static_cast<uint32_t>(props.size());
+        auto const     bridgeStart  = std::chrono::steady_clock::now();
+
+        for (uint32_t spawnIndex = 0; spawnIndex < spawnedCount; ++spawnIndex)
+        {
+            std::unique_ptr<Prop> cube = std::make_unique<Prop>(nullptr);
+            cube->m_position           = Vec3(rng.RollRandomFloatInRange(-HEADLESS_FIELD_HALF_SIZE, HEADLESS_FIELD_HALF_SIZE),
+                                              rng.RollRandomFloatInRange(-HEADLESS_FIELD_HALF_SIZE, HEADLESS_FIELD_HALF_SIZE),
+                                              rng.RollRandomFloatInRange(0.f, 20.f));
+            cube->m_color              = Rgba8(static_cast<unsigned char>(rng.RollRandomIntInRange(100, 255)),
+                                               static_cast<unsigned char>(rng.RollRandomIntInRange(100, 255)),
+                                               static_cast<unsigned char>(rng.RollRandomIntInRange(100, 255)),
+                                               255);
+            cube->InitializeLocalVertsForCube();
+            props.push_back(std::move(cube));
+        }
+
+        BeginStep(entityCount, spawnedCount, GetMilliseconds(bridgeStart));
+
+        for (uint32_t frame = 0; frame < m_config.m_framesPerStep; ++frame)
+        {
+            auto const updateStart = std::chrono::steady_clock::now();
+
+            for (std::unique_ptr<Prop> const& prop : props)
+            {
+                prop->Update(deltaSeconds);
+            }
+
+            AddUpdateSample(GetMilliseconds(updateStart));
+
+            builder.Build(static_cast<uint32_t>(props.size()), buildPacket);
+
+            sDrawPacketStats const& stats = builder.GetStats();
+            AddRenderBuildSample(stats.m_buildMilliseconds + stats.m_sortMilliseconds + stats.m_mergeMilliseconds);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+bool StressScenario::Finish()
+{
+    if (m_isMeasuring)
+    {
+        EndStep();
+    }
+
+    for (size_t stepIndex = 1; stepIndex < m_steps.size(); ++stepIndex)
+    {
+        sStressStep& step = m_steps[stepIndex];
+
+        // A short last step (max not a power of the growth factor) would turn timer noise into a steep
+        // exponent; reach back until the entity count at least doubles.
+        size_t previousIndex = stepIndex - 1;
+
+        while (previousIndex > 0 && m_steps[previousIndex].m_entityCount * 2ull > step.m_entityCount)
+        {
+            --previousIndex;
+        }
+
+        sStressStep const& previous = m_steps[previousIndex];
+
+        // Bridge cost is per entity; scaled to the whole population it grows linearly when flat.
+        double const previousBridgeMilliseconds = previous.m_bridgeNsPerEntity * previous.m_entityCount / 1000000.0;
+        double const bridgeMilliseconds         = step.m_bridgeNsPerEntity * step.m_entityCount / 1000000.0;
+
+        step.m_bridgeExponent      = GetGrowthExponent(previousBridgeMilliseconds, previous.m_entityCount, bridgeMilliseconds, step.m_entityCount, NOISE_FLOOR_MILLISECONDS);
+        step.m_updateExponent      = GetGrowthExponent(previous.m_updateMilliseconds, previous.m_entityCount, step.m_updateMilliseconds, step.m_entityCount, NOISE_FLOOR_MILLISECONDS);
+        step.m_renderBuildExponent = GetGrowthExponent(previous.m_renderBuildMilliseconds, previous.m_entityCount, step.m_renderBuildMilliseconds, step.m_entityCount, NOISE_FLOOR_MILLISECONDS);
+        step.m_memoryExponent      = GetGrowthExponent(static_cast<double>(previous.m_memoryBytes), previous.m_entityCount, static_cast<double>(step.m_memoryBytes), step.m_entityCount,
+                                                       static_cast<double>(NOISE_FLOOR_BYTES));
+    }
+
+    FindFirstSuperlinear();
+
+    bool const isJsonWritten = WriteTextFile(m_config.m_jsonPath, ToJson());
+    bool const isCsvWritten  = WriteTextFile(m_config.m_csvPath, ToCsv());
+
+    return isJsonWritten && isCsvWritten;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Earliest step wins; within one step, the subsystem growing fastest.
+//
+void StressScenario::FindFirstSuperlinear()
+{
+    m_firstSuperlinearSubsystem.clear();
+    m_firstSuperlinearEntityCount = 0;
+    m_firstSuperlinearExponent    = 0.f;
+
+    for (sStressStep const& step : m_steps)
+    {
+        std::pair<char const*, float> const exponents[] = {
+            {"bridge", step.m_bridgeExponent},
+            {"update", step.m_updateExponent},
+            {"renderBuild", step.m_renderBuildExponent},
+            {"memory", step.m_memoryExponent},
+        };
+
+        for (auto const& [subsystem, exponent] : exponents)
+        {
+            if (exponent > m_config.m_superlinearExponent && exponent > m_firstSuperlinearExponent)
+            {
+                m_firstSuperlinearSubsystem   = subsystem;
+                m_firstSuperlinearEntityCount = step.m_entityCount;
+                m_firstSuperlinearExponent    = exponent;
+            }
+        }
+
+        if (!m_firstSuperlinearSubsystem.empty())
+        {
+            return;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+std::string StressScenario::ToJson() const
+{
+    std::string json = "{\n  \"context\": {\n";
+    json += Stringf("    \"mode\": \"%s\",\n", m_mode.c_str());
+    json += Stringf("    \"startEntityCount\": %u,\n", m_config.m_startEntityCount);
+    json += Stringf("    \"growthFactor\": %u,\n", m_config.m_growthFactor);
+    json += Stringf("    \"maxEntityCount\": %u,\n", m_config.m_maxEntityCount);
+    json += Stringf("    \"framesPerStep\": %u,\n", m_config.m_framesPerStep);
+    json += Stringf("    \"superlinearExponent\": %.3f\n", m_config.m_superlinearExponent);
+    json += "  },\n  \"steps\": [";
+
+    for (size_t stepIndex = 0; stepIndex < m_steps.size(); ++stepIndex)
+    {
+        sStressStep const& step = m_steps[stepIndex];
+
+        json += stepIndex == 0 ? "\n" : ",\n";
+        json += Stringf("    {\"entityCount\": %u, \"spawnedCount\": %u, \"bridgeNsPerEntity\": %.3f, \"updateMs\": %.4f, \"renderBuildMs\": %.4f, \"memoryBytes\": %llu, ",
+                        step.m_entityCount, step.m_spawnedCount, step.m_bridgeNsPerEntity, step.m_updateMilliseconds, step.m_renderBuildMilliseconds,
+                        static_cast<unsigned long long>(step.m_memoryBytes));
+        json += Stringf("\"bridgeExponent\": %.3f, \"updateExponent\": %.3f, \"renderBuildExponent\": %.3f, \"memoryExponent\": %.3f}",
+                        step.m_bridgeExponent, step.m_updateExponent, step.m_renderBuildExponent, step.m_memoryExponent);
+    }
+
+    json += "\n  ],\n  \"firstSuperlinear\": ";
+
+    if (m_firstSuperlinearSubsystem.empty())
+    {
+        json += "null";
+    }
+    else
+    {
+        json += Stringf("{\"subsystem\": \"%s\", \"entityCount\": %u, \"exponent\": %.3f}", m_firstSuperlinearSubsystem.c_str(),
+                        m_firstSuperlinearEntityCount, m_firstSuperlinearExponent);
+    }
+
+    json += "\n}\n";
+
+    return json;
+}
+
+//----------------------------------------------------------------------------------------------------
+std::string StressScenario::ToCsv() const
+{
+    std::string csv = "entityCount,spawnedCount,bridgeNsPerEntity,updateMs,renderBuildMs,memoryBytes,bridgeExponent,updateExponent,renderBuildExponent,memoryExponent\n";
+
+    for (sStressStep const& step : m_steps)
+    {
+        csv += Stringf("%u,%u,%.3f,%.4f,%.4f,%llu,%.3f,%.3f,%.3f,%.3f\n", step.m_entityCount, step.m_spawnedCount, step.m_bridgeNsPerEntity,
+                       step.m_updateMilliseconds, step.m_renderBuildMilliseconds, static_cast<unsigned long long>(step.m_memoryBytes),
+                       step.m_bridgeExponent, step.m_updateExponent, step.m_renderBuildExponent, step.m_memoryExponent);
+    }
+
+    return csv;
+}
+
+//----------------------------------------------------------------------------------------------------
+std::string StressScenario::ToReport() const
+{
+    std::string report = Stringf("Stress scenario (%s): %u -> %u entities x%u, %u frames per step\n", m_mode.c_str(),
+                                 m_config.m_startEntityCount, m_config.m_maxEntityCount, m_config.m_growthFactor, m_config.m_framesPerStep);
+    report += "entities  bridge ns/ent  update ms  render ms  memory MiB  k bridge  k update  k render  k memory\n";
+
+    for (sStressStep const& step : m_steps)
+    {
+        report += Stringf("%8u  %13.1f  %9.3f  %9.3f  %10.1f  %8.2f  %8.2f  %8.2f  %8.2f\n", step.m_entityCount, step.m_bridgeNsPerEntity,
+                          step.m_updateMilliseconds, step.m_renderBuildMilliseconds, static_cast<double>(step.m_memoryBytes) / (1024.0 * 1024.0),
+                          step.m_bridgeExponent, step.m_updateExponent, step.m_renderBuildExponent, step.m_memoryExponent);
+    }
+
+    if (m_mode == "headless")
+    {
+        report += "bridge           C++ spawn only; script dispatch and marshalling are measured in game\n";
+    }
+
+    if (m_firstSuperlinearSubsystem.empty())
+    {
+        report += Stringf("superlinear      none above k = %.2f\n", m_config.m_superlinearExponent);
+    }
+    else
+    {
+        report += Stringf("superlinear      %s at %u entities (k = %.2f)\n", m_firstSuperlinearSubsystem.c_str(), m_firstSuperlinearEntityCount,
+                          m_firstSuperlinearExponent);
+    }
+
+    return report;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Private bytes on Windows, resident set elsewhere.
+//
+STATIC uint64_t StressScenario::GetProcessMemoryBytes()
+{
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS_EX counters = {};
+
+    if (GetProcessMemoryInfo(GetCurrentProcess(), reinterpret_cast<PROCESS_MEMORY_COUNTERS*>(&counters), sizeof(counters)))
+    {
+        return counters.PrivateUsage;
+    }
+
+    return 0;
+#else
+    std::ifstream statm("/proc/self/statm");
+    uint64_t      totalPages    = 0;
+    uint64_t      residentPages = 0;
+
+    if (!(statm >> totalPages >> residentPages))
+    {
+        return 0;
+    }
+
+    return residentPages * static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
@@ -0,0 +1,106 @@
+//----------------------------------------------------------------------------------------------------
+// StressScenario.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class WorkerPool;
+
+//----------------------------------------------------------------------------------------------------
+struct sStressScenarioConfig
+{
+    uint32_t    m_startEntityCount    = 1000;
+    uint32_t    m_growthFactor        = 4;           // Entity count is multiplied by this every step
+    uint32_t    m_maxEntityCount      = 1000000;     // Last step, even when not a power of the growth factor
+    uint32_t    m_framesPerStep       = 16;          // Update / render-build costs are the median of these frames
+    float       m_superlinearExponent = 1.2f;        // Cost ~ N^k between two steps with k above this is superlinear
+    std::string m_jsonPath            = "Logs/StressScenario.json";
+    std::string m_csvPath             = "Logs/StressScenario.csv";
+};
+
+//----------------------------------------------------------------------------------------------------
+// One point on the scalability curve. Exponents compare with the nearest earlier step that had at most
+// half the entities: total cost grows as N^k, so 1 is linear (per-entity cost flat); 0 at the first step.
+//----------------------------------------------------------------------------------------------------
+struct sStressStep
+{
+    uint32_t m_entityCount             = 0;
+    uint32_t m_spawnedCount            = 0;       // Entities created through createCube for this step
+    double   m_bridgeNsPerEntity       = 0.0;     // createCube: script call, argument marshalling, spawn
+    double   m_updateMilliseconds      = 0.0;     // Entity update, per frame
+    double   m_renderBuildMilliseconds = 0.0;     // Draw packet build, sort and merge, per frame
+    uint64_t m_memoryBytes             = 0;       // Process memory above the scenario's starting point
+
+    float m_bridgeExponent      = 0.f;
+    float m_updateExponent      = 0.f;
+    float m_renderBuildExponent = 0.f;
+    float m_memoryExponent      = 0.f;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Ramps the entity count geometrically and records what each subsystem costs at every step, then
+// writes the curve as JSON and CSV and names the first subsystem whose cost grows faster than the
+// entity count.
+//
+// In game (-stressScenario=MAX), Data/Scripts/StressScenario.js drives it: the script spawns each
+// step's cubes through game.createCube(), timing the calls, and reports them with
+// game.recordStressStep(); Game then feeds the next m_framesPerStep frames of entity update and draw
+// packet timings here; Game::CreateCube() skips its per-cube logging while a scenario runs. Headless,
+// RunHeadless() ramps its own props the same way, but its bridge cost is only the C++ spawn: there is
+// no V8 or Game to call createCube through.
+//
+// Costs too small to time reliably (under 0.05 ms per frame, or 1 MiB) never count as superlinear.
+//----------------------------------------------------------------------------------------------------
+class StressScenario
+{
+public:
+    explicit StressScenario(sStressScenarioConfig const& config);
+
+    static bool ParseCommandLine(std::string const& commandLine, sStressScenarioConfig& out_config);
+
+    // Driven step by step (in game)
+    void BeginStep(uint32_t entityCount, uint32_t spawnedCount, double bridgeMilliseconds);
+    void AddUpdateSample(double milliseconds);
+    void AddRenderBuildSample(double milliseconds);
+    bool IsMeasuring() const { return m_isMeasuring; }
+
+    // Whole ramp without a window, renderer or V8
+    void RunHeadless(WorkerPool* workerPool);
+
+    bool Finish();          // Finds the first superlinear subsystem and writes the JSON and CSV
+
+    std::vector<uint32_t>           GetStepEntityCounts() const;
+    std::vector<sStressStep> const& GetSteps() const { return m_steps; }
+    sStressScenarioConfig const&    GetConfig() const { return m_config; }
+    std::string                     GetFirstSuperlinearSubsystem() const { return m_firstSuperlinearSubsystem; }     // Empty if none
+    uint32_t                        GetFirstSuperlinearEntityCount() const { return m_firstSuperlinearEntityCount; }
+    std::string                     ToReport() const;
+
+    static uint64_t GetProcessMemoryBytes();
+
+private:
+    void EndStep();
+    void FindFirstSuperlinear();
+
+    std::string ToJson() const;
+    std::string ToCsv() const;
+
+    sStressScenarioConfig    m_config;
+    std::vector<sStressStep> m_steps;
+    uint64_t                 m_baselineMemoryBytes = 0;
+
+    bool                m_isMeasuring = false;
+    sStressStep         m_currentStep;
+    std::vector<double> m_updateSamples;
+    std::vector<double> m_renderBuildSamples;
+
+    std::string m_firstSuperlinearSubsystem;
+    uint32_t    m_firstSuperlinearEntityCount = 0;
+    float       m_firstSuperlinearExponent    = 0.f;
+    std::string m_mode = "game";
+};
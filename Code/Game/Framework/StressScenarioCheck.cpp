@@ -0,0 +1,48 @@
+//----------------------------------------------------------------------------------------------------
+// StressScenarioCheck.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/HeadlessRunner.hpp"
+
+#include <chrono>
+#include <vector>
+
+#include "Engine/Core/StringUtils.hpp"
+#include "Game/Framework/WorkerPool.hpp"
+#include "Game/Framework/StressScenario.hpp"
+
+//----------------------------------------------------------------------------------------------------
+bool RunStressScenarioCheck(sHeadlessRunConfig const& config,
+                            WorkerPool&               workerPool)
+{
+    sStressScenarioConfig scenarioConfig = config.m_stressConfig;
+    scenarioConfig.m_maxEntityCount      = config.m_stressMaxEntityCount;
+
+    StressScenario scenario(scenarioConfig);
+
+    auto const start = std::chrono::steady_clock::now();
+    scenario.RunHeadless(&workerPool);
+    double const seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    bool const isWritten = scenario.Finish();
+
+    std::vector<uint32_t> const     entityCounts = scenario.GetStepEntityCounts();
+    std::vector<sStressStep> const& steps        = scenario.GetSteps();
+    bool                            isComplete   = steps.size() == entityCounts.size();
+
+    for (size_t stepIndex = 0; isComplete && stepIndex < steps.size(); ++stepIndex)
+    {
+        isComplete = steps[stepIndex].m_entityCount == entityCounts[stepIndex] && steps[stepIndex].m_renderBuildMilliseconds > 0.0;
+    }
+
+    String report = scenario.ToReport();
+    report += Stringf("total seconds    %.1f\n", seconds);
+    report += Stringf("json             %s%s\n", scenario.GetConfig().m_jsonPath.c_str(), isWritten ? "" : " (write FAILED)");
+    report += Stringf("csv              %s\n", scenario.GetConfig().m_csvPath.c_str());
+    report += Stringf("validation       %s\n", isWritten && isComplete ? "OK" : "FAILED");
+
+    WriteHeadlessReport(config.m_stressReportPath, report);
+
+    return isWritten && isComplete;
+}
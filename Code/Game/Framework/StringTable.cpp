@@ -0,0 +1,132 @@
+//----------------------------------------------------------------------------------------------------
+// StringTable.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/StringTable.hpp"
+
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+#include "Engine/Core/EngineCommon.hpp"
+
+//----------------------------------------------------------------------------------------------------
+struct sStringTableState
+{
+    std::shared_mutex                         m_mutex;
+    std::unordered_map<StringID, std::string> m_strings;      // Nodes never move, so string views stay valid
+    uint32_t                                  m_collisionCount = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Function-local so interning works from static initializers and before App startup.
+//
+static sStringTableState& GetState()
+{
+    static sStringTableState state;
+    return state;
+}
+
+//----------------------------------------------------------------------------------------------------
+static StringID GetNextProbeID(StringID const id)
+{
+    return id + 1 != INVALID_STRING_ID ? id + 1 : id + 2;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Walks the probe chain from the hash. Returns the string's ID, or INVALID_STRING_ID with out_freeID set
+// to where it would be inserted. The caller holds the lock.
+//
+static StringID ProbeLocked(sStringTableState const& state,
+                            std::string_view const   text,
+                            StringID&                out_freeID)
+{
+    StringID id = HashStringID(text);
+
+    for (auto it = state.m_strings.find(id); it != state.m_strings.end(); it = state.m_strings.find(id))
+    {
+        if (it->second == text)
+        {
+            return id;
+        }
+
+        id = GetNextProbeID(id);
+    }
+
+    out_freeID = id;
+    return INVALID_STRING_ID;
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC StringID StringTable::Intern(std::string_view const text)
+{
+    StringID const existingID = Find(text);
+
+    if (existingID != INVALID_STRING_ID)
+    {
+        return existingID;
+    }
+
+    sStringTableState&                  state = GetState();
+    std::unique_lock<std::shared_mutex> lock(state.m_mutex);
+
+    // Another thread may have added it between the two locks.
+    StringID       freeID = INVALID_STRING_ID;
+    StringID const id     = ProbeLocked(state, text, freeID);
+
+    if (id != INVALID_STRING_ID)
+    {
+        return id;
+    }
+
+    if (freeID != HashStringID(text))
+    {
+        ++state.m_collisionCount;
+    }
+
+    state.m_strings.emplace(freeID, std::string(text));
+
+    return freeID;
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC StringID StringTable::Find(std::string_view const text)
+{
+    sStringTableState&                  state = GetState();
+    std::shared_lock<std::shared_mutex> lock(state.m_mutex);
+
+    StringID freeID = INVALID_STRING_ID;
+
+    return ProbeLocked(state, text, freeID);
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC std::string_view StringTable::GetString(StringID const id)
+{
+    sStringTableState&                  state = GetState();
+    std::shared_lock<std::shared_mutex> lock(state.m_mutex);
+
+    auto const it = state.m_strings.find(id);
+
+    return it != state.m_strings.end() ? std::string_view(it->second) : std::string_view();
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC uint32_t StringTable::GetCount()
+{
+    sStringTableState&                  state = GetState();
+    std::shared_lock<std::shared_mutex> lock(state.m_mutex);
+
+    return static_cast<uint32_t>(state.m_strings.size());
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC uint32_t StringTable::GetCollisionCount()
+{
+    sStringTableState&                  state = GetState();
+    std::shared_lock<std::shared_mutex> lock(state.m_mutex);
+
+    return state.m_collisionCount;
+}
@@ -0,0 +1,60 @@
+//----------------------------------------------------------------------------------------------------
+// StringTable.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <string_view>
+
+//----------------------------------------------------------------------------------------------------
+using StringID = uint32_t;
+
+StringID constexpr INVALID_STRING_ID = 0;
+
+//----------------------------------------------------------------------------------------------------
+// 32-bit FNV-1a. Zero is reserved for INVALID_STRING_ID and maps to 1.
+//----------------------------------------------------------------------------------------------------
+constexpr StringID HashStringID(std::string_view const text)
+{
+    uint32_t hash = 2166136261u;
+
+    for (char const c : text)
+    {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 16777619u;
+    }
+
+    return hash != INVALID_STRING_ID ? hash : 1u;
+}
+
+//----------------------------------------------------------------------------------------------------
+// "createCube"_sid is hashed at compile time, so it can be a case label.
+//----------------------------------------------------------------------------------------------------
+consteval StringID operator""_sid(char const* const text, size_t const length)
+{
+    return HashStringID(std::string_view(text, length));
+}
+
+//----------------------------------------------------------------------------------------------------
+// Process-wide interned strings. Each distinct string gets one 32-bit ID that never changes and is the
+// same as its "..."_sid literal, so hot paths (script method dispatch, watched file lookups) can hash
+// once and then compare and key maps on the ID instead of on the text.
+//
+// Two strings with the same hash cannot share an ID: the later one is given the next free ID and counted
+// in GetCollisionCount(), and no longer matches its literal. Callers that switch on literals check
+// Intern(name) == HashStringID(name) when they register their names.
+//
+// Safe to call from any thread. Strings are never removed, so the views returned by GetString() stay valid
+// for the life of the process.
+//----------------------------------------------------------------------------------------------------
+class StringTable
+{
+public:
+    static StringID         Intern(std::string_view text);      // Adds the string on first use
+    static StringID         Find(std::string_view text);        // INVALID_STRING_ID if never interned
+    static std::string_view GetString(StringID id);             // Empty if unknown
+
+    static uint32_t GetCount();
+    static uint32_t GetCollisionCount();
+};
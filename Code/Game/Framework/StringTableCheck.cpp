@@ -0,0 +1,174 @@
+//----------------------------------------------------------------------------------------------------
+// StringTableCheck.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/HeadlessRunner.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "Engine/Core/StringUtils.hpp"
+#include "Game/Framework/StringTable.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// Same shape as GameScriptInterface::CallMethod before and after interning: a chain of string compares,
+// or one lookup and a switch on compile-time IDs.
+//
+static int DispatchByCompare(std::string const& name)
+{
+    if (name == "createCube") return 0;
+    if (name == "moveProp") return 1;
+    if (name == "getPlayerPosition") return 2;
+    if (name == "update") return 3;
+    if (name == "render") return 4;
+    if (name == "getRenderStats") return 5;
+    if (name == "getInputStats") return 6;
+    if (name == "getActionState") return 7;
+    return -1;
+}
+
+//----------------------------------------------------------------------------------------------------
+static int DispatchByID(std::string const& name)
+{
+    switch (StringTable::Find(name))
+    {
+    case "createCube"_sid:        return 0;
+    case "moveProp"_sid:          return 1;
+    case "getPlayerPosition"_sid: return 2;
+    case "update"_sid:            return 3;
+    case "render"_sid:            return 4;
+    case "getRenderStats"_sid:    return 5;
+    case "getInputStats"_sid:     return 6;
+    case "getActionState"_sid:    return 7;
+    default:                      return -1;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+bool RunStringTableCheck(sHeadlessRunConfig const& config)
+{
+    uint32_t const stringCount = config.m_stringCount;
+    uint32_t const threadCount = std::max(std::thread::hardware_concurrency(), 2u);
+
+    std::vector<std::string> strings;
+    strings.reserve(stringCount);
+
+    for (uint32_t index = 0; index < stringCount; ++index)
+    {
+        strings.push_back(Stringf("Data/Scripts/Generated/Module%u/File%u.js", index / 64, index));
+    }
+
+    uint32_t const collisionsBefore = StringTable::GetCollisionCount();
+    uint32_t const countBefore      = StringTable::GetCount();
+
+    // Every thread interns every string, each starting at a different offset so first-time inserts race.
+    std::vector<std::vector<StringID>> threadIDs(threadCount, std::vector<StringID>(stringCount));
+    std::vector<std::thread>           threads;
+
+    auto const internStart = std::chrono::steady_clock::now();
+
+    for (uint32_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+    {
+        threads.emplace_back([&, threadIndex]()
+        {
+            uint32_t const offset = static_cast<uint32_t>(static_cast<uint64_t>(stringCount) * threadIndex / threadCount);
+
+            for (uint32_t step = 0; step < stringCount; ++step)
+            {
+                uint32_t const index          = (offset + step) % stringCount;
+                threadIDs[threadIndex][index] = StringTable::Intern(strings[index]);
+            }
+        });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    double const internMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - internStart).count();
+
+    uint32_t disagreeCount = 0;
+    uint32_t roundTripFail = 0;
+    uint32_t probedCount   = 0;     // Strings whose ID is not their hash, because an earlier string had it
+
+    for (uint32_t index = 0; index < stringCount; ++index)
+    {
+        StringID const id = threadIDs[0][index];
+
+        for (uint32_t threadIndex = 1; threadIndex < threadCount; ++threadIndex)
+        {
+            disagreeCount += threadIDs[threadIndex][index] != id ? 1 : 0;
+        }
+
+        roundTripFail += StringTable::GetString(id) != strings[index] || StringTable::Find(strings[index]) != id ? 1 : 0;
+        probedCount   += id != HashStringID(strings[index]) ? 1 : 0;
+    }
+
+    uint32_t const addedCount     = StringTable::GetCount() - countBefore;
+    uint32_t const collisionCount = StringTable::GetCollisionCount() - collisionsBefore;
+
+    // Lookup cost: the same names (plus misses) through both dispatch styles.
+    char const* const lookupNames[] = {"createCube", "getActionState", "render", "getInputStats", "unknownMethod", "moveProp", "getRenderStats", "update"};
+    std::vector<std::string> lookups;
+
+    for (uint32_t index = 0; index < 1u << 16; ++index)
+    {
+        lookups.emplace_back(lookupNames[(index * 7u) % std::size(lookupNames)]);
+    }
+
+    for (char const* const name : lookupNames)
+    {
+        if (std::strcmp(name, "unknownMethod") != 0)
+        {
+            StringTable::Intern(name);
+        }
+    }
+
+    uint32_t const passCount      = 32;
+    uint32_t       dispatchErrors = 0;
+    int64_t        compareSum     = 0;
+    int64_t        idSum          = 0;
+
+    auto const compareStart = std::chrono::steady_clock::now();
+
+    for (uint32_t pass = 0; pass < passCount; ++pass)
+    {
+        for (std::string const& name : lookups) compareSum += DispatchByCompare(name);
+    }
+
+    auto const idStart = std::chrono::steady_clock::now();
+
+    for (uint32_t pass = 0; pass < passCount; ++pass)
+    {
+        for (std::string const& name : lookups) idSum += DispatchByID(name);
+    }
+
+    auto const idEnd = std::chrono::steady_clock::now();
+
+    for (std::string const& name : lookups)
+    {
+        dispatchErrors += DispatchByCompare(name) != DispatchByID(name) ? 1 : 0;
+    }
+
+    double const lookupCount  = static_cast<double>(lookups.size()) * passCount;
+    double const compareNanos = std::chrono::duration<double, std::nano>(idStart - compareStart).count() / lookupCount;
+    double const idNanos      = std::chrono::duration<double, std::nano>(idEnd - idStart).count() / lookupCount;
+    bool const   isValid      = disagreeCount == 0 && roundTripFail == 0 && addedCount == stringCount && probedCount == collisionCount &&
+                                dispatchErrors == 0 && compareSum == idSum;
+
+    String report = Stringf("String table: %u strings interned from %u threads\n", stringCount, threadCount);
+    report += Stringf("intern ms        %.3f (%.1f ns per call)\n", internMilliseconds, internMilliseconds * 1e6 / (static_cast<double>(stringCount) * threadCount));
+    report += Stringf("added            %u, %u hash collisions moved to a probed ID\n", addedCount, collisionCount);
+    report += Stringf("thread disagree  %u, round-trip failures %u\n", disagreeCount, roundTripFail);
+    report += Stringf("dispatch ns      compare chain %.1f, Find + switch %.1f (%u mismatches)\n", compareNanos, idNanos, dispatchErrors);
+    report += Stringf("validation       %s\n", isValid ? "OK" : "FAILED");
+
+    WriteHeadlessReport(config.m_stringReportPath, report);
+
+    return isValid;
+}
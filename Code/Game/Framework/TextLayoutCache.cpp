@@ -0,0 +1,240 @@
+//----------------------------------------------------------------------------------------------------
+// TextLayoutCache.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/TextLayoutCache.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include "Engine/Renderer/BitmapFont.hpp"
+
+//----------------------------------------------------------------------------------------------------
+static uint64_t constexpr FNV_OFFSET_BASIS = 14695981039346656037ull;
+static uint64_t constexpr FNV_PRIME        = 1099511628211ull;
+
+//----------------------------------------------------------------------------------------------------
+static uint64_t HashBytes(void const* data, size_t const byteCount, uint64_t hash)
+{
+    unsigned char const* bytes = static_cast<unsigned char const*>(data);
+
+    for (size_t i = 0; i < byteCount; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= FNV_PRIME;
+    }
+
+    return hash;
+}
+
+//----------------------------------------------------------------------------------------------------
+TextLayoutCache::TextLayoutCache(sTextLayoutCacheConfig const& config)
+    : m_config(config)
+{
+    m_arena.resize(m_config.m_arenaVertexCapacity);
+    m_stats.m_arenaBytes = m_arena.size() * sizeof(Vertex_PCU);
+}
+
+//----------------------------------------------------------------------------------------------------
+void TextLayoutCache::AddVertsForText2D(VertexList_PCU&    out_verts,
+                                        BitmapFont&        font,
+                                        Vec2 const&        position,
+                                        float const        cellHeight,
+                                        std::string const& text,
+                                        Rgba8 const&       tint,
+                                        float const        cellAspect,
+                                        Vec2 const&        alignment)
+{
+    if (text.empty())
+    {
+        return;
+    }
+
+    sEntry const* entry = FindOrAddEntry(font, cellHeight, text, cellAspect, alignment);
+
+    // Too large to cache: lay it out straight into the caller's list.
+    if (entry == nullptr)
+    {
+        float const width = font.GetTextWidth(cellHeight, text, cellAspect);
+        font.AddVertsForText2D(out_verts, position - Vec2(alignment.x * width, alignment.y * cellHeight), cellHeight, text, tint, cellAspect);
+        return;
+    }
+
+    Vec2 const offset = position - Vec2(alignment.x * entry->m_width, alignment.y * cellHeight);
+
+    out_verts.reserve(out_verts.size() + entry->m_vertexCount);
+
+    for (uint32_t i = 0; i < entry->m_vertexCount; ++i)
+    {
+        Vertex_PCU vertex = m_arena[entry->m_firstVertex + i];
+        vertex.m_position.x += offset.x;
+        vertex.m_position.y += offset.y;
+        vertex.m_color = tint;
+        out_verts.push_back(vertex);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void TextLayoutCache::Clear()
+{
+    m_entries.clear();
+    m_entriesByHash.clear();
+    m_arenaTop = 0;
+
+    m_stats.m_entryCount      = 0;
+    m_stats.m_usedVertexCount = 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+TextLayoutCache::sEntry const* TextLayoutCache::FindOrAddEntry(BitmapFont&        font,
+                                                               float const        cellHeight,
+                                                               std::string const& text,
+                                                               float const        cellAspect,
+                                                               Vec2 const&        alignment)
+{
+    BitmapFont const* const fontKey = &font;
+
+    uint64_t hash = HashBytes(text.data(), text.size(), FNV_OFFSET_BASIS);
+    hash          = HashBytes(&fontKey, sizeof(fontKey), hash);
+    hash          = HashBytes(&cellHeight, sizeof(cellHeight), hash);
+    hash          = HashBytes(&cellAspect, sizeof(cellAspect), hash);
+    hash          = HashBytes(&alignment.x, sizeof(alignment.x), hash);
+    hash          = HashBytes(&alignment.y, sizeof(alignment.y), hash);
+
+    auto const found = m_entriesByHash.find(hash);
+
+    if (found != m_entriesByHash.end())
+    {
+        sEntry const& entry = *found->second;
+
+        if (entry.m_font == fontKey && entry.m_cellHeight == cellHeight && entry.m_cellAspect == cellAspect &&
+            entry.m_alignment.x == alignment.x && entry.m_alignment.y == alignment.y && entry.m_text == text)
+        {
+            ++m_stats.m_hitCount;
+            m_entries.splice(m_entries.begin(), m_entries, found->second);
+            return &m_entries.front();
+        }
+
+        // Hash collision: the newcomer replaces the old entry.
+        m_stats.m_usedVertexCount -= entry.m_vertexCount;
+        m_entries.erase(found->second);
+        m_entriesByHash.erase(found);
+    }
+
+    ++m_stats.m_missCount;
+
+    m_scratch.clear();
+    font.AddVertsForText2D(m_scratch, Vec2::ZERO, cellHeight, text, Rgba8::WHITE, cellAspect);
+
+    uint32_t const vertexCount = static_cast<uint32_t>(m_scratch.size());
+
+    while (!m_entries.empty() && m_entries.size() >= m_config.m_maxEntryCount)
+    {
+        EvictLeastRecentlyUsed();
+    }
+
+    if (m_config.m_maxEntryCount == 0 || !Reserve(vertexCount))
+    {
+        m_stats.m_entryCount = static_cast<uint32_t>(m_entries.size());
+        return nullptr;
+    }
+
+    std::copy(m_scratch.begin(), m_scratch.end(), m_arena.begin() + m_arenaTop);
+
+    sEntry entry;
+    entry.m_font        = fontKey;
+    entry.m_text        = text;
+    entry.m_cellHeight  = cellHeight;
+    entry.m_cellAspect  = cellAspect;
+    entry.m_alignment   = alignment;
+    entry.m_hash        = hash;
+    entry.m_firstVertex = m_arenaTop;
+    entry.m_vertexCount = vertexCount;
+    entry.m_width       = font.GetTextWidth(cellHeight, text, cellAspect);
+
+    m_arenaTop += vertexCount;
+    m_entries.push_front(std::move(entry));
+    m_entriesByHash[hash] = m_entries.begin();
+
+    m_stats.m_usedVertexCount += vertexCount;
+    m_stats.m_entryCount = static_cast<uint32_t>(m_entries.size());
+
+    return &m_entries.front();
+}
+
+//----------------------------------------------------------------------------------------------------
+// Makes room for vertexCount vertices at m_arenaTop, evicting and compacting as needed.
+//
+bool TextLayoutCache::Reserve(uint32_t const vertexCount)
+{
+    uint32_t const capacity = static_cast<uint32_t>(m_arena.size());
+
+    if (vertexCount > capacity)
+    {
+        return false;
+    }
+
+    while (m_arenaTop + vertexCount > capacity)
+    {
+        if (m_stats.m_usedVertexCount + vertexCount <= capacity)
+        {
+            CompactArena();
+        }
+        else
+        {
+            EvictLeastRecentlyUsed();
+        }
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void TextLayoutCache::EvictLeastRecentlyUsed()
+{
+    sEntry const& entry = m_entries.back();
+
+    m_stats.m_usedVertexCount -= entry.m_vertexCount;
+    ++m_stats.m_evictionCount;
+
+    m_entriesByHash.erase(entry.m_hash);
+    m_entries.pop_back();
+
+    if (m_entries.empty())
+    {
+        m_arenaTop = 0;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Slides every live run down in arena order, so each copy moves towards the front and never overlaps a
+// run that has not been moved yet.
+//
+void TextLayoutCache::CompactArena()
+{
+    std::vector<sEntry*> entries;
+    entries.reserve(m_entries.size());
+
+    for (sEntry& entry : m_entries)
+    {
+        entries.push_back(&entry);
+    }
+
+    std::sort(entries.begin(), entries.end(), [](sEntry const* a, sEntry const* b) { return a->m_firstVertex < b->m_firstVertex; });
+
+    uint32_t cursor = 0;
+
+    for (sEntry* entry : entries)
+    {
+        if (entry->m_firstVertex != cursor)
+        {
+            std::copy(m_arena.begin() + entry->m_firstVertex, m_arena.begin() + entry->m_firstVertex + entry->m_vertexCount, m_arena.begin() + cursor);
+            entry->m_firstVertex = cursor;
+        }
+
+        cursor += entry->m_vertexCount;
+    }
+
+    m_arenaTop = cursor;
+}
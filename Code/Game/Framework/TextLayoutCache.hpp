@@ -0,0 +1,91 @@
+//----------------------------------------------------------------------------------------------------
+// TextLayoutCache.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Math/Vec2.hpp"
+#include "Engine/Renderer/VertexUtils.hpp"
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class BitmapFont;
+
+//----------------------------------------------------------------------------------------------------
+struct sTextLayoutCacheConfig
+{
+    uint32_t m_arenaVertexCapacity = 64 * 1024;     // ~1.5 MB of Vertex_PCU shared by all cached strings
+    uint32_t m_maxEntryCount       = 4096;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sTextLayoutCacheStats
+{
+    uint64_t m_hitCount        = 0;
+    uint64_t m_missCount       = 0;
+    uint64_t m_evictionCount   = 0;
+    uint32_t m_entryCount      = 0;
+    uint32_t m_usedVertexCount = 0;
+    size_t   m_arenaBytes      = 0;
+
+    float GetHitRate() const { return m_hitCount + m_missCount > 0 ? static_cast<float>(m_hitCount) / static_cast<float>(m_hitCount + m_missCount) : 0.f; }
+};
+
+//----------------------------------------------------------------------------------------------------
+// Glyph quads for strings that are drawn again and again (overlay labels, console lines), laid out once
+// by BitmapFont and then copied out of a shared vertex arena.
+//
+// Entries are keyed by font, FNV-1a hash of the text, cell height, cell aspect and alignment. Layouts are
+// stored at the origin in white; AddVertsForText2D() translates and tints them on the way out, so moving
+// or recoloring a string still hits. When the arena or the entry budget runs out, least recently used
+// entries are evicted and the survivors are compacted to the front of the arena.
+//
+// Main thread only.
+//----------------------------------------------------------------------------------------------------
+class TextLayoutCache
+{
+public:
+    explicit TextLayoutCache(sTextLayoutCacheConfig const& config);
+
+    // alignment (0,0) puts the text's bottom-left at position, (1,1) its top-right
+    void AddVertsForText2D(VertexList_PCU& out_verts, BitmapFont& font, Vec2 const& position, float cellHeight, std::string const& text,
+                           Rgba8 const& tint = Rgba8::WHITE, float cellAspect = 1.f, Vec2 const& alignment = Vec2::ZERO);
+
+    void Clear();
+
+    sTextLayoutCacheStats const& GetStats() const { return m_stats; }
+
+private:
+    struct sEntry
+    {
+        BitmapFont const* m_font = nullptr;
+        std::string       m_text;
+        float             m_cellHeight = 0.f;
+        float             m_cellAspect = 0.f;
+        Vec2              m_alignment;
+        uint64_t          m_hash        = 0;
+        uint32_t          m_firstVertex = 0;     // Into m_arena
+        uint32_t          m_vertexCount = 0;
+        float             m_width       = 0.f;
+    };
+
+    using EntryList = std::list<sEntry>;        // Front = most recently used
+
+    sEntry const* FindOrAddEntry(BitmapFont& font, float cellHeight, std::string const& text, float cellAspect, Vec2 const& alignment);
+    bool          Reserve(uint32_t vertexCount);
+    void          EvictLeastRecentlyUsed();
+    void          CompactArena();
+
+    sTextLayoutCacheConfig                            m_config;
+    VertexList_PCU                                    m_arena;
+    uint32_t                                          m_arenaTop = 0;     // Everything from here up is free
+    EntryList                                         m_entries;
+    std::unordered_map<uint64_t, EntryList::iterator> m_entriesByHash;
+    VertexList_PCU                                    m_scratch;
+    sTextLayoutCacheStats                             m_stats;
+};
@@ -0,0 +1,332 @@
+//----------------------------------------------------------------------------------------------------
+// TextureAtlas.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/TextureAtlas.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <climits>
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Game/Framework/WorkerPool.hpp"
+#include "ThirdParty/stb/stb_image.h"
+
+//----------------------------------------------------------------------------------------------------
+TextureAtlas::TextureAtlas(sTextureAtlasConfig const& config)
+    : m_config(config)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+int TextureAtlas::AddTexture(sSoftwareTexture const& texture)
+{
+    m_inputs.push_back(texture);
+
+    return static_cast<int>(m_inputs.size()) - 1;
+}
+
+//----------------------------------------------------------------------------------------------------
+void TextureAtlas::Build()
+{
+    auto const startTime = std::chrono::steady_clock::now();
+
+    m_regions.assign(m_inputs.size(), sAtlasRegion());
+    m_isPacked.assign(m_inputs.size(), false);
+    m_pages.clear();
+    m_packedTexelCount = 0;
+
+    IntVec2 const pageDimensions = m_config.m_pageDimensions;
+    int const     padding        = m_config.m_padding;
+
+    std::vector<int> order;
+
+    for (int index = 0; index < static_cast<int>(m_inputs.size()); ++index)
+    {
+        IntVec2 const dimensions = m_inputs[index].m_dimensions;
+
+        bool const isSmall = dimensions.x > 0 && dimensions.y > 0 && dimensions.x <= m_config.m_maxInputSize && dimensions.y <= m_config.m_maxInputSize;
+        bool const isFit   = dimensions.x + 2 * padding <= pageDimensions.x && dimensions.y + 2 * padding <= pageDimensions.y;
+
+        if (isSmall && isFit)
+        {
+            order.push_back(index);
+        }
+    }
+
+    // Tallest first keeps the skyline flat; the index tie-break makes the order (and layout) deterministic.
+    std::sort(order.begin(), order.end(), [this](int const a, int const b)
+    {
+        IntVec2 const sizeA = m_inputs[a].m_dimensions;
+        IntVec2 const sizeB = m_inputs[b].m_dimensions;
+
+        if (sizeA.y != sizeB.y) return sizeA.y > sizeB.y;
+        if (sizeA.x != sizeB.x) return sizeA.x > sizeB.x;
+        return a < b;
+    });
+
+    std::vector<std::vector<sSkylineNode>> skylines;
+
+    for (int const index : order)
+    {
+        IntVec2 const dimensions = m_inputs[index].m_dimensions;
+        IntVec2 const paddedSize(dimensions.x + 2 * padding, dimensions.y + 2 * padding);
+
+        uint32_t pageIndex = 0;
+        int      x         = 0;
+        int      y         = 0;
+
+        while (pageIndex < skylines.size() && !FindPosition(skylines[pageIndex], paddedSize, x, y))
+        {
+            ++pageIndex;
+        }
+
+        if (pageIndex == skylines.size())
+        {
+            skylines.push_back({sSkylineNode{0, 0, pageDimensions.x}});
+            x = 0;
+            y = 0;
+        }
+
+        AddSkylineLevel(skylines[pageIndex], x, y, paddedSize);
+
+        sAtlasRegion& region = m_regions[index];
+        region.m_pageIndex   = pageIndex;
+        region.m_texelMins   = IntVec2(x + padding, y + padding);
+        region.m_dimensions  = dimensions;
+
+        // Row 0 is the top of the page (v = 1).
+        float const width  = static_cast<float>(pageDimensions.x);
+        float const height = static_cast<float>(pageDimensions.y);
+
+        region.m_uvBounds = AABB2(Vec2(static_cast<float>(region.m_texelMins.x) / width, 1.f - static_cast<float>(region.m_texelMins.y + dimensions.y) / height),
+                                  Vec2(static_cast<float>(region.m_texelMins.x + dimensions.x) / width, 1.f - static_cast<float>(region.m_texelMins.y) / height));
+
+        m_isPacked[index] = true;
+        m_packedTexelCount += static_cast<uint64_t>(paddedSize.x) * paddedSize.y;
+    }
+
+    m_pages.resize(skylines.size());
+
+    for (sSoftwareTexture& page : m_pages)
+    {
+        page.m_dimensions = pageDimensions;
+        page.m_texels.assign(static_cast<size_t>(pageDimensions.x) * pageDimensions.y, Rgba8(0, 0, 0, 0));
+    }
+
+    // Regions (gutters included) never overlap, so every copy can run on its own worker.
+    if (m_config.m_workerPool != nullptr)
+    {
+        m_config.m_workerPool->ParallelFor(static_cast<uint32_t>(order.size()), [this, &order](uint32_t const job, uint32_t)
+        {
+            CopyRegion(order[job]);
+        });
+    }
+    else
+    {
+        for (int const index : order)
+        {
+            CopyRegion(index);
+        }
+    }
+
+    m_buildMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+//----------------------------------------------------------------------------------------------------
+bool TextureAtlas::IsPacked(int const index) const
+{
+    return index >= 0 && index < static_cast<int>(m_isPacked.size()) && m_isPacked[index];
+}
+
+//----------------------------------------------------------------------------------------------------
+sAtlasRegion const& TextureAtlas::GetRegion(int const index) const
+{
+    return m_regions[index];
+}
+
+//----------------------------------------------------------------------------------------------------
+float TextureAtlas::GetOccupancy() const
+{
+    if (m_pages.empty())
+    {
+        return 0.f;
+    }
+
+    double const pageTexelCount = static_cast<double>(m_config.m_pageDimensions.x) * m_config.m_pageDimensions.y * static_cast<double>(m_pages.size());
+
+    return static_cast<float>(static_cast<double>(m_packedTexelCount) / pageTexelCount);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Maps [0,1] UVs into the region. Returns false (leaving the vertexes untouched) when any UV is
+// outside [0,1], since that mesh relies on wrapping and cannot be drawn from an atlas.
+//
+STATIC bool TextureAtlas::RemapUVs(VertexList_PCU& vertexes,
+                                   AABB2 const&    uvBounds)
+{
+    for (Vertex_PCU const& vertex : vertexes)
+    {
+        if (vertex.m_uvTexCoords.x < 0.f || vertex.m_uvTexCoords.x > 1.f || vertex.m_uvTexCoords.y < 0.f || vertex.m_uvTexCoords.y > 1.f)
+        {
+            return false;
+        }
+    }
+
+    Vec2 const size(uvBounds.m_maxs.x - uvBounds.m_mins.x, uvBounds.m_maxs.y - uvBounds.m_mins.y);
+
+    for (Vertex_PCU& vertex : vertexes)
+    {
+        vertex.m_uvTexCoords.x = uvBounds.m_mins.x + vertex.m_uvTexCoords.x * size.x;
+        vertex.m_uvTexCoords.y = uvBounds.m_mins.y + vertex.m_uvTexCoords.y * size.y;
+    }
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Decodes PNG/JPG/TGA into RGBA texels, top row first like sSoftwareTexture.
+//
+STATIC bool TextureAtlas::LoadImageFile(std::string const& filePath,
+                                        sSoftwareTexture&  out_texture)
+{
+    int width          = 0;
+    int height         = 0;
+    int channelsInFile = 0;
+
+    stbi_set_flip_vertically_on_load(0);
+
+    unsigned char* data = stbi_load(filePath.c_str(), &width, &height, &channelsInFile, 4);
+
+    if (data == nullptr)
+    {
+        return false;
+    }
+
+    out_texture.m_dimensions = IntVec2(width, height);
+    out_texture.m_texels.resize(static_cast<size_t>(width) * height);
+
+    for (size_t i = 0; i < out_texture.m_texels.size(); ++i)
+    {
+        out_texture.m_texels[i] = Rgba8(data[i * 4 + 0], data[i * 4 + 1], data[i * 4 + 2], data[i * 4 + 3]);
+    }
+
+    stbi_image_free(data);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Lowest resulting top edge wins, then the leftmost position ("bottom-left" with y growing downwards).
+//
+bool TextureAtlas::FindPosition(std::vector<sSkylineNode> const& skyline,
+                                IntVec2 const&                   size,
+                                int&                             out_x,
+                                int&                             out_y) const
+{
+    int  bestBottom = INT_MAX;
+    bool isFound    = false;
+
+    for (size_t first = 0; first < skyline.size(); ++first)
+    {
+        int const x = skyline[first].m_x;
+
+        if (x + size.x > m_config.m_pageDimensions.x)
+        {
+            break;
+        }
+
+        int y            = 0;
+        int coveredWidth = 0;
+
+        for (size_t node = first; node < skyline.size() && coveredWidth < size.x; ++node)
+        {
+            y = std::max(y, skyline[node].m_y);
+            coveredWidth += skyline[node].m_width;
+        }
+
+        if (y + size.y > m_config.m_pageDimensions.y || y + size.y >= bestBottom)
+        {
+            continue;
+        }
+
+        bestBottom = y + size.y;
+        out_x      = x;
+        out_y      = y;
+        isFound    = true;
+    }
+
+    return isFound;
+}
+
+//----------------------------------------------------------------------------------------------------
+void TextureAtlas::AddSkylineLevel(std::vector<sSkylineNode>& skyline,
+                                   int const                  x,
+                                   int const                  y,
+                                   IntVec2 const&             size) const
+{
+    size_t index = 0;
+
+    while (index < skyline.size() && skyline[index].m_x < x)
+    {
+        ++index;
+    }
+
+    skyline.insert(skyline.begin() + static_cast<std::ptrdiff_t>(index), sSkylineNode{x, y + size.y, size.x});
+
+    // Trim the segments the new one now covers.
+    int const newEnd = x + size.x;
+    size_t    next   = index + 1;
+
+    while (next < skyline.size() && skyline[next].m_x < newEnd)
+    {
+        sSkylineNode& node    = skyline[next];
+        int const     nodeEnd = node.m_x + node.m_width;
+
+        if (nodeEnd <= newEnd)
+        {
+            skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(next));
+            continue;
+        }
+
+        node.m_width = nodeEnd - newEnd;
+        node.m_x     = newEnd;
+        break;
+    }
+
+    for (size_t i = 0; i + 1 < skyline.size();)
+    {
+        if (skyline[i].m_y == skyline[i + 1].m_y)
+        {
+            skyline[i].m_width += skyline[i + 1].m_width;
+            skyline.erase(skyline.begin() + static_cast<std::ptrdiff_t>(i + 1));
+        }
+        else
+        {
+            ++i;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void TextureAtlas::CopyRegion(int const index)
+{
+    sSoftwareTexture const& source  = m_inputs[index];
+    sAtlasRegion const&     region  = m_regions[index];
+    sSoftwareTexture&       page    = m_pages[region.m_pageIndex];
+    int const               padding = m_config.m_padding;
+
+    for (int y = -padding; y < region.m_dimensions.y + padding; ++y)
+    {
+        int const sourceY = std::clamp(y, 0, region.m_dimensions.y - 1);
+        Rgba8*    row     = &page.m_texels[static_cast<size_t>(region.m_texelMins.y + y) * page.m_dimensions.x];
+
+        for (int x = -padding; x < region.m_dimensions.x + padding; ++x)
+        {
+            int const sourceX = std::clamp(x, 0, region.m_dimensions.x - 1);
+
+            row[region.m_texelMins.x + x] = source.m_texels[static_cast<size_t>(sourceY) * source.m_dimensions.x + sourceX];
+        }
+    }
+}
@@ -0,0 +1,85 @@
+//----------------------------------------------------------------------------------------------------
+// TextureAtlas.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/IntVec2.hpp"
+#include "Engine/Renderer/VertexUtils.hpp"
+#include "Game/Framework/SoftwareRenderer.hpp"
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class WorkerPool;
+
+//----------------------------------------------------------------------------------------------------
+struct sTextureAtlasConfig
+{
+    IntVec2     m_pageDimensions = IntVec2(2048, 2048);
+    int         m_padding        = 2;           // Edge-extended gutter around every region, in texels
+    int         m_maxInputSize   = 512;         // Larger textures are left out of the atlas
+    WorkerPool* m_workerPool     = nullptr;     // nullptr copies texels on the calling thread
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sAtlasRegion
+{
+    uint32_t m_pageIndex = 0;
+    IntVec2  m_texelMins;                       // Top-left texel of the region (row 0 at the top)
+    IntVec2  m_dimensions;
+    AABB2    m_uvBounds;                        // Where the source texture's [0,1] UVs land on the page
+};
+
+//----------------------------------------------------------------------------------------------------
+// Packs small textures into shared pages so props with different textures can be drawn with one bind.
+//
+// Build() places regions with a skyline bottom-left packer, tallest textures first; ties are broken by
+// width and then by AddTexture order, so the same inputs always give the same layout. Placement runs
+// on the calling thread (it is cheap and inherently serial); the texel copies, one job per region, run
+// on the WorkerPool. Each region is surrounded by a gutter that repeats its edge texels, so bilinear
+// filtering and UVs that land exactly on a region edge never pick up a neighbour.
+//
+// Atlased textures cannot wrap: RemapUVs() only accepts meshes whose UVs stay inside [0,1].
+//----------------------------------------------------------------------------------------------------
+class TextureAtlas
+{
+public:
+    explicit TextureAtlas(sTextureAtlasConfig const& config);
+
+    int  AddTexture(sSoftwareTexture const& texture);       // Returns the input index; texels are copied
+    void Build();
+
+    bool                    IsPacked(int index) const;
+    sAtlasRegion const&     GetRegion(int index) const;
+    uint32_t                GetPageCount() const { return static_cast<uint32_t>(m_pages.size()); }
+    sSoftwareTexture const& GetPage(uint32_t pageIndex) const { return m_pages[pageIndex]; }
+    float                   GetOccupancy() const;           // Packed texels (with gutters) / page texels
+    double                  GetBuildMilliseconds() const { return m_buildMilliseconds; }
+
+    static bool RemapUVs(VertexList_PCU& vertexes, AABB2 const& uvBounds);
+    static bool LoadImageFile(std::string const& filePath, sSoftwareTexture& out_texture);
+
+private:
+    struct sSkylineNode
+    {
+        int m_x;
+        int m_y;                                // Top of the filled area under this segment
+        int m_width;
+    };
+
+    bool FindPosition(std::vector<sSkylineNode> const& skyline, IntVec2 const& size, int& out_x, int& out_y) const;
+    void AddSkylineLevel(std::vector<sSkylineNode>& skyline, int x, int y, IntVec2 const& size) const;
+    void CopyRegion(int index);
+
+    sTextureAtlasConfig            m_config;
+    std::vector<sSoftwareTexture>  m_inputs;
+    std::vector<sAtlasRegion>      m_regions;
+    std::vector<bool>              m_isPacked;
+    std::vector<sSoftwareTexture>  m_pages;
+    uint64_t                       m_packedTexelCount  = 0;
+    double                         m_buildMilliseconds = 0.0;
+};
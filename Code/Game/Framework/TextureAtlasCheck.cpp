@@ -0,0 +1,142 @@
+//----------------------------------------------------------------------------------------------------
+// TextureAtlasCheck.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/HeadlessRunner.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Math/RandomNumberGenerator.hpp"
+#include "Game/Framework/TextureAtlas.hpp"
+#include "Game/Framework/WorkerPool.hpp"
+
+//----------------------------------------------------------------------------------------------------
+bool RunTextureAtlasCheck(sHeadlessRunConfig const& config,
+                          WorkerPool&               workerPool)
+{
+    // Every texel encodes its texture index and coordinates, so any misplaced copy shows up.
+    RandomNumberGenerator         rng;
+    std::vector<sSoftwareTexture> textures(config.m_atlasTextureCount);
+
+    for (uint32_t index = 0; index < static_cast<uint32_t>(textures.size()); ++index)
+    {
+        sSoftwareTexture& texture = textures[index];
+        texture.m_dimensions      = IntVec2(rng.RollRandomIntInRange(4, 256), rng.RollRandomIntInRange(4, 256));
+        texture.m_texels.resize(static_cast<size_t>(texture.m_dimensions.x) * texture.m_dimensions.y);
+
+        for (int y = 0; y < texture.m_dimensions.y; ++y)
+        {
+            for (int x = 0; x < texture.m_dimensions.x; ++x)
+            {
+                texture.m_texels[static_cast<size_t>(y) * texture.m_dimensions.x + x] =
+                    Rgba8(static_cast<unsigned char>(index), static_cast<unsigned char>(index >> 8), static_cast<unsigned char>(x), static_cast<unsigned char>(y));
+            }
+        }
+    }
+
+    sTextureAtlasConfig serialConfig;
+    sTextureAtlasConfig parallelConfig;
+    parallelConfig.m_workerPool = &workerPool;
+
+    TextureAtlas serialAtlas(serialConfig);
+    TextureAtlas parallelAtlas(parallelConfig);
+
+    for (sSoftwareTexture const& texture : textures)
+    {
+        serialAtlas.AddTexture(texture);
+        parallelAtlas.AddTexture(texture);
+    }
+
+    serialAtlas.Build();
+    parallelAtlas.Build();
+
+    // Same inputs must give the same layout and pages regardless of threading.
+    bool isDeterministic = serialAtlas.GetPageCount() == parallelAtlas.GetPageCount();
+
+    for (uint32_t page = 0; page < serialAtlas.GetPageCount() && isDeterministic; ++page)
+    {
+        std::vector<Rgba8> const& serialTexels   = serialAtlas.GetPage(page).m_texels;
+        std::vector<Rgba8> const& parallelTexels = parallelAtlas.GetPage(page).m_texels;
+
+        isDeterministic = std::equal(serialTexels.begin(), serialTexels.end(), parallelTexels.begin(), parallelTexels.end(), [](Rgba8 const& a, Rgba8 const& b)
+        {
+            return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a;
+        });
+    }
+
+    int const padding       = serialConfig.m_padding;
+    uint32_t  packedCount   = 0;
+    uint64_t  overlapCount  = 0;
+    uint64_t  mismatchCount = 0;
+
+    for (int index = 0; index < static_cast<int>(textures.size()); ++index)
+    {
+        if (!parallelAtlas.IsPacked(index))
+        {
+            continue;
+        }
+
+        ++packedCount;
+
+        sAtlasRegion const& region = parallelAtlas.GetRegion(index);
+        sAtlasRegion const& other  = serialAtlas.GetRegion(index);
+
+        isDeterministic = isDeterministic && serialAtlas.IsPacked(index) && region.m_pageIndex == other.m_pageIndex &&
+                          region.m_texelMins.x == other.m_texelMins.x && region.m_texelMins.y == other.m_texelMins.y;
+
+        for (int otherIndex = index + 1; otherIndex < static_cast<int>(textures.size()); ++otherIndex)
+        {
+            if (!parallelAtlas.IsPacked(otherIndex) || parallelAtlas.GetRegion(otherIndex).m_pageIndex != region.m_pageIndex)
+            {
+                continue;
+            }
+
+            sAtlasRegion const& b = parallelAtlas.GetRegion(otherIndex);
+
+            bool const isSeparate = region.m_texelMins.x + region.m_dimensions.x + padding <= b.m_texelMins.x - padding ||
+                                    b.m_texelMins.x + b.m_dimensions.x + padding <= region.m_texelMins.x - padding ||
+                                    region.m_texelMins.y + region.m_dimensions.y + padding <= b.m_texelMins.y - padding ||
+                                    b.m_texelMins.y + b.m_dimensions.y + padding <= region.m_texelMins.y - padding;
+
+            overlapCount += isSeparate ? 0 : 1;
+        }
+
+        // Sample each texel center (and the gutter ring) through the remapped UVs.
+        sSoftwareTexture const& source = textures[index];
+        sSoftwareTexture const& page   = parallelAtlas.GetPage(region.m_pageIndex);
+        AABB2 const&            uvs    = region.m_uvBounds;
+
+        for (int y = -padding; y < source.m_dimensions.y + padding; ++y)
+        {
+            for (int x = -padding; x < source.m_dimensions.x + padding; ++x)
+            {
+                float const u = uvs.m_mins.x + (static_cast<float>(x) + 0.5f) / static_cast<float>(source.m_dimensions.x) * (uvs.m_maxs.x - uvs.m_mins.x);
+                float const v = uvs.m_maxs.y - (static_cast<float>(y) + 0.5f) / static_cast<float>(source.m_dimensions.y) * (uvs.m_maxs.y - uvs.m_mins.y);
+
+                int const pageX = static_cast<int>(u * static_cast<float>(page.m_dimensions.x));
+                int const pageY = static_cast<int>((1.f - v) * static_cast<float>(page.m_dimensions.y));
+
+                Rgba8 const& expected = source.m_texels[static_cast<size_t>(std::clamp(y, 0, source.m_dimensions.y - 1)) * source.m_dimensions.x +
+                                                        std::clamp(x, 0, source.m_dimensions.x - 1)];
+                Rgba8 const& actual   = page.m_texels[static_cast<size_t>(pageY) * page.m_dimensions.x + pageX];
+
+                mismatchCount += expected.r == actual.r && expected.g == actual.g && expected.b == actual.b && expected.a == actual.a ? 0 : 1;
+            }
+        }
+    }
+
+    String report = Stringf("Texture atlas: %u textures (4-256 texels per side), %dx%d pages, %d texel gutter, %u workers\n",
+                            config.m_atlasTextureCount, serialConfig.m_pageDimensions.x, serialConfig.m_pageDimensions.y, padding, workerPool.GetWorkerCount());
+    report += Stringf("packed           %8u  (%u pages, %.1f %% occupancy)\n", packedCount, parallelAtlas.GetPageCount(), 100.f * parallelAtlas.GetOccupancy());
+    report += Stringf("single-threaded  %8.3f ms\n", serialAtlas.GetBuildMilliseconds());
+    report += Stringf("worker pool      %8.3f ms\n", parallelAtlas.GetBuildMilliseconds());
+    report += Stringf("validation       %s (%s, %llu overlaps, %llu texel mismatches)\n", isDeterministic && overlapCount == 0 && mismatchCount == 0 ? "OK" : "FAILED",
+                      isDeterministic ? "deterministic" : "LAYOUT DIFFERS", static_cast<unsigned long long>(overlapCount), static_cast<unsigned long long>(mismatchCount));
+
+    WriteHeadlessReport(config.m_atlasReportPath, report);
+
+    return isDeterministic && overlapCount == 0 && mismatchCount == 0;
+}
@@ -0,0 +1,168 @@
+//----------------------------------------------------------------------------------------------------
+// WorkerPool.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/WorkerPool.hpp"
+
+#include <algorithm>
+
+#include "Engine/Core/EngineCommon.hpp"
+
+//----------------------------------------------------------------------------------------------------
+WorkerPool::WorkerPool(uint32_t const threadCount)
+{
+    StartThreads(ResolveThreadCount(threadCount));
+}
+
+//----------------------------------------------------------------------------------------------------
+WorkerPool::~WorkerPool()
+{
+    StopThreads();
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC uint32_t WorkerPool::ResolveThreadCount(uint32_t const threadCount)
+{
+    if (threadCount != 0)
+    {
+        return threadCount;
+    }
+
+    uint32_t const hardwareThreads = std::thread::hardware_concurrency();
+
+    return hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+void WorkerPool::StartThreads(uint32_t const threadCount)
+{
+    m_threads.reserve(threadCount);
+
+    for (uint32_t i = 0; i < threadCount; ++i)
+    {
+        // Worker index 0 is reserved for the thread calling ParallelFor. New threads start at the current
+        // generation so a pool resized after earlier jobs does not rerun the last one.
+        m_threads.emplace_back(&WorkerPool::WorkerThreadMain, this, i + 1, m_jobGeneration);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void WorkerPool::StopThreads()
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_isQuitting = true;
+    }
+
+    m_wakeCondition.notify_all();
+
+    for (std::thread& thread : m_threads)
+    {
+        if (thread.joinable())
+        {
+            thread.join();
+        }
+    }
+
+    m_threads.clear();
+    m_isQuitting = false;
+}
+
+//----------------------------------------------------------------------------------------------------
+void WorkerPool::Resize(uint32_t const threadCount)
+{
+    uint32_t const resolvedCount = ResolveThreadCount(threadCount);
+
+    if (resolvedCount == GetThreadCount())
+    {
+        return;
+    }
+
+    StopThreads();
+    StartThreads(resolvedCount);
+}
+
+//----------------------------------------------------------------------------------------------------
+void WorkerPool::ParallelFor(uint32_t const            count,
+                             ParallelForFunction const& function)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    // Not worth waking anyone for a single item.
+    if (m_threads.empty() || count == 1)
+    {
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            function(i, 0);
+        }
+
+        return;
+    }
+
+    {
+        std::lock_guard lock(m_mutex);
+        m_function      = &function;
+        m_jobCount      = count;
+        m_activeWorkers = static_cast<uint32_t>(m_threads.size());
+        m_nextIndex.store(0, std::memory_order_relaxed);
+        ++m_jobGeneration;
+    }
+
+    m_wakeCondition.notify_all();
+
+    RunJobIndices(0);
+
+    std::unique_lock lock(m_mutex);
+    m_doneCondition.wait(lock, [this] { return m_activeWorkers == 0; });
+    m_function = nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------
+void WorkerPool::WorkerThreadMain(uint32_t const workerIndex,
+                                  uint64_t       seenGeneration)
+{
+    while (true)
+    {
+        {
+            std::unique_lock lock(m_mutex);
+            m_wakeCondition.wait(lock, [this, seenGeneration] { return m_isQuitting || m_jobGeneration != seenGeneration; });
+
+            if (m_isQuitting)
+            {
+                return;
+            }
+
+            seenGeneration = m_jobGeneration;
+        }
+
+        RunJobIndices(workerIndex);
+
+        {
+            std::lock_guard lock(m_mutex);
+            --m_activeWorkers;
+        }
+
+        m_doneCondition.notify_one();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void WorkerPool::RunJobIndices(uint32_t const workerIndex)
+{
+    // Indices are claimed one at a time so uneven jobs (e.g. worlds with different prop counts) balance.
+    while (true)
+    {
+        uint32_t const index = m_nextIndex.fetch_add(1, std::memory_order_relaxed);
+
+        if (index >= m_jobCount)
+        {
+            return;
+        }
+
+        (*m_function)(index, workerIndex);
+    }
+}
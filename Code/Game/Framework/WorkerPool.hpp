@@ -0,0 +1,62 @@
+//----------------------------------------------------------------------------------------------------
+// WorkerPool.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+// Persistent worker threads for data-parallel game work. Threads are created once and sleep between
+// jobs, so ParallelFor can be called every frame without paying thread start-up cost.
+//
+// ParallelFor blocks until every index has been processed; the calling thread takes part in the work.
+// Jobs must not call back into the same pool.
+//
+// Resize() replaces the threads; call it from the owning thread between ParallelFor calls (the game
+// does so between frames when workerThreadCount changes in GameConfig.xml).
+//----------------------------------------------------------------------------------------------------
+class WorkerPool
+{
+public:
+    using ParallelForFunction = std::function<void(uint32_t index, uint32_t workerIndex)>;
+
+    explicit WorkerPool(uint32_t threadCount = 0);    // 0 = hardware_concurrency - 1
+    ~WorkerPool();
+
+    WorkerPool(WorkerPool const&)            = delete;
+    WorkerPool& operator=(WorkerPool const&) = delete;
+
+    void ParallelFor(uint32_t count, ParallelForFunction const& function);
+    void Resize(uint32_t threadCount);                // Same meaning of 0 as the constructor
+
+    uint32_t GetThreadCount() const { return static_cast<uint32_t>(m_threads.size()); }
+    uint32_t GetWorkerCount() const { return GetThreadCount() + 1; }      // workers + calling thread
+
+private:
+    static uint32_t ResolveThreadCount(uint32_t threadCount);
+
+    void StartThreads(uint32_t threadCount);
+    void StopThreads();
+    void WorkerThreadMain(uint32_t workerIndex, uint64_t seenGeneration);
+    void RunJobIndices(uint32_t workerIndex);
+
+    std::vector<std::thread> m_threads;
+
+    std::mutex              m_mutex;
+    std::condition_variable m_wakeCondition;
+    std::condition_variable m_doneCondition;
+
+    ParallelForFunction const* m_function      = nullptr;
+    uint32_t                   m_jobCount      = 0;
+    uint64_t                   m_jobGeneration = 0;
+    uint32_t                   m_activeWorkers = 0;
+    bool                       m_isQuitting    = false;
+    std::atomic<uint32_t>      m_nextIndex{0};
+};
@@ -0,0 +1,263 @@
+//----------------------------------------------------------------------------------------------------
+// WorldSnapshot.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/WorldSnapshot.hpp"
+
+#include <filesystem>
+#include <fstream>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Core/LogSubsystem.hpp"
+#include "Engine/Core/StringUtils.hpp"
+#include "Game/Framework/EventBus.hpp"
+#include "Game/Framework/GameCommon.hpp"
+
+//----------------------------------------------------------------------------------------------------
+WorldSnapshotWriter::~WorldSnapshotWriter()
+{
+    WaitForPendingWrite();
+}
+
+//----------------------------------------------------------------------------------------------------
+void WorldSnapshotWriter::SubmitAsync(std::string const&   filePath,
+                                      sWorldSnapshotData&& data)
+{
+    WaitForPendingWrite();
+
+    // Interned here so the write thread never takes the StringTable's exclusive lock.
+    StringID const pathID = StringTable::Intern(filePath);
+
+    m_writeThread = std::thread([filePath, pathID, snapshot = std::move(data)]()
+    {
+        bool const isWritten = WriteToFile(filePath, snapshot);
+
+        if (!isWritten)
+        {
+            DAEMON_LOG(LogGame, eLogVerbosity::Error, StringFormat("(WorldSnapshotWriter::SubmitAsync)(failed to write {})", filePath));
+        }
+
+        if (g_eventBus != nullptr)
+        {
+            g_eventBus->Post("worldSnapshotWritten"_sid, pathID, isWritten ? 1 : 0);
+        }
+    });
+}
+
+//----------------------------------------------------------------------------------------------------
+void WorldSnapshotWriter::WaitForPendingWrite()
+{
+    if (m_writeThread.joinable())
+    {
+        m_writeThread.join();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC bool WorldSnapshotWriter::WriteToFile(std::string const&        filePath,
+                                             sWorldSnapshotData const& data)
+{
+    std::filesystem::path const path(filePath);
+
+    if (path.has_parent_path())
+    {
+        std::error_code errorCode;
+        std::filesystem::create_directories(path.parent_path(), errorCode);
+    }
+
+    // Write to a temporary file first so a crash mid-write never leaves a truncated snapshot behind.
+    std::filesystem::path const tempPath = path.string() + ".tmp";
+
+    sWorldSnapshotHeader header = data.m_header;
+    header.m_propCount          = static_cast<uint32_t>(data.m_props.size());
+    header.m_propOffset         = sizeof(sWorldSnapshotHeader);
+    header.m_jsStateOffset      = header.m_propOffset + data.m_props.size() * sizeof(sPropSnapshotRecord);
+    header.m_jsStateSize        = data.m_jsState.size();
+
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+
+        if (!file.is_open())
+        {
+            return false;
+        }
+
+        file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+        file.write(reinterpret_cast<char const*>(data.m_props.data()), static_cast<std::streamsize>(data.m_props.size() * sizeof(sPropSnapshotRecord)));
+        file.write(data.m_jsState.data(), static_cast<std::streamsize>(data.m_jsState.size()));
+
+        if (!file.good())
+        {
+            return false;
+        }
+    }
+
+    std::error_code errorCode;
+    std::filesystem::rename(tempPath, path, errorCode);
+
+    return !errorCode;
+}
+
+//----------------------------------------------------------------------------------------------------
+WorldSnapshotReader::~WorldSnapshotReader()
+{
+    Close();
+}
+
+//----------------------------------------------------------------------------------------------------
+bool WorldSnapshotReader::Open(std::string const& filePath)
+{
+    Close();
+
+#if defined(_WIN32)
+    HANDLE const file = CreateFileA(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return Fail("cannot open " + filePath);
+    }
+
+    m_fileHandle = file;
+
+    LARGE_INTEGER fileSize;
+
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+    {
+        return Fail("cannot read size of " + filePath);
+    }
+
+    m_mappedSize = static_cast<uint64_t>(fileSize.QuadPart);
+
+    HANDLE const mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+    if (mapping == nullptr)
+    {
+        return Fail("cannot map " + filePath);
+    }
+
+    m_mappingHandle = mapping;
+    m_mappedData    = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+#else
+    m_fileDescriptor = open(filePath.c_str(), O_RDONLY);
+
+    if (m_fileDescriptor < 0)
+    {
+        return Fail("cannot open " + filePath);
+    }
+
+    struct stat fileStat = {};
+
+    if (fstat(m_fileDescriptor, &fileStat) != 0 || fileStat.st_size == 0)
+    {
+        return Fail("cannot read size of " + filePath);
+    }
+
+    m_mappedSize = static_cast<uint64_t>(fileStat.st_size);
+
+    void* const mapped = mmap(nullptr, m_mappedSize, PROT_READ, MAP_PRIVATE, m_fileDescriptor, 0);
+    m_mappedData       = mapped == MAP_FAILED ? nullptr : mapped;
+#endif
+
+    if (m_mappedData == nullptr)
+    {
+        return Fail("cannot map view of " + filePath);
+    }
+
+    // Validate before handing out any pointer into the mapping; these are the only fix-ups needed.
+    if (m_mappedSize < sizeof(sWorldSnapshotHeader))
+    {
+        return Fail("file too small to be a snapshot");
+    }
+
+    sWorldSnapshotHeader const* header = static_cast<sWorldSnapshotHeader const*>(m_mappedData);
+
+    if (header->m_magic != WORLD_SNAPSHOT_MAGIC)
+    {
+        return Fail("not a world snapshot");
+    }
+
+    if (header->m_version != WORLD_SNAPSHOT_VERSION || header->m_headerSize != sizeof(sWorldSnapshotHeader))
+    {
+        return Fail(StringFormat("unsupported snapshot version {}", header->m_version));
+    }
+
+    // Offsets and sizes come from the file: compare by subtraction so a huge value cannot wrap the sum.
+    uint64_t const propBytes   = static_cast<uint64_t>(header->m_propCount) * sizeof(sPropSnapshotRecord);
+    bool const     isPropsIn   = header->m_propOffset <= m_mappedSize && propBytes <= m_mappedSize - header->m_propOffset;
+    bool const     isJSStateIn = header->m_jsStateOffset <= m_mappedSize && header->m_jsStateSize <= m_mappedSize - header->m_jsStateOffset;
+
+    if (!isPropsIn || !isJSStateIn)
+    {
+        return Fail("snapshot is truncated");
+    }
+
+    if (header->m_propOffset % alignof(sPropSnapshotRecord) != 0)
+    {
+        return Fail("prop records are misaligned");
+    }
+
+    m_header = header;
+    m_props  = reinterpret_cast<sPropSnapshotRecord const*>(static_cast<uint8_t const*>(m_mappedData) + header->m_propOffset);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void WorldSnapshotReader::Close()
+{
+#if defined(_WIN32)
+    if (m_mappedData != nullptr) UnmapViewOfFile(m_mappedData);
+    if (m_mappingHandle != nullptr) CloseHandle(m_mappingHandle);
+    if (m_fileHandle != nullptr) CloseHandle(m_fileHandle);
+#else
+    if (m_mappedData != nullptr) munmap(const_cast<void*>(m_mappedData), m_mappedSize);
+    if (m_fileDescriptor >= 0) close(m_fileDescriptor);
+#endif
+
+    m_mappedData     = nullptr;
+    m_mappedSize     = 0;
+    m_fileHandle     = nullptr;
+    m_mappingHandle  = nullptr;
+    m_fileDescriptor = -1;
+    m_header         = nullptr;
+    m_props          = nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------
+uint32_t WorldSnapshotReader::GetPropCount() const
+{
+    return m_header != nullptr ? m_header->m_propCount : 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+std::string WorldSnapshotReader::GetJSState() const
+{
+    if (m_header == nullptr || m_header->m_jsStateSize == 0)
+    {
+        return std::string();
+    }
+
+    char const* jsState = static_cast<char const*>(m_mappedData) + m_header->m_jsStateOffset;
+
+    return std::string(jsState, static_cast<size_t>(m_header->m_jsStateSize));
+}
+
+//----------------------------------------------------------------------------------------------------
+bool WorldSnapshotReader::Fail(std::string const& error)
+{
+    m_lastError = error;
+    Close();
+
+    return false;
+}
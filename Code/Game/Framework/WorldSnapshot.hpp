@@ -0,0 +1,137 @@
+//----------------------------------------------------------------------------------------------------
+// WorldSnapshot.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+// Binary world snapshot layout (little-endian, all records are POD so the loader can read them
+// straight out of the mapped file without per-field parsing):
+//
+//   sWorldSnapshotHeader
+//   sPropSnapshotRecord[propCount]      @ propOffset
+//   char[jsStateSize]                   @ jsStateOffset (UTF-8 JSON from JSEngine)
+//
+// Bump WORLD_SNAPSHOT_VERSION whenever a record layout changes.
+//----------------------------------------------------------------------------------------------------
+uint32_t constexpr WORLD_SNAPSHOT_MAGIC   = 0x53574750; // 'PGWS'
+uint32_t constexpr WORLD_SNAPSHOT_VERSION = 1;
+
+//----------------------------------------------------------------------------------------------------
+struct sEntitySnapshotRecord
+{
+    float   m_position[3]        = {};
+    float   m_velocity[3]        = {};
+    float   m_orientation[3]     = {};   // yaw, pitch, roll
+    float   m_angularVelocity[3] = {};
+    uint8_t m_color[4]           = {};
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sPropSnapshotRecord
+{
+    sEntitySnapshotRecord m_entity;
+    uint8_t               m_meshType   = 0;
+    uint8_t               m_isTextured = 0;
+    uint8_t               m_padding[2] = {};
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sClockSnapshotRecord
+{
+    double  m_totalSeconds = 0.0;
+    double  m_timeScale    = 1.0;
+    uint8_t m_isPaused     = 0;
+    uint8_t m_padding[7]   = {};
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sWorldSnapshotHeader
+{
+    uint32_t              m_magic         = WORLD_SNAPSHOT_MAGIC;
+    uint32_t              m_version       = WORLD_SNAPSHOT_VERSION;
+    uint32_t              m_headerSize    = sizeof(sWorldSnapshotHeader);
+    uint32_t              m_propCount     = 0;
+    uint64_t              m_propOffset    = 0;
+    uint64_t              m_jsStateOffset = 0;
+    uint64_t              m_jsStateSize   = 0;
+    sEntitySnapshotRecord m_player;
+    uint8_t               m_playerPadding[4] = {};   // Keeps m_gameClock 8-aligned with no implicit gap
+    sClockSnapshotRecord  m_gameClock;
+    uint8_t               m_gameState  = 0;
+    uint8_t               m_padding[7] = {};
+};
+
+static_assert(sizeof(sEntitySnapshotRecord) == 52);
+static_assert(sizeof(sPropSnapshotRecord) == 56);
+static_assert(sizeof(sClockSnapshotRecord) == 24);
+static_assert(sizeof(sWorldSnapshotHeader) == 128);
+
+//----------------------------------------------------------------------------------------------------
+// Everything the Game hands over for a save; owned by the writer thread once submitted.
+//----------------------------------------------------------------------------------------------------
+struct sWorldSnapshotData
+{
+    sWorldSnapshotHeader             m_header;
+    std::vector<sPropSnapshotRecord> m_props;
+    std::string                      m_jsState;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Writes snapshots on a background thread. Only one write is in flight at a time; submitting a new
+// snapshot waits for the previous one so files are never interleaved.
+//----------------------------------------------------------------------------------------------------
+class WorldSnapshotWriter
+{
+public:
+    WorldSnapshotWriter() = default;
+    ~WorldSnapshotWriter();
+
+    void SubmitAsync(std::string const& filePath, sWorldSnapshotData&& data);
+    void WaitForPendingWrite();
+
+    static bool WriteToFile(std::string const& filePath, sWorldSnapshotData const& data);
+
+private:
+    std::thread m_writeThread;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Memory-maps a snapshot file and exposes its records in place. The views stay valid until Close()
+// or destruction.
+//----------------------------------------------------------------------------------------------------
+class WorldSnapshotReader
+{
+public:
+    WorldSnapshotReader() = default;
+    ~WorldSnapshotReader();
+
+    WorldSnapshotReader(WorldSnapshotReader const&)            = delete;
+    WorldSnapshotReader& operator=(WorldSnapshotReader const&) = delete;
+
+    bool Open(std::string const& filePath);
+    void Close();
+
+    sWorldSnapshotHeader const* GetHeader() const { return m_header; }
+    sPropSnapshotRecord const*  GetProps() const { return m_props; }
+    uint32_t                    GetPropCount() const;
+    std::string                 GetJSState() const;
+    std::string const&          GetLastError() const { return m_lastError; }
+
+private:
+    bool Fail(std::string const& error);
+
+    void const*                 m_mappedData     = nullptr;
+    uint64_t                    m_mappedSize     = 0;
+    void*                       m_fileHandle     = nullptr;
+    void*                       m_mappingHandle  = nullptr;
+    int                         m_fileDescriptor = -1;
+    sWorldSnapshotHeader const* m_header         = nullptr;
+    sPropSnapshotRecord const*  m_props          = nullptr;
+    std::string                 m_lastError;
+};
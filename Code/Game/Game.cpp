@@ -11,32 +11,110 @@
 #include "Engine/Core/ErrorWarningAssert.hpp"
 #include "Engine/Core/LogSubsystem.hpp"
 #include "Engine/Input/InputSystem.hpp"
+#include "Engine/Math/MathUtils.hpp"
 #include "Engine/Math/RandomNumberGenerator.hpp"
 #include "Engine/Platform/Window.hpp"
 #include "Engine/Renderer/BitmapFont.hpp"
 #include "Engine/Renderer/DebugRenderSystem.hpp"
+#include "Engine/Renderer/Image.hpp"
 #include "Engine/Renderer/Renderer.hpp"
 #include "Engine/Resource/ResourceSubsystem.hpp"
 #include "Engine/Resource/Resource/ModelResource.hpp"
 #include "Engine/Scripting/V8Subsystem.hpp"
+#include "Game/Framework/ActionMap.hpp"
 #include "Game/Framework/App.hpp"
+#include "Game/Framework/ConsoleScrollback.hpp"
+#include "Game/Framework/CountingRenderer.hpp"
+#include "Game/Framework/DrawPacketBuilder.hpp"
+#include "Game/Framework/GameConfig.hpp"
 #include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/InputEventQueue.hpp"
+#include "Game/Framework/OcclusionCuller.hpp"
+#include "Game/Framework/ScriptBundler.hpp"
+#include "Game/Framework/StressScenario.hpp"
+#include "Game/Framework/TextLayoutCache.hpp"
+#include "Game/Framework/TextureAtlas.hpp"
+#include "Game/Framework/WorkerPool.hpp"
 #include "Game/Player.hpp"
 #include "Game/Prop.hpp"
+#include "Game/Subsystem/Audio/AudioOutput.hpp"
+#include "Game/Subsystem/Audio/AudioVoicePool.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <sstream>
 
+//----------------------------------------------------------------------------------------------------
+static String const QUICK_SAVE_SNAPSHOT_PATH = "Saves/QuickSave.snapshot";
+static String const ACTION_MAP_PATH          = "Data/Config/ActionMap.xml";
+
+// Indexed by CreateTexturedProp; small ones are packed into the prop texture atlas at startup.
+static char const* const PROP_TEXTURE_FILES[] = {"Data/Images/TestUV.png"};
+
+// With rendering off, one App frame keeps stepping for this long so the window still pumps messages.
+static double constexpr FAST_FORWARD_NO_RENDER_BUDGET_SECONDS = 0.1;
+static double constexpr FAST_FORWARD_STATS_WINDOW_SECONDS     = 1.0;
+
+//----------------------------------------------------------------------------------------------------
+static void WriteEntitySnapshotRecord(Entity const& entity, sEntitySnapshotRecord& out_record)
+{
+    out_record.m_position[0]        = entity.m_position.x;
+    out_record.m_position[1]        = entity.m_position.y;
+    out_record.m_position[2]        = entity.m_position.z;
+    out_record.m_velocity[0]        = entity.m_velocity.x;
+    out_record.m_velocity[1]        = entity.m_velocity.y;
+    out_record.m_velocity[2]        = entity.m_velocity.z;
+    out_record.m_orientation[0]     = entity.m_orientation.m_yawDegrees;
+    out_record.m_orientation[1]     = entity.m_orientation.m_pitchDegrees;
+    out_record.m_orientation[2]     = entity.m_orientation.m_rollDegrees;
+    out_record.m_angularVelocity[0] = entity.m_angularVelocity.m_yawDegrees;
+    out_record.m_angularVelocity[1] = entity.m_angularVelocity.m_pitchDegrees;
+    out_record.m_angularVelocity[2] = entity.m_angularVelocity.m_rollDegrees;
+    out_record.m_color[0]           = entity.m_color.r;
+    out_record.m_color[1]           = entity.m_color.g;
+    out_record.m_color[2]           = entity.m_color.b;
+    out_record.m_color[3]           = entity.m_color.a;
+}
+
+//----------------------------------------------------------------------------------------------------
+static void ReadEntitySnapshotRecord(sEntitySnapshotRecord const& record, Entity& out_entity)
+{
+    out_entity.m_position        = Vec3(record.m_position[0], record.m_position[1], record.m_position[2]);
+    out_entity.m_velocity        = Vec3(record.m_velocity[0], record.m_velocity[1], record.m_velocity[2]);
+    out_entity.m_orientation     = EulerAngles(record.m_orientation[0], record.m_orientation[1], record.m_orientation[2]);
+    out_entity.m_angularVelocity = EulerAngles(record.m_angularVelocity[0], record.m_angularVelocity[1], record.m_angularVelocity[2]);
+    out_entity.m_color           = Rgba8(record.m_color[0], record.m_color[1], record.m_color[2], record.m_color[3]);
+}
+
 //----------------------------------------------------------------------------------------------------
 Game::Game()
 {
     DAEMON_LOG(LogGame, eLogVerbosity::Log, StringFormat("(Game::Game)(start)"));
 
+    m_actionMap = new ActionMap();
+    m_actionMap->LoadFromFile(ACTION_MAP_PATH);
+
+    m_workerPool        = new WorkerPool(g_gameConfig->Get().m_workerThreadCount);
+    m_drawPacketBuilder = new DrawPacketBuilder(m_workerPool);
+    BuildPropTextureAtlas();
+
     SpawnPlayer();
     InitPlayer();
     SpawnProps();
     InitProps();
 
+    sOcclusionCullerConfig occlusionConfig;
+    occlusionConfig.m_dimensions = IntVec2(static_cast<int>(g_gameConfig->Get().m_occlusionBufferWidth), static_cast<int>(g_gameConfig->Get().m_occlusionBufferHeight));
+    occlusionConfig.m_workerPool = m_workerPool;
+    m_occlusionCuller            = new OcclusionCuller(occlusionConfig);
+    m_lodDetailScale             = g_gameConfig->Get().m_lodDetailScale;
+
+    sAudioVoicePoolConfig audioVoicePoolConfig;
+    audioVoicePoolConfig.m_maxRealVoices = g_gameConfig->Get().m_audioMaxRealVoices;
+    audioVoicePoolConfig.m_minAudibility = g_gameConfig->Get().m_audioMinAudibility;
+    m_audioOutput    = new EngineAudioOutput(*g_audio);
+    m_audioVoicePool = new AudioVoicePool(audioVoicePoolConfig, *m_audioOutput);
+
     m_screenCamera = new Camera();
 
     Vec2 const bottomLeft = Vec2::ZERO;
@@ -47,6 +125,8 @@ Game::Game()
     m_screenCamera->SetNormalizedViewport(AABB2::ZERO_TO_ONE);
     m_gameClock = new Clock(Clock::GetSystemClock());
 
+    g_eventSystem->SubscribeEventCallbackFunction("FastForward", OnFastForwardCommand);
+
 
 #if defined(ENGINE_DEBUG_RENDER)
     DebugAddWorldBasis(Mat44(), -1.f);
@@ -71,8 +151,20 @@ Game::~Game()
 {
     DAEMON_LOG(LogGame, eLogVerbosity::Log, StringFormat("(Game::~Game)(start)"));
 
-    m_props.clear();
+    g_eventSystem->UnsubscribeEventCallbackFunction("FastForward", OnFastForwardCommand);
+
+    m_snapshotWriter.WaitForPendingWrite();
+    ClearProps();
 
+    GAME_SAFE_RELEASE(m_stressScenario);
+    GAME_SAFE_RELEASE(m_scriptBundler);
+    GAME_SAFE_RELEASE(m_actionMap);
+    GAME_SAFE_RELEASE(m_audioVoicePool);
+    GAME_SAFE_RELEASE(m_audioOutput);
+    GAME_SAFE_RELEASE(m_occlusionCuller);
+    GAME_SAFE_RELEASE(m_propTextureAtlas);
+    GAME_SAFE_RELEASE(m_drawPacketBuilder);
+    GAME_SAFE_RELEASE(m_workerPool);
     GAME_SAFE_RELEASE(m_gameClock);
     GAME_SAFE_RELEASE(m_player);
     GAME_SAFE_RELEASE(m_screenCamera);
@@ -87,6 +179,29 @@ void Game::PostInit()
     m_hasInitializedJS = true;
 }
 
+//----------------------------------------------------------------------------------------------------
+// Called between frames, so the worker pool and the occlusion culler are idle and can be rebuilt.
+//
+void Game::ApplyConfig(sGameConfig const& config)
+{
+    m_audioVoicePool->SetRealVoiceBudget(config.m_audioMaxRealVoices, config.m_audioMinAudibility);
+    m_workerPool->Resize(config.m_workerThreadCount);
+    m_lodDetailScale = config.m_lodDetailScale;
+
+    IntVec2 const occlusionDimensions(static_cast<int>(config.m_occlusionBufferWidth), static_cast<int>(config.m_occlusionBufferHeight));
+    IntVec2 const currentDimensions = m_occlusionCuller->GetDimensions();
+
+    if (occlusionDimensions.x != currentDimensions.x || occlusionDimensions.y != currentDimensions.y)
+    {
+        sOcclusionCullerConfig occlusionConfig;
+        occlusionConfig.m_dimensions = occlusionDimensions;
+        occlusionConfig.m_workerPool = m_workerPool;
+
+        GAME_SAFE_RELEASE(m_occlusionCuller);
+        m_occlusionCuller = new OcclusionCuller(occlusionConfig);
+    }
+}
+
 //----------------------------------------------------------------------------------------------------
 void Game::UpdateJS()
 {
@@ -117,16 +232,16 @@ bool Game::IsAttractMode() const
 }
 
 //----------------------------------------------------------------------------------------------------
-void Game::UpdateFromKeyBoard()
+void Game::UpdateFromActions()
 {
     if (m_gameState == eGameState::ATTRACT)
     {
-        if (g_input->WasKeyJustPressed(KEYCODE_ESC))
+        if (m_actionMap->WasJustPressed(eAction::BACK))
         {
             App::RequestQuit();
         }
 
-        if (g_input->WasKeyJustPressed(KEYCODE_SPACE))
+        if (m_actionMap->WasJustPressed(eAction::START))
         {
             m_gameState = eGameState::GAME;
         }
@@ -134,32 +249,47 @@ void Game::UpdateFromKeyBoard()
 
     if (m_gameState == eGameState::GAME)
     {
-        if (g_input->WasKeyJustPressed(KEYCODE_ESC))
+        if (m_actionMap->WasJustPressed(eAction::BACK))
         {
             m_gameState = eGameState::ATTRACT;
         }
 
-        if (g_input->WasKeyJustPressed(KEYCODE_P))
+        if (m_actionMap->WasJustPressed(eAction::PAUSE))
         {
             m_gameClock->TogglePause();
         }
 
-        if (g_input->WasKeyJustPressed(KEYCODE_O))
+        if (m_actionMap->WasJustPressed(eAction::STEP_FRAME))
         {
             m_gameClock->StepSingleFrame();
         }
 
-        if (g_input->IsKeyDown(KEYCODE_T))
+        if (m_actionMap->IsDown(eAction::SLOW_MOTION))
         {
             m_gameClock->SetTimeScale(0.1f);
         }
 
-        if (g_input->WasKeyJustReleased(KEYCODE_T))
+        if (m_actionMap->WasJustReleased(eAction::SLOW_MOTION) && !m_actionMap->IsDown(eAction::SLOW_MOTION))
         {
             m_gameClock->SetTimeScale(1.f);
         }
 
-        if (g_input->WasKeyJustPressed(NUMCODE_1))
+        if (m_actionMap->WasJustPressed(eAction::QUICK_SAVE))
+        {
+            SaveSnapshot(QUICK_SAVE_SNAPSHOT_PATH);
+        }
+
+        if (m_actionMap->WasJustPressed(eAction::QUICK_LOAD))
+        {
+            LoadSnapshot(QUICK_SAVE_SNAPSHOT_PATH);
+        }
+
+        if (m_actionMap->WasJustPressed(eAction::TOGGLE_OCCLUSION))
+        {
+            SetOcclusionCulling(!m_isOcclusionCullingEnabled);
+        }
+
+        if (m_actionMap->WasJustPressed(eAction::DEBUG_LINE))
         {
             Vec3 forward;
             Vec3 right;
@@ -169,12 +299,12 @@ void Game::UpdateFromKeyBoard()
             DebugAddWorldLine(m_player->m_position, m_player->m_position + forward * 20.f, 0.01f, 10.f, Rgba8(255, 255, 0), Rgba8(255, 255, 0), eDebugRenderMode::X_RAY);
         }
 
-        if (g_input->IsKeyDown(NUMCODE_2))
+        if (m_actionMap->IsDown(eAction::DEBUG_POINT))
         {
             DebugAddWorldPoint(Vec3(m_player->m_position.x, m_player->m_position.y, 0.f), 0.25f, 60.f, Rgba8(150, 75, 0), Rgba8(150, 75, 0));
         }
 
-        if (g_input->WasKeyJustPressed(NUMCODE_3))
+        if (m_actionMap->WasJustPressed(eAction::DEBUG_SPHERE))
         {
             Vec3 forward;
             Vec3 right;
@@ -184,12 +314,12 @@ void Game::UpdateFromKeyBoard()
             DebugAddWorldWireSphere(m_player->m_position + forward * 2.f, 1.f, 5.f, Rgba8::GREEN, Rgba8::RED);
         }
 
-        if (g_input->WasKeyJustPressed(NUMCODE_4))
+        if (m_actionMap->WasJustPressed(eAction::DEBUG_BASIS))
         {
             DebugAddWorldBasis(m_player->GetModelToWorldTransform(), 20.f);
         }
 
-        if (g_input->WasKeyJustReleased(NUMCODE_5))
+        if (m_actionMap->WasJustReleased(eAction::DEBUG_TEXT))
         {
             float const  positionX    = m_player->m_position.x;
             float const  positionY    = m_player->m_position.y;
@@ -207,13 +337,13 @@ void Game::UpdateFromKeyBoard()
             DebugAddBillboardText(text, m_player->m_position + forward, 0.1f, Vec2::HALF, 10.f, Rgba8::WHITE, Rgba8::RED);
         }
 
-        if (g_input->WasKeyJustPressed(NUMCODE_6))
+        if (m_actionMap->WasJustPressed(eAction::DEBUG_CYLINDER))
         {
             DebugAddWorldCylinder(m_player->m_position, m_player->m_position + Vec3::Z_BASIS * 2, 1.f, 10.f, true, Rgba8::WHITE, Rgba8::RED);
         }
 
 
-        if (g_input->WasKeyJustReleased(NUMCODE_7))
+        if (m_actionMap->WasJustReleased(eAction::DEBUG_MESSAGE))
         {
             float const orientationX = m_player->GetCamera()->GetOrientation().m_yawDegrees;
             float const orientationY = m_player->GetCamera()->GetOrientation().m_pitchDegrees;
@@ -226,53 +356,6 @@ void Game::UpdateFromKeyBoard()
     }
 }
 
-//----------------------------------------------------------------------------------------------------
-void Game::UpdateFromController()
-{
-    XboxController const& controller = g_input->GetController(0);
-
-    if (m_gameState == eGameState::ATTRACT)
-    {
-        if (controller.WasButtonJustPressed(XBOX_BUTTON_BACK))
-        {
-            App::RequestQuit();
-        }
-
-        if (controller.WasButtonJustPressed(XBOX_BUTTON_START))
-        {
-            m_gameState = eGameState::GAME;
-        }
-    }
-
-    if (m_gameState == eGameState::GAME)
-    {
-        if (controller.WasButtonJustPressed(XBOX_BUTTON_BACK))
-        {
-            m_gameState = eGameState::ATTRACT;
-        }
-
-        if (controller.WasButtonJustPressed(XBOX_BUTTON_B))
-        {
-            m_gameClock->TogglePause();
-        }
-
-        if (controller.WasButtonJustPressed(XBOX_BUTTON_Y))
-        {
-            m_gameClock->StepSingleFrame();
-        }
-
-        if (controller.WasButtonJustPressed(XBOX_BUTTON_X))
-        {
-            m_gameClock->SetTimeScale(0.1f);
-        }
-
-        if (controller.WasButtonJustReleased(XBOX_BUTTON_X))
-        {
-            m_gameClock->SetTimeScale(1.f);
-        }
-    }
-}
-
 //----------------------------------------------------------------------------------------------------
 void Game::UpdateEntities(float const gameDeltaSeconds,
                           float const systemDeltaSeconds) const
@@ -290,22 +373,63 @@ void Game::UpdateEntities(float const gameDeltaSeconds,
         }
     }
 
-    m_props[0]->m_orientation.m_pitchDegrees += 30.f * gameDeltaSeconds;
-    m_props[0]->m_orientation.m_rollDegrees += 30.f * gameDeltaSeconds;
+    // A loaded snapshot may hold fewer props than the default scene.
+    if (m_props.size() >= 3)
+    {
+        m_props[0]->m_orientation.m_pitchDegrees += 30.f * gameDeltaSeconds;
+        m_props[0]->m_orientation.m_rollDegrees += 30.f * gameDeltaSeconds;
+
+        float const time       = static_cast<float>(GetGameSeconds());
+        float const colorValue = (sinf(time) + 1.0f) * 0.5f * 255.0f;
 
-    float const time       = static_cast<float>(m_gameClock->GetTotalSeconds());
-    float const colorValue = (sinf(time) + 1.0f) * 0.5f * 255.0f;
+        m_props[1]->m_color.r = static_cast<unsigned char>(colorValue);
+        m_props[1]->m_color.g = static_cast<unsigned char>(colorValue);
+        m_props[1]->m_color.b = static_cast<unsigned char>(colorValue);
 
-    m_props[1]->m_color.r = static_cast<unsigned char>(colorValue);
-    m_props[1]->m_color.g = static_cast<unsigned char>(colorValue);
-    m_props[1]->m_color.b = static_cast<unsigned char>(colorValue);
+        m_props[2]->m_orientation.m_yawDegrees += 45.f * gameDeltaSeconds;
+    }
 
-    m_props[2]->m_orientation.m_yawDegrees += 45.f * gameDeltaSeconds;
+    // Fast-forward sub-steps would stack one copy of every line per step.
+    if (m_isSimulationSubStep)
+    {
+        return;
+    }
 
-    DebugAddScreenText(Stringf("GameTime:   %.2f", m_gameClock->GetTotalSeconds()), m_screenCamera->GetOrthographicTopRight() - Vec2(500.f, 20.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
+    DebugAddScreenText(Stringf("GameTime:   %.2f", GetGameSeconds()), m_screenCamera->GetOrthographicTopRight() - Vec2(500.f, 20.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
     DebugAddScreenText(Stringf("SystemTime: %.2f", Clock::GetSystemClock().GetTotalSeconds()), m_screenCamera->GetOrthographicTopRight() - Vec2(500.f, 40.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
     DebugAddScreenText(Stringf("FPS:        %.2f", 1.f / m_gameClock->GetDeltaSeconds()), m_screenCamera->GetOrthographicTopRight() - Vec2(500.f, 60.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
     DebugAddScreenText(Stringf("Scale:      %.2f", m_gameClock->GetTimeScale()), m_screenCamera->GetOrthographicTopRight() - Vec2(500.f, 80.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
+
+    DebugAddScreenText(Stringf("Verts:      %u", m_submittedVertexCount), m_screenCamera->GetOrthographicTopRight() - Vec2(500.f, 100.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
+
+    if (m_isOcclusionCullingEnabled)
+    {
+        DebugAddScreenText(Stringf("Occlusion:  %u visible, %u occluded", m_visiblePropCount, m_occludedPropCount), m_screenCamera->GetOrthographicTopRight() - Vec2(500.f, 120.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
+    }
+    else
+    {
+        DebugAddScreenText("Occlusion:  off (F6)", m_screenCamera->GetOrthographicTopRight() - Vec2(500.f, 120.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
+    }
+
+    sTextLayoutCacheStats const& textStats = g_textLayoutCache->GetStats();
+    DebugAddScreenText(Stringf("TextCache:  %.1f%% hits, %u entries, %u/%u KB", 100.f * textStats.GetHitRate(), textStats.m_entryCount,
+                               static_cast<uint32_t>(textStats.m_usedVertexCount * sizeof(Vertex_PCU) / 1024), static_cast<uint32_t>(textStats.m_arenaBytes / 1024)),
+                       m_screenCamera->GetOrthographicTopRight() - Vec2(500.f, 140.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
+
+    sRenderFrameStats const& renderStats = g_countingRenderer->GetFrame(0);
+    DebugAddScreenText(Stringf("Render:     %u draws, %u state (%u redundant), %.1f KB up", renderStats.m_drawCallCount, renderStats.GetStateChangeCount(),
+                               renderStats.m_redundantStateCount, static_cast<float>(renderStats.m_uploadBytes) / 1024.f),
+                       m_screenCamera->GetOrthographicTopRight() - Vec2(500.f, 180.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
+
+    sInputLatencyStats const inputStats = g_inputEventQueue->GetLatencyStats();
+    DebugAddScreenText(Stringf("Input:      %.2f ms avg, %.2f ms max, %llu events", inputStats.GetAverageSeconds() * 1000.0, inputStats.m_maxSeconds * 1000.0,
+                               inputStats.m_eventCount),
+                       m_screenCamera->GetOrthographicTopRight() - Vec2(500.f, 200.f), 20.f, Vec2::ZERO, 0.f, Rgba8::WHITE, Rgba8::WHITE);
+
+    if (m_isFastForwarding)
+    {
+        DebugAddScreenText(Stringf("FastFwd:    x%.1f (%u/frame)", m_fastForwardStats.m_simSecondsPerWallSecond, m_fastForwardConfig.m_renderEveryNthFrame), m_screenCamera->GetOrthographicTopRight() - Vec2(500.f, 160.f), 20.f, Vec2::ZERO, 0.f, Rgba8::YELLOW, Rgba8::YELLOW);
+    }
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -315,14 +439,14 @@ void Game::RenderAttractMode() const
 
     VertexList_PCU verts;
     AddVertsForDisc2D(verts, Vec2(clientDimensions.x * 0.5f, clientDimensions.y * 0.5f), 300.f, 10.f, Rgba8::YELLOW);
-    g_renderer->SetModelConstants();
-    g_renderer->SetBlendMode(eBlendMode::OPAQUE);
-    g_renderer->SetRasterizerMode(eRasterizerMode::SOLID_CULL_BACK);
-    g_renderer->SetSamplerMode(eSamplerMode::BILINEAR_CLAMP);
-    g_renderer->SetDepthMode(eDepthMode::DISABLED);
-    g_renderer->BindTexture(nullptr);
-    g_renderer->BindShader(g_renderer->CreateOrGetShaderFromFile("Data/Shaders/Default"));
-    g_renderer->DrawVertexArray(verts);
+    g_countingRenderer->SetModelConstants();
+    g_countingRenderer->SetBlendMode(eBlendMode::OPAQUE);
+    g_countingRenderer->SetRasterizerMode(eRasterizerMode::SOLID_CULL_BACK);
+    g_countingRenderer->SetSamplerMode(eSamplerMode::BILINEAR_CLAMP);
+    g_countingRenderer->SetDepthMode(eDepthMode::DISABLED);
+    g_countingRenderer->BindTexture(nullptr);
+    g_countingRenderer->BindShader(g_renderer->CreateOrGetShaderFromFile("Data/Shaders/Default"));
+    g_countingRenderer->DrawVertexArray(verts);
 }
 
 void Game::RenderGame() const
@@ -339,25 +463,146 @@ void Game::RenderGame() const
     AddVertsForLineSegment2D(verts, topRight, bottomLeft, 10.f, false, Rgba8::GREEN);
     AddVertsForLineSegment2D(verts, topLeft, bottomRight, 10.f, false, Rgba8::GREEN);
 
-    g_renderer->SetModelConstants();
-    g_renderer->SetBlendMode(eBlendMode::OPAQUE);
-    g_renderer->SetRasterizerMode(eRasterizerMode::SOLID_CULL_BACK);
-    g_renderer->SetSamplerMode(eSamplerMode::BILINEAR_CLAMP);
-    g_renderer->SetDepthMode(eDepthMode::DISABLED);
-    g_renderer->BindTexture(nullptr);
-    g_renderer->BindShader(g_renderer->CreateOrGetShaderFromFile("Data/Shaders/Default"));
-    g_renderer->DrawVertexArray(verts);
+    g_countingRenderer->SetModelConstants();
+    g_countingRenderer->SetBlendMode(eBlendMode::OPAQUE);
+    g_countingRenderer->SetRasterizerMode(eRasterizerMode::SOLID_CULL_BACK);
+    g_countingRenderer->SetSamplerMode(eSamplerMode::BILINEAR_CLAMP);
+    g_countingRenderer->SetDepthMode(eDepthMode::DISABLED);
+    g_countingRenderer->BindTexture(nullptr);
+    g_countingRenderer->BindShader(g_renderer->CreateOrGetShaderFromFile("Data/Shaders/Default"));
+    g_countingRenderer->DrawVertexArray(verts);
 }
 
 //----------------------------------------------------------------------------------------------------
 void Game::RenderEntities() const
 {
-    g_renderer->SetModelConstants(m_player->GetModelToWorldTransform());
+    g_countingRenderer->SetModelConstants(m_player->GetModelToWorldTransform());
     m_player->Render();
 
+    m_submittedVertexCount = 0;
+    m_visiblePropCount     = 0;
+    m_occludedPropCount    = 0;
+
+    // Occluders go into the low-resolution depth buffer first; everything else is tested against it
+    // while its draw packet is built.
+    if (m_isOcclusionCullingEnabled)
+    {
+        m_occlusionCuller->BeginFrame(*m_player->GetCamera());
+
+        for (Prop const* prop : m_props)
+        {
+            if (prop->IsOccluder())
+            {
+                prop->RenderOccluder(*m_occlusionCuller);
+            }
+        }
+
+        m_occlusionCuller->EndOccluders();
+    }
+
+    Vec3 const cameraPosition = m_player->m_position;
+
+    // Runs on the workers: read-only access to props, the culler pyramid and the atlas pages.
+    m_drawPacketBuilder->Build(static_cast<uint32_t>(m_props.size()), [this, &cameraPosition](uint32_t const propIndex, sDrawPacket& out_packet)
+    {
+        Prop const& prop = *m_props[propIndex];
+
+        if (m_isOcclusionCullingEnabled && !prop.IsOccluder() && m_occlusionCuller->TestOccluded(prop.GetWorldBounds()))
+        {
+            return false;
+        }
+
+        return prop.BuildDrawPacket(cameraPosition, GetPropMaterialKey(prop), out_packet);
+    });
+
+    m_visiblePropCount  = m_drawPacketBuilder->GetStats().m_packetCount;
+
+    if (m_stressScenario != nullptr && m_stressScenario->IsMeasuring())
+    {
+        sDrawPacketStats const& stats = m_drawPacketBuilder->GetStats();
+        m_stressScenario->AddRenderBuildSample(stats.m_buildMilliseconds + stats.m_sortMilliseconds + stats.m_mergeMilliseconds);
+    }
+    m_occludedPropCount = static_cast<uint32_t>(m_props.size()) - m_visiblePropCount;
+
+    if (m_isOcclusionCullingEnabled)
+    {
+        m_occlusionCuller->AddTestCounts(static_cast<uint32_t>(m_props.size()), m_occludedPropCount);
+    }
+
+    SubmitDrawPackets();
+}
+
+//----------------------------------------------------------------------------------------------------
+// Packets arrive grouped by texture, so the shared state is set once and textures only rebind when
+// the group changes.
+//
+void Game::SubmitDrawPackets() const
+{
+    std::vector<sDrawPacket> const& packets = m_drawPacketBuilder->GetPackets();
+
+    if (packets.empty())
+    {
+        return;
+    }
+
+    g_countingRenderer->SetBlendMode(eBlendMode::OPAQUE);
+    g_countingRenderer->SetRasterizerMode(eRasterizerMode::SOLID_CULL_BACK);
+    g_countingRenderer->SetSamplerMode(eSamplerMode::POINT_CLAMP);
+    g_countingRenderer->SetDepthMode(eDepthMode::READ_WRITE_LESS_EQUAL);
+    g_countingRenderer->BindShader(g_renderer->CreateOrGetShaderFromFile("Data/Shaders/Bloom", eVertexType::VERTEX_PCU));
+
+    g_countingRenderer->AddTransientBytes(packets.size() * sizeof(sDrawPacket));
+
+    Texture const* boundTexture = packets.front().m_texture;
+    g_countingRenderer->BindTexture(boundTexture);
+
+    for (sDrawPacket const& packet : packets)
+    {
+        if (packet.m_texture != boundTexture)
+        {
+            boundTexture = packet.m_texture;
+            g_countingRenderer->BindTexture(boundTexture);
+        }
+
+        g_countingRenderer->SetModelConstants(packet.m_modelToWorld, packet.m_color);
+        g_countingRenderer->DrawVertexArray(static_cast<int>(packet.m_vertexCount), packet.m_vertexes);
+        m_submittedVertexCount += packet.m_vertexCount;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// 0 = untextured, 1 + page index for prop atlas pages, and the top key for any other texture.
+//
+uint16_t Game::GetPropMaterialKey(Prop const& prop) const
+{
+    Texture const* texture = prop.GetTexture();
+
+    if (texture == nullptr)
+    {
+        return 0;
+    }
+
+    for (size_t pageIndex = 0; pageIndex < m_propAtlasPages.size(); ++pageIndex)
+    {
+        if (m_propAtlasPages[pageIndex] == texture)
+        {
+            return static_cast<uint16_t>(pageIndex + 1);
+        }
+    }
+
+    return UINT16_MAX;
+}
+
+//----------------------------------------------------------------------------------------------------
+void Game::UpdatePropLevelsOfDetail()
+{
+    float const viewportHeight              = Window::s_mainWindow->GetClientDimensions().y;
+    float const pixelsPerUnitAtUnitDistance = 0.5f * viewportHeight / TanDegrees(0.5f * Player::CAMERA_FOV_DEGREES) * m_lodDetailScale;
+    Vec3 const  cameraPosition              = m_player->m_position;
+
     for (Prop* prop : m_props)
     {
-        prop->Render();
+        prop->UpdateLevelOfDetail(cameraPosition, pixelsPerUnitAtUnitDistance);
     }
 }
 
@@ -376,13 +621,11 @@ void Game::InitPlayer() const
 //----------------------------------------------------------------------------------------------------
 void Game::SpawnProps()
 {
-    Texture const* texture = g_renderer->CreateOrGetTextureFromFile("Data/Images/TestUV.png");
-
     m_props.reserve(4);
 
     Prop* prop1 = new Prop(this);
     Prop* prop2 = new Prop(this);
-    Prop* prop3 = new Prop(this, texture);
+    Prop* prop3 = CreateTexturedProp(0);
     Prop* prop4 = new Prop(this);
 
     if (prop1 != nullptr) m_props.push_back(prop1);
@@ -391,6 +634,73 @@ void Game::SpawnProps()
     if (prop4 != nullptr) m_props.push_back(prop4);
 }
 
+//----------------------------------------------------------------------------------------------------
+// Packs every small prop texture into shared pages on the worker pool, so textured props can share a
+// bind (and, batched, a draw). Files that fail to load or are too large keep their own texture.
+//
+void Game::BuildPropTextureAtlas()
+{
+    sTextureAtlasConfig atlasConfig;
+    atlasConfig.m_workerPool = m_workerPool;
+    m_propTextureAtlas       = new TextureAtlas(atlasConfig);
+
+    for (char const* filePath : PROP_TEXTURE_FILES)
+    {
+        sSoftwareTexture image;
+
+        if (!TextureAtlas::LoadImageFile(filePath, image))
+        {
+            DAEMON_LOG(LogGame, eLogVerbosity::Warning, StringFormat("(Game::BuildPropTextureAtlas)({})(failed to load)", filePath));
+        }
+
+        // Added even when empty, so atlas indices stay equal to PROP_TEXTURE_FILES indices.
+        m_propTextureAtlas->AddTexture(image);
+    }
+
+    m_propTextureAtlas->Build();
+
+    // sSoftwareTexture row 0 is the top of the image; Image texel y = 0 is the bottom (v = 0).
+    for (uint32_t pageIndex = 0; pageIndex < m_propTextureAtlas->GetPageCount(); ++pageIndex)
+    {
+        sSoftwareTexture const& page = m_propTextureAtlas->GetPage(pageIndex);
+        Image                   image(page.m_dimensions, Rgba8(0, 0, 0, 0));
+
+        for (int y = 0; y < page.m_dimensions.y; ++y)
+        {
+            for (int x = 0; x < page.m_dimensions.x; ++x)
+            {
+                image.SetTexelColor(IntVec2(x, page.m_dimensions.y - 1 - y), page.m_texels[static_cast<size_t>(y) * page.m_dimensions.x + x]);
+            }
+        }
+
+        m_propAtlasPages.push_back(g_renderer->CreateTextureFromImage(image));
+    }
+
+    DAEMON_LOG(LogGame, eLogVerbosity::Log, StringFormat("(Game::BuildPropTextureAtlas)({} textures, {} pages, {:.1f}% occupancy, {:.2f} ms)",
+                                                         std::size(PROP_TEXTURE_FILES), m_propTextureAtlas->GetPageCount(),
+                                                         100.f * m_propTextureAtlas->GetOccupancy(), m_propTextureAtlas->GetBuildMilliseconds()));
+}
+
+//----------------------------------------------------------------------------------------------------
+Prop* Game::CreateTexturedProp(uint32_t const textureIndex)
+{
+    int const index = static_cast<int>(textureIndex);
+
+    if (m_propTextureAtlas != nullptr && m_propTextureAtlas->IsPacked(index))
+    {
+        sAtlasRegion const& region = m_propTextureAtlas->GetRegion(index);
+        Prop*               prop   = new Prop(this, m_propAtlasPages[region.m_pageIndex]);
+
+        prop->SetTextureAtlasRegion(region.m_uvBounds);
+
+        return prop;
+    }
+
+    char const* filePath = textureIndex < std::size(PROP_TEXTURE_FILES) ? PROP_TEXTURE_FILES[textureIndex] : PROP_TEXTURE_FILES[0];
+
+    return new Prop(this, g_renderer->CreateOrGetTextureFromFile(filePath));
+}
+
 //----------------------------------------------------------------------------------------------------
 void Game::InitProps() const
 {
@@ -403,6 +713,10 @@ void Game::InitProps() const
     m_props[1]->m_position = Vec3(-2.f, -2.f, 0.f);
     m_props[2]->m_position = Vec3(10, -5, 1);
     m_props[3]->m_position = Vec3::ZERO;
+
+    // The two cubes are closed, convex meshes and can hide the props behind them.
+    m_props[0]->SetOccluder(true);
+    m_props[1]->SetOccluder(true);
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -439,7 +753,7 @@ void Game::ExecuteJavaScriptCommand(String const& command)
 
         if (g_v8Subsystem->HasError())
         {
-            DAEMON_LOG(LogGame, eLogVerbosity::Error, Stringf("Game::ExecuteJavaScriptCommand() error | %s", g_v8Subsystem->GetLastError().c_str()));
+            DAEMON_LOG(LogGame, eLogVerbosity::Error, Stringf("Game::ExecuteJavaScriptCommand() error | %s", GetScriptError().c_str()));
         }
     }
 
@@ -575,7 +889,7 @@ void Game::ExecuteJavaScriptFile(String const& filename)
 
         if (g_v8Subsystem->HasError())
         {
-            DAEMON_LOG(LogGame, eLogVerbosity::Error, StringFormat("(Game::ExecuteJavaScriptFile)(fail)(error: {})", g_v8Subsystem->GetLastError()));
+            DAEMON_LOG(LogGame, eLogVerbosity::Error, StringFormat("(Game::ExecuteJavaScriptFile)(fail)(error: {})", GetScriptError()));
         }
 
         return;
@@ -626,7 +940,14 @@ void Game::HandleJavaScriptCommands()
 //----------------------------------------------------------------------------------------------------
 void Game::CreateCube(Vec3 const& position)
 {
-    DAEMON_LOG(LogScript, eLogVerbosity::Log, StringFormat("(Game::CreateCube)(start)(position ({:.2f}, {:.2f}, {:.2f}))", position.x, position.y, position.z));
+    // Per-cube logging would dominate the stress scenario's bridge timing, which the headless run
+    // measures without it.
+    bool const isLogged = m_stressScenario == nullptr;
+
+    if (isLogged)
+    {
+        DAEMON_LOG(LogScript, eLogVerbosity::Log, StringFormat("(Game::CreateCube)(start)(position ({:.2f}, {:.2f}, {:.2f}))", position.x, position.y, position.z));
+    }
 
     Prop* newCube       = new Prop(this);
     newCube->m_position = position;
@@ -640,7 +961,10 @@ void Game::CreateCube(Vec3 const& position)
 
     m_props.push_back(newCube);
 
-    DAEMON_LOG(LogScript, eLogVerbosity::Log, StringFormat("(Game::CreateCube)(end)(m_props size: {})", m_props.size()));
+    if (isLogged)
+    {
+        DAEMON_LOG(LogScript, eLogVerbosity::Log, StringFormat("(Game::CreateCube)(end)(m_props size: {})", m_props.size()));
+    }
 }
 
 //----------------------------------------------------------------------------------------------------
@@ -664,13 +988,422 @@ Player* Game::GetPlayer()
     return m_player;
 }
 
+//----------------------------------------------------------------------------------------------------
+void Game::SetFastForward(bool const               isEnabled,
+                          sFastForwardConfig const& config)
+{
+    m_fastForwardConfig                     = config;
+    m_fastForwardConfig.m_fixedDeltaSeconds = std::max(config.m_fixedDeltaSeconds, 0.0001f);
+
+    if (isEnabled && !m_isFastForwarding)
+    {
+        m_fastForwardStats             = sFastForwardStats();
+        m_fastForwardWindowSimSeconds  = 0.0;
+        m_fastForwardWindowWallSeconds = 0.0;
+        m_fastForwardLastFrameTime     = std::chrono::steady_clock::now();
+    }
+
+    if (!isEnabled && m_isFastForwarding)
+    {
+        DAEMON_LOG(LogGame, eLogVerbosity::Display, StringFormat("(Game::SetFastForward)(off)(steps: {})(simulated: {:.1f}s)(wall: {:.1f}s)",
+                       m_fastForwardStats.m_stepCount, m_fastForwardStats.m_simulatedSeconds, m_fastForwardStats.m_wallSeconds));
+    }
+
+    m_isFastForwarding = isEnabled;
+
+    DAEMON_LOG(LogGame, eLogVerbosity::Display, StringFormat("(Game::SetFastForward)({})(delta: {:.4f})(renderEvery: {})",
+                   isEnabled ? "on" : "off", m_fastForwardConfig.m_fixedDeltaSeconds, m_fastForwardConfig.m_renderEveryNthFrame));
+}
+
+//----------------------------------------------------------------------------------------------------
+bool Game::IsFastForwarding() const
+{
+    return m_isFastForwarding;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Runs several fixed-delta JS updates in one App frame. Returns false when this frame should not be
+// rendered.
+//
+// Every step advances game time by the fixed delta times the clock's time scale, and that same delta
+// goes to JS and from there to the C++ entity update, so N fast-forwarded steps end where N normal
+// fixed steps would. The engine clock cannot be stepped by hand, so the difference between the fixed
+// steps and the wall time it ticked this frame is kept in m_gameSecondsOffset (see GetGameSeconds()).
+//
+bool Game::UpdateFastForwardJS()
+{
+    if (!m_hasInitializedJS || g_v8Subsystem == nullptr || !g_v8Subsystem->IsInitialized())
+    {
+        return true;
+    }
+
+    // Pause and single-step still go through the game clock.
+    if (m_gameClock->IsPaused())
+    {
+        UpdateJS();
+        m_fastForwardLastFrameTime = std::chrono::steady_clock::now();
+        return true;
+    }
+
+    float const    deltaSeconds     = m_fastForwardConfig.m_fixedDeltaSeconds;
+    float const    gameDeltaSeconds = deltaSeconds * static_cast<float>(m_gameClock->GetTimeScale());
+    uint32_t const renderEvery      = m_fastForwardConfig.m_renderEveryNthFrame;
+    String const   updateCommand    = StringFormat("globalThis.JSEngine.update({}, {});", std::to_string(gameDeltaSeconds), std::to_string(deltaSeconds));
+    auto const     startTime        = std::chrono::steady_clock::now();
+    uint32_t       stepCount        = 0;
+
+    // This frame's wall-clock tick is replaced by the fixed steps below.
+    m_gameSecondsOffset -= m_gameClock->GetDeltaSeconds();
+
+    while (true)
+    {
+        m_isSimulationSubStep = stepCount > 0;
+        m_gameSecondsOffset += static_cast<double>(gameDeltaSeconds);
+        ExecuteJavaScriptCommand(updateCommand);
+        ++stepCount;
+
+        if (renderEvery != 0)
+        {
+            if (stepCount >= renderEvery) break;
+        }
+        else
+        {
+            std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - startTime;
+            if (elapsed.count() >= FAST_FORWARD_NO_RENDER_BUDGET_SECONDS) break;
+        }
+    }
+
+    m_isSimulationSubStep = false;
+
+    // Wall time is measured frame to frame so render and present cost count against the speed-up.
+    auto const                          now         = std::chrono::steady_clock::now();
+    std::chrono::duration<double> const wallElapsed = now - m_fastForwardLastFrameTime;
+    double const                        simElapsed  = static_cast<double>(gameDeltaSeconds) * stepCount;
+    m_fastForwardLastFrameTime                      = now;
+
+    m_fastForwardStats.m_stepCount += stepCount;
+    m_fastForwardStats.m_simulatedSeconds += simElapsed;
+    m_fastForwardStats.m_wallSeconds += wallElapsed.count();
+    m_fastForwardWindowSimSeconds += simElapsed;
+    m_fastForwardWindowWallSeconds += wallElapsed.count();
+
+    if (m_fastForwardWindowWallSeconds >= FAST_FORWARD_STATS_WINDOW_SECONDS)
+    {
+        m_fastForwardStats.m_simSecondsPerWallSecond = m_fastForwardWindowSimSeconds / m_fastForwardWindowWallSeconds;
+        m_fastForwardWindowSimSeconds                = 0.0;
+        m_fastForwardWindowWallSeconds               = 0.0;
+
+        DAEMON_LOG(LogGame, eLogVerbosity::Log, StringFormat("(Game::UpdateFastForwardJS)(sim seconds per wall second: {:.2f})", m_fastForwardStats.m_simSecondsPerWallSecond));
+    }
+
+    return renderEvery != 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+double Game::GetGameSeconds() const
+{
+    return m_gameClock->GetTotalSeconds() + m_gameSecondsOffset;
+}
+
+//----------------------------------------------------------------------------------------------------
+sFastForwardConfig const& Game::GetFastForwardConfig() const
+{
+    return m_fastForwardConfig;
+}
+
+//----------------------------------------------------------------------------------------------------
+sFastForwardStats const& Game::GetFastForwardStats() const
+{
+    return m_fastForwardStats;
+}
+
+//----------------------------------------------------------------------------------------------------
+// -fastForward=N enables fast-forward rendering every Nth step (0 = no rendering), -fastForwardDelta=S
+// overrides the fixed step.
+//
+STATIC bool Game::ParseFastForwardCommandLine(String const&       commandLine,
+                                              sFastForwardConfig& out_config)
+{
+    if (!FindCommandLineUInt(commandLine, "fastForward", out_config.m_renderEveryNthFrame))
+    {
+        return false;
+    }
+
+    FindCommandLineFloat(commandLine, "fastForwardDelta", out_config.m_fixedDeltaSeconds);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Dev console: FastForward [enabled=true|false] [renderEvery=N] [delta=S]; no "enabled" toggles.
+//
+STATIC bool Game::OnFastForwardCommand(EventArgs& args)
+{
+    if (g_game == nullptr)
+    {
+        return false;
+    }
+
+    sFastForwardConfig config = g_game->GetFastForwardConfig();
+
+    bool const isEnabled         = args.GetValue("enabled", !g_game->IsFastForwarding());
+    config.m_renderEveryNthFrame = static_cast<uint32_t>(std::max(args.GetValue("renderEvery", static_cast<int>(config.m_renderEveryNthFrame)), 0));
+    config.m_fixedDeltaSeconds   = args.GetValue("delta", config.m_fixedDeltaSeconds);
+
+    g_game->SetFastForward(isEnabled, config);
+
+    g_consoleScrollback->AddLine(DevConsole::INFO_MINOR, Stringf("FastForward %s (delta=%.4f, renderEvery=%u)",
+                                                                 isEnabled ? "on" : "off", config.m_fixedDeltaSeconds, config.m_renderEveryNthFrame));
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// The script owns the ramp (it spawns through the real createCube bridge); it gets the step counts
+// from here so both sides agree on them.
+//
+void Game::StartStressScenario(sStressScenarioConfig const& config)
+{
+    GAME_SAFE_RELEASE(m_stressScenario);
+    m_stressScenario = new StressScenario(config);
+
+    std::vector<uint32_t> const entityCounts = m_stressScenario->GetStepEntityCounts();
+    String                      countList;
+
+    for (uint32_t const entityCount : entityCounts)
+    {
+        countList += Stringf(countList.empty() ? "%u" : ", %u", entityCount);
+    }
+
+    DAEMON_LOG(LogGame, eLogVerbosity::Display, StringFormat("(Game::StartStressScenario)(steps: [{}])(framesPerStep: {})", countList,
+                                                             m_stressScenario->GetConfig().m_framesPerStep));
+
+    ExecuteJavaScriptFile("Data/Scripts/StressScenario.js");
+    ExecuteJavaScriptCommand(Stringf("globalThis.stressScenario.start([%s], %u);", countList.c_str(), m_stressScenario->GetConfig().m_framesPerStep));
+}
+
+//----------------------------------------------------------------------------------------------------
+bool Game::RecordStressStep(uint32_t const entityCount,
+                            uint32_t const spawnedCount,
+                            double const   bridgeMilliseconds)
+{
+    if (m_stressScenario == nullptr)
+    {
+        return false;
+    }
+
+    m_stressScenario->BeginStep(entityCount, spawnedCount, bridgeMilliseconds);
+
+    DAEMON_LOG(LogGame, eLogVerbosity::Display, StringFormat("(Game::RecordStressStep)(entities: {})(props: {})(createCube: {:.3f} ms for {})",
+                                                             entityCount, m_props.size(), bridgeMilliseconds, spawnedCount));
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool Game::FinishStressScenario(String& out_superlinearSubsystem)
+{
+    if (m_stressScenario == nullptr)
+    {
+        return false;
+    }
+
+    bool const isWritten     = m_stressScenario->Finish();
+    out_superlinearSubsystem = m_stressScenario->GetFirstSuperlinearSubsystem();
+
+    DAEMON_LOG(LogGame, eLogVerbosity::Log, StringFormat("(Game::FinishStressScenario)\n{}", m_stressScenario->ToReport()));
+    DAEMON_LOG(LogGame, eLogVerbosity::Display, StringFormat("(Game::FinishStressScenario)({})(first superlinear: {} at {} entities)",
+                                                             isWritten ? m_stressScenario->GetConfig().m_jsonPath : "write FAILED",
+                                                             out_superlinearSubsystem.empty() ? "none" : out_superlinearSubsystem,
+                                                             m_stressScenario->GetFirstSuperlinearEntityCount()));
+
+    GAME_SAFE_RELEASE(m_stressScenario);
+    return isWritten;
+}
+
+//----------------------------------------------------------------------------------------------------
+void Game::SetOcclusionCulling(bool const isEnabled)
+{
+    m_isOcclusionCullingEnabled = isEnabled;
+
+    DAEMON_LOG(LogGame, eLogVerbosity::Display, StringFormat("(Game::SetOcclusionCulling)({})", isEnabled ? "on" : "off"));
+}
+
+//----------------------------------------------------------------------------------------------------
+bool Game::IsOcclusionCullingEnabled() const
+{
+    return m_isOcclusionCullingEnabled;
+}
+
+//----------------------------------------------------------------------------------------------------
+ActionMap const* Game::GetActionMap() const
+{
+    return m_actionMap;
+}
+
+//----------------------------------------------------------------------------------------------------
+AudioVoicePool* Game::GetAudioVoicePool() const
+{
+    return m_audioVoicePool;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool Game::SaveSnapshot(String const& filePath)
+{
+    sWorldSnapshotData data;
+
+    data.m_header.m_gameState = static_cast<uint8_t>(m_gameState);
+    WriteEntitySnapshotRecord(*m_player, data.m_header.m_player);
+
+    data.m_header.m_gameClock.m_totalSeconds = GetGameSeconds();
+    data.m_header.m_gameClock.m_timeScale    = m_gameClock->GetTimeScale();
+    data.m_header.m_gameClock.m_isPaused     = m_gameClock->IsPaused() ? 1 : 0;
+
+    data.m_props.resize(m_props.size());
+
+    for (size_t i = 0; i < m_props.size(); ++i)
+    {
+        WriteEntitySnapshotRecord(*m_props[i], data.m_props[i].m_entity);
+        data.m_props[i].m_meshType   = static_cast<uint8_t>(m_props[i]->GetMeshType());
+        data.m_props[i].m_isTextured = m_props[i]->GetTexture() != nullptr ? 1 : 0;
+    }
+
+    if (m_hasInitializedJS && g_v8Subsystem && g_v8Subsystem->IsInitialized())
+    {
+        if (g_v8Subsystem->ExecuteScript("JSON.stringify(globalThis.JSEngine.serializeSystemData());"))
+        {
+            data.m_jsState = g_v8Subsystem->GetLastResult();
+        }
+    }
+
+    size_t const propCount = data.m_props.size();
+
+    // The capture above is the only main-thread cost; file I/O happens on the writer thread.
+    m_snapshotWriter.SubmitAsync(filePath, std::move(data));
+
+    DAEMON_LOG(LogGame, eLogVerbosity::Display, StringFormat("(Game::SaveSnapshot)({})(props: {})", filePath, propCount));
+    DebugAddMessage(Stringf("Snapshot saved: %s", filePath.c_str()), 2.f);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool Game::LoadSnapshot(String const& filePath)
+{
+    // A quick save to the same file may still be in flight.
+    m_snapshotWriter.WaitForPendingWrite();
+
+    WorldSnapshotReader reader;
+
+    if (!reader.Open(filePath))
+    {
+        DAEMON_LOG(LogGame, eLogVerbosity::Error, StringFormat("(Game::LoadSnapshot)({})(failed: {})", filePath, reader.GetLastError()));
+        DebugAddMessage(Stringf("Snapshot load failed: %s", reader.GetLastError().c_str()), 2.f);
+        return false;
+    }
+
+    sWorldSnapshotHeader const& header    = *reader.GetHeader();
+    sPropSnapshotRecord const*  records   = reader.GetProps();
+    uint32_t const              propCount = reader.GetPropCount();
+
+    // Enums are stored as bytes; reject the file before touching the world rather than cast garbage.
+    bool isValid = header.m_gameState <= static_cast<uint8_t>(eGameState::GAME);
+
+    for (uint32_t i = 0; i < propCount && isValid; ++i)
+    {
+        isValid = records[i].m_meshType <= static_cast<uint8_t>(ePropMeshType::GRID);
+    }
+
+    if (!isValid)
+    {
+        DAEMON_LOG(LogGame, eLogVerbosity::Error, StringFormat("(Game::LoadSnapshot)({})(failed: game state or mesh type out of range)", filePath));
+        DebugAddMessage("Snapshot load failed: game state or mesh type out of range", 2.f);
+        return false;
+    }
+
+    ClearProps();
+    m_props.reserve(propCount);
+
+    for (uint32_t i = 0; i < propCount; ++i)
+    {
+        sPropSnapshotRecord const& record = records[i];
+        Prop*                      prop   = record.m_isTextured != 0 ? CreateTexturedProp(0) : new Prop(this);
+
+        prop->SetMeshType(static_cast<ePropMeshType>(record.m_meshType));
+        ReadEntitySnapshotRecord(record.m_entity, *prop);
+        m_props.push_back(prop);
+    }
+
+    ReadEntitySnapshotRecord(header.m_player, *m_player);
+    m_cameraShakeActive = false;
+    m_gameState         = static_cast<eGameState>(header.m_gameState);
+
+    m_gameClock->SetTimeScale(header.m_gameClock.m_timeScale);
+    m_gameSecondsOffset = header.m_gameClock.m_totalSeconds - m_gameClock->GetTotalSeconds();
+
+    if (m_gameClock->IsPaused() != (header.m_gameClock.m_isPaused != 0))
+    {
+        m_gameClock->TogglePause();
+    }
+
+    String const jsState = reader.GetJSState();
+
+    if (!jsState.empty() && m_hasInitializedJS)
+    {
+        ExecuteJavaScriptCommand(StringFormat("globalThis.JSEngine.restoreSystemData({});", jsState));
+    }
+
+    DAEMON_LOG(LogGame, eLogVerbosity::Display, StringFormat("(Game::LoadSnapshot)({})(props: {})", filePath, propCount));
+    DebugAddMessage(Stringf("Snapshot loaded: %s (%u props)", filePath.c_str(), propCount), 2.f);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void Game::ClearProps()
+{
+    for (Prop* prop : m_props)
+    {
+        delete prop;
+    }
+
+    m_props.clear();
+}
+
 //----------------------------------------------------------------------------------------------------
 void Game::Update(float const gameDeltaSeconds,
                   float const systemDeltaSeconds)
 {
-    UpdateEntities(gameDeltaSeconds, systemDeltaSeconds);
-    UpdateFromKeyBoard();
-    UpdateFromController();
+    // Every step, fast-forward sub-steps included, applies the input events that arrived before it.
+    g_inputEventQueue->ConsumeStep(InputEventQueue::GetTimestamp());
+    m_actionMap->Resolve(*g_inputEventQueue, g_input->GetController(0));
+
+    if (m_stressScenario != nullptr && m_stressScenario->IsMeasuring())
+    {
+        auto const updateStart = std::chrono::steady_clock::now();
+        UpdateEntities(gameDeltaSeconds, systemDeltaSeconds);
+        m_stressScenario->AddUpdateSample(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - updateStart).count());
+    }
+    else
+    {
+        UpdateEntities(gameDeltaSeconds, systemDeltaSeconds);
+    }
+
+    // Key edges and console commands belong to the real frame, not to each fast-forward sub-step.
+    if (m_isSimulationSubStep)
+    {
+        return;
+    }
+
+    UpdatePropLevelsOfDetail();
+
+    Vec3 forward;
+    Vec3 left;
+    Vec3 up;
+    m_player->m_orientation.GetAsVectors_IFwd_JLeft_KUp(forward, left, up);
+    m_audioVoicePool->SetListener(m_player->m_position, left);
+    m_audioVoicePool->Update(systemDeltaSeconds);
+
+    UpdateFromActions();
 
     // Note: HandleJavaScriptCommands is now called from the main Update() method
     HandleJavaScriptCommands();
@@ -681,7 +1414,7 @@ void Game::Render() const
 {
     //-Start-of-Game-Camera---------------------------------------------------------------------------
 
-    g_renderer->BeginCamera(*m_player->GetCamera());
+    g_countingRenderer->BeginCamera(*m_player->GetCamera());
 
     if (m_gameState == eGameState::GAME)
     {
@@ -713,7 +1446,7 @@ void Game::Render() const
         }
     }
 
-    g_renderer->EndCamera(*m_player->GetCamera());
+    g_countingRenderer->EndCamera(*m_player->GetCamera());
 
     //-End-of-Game-Camera-----------------------------------------------------------------------------
     //------------------------------------------------------------------------------------------------
@@ -724,14 +1457,14 @@ void Game::Render() const
     //------------------------------------------------------------------------------------------------
     //-Start-of-Screen-Camera-------------------------------------------------------------------------
 
-    g_renderer->BeginCamera(*m_screenCamera);
+    g_countingRenderer->BeginCamera(*m_screenCamera);
 
     if (m_gameState == eGameState::ATTRACT)
     {
         RenderAttractMode();
     }
 
-    g_renderer->EndCamera(*m_screenCamera);
+    g_countingRenderer->EndCamera(*m_screenCamera);
 
     //-End-of-Screen-Camera---------------------------------------------------------------------------
     if (m_gameState == eGameState::GAME)
@@ -800,18 +1533,51 @@ void Game::InitializeJavaScriptFramework()
 
     try
     {
-        // Load the JavaScript framework files in dependency order
-        DAEMON_LOG(LogGame, eLogVerbosity::Display, "Loading JSEngine.js...");
-        ExecuteJavaScriptFile("Data/Scripts/JSEngine.js");
+        bool isBundleLoaded = false;
 
-        DAEMON_LOG(LogGame, eLogVerbosity::Display, "Loading InputSystem.js...");
-        ExecuteJavaScriptFile("Data/Scripts/InputSystem.js");
+#if defined(GAME_SCRIPT_BUNDLE)
+        // Production: one pre-stripped script, rebuilt here only when a source file is newer than it.
+        m_scriptBundler = new ScriptBundler(sScriptBundleConfig{});
 
-        // Hot-reload system is now implemented in C++ (FileWatcher + ScriptReloader)
-        // No longer need to load JavaScript hot-reload files
+        if (m_scriptBundler->BuildIfStale())
+        {
+            auto const loadStart = std::chrono::steady_clock::now();
 
-        DAEMON_LOG(LogGame, eLogVerbosity::Display, "Loading JSGame.js...");
-        ExecuteJavaScriptFile("Data/Scripts/JSGame.js");
+            DAEMON_LOG(LogGame, eLogVerbosity::Display, StringFormat("Loading {}...", m_scriptBundler->GetBundlePath()));
+            ExecuteJavaScriptFile(m_scriptBundler->GetBundlePath());
+
+            DAEMON_LOG(LogGame, eLogVerbosity::Display, StringFormat("(Game::InitializeJavaScriptFramework)(bundle of {} files compiled and run in {:.3f} ms)",
+                                                                     m_scriptBundler->GetOrderedSources().size(),
+                                                                     std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - loadStart).count()));
+            isBundleLoaded = true;
+        }
+        else
+        {
+            DAEMON_LOG(LogGame, eLogVerbosity::Warning, "Game::InitializeJavaScriptFramework() script bundle unavailable, loading separate files");
+            GAME_SAFE_RELEASE(m_scriptBundler);
+        }
+#endif
+
+        if (!isBundleLoaded)
+        {
+            auto const loadStart = std::chrono::steady_clock::now();
+
+            // Load the JavaScript framework files in dependency order
+            DAEMON_LOG(LogGame, eLogVerbosity::Display, "Loading JSEngine.js...");
+            ExecuteJavaScriptFile("Data/Scripts/JSEngine.js");
+
+            DAEMON_LOG(LogGame, eLogVerbosity::Display, "Loading InputSystem.js...");
+            ExecuteJavaScriptFile("Data/Scripts/InputSystem.js");
+
+            // Hot-reload system is now implemented in C++ (FileWatcher + ScriptReloader)
+            // No longer need to load JavaScript hot-reload files
+
+            DAEMON_LOG(LogGame, eLogVerbosity::Display, "Loading JSGame.js...");
+            ExecuteJavaScriptFile("Data/Scripts/JSGame.js");
+
+            DAEMON_LOG(LogGame, eLogVerbosity::Display, StringFormat("(Game::InitializeJavaScriptFramework)(3 separate files compiled and run in {:.3f} ms)",
+                                                                     std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - loadStart).count()));
+        }
 
         DAEMON_LOG(LogGame, eLogVerbosity::Display, "Game::InitializeJavaScriptFramework() complete - C++ hot-reload system integrated");
     }
@@ -820,3 +1586,11 @@ void Game::InitializeJavaScriptFramework()
         DAEMON_LOG(LogGame, eLogVerbosity::Error, "Game::InitializeJavaScriptFramework() exception occurred");
     }
 }
+
+//----------------------------------------------------------------------------------------------------
+String Game::GetScriptError() const
+{
+    String const error = g_v8Subsystem->GetLastError();
+
+    return m_scriptBundler != nullptr ? m_scriptBundler->MapErrorMessage(error) : error;
+}
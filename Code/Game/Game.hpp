@@ -4,16 +4,31 @@
 
 //----------------------------------------------------------------------------------------------------
 #pragma once
+#include <chrono>
 #include <vector>
 
+#include "Engine/Core/EventSystem.hpp"
 #include "Engine/Core/StringUtils.hpp"
 #include "Engine/Renderer/VertexUtils.hpp"
+#include "Game/Framework/WorldSnapshot.hpp"
 
 //-Forward-Declaration--------------------------------------------------------------------------------
+class ActionMap;
+class AudioVoicePool;
 class Camera;
 class Clock;
+class DrawPacketBuilder;
+class EngineAudioOutput;
+class OcclusionCuller;
 class Player;
 class Prop;
+class ScriptBundler;
+class StressScenario;
+class Texture;
+class TextureAtlas;
+class WorkerPool;
+struct sGameConfig;
+struct sStressScenarioConfig;
 
 //----------------------------------------------------------------------------------------------------
 enum class eGameState : uint8_t
@@ -22,6 +37,22 @@ enum class eGameState : uint8_t
     GAME
 };
 
+//----------------------------------------------------------------------------------------------------
+struct sFastForwardConfig
+{
+    float    m_fixedDeltaSeconds   = 1.f / 60.f;
+    uint32_t m_renderEveryNthFrame = 10;           // 0 = never render while fast-forwarding
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sFastForwardStats
+{
+    uint64_t m_stepCount               = 0;
+    double   m_simulatedSeconds        = 0.0;
+    double   m_wallSeconds             = 0.0;
+    double   m_simSecondsPerWallSecond = 0.0;      // Over the most recent one-second window
+};
+
 //----------------------------------------------------------------------------------------------------
 class Game
 {
@@ -30,6 +61,7 @@ public:
     ~Game();
 
     void PostInit();
+    void ApplyConfig(sGameConfig const& config);      // Hot reloadable tunables only
     void UpdateJS();
     void RenderJS();
     bool IsAttractMode() const;
@@ -50,36 +82,109 @@ public:
     void    Update(float gameDeltaSeconds, float systemDeltaSeconds);
     void    Render() const;
 
+    // Fast-forward: fixed-delta simulation as fast as the CPU allows, rendering every Nth frame
+    void                      SetFastForward(bool isEnabled, sFastForwardConfig const& config);
+    bool                      IsFastForwarding() const;
+    bool                      UpdateFastForwardJS();
+    sFastForwardConfig const& GetFastForwardConfig() const;
+    sFastForwardStats const&  GetFastForwardStats() const;
+
+    static bool ParseFastForwardCommandLine(String const& commandLine, sFastForwardConfig& out_config);
+    static bool OnFastForwardCommand(EventArgs& args);
+
+    // Stress scenario: StressScenario.js ramps the entity count, Game times each step's frames
+    void StartStressScenario(sStressScenarioConfig const& config);
+    bool RecordStressStep(uint32_t entityCount, uint32_t spawnedCount, double bridgeMilliseconds);
+    bool FinishStressScenario(String& out_superlinearSubsystem);
+
+    // Software occlusion culling of props against designated occluder props
+    void SetOcclusionCulling(bool isEnabled);
+    bool IsOcclusionCullingEnabled() const;
+
+    // Data-driven bindings resolved once per sim step; read actions instead of keys
+    ActionMap const* GetActionMap() const;
+
+    // Pooled, virtualized voices; script code drives them through batched commands
+    AudioVoicePool* GetAudioVoicePool() const;
+
+    // World snapshot (binary, async write / mmap read)
+    bool SaveSnapshot(String const& filePath);
+    bool LoadSnapshot(String const& filePath);
+
     // 新增：控制台命令處理
     void HandleConsoleCommands();
 
 private:
-    void UpdateFromKeyBoard();
-    void UpdateFromController();
+    void UpdateFromActions();
     void UpdateEntities(float gameDeltaSeconds, float systemDeltaSeconds) const;
     void RenderAttractMode() const;
     void RenderGame() const;
     void RenderEntities() const;
+    void SubmitDrawPackets() const;
+
+    void UpdatePropLevelsOfDetail();
+
+    uint16_t GetPropMaterialKey(Prop const& prop) const;      // Groups packets by texture
+
+    void  SpawnPlayer();
+    void  InitPlayer() const;
+    void  SpawnProps();
+    void  InitProps() const;
+    void  BuildPropTextureAtlas();
+    Prop* CreateTexturedProp(uint32_t textureIndex);
 
-    void SpawnPlayer();
-    void InitPlayer() const;
-    void SpawnProps();
-    void InitProps() const;
 
+    void ClearProps();
 
-    void SetupJavaScriptBindings();
-    void InitializeJavaScriptFramework();
+    void   SetupJavaScriptBindings();
+    void   InitializeJavaScriptFramework();
+    String GetScriptError() const;     // V8's last error, with bundle locations mapped back to the source files
+    double GetGameSeconds() const;     // Game clock time, plus what fast-forward simulated beyond it
 
+    ActionMap*         m_actionMap    = nullptr;
     Camera*            m_screenCamera = nullptr;
     Player*            m_player       = nullptr;
     std::vector<Prop*> m_props;
     Clock*             m_gameClock = nullptr;
     eGameState         m_gameState = eGameState::ATTRACT;
 
+    WorldSnapshotWriter m_snapshotWriter;
+
+    mutable uint32_t m_submittedVertexCount = 0;     // Counted while rendering props, shown next frame
+
+    WorkerPool*      m_workerPool                = nullptr;
+    OcclusionCuller* m_occlusionCuller           = nullptr;
+    bool             m_isOcclusionCullingEnabled = true;
+    float            m_lodDetailScale            = 1.f;     // Below 1 props switch to coarser levels sooner
+    mutable uint32_t m_visiblePropCount          = 0;     // Last rendered frame
+    mutable uint32_t m_occludedPropCount         = 0;
+
+    DrawPacketBuilder* m_drawPacketBuilder = nullptr;     // Per-prop draw data, built in parallel each frame
+
+    TextureAtlas*         m_propTextureAtlas = nullptr;     // Small prop textures packed into shared pages
+    std::vector<Texture*> m_propAtlasPages;                 // GPU copies of the atlas pages, owned by the Renderer
+
+    EngineAudioOutput* m_audioOutput    = nullptr;
+    AudioVoicePool*    m_audioVoicePool = nullptr;     // Listener follows the player
+
+    bool               m_isFastForwarding    = false;
+    bool               m_isSimulationSubStep = false;     // Extra fast-forward steps skip input and debug text
+    sFastForwardConfig m_fastForwardConfig;
+    sFastForwardStats  m_fastForwardStats;
+    double             m_fastForwardWindowSimSeconds  = 0.0;
+    double             m_fastForwardWindowWallSeconds = 0.0;
+    double             m_gameSecondsOffset            = 0.0;     // Fixed steps minus the wall time the game clock ticked meanwhile; snapshot time
+
+    std::chrono::steady_clock::time_point m_fastForwardLastFrameTime;
+
+    StressScenario* m_stressScenario = nullptr;     // Only under -stressScenario=MAX, until the script finishes it
+
 
     bool m_hasInitializedJS = false;
     bool m_hasRunJSTests    = false;
 
+    ScriptBundler* m_scriptBundler = nullptr;     // Only when the framework was loaded as one bundle (GAME_SCRIPT_BUNDLE)
+
     Vec3 m_originalPlayerPosition = Vec3(-2.f, 0.f, 1.f);  // 儲存原始位置
     bool m_cameraShakeActive      = false;                        // 追蹤震動狀態
 };
@@ -9,6 +9,7 @@
 #include "Engine/Input/InputSystem.hpp"
 #include "Engine/Math/MathUtils.hpp"
 #include "Engine/Renderer/Camera.hpp"
+#include "Game/Framework/ActionMap.hpp"
 #include "Game/Game.hpp"
 
 //----------------------------------------------------------------------------------------------------
@@ -17,7 +18,7 @@ Player::Player(Game* owner)
 {
     m_worldCamera = new Camera();
 
-    m_worldCamera->SetPerspectiveGraphicView(2.f, 60.f, 0.1f, 100.f);
+    m_worldCamera->SetPerspectiveGraphicView(2.f, CAMERA_FOV_DEGREES, 0.1f, 100.f);
 
     m_worldCamera->SetNormalizedViewport(AABB2::ZERO_TO_ONE);
 
@@ -43,9 +44,9 @@ Player::~Player()
 //----------------------------------------------------------------------------------------------------
 void Player::Update(float deltaSeconds)
 {
-    XboxController const& controller = g_input->GetController(0);
+    ActionMap const& actions = *m_game->GetActionMap();
 
-    if (g_input->WasKeyJustPressed(KEYCODE_H) || controller.WasButtonJustPressed(XBOX_BUTTON_START))
+    if (actions.WasJustPressed(eAction::RESET_CAMERA))
     {
         if (m_game->IsAttractMode() == false)
         {
@@ -62,23 +63,21 @@ void Player::Update(float deltaSeconds)
     m_velocity                = Vec3::ZERO;
     float constexpr moveSpeed = 2.f;
 
-    Vec2 const leftStickInput = controller.GetLeftStick().GetPosition();
-    m_velocity += Vec3(leftStickInput.y, -leftStickInput.x, 0.f) * moveSpeed;
+    m_velocity += Vec3(actions.GetAxis(eActionAxis::MOVE_Y), -actions.GetAxis(eActionAxis::MOVE_X), 0.f) * moveSpeed;
 
-    if (g_input->IsKeyDown(KEYCODE_W)) m_velocity += forward * moveSpeed;
-    if (g_input->IsKeyDown(KEYCODE_S)) m_velocity -= forward * moveSpeed;
-    if (g_input->IsKeyDown(KEYCODE_A)) m_velocity += left * moveSpeed;
-    if (g_input->IsKeyDown(KEYCODE_D)) m_velocity -= left * moveSpeed;
-    if (g_input->IsKeyDown(KEYCODE_Z) || controller.IsButtonDown(XBOX_BUTTON_LSHOULDER)) m_velocity -= Vec3(0.f, 0.f, 1.f) * moveSpeed;
-    if (g_input->IsKeyDown(KEYCODE_C) || controller.IsButtonDown(XBOX_BUTTON_RSHOULDER)) m_velocity += Vec3(0.f, 0.f, 1.f) * moveSpeed;
+    if (actions.IsDown(eAction::MOVE_FORWARD)) m_velocity += forward * moveSpeed;
+    if (actions.IsDown(eAction::MOVE_BACK)) m_velocity -= forward * moveSpeed;
+    if (actions.IsDown(eAction::MOVE_LEFT)) m_velocity += left * moveSpeed;
+    if (actions.IsDown(eAction::MOVE_RIGHT)) m_velocity -= left * moveSpeed;
+    if (actions.IsDown(eAction::MOVE_DOWN)) m_velocity -= Vec3(0.f, 0.f, 1.f) * moveSpeed;
+    if (actions.IsDown(eAction::MOVE_UP)) m_velocity += Vec3(0.f, 0.f, 1.f) * moveSpeed;
 
-    if (g_input->IsKeyDown(KEYCODE_SHIFT) || controller.IsButtonDown(XBOX_BUTTON_A)) deltaSeconds *= 10.f;
+    if (actions.IsDown(eAction::SPRINT)) deltaSeconds *= 10.f;
 
     m_position += m_velocity * deltaSeconds;
 
-    Vec2 const rightStickInput = controller.GetRightStick().GetPosition();
-    m_orientation.m_yawDegrees -= rightStickInput.x * 0.125f;
-    m_orientation.m_pitchDegrees -= rightStickInput.y * 0.125f;
+    m_orientation.m_yawDegrees -= actions.GetAxis(eActionAxis::LOOK_X) * 0.125f;
+    m_orientation.m_pitchDegrees -= actions.GetAxis(eActionAxis::LOOK_Y) * 0.125f;
 
     m_orientation.m_yawDegrees -= g_input->GetCursorClientDelta().x * 0.125f;
     m_orientation.m_pitchDegrees += g_input->GetCursorClientDelta().y * 0.125f;
@@ -86,21 +85,18 @@ void Player::Update(float deltaSeconds)
 
     m_angularVelocity.m_rollDegrees = 0.f;
 
-    float const leftTriggerInput  = controller.GetLeftTrigger();
-    float const rightTriggerInput = controller.GetRightTrigger();
-
-    if (leftTriggerInput != 0.f)
+    if (actions.GetAxis(eActionAxis::ROLL_NEGATIVE) != 0.f)
     {
         m_angularVelocity.m_rollDegrees -= 90.f;
     }
 
-    if (rightTriggerInput != 0.f)
+    if (actions.GetAxis(eActionAxis::ROLL_POSITIVE) != 0.f)
     {
         m_angularVelocity.m_rollDegrees += 90.f;
     }
 
-    if (g_input->IsKeyDown(KEYCODE_Q)) m_angularVelocity.m_rollDegrees = 90.f;
-    if (g_input->IsKeyDown(KEYCODE_E)) m_angularVelocity.m_rollDegrees = -90.f;
+    if (actions.IsDown(eAction::ROLL_LEFT)) m_angularVelocity.m_rollDegrees = 90.f;
+    if (actions.IsDown(eAction::ROLL_RIGHT)) m_angularVelocity.m_rollDegrees = -90.f;
 
     m_orientation.m_rollDegrees += m_angularVelocity.m_rollDegrees * deltaSeconds;
     m_orientation.m_rollDegrees = GetClamped(m_orientation.m_rollDegrees, -45.f, 45.f);
@@ -23,6 +23,8 @@ public:
 
     Camera* GetCamera() const;
 
+    static float constexpr CAMERA_FOV_DEGREES = 60.f;
+
 private:
     Camera* m_worldCamera = nullptr;
 };
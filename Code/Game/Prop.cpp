@@ -7,12 +7,20 @@
 
 #include "Engine/Core/Clock.hpp"
 #include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/MathUtils.hpp"
 #include "Engine/Renderer/BitmapFont.hpp"
 #include "Engine/Renderer/Renderer.hpp"
 #include "Engine/Renderer/VertexUtils.hpp"
+#include "Game/Framework/CountingRenderer.hpp"
+#include "Game/Framework/DrawPacketBuilder.hpp"
 #include "Game/Framework/GameCommon.hpp"
+#include "Game/Framework/OcclusionCuller.hpp"
+#include "Game/Framework/SoftwareRenderer.hpp"
+#include "Game/Framework/TextureAtlas.hpp"
 #include "ThirdParty/stb/stb_image.h"
 
+#include <cfloat>
+
 //----------------------------------------------------------------------------------------------------
 Prop::Prop(Game* owner, Texture const* texture)
     : Entity(owner),
@@ -31,71 +39,208 @@ void Prop::Update(float const deltaSeconds)
 //----------------------------------------------------------------------------------------------------
 void Prop::Render() const
 {
-    g_renderer->SetModelConstants(GetModelToWorldTransform(), m_color);
-    g_renderer->SetBlendMode(eBlendMode::OPAQUE); //AL
-    g_renderer->SetRasterizerMode(eRasterizerMode::SOLID_CULL_BACK);  //SOLID_CULL_NONE
-    g_renderer->SetSamplerMode(eSamplerMode::POINT_CLAMP);
-    g_renderer->SetDepthMode(eDepthMode::READ_WRITE_LESS_EQUAL);  //DISABLE
-    g_renderer->BindTexture(m_texture);
-    g_renderer->BindShader(g_renderer->CreateOrGetShaderFromFile("Data/Shaders/Bloom", eVertexType::VERTEX_PCU));
-    g_renderer->DrawVertexArray(static_cast<int>(m_vertexes.size()), m_vertexes.data());
+    if (GetVertexCount() == 0)
+    {
+        return;
+    }
+
+    VertexList_PCU const& vertexes = GetLevelVertexes();
+
+    // An atlas page is meaningless to a mesh whose UVs could not be remapped, so draw it untextured.
+    Texture const* texture = m_isAtlasTextured && m_atlasLevels.empty() ? nullptr : m_texture;
+
+    g_countingRenderer->SetModelConstants(GetModelToWorldTransform(), m_color);
+    g_countingRenderer->SetBlendMode(eBlendMode::OPAQUE); //AL
+    g_countingRenderer->SetRasterizerMode(eRasterizerMode::SOLID_CULL_BACK);  //SOLID_CULL_NONE
+    g_countingRenderer->SetSamplerMode(eSamplerMode::POINT_CLAMP);
+    g_countingRenderer->SetDepthMode(eDepthMode::READ_WRITE_LESS_EQUAL);  //DISABLE
+    g_countingRenderer->BindTexture(texture);
+    g_countingRenderer->BindShader(g_renderer->CreateOrGetShaderFromFile("Data/Shaders/Bloom", eVertexType::VERTEX_PCU));
+    g_countingRenderer->DrawVertexArray(static_cast<int>(vertexes.size()), vertexes.data());
 }
 
 //----------------------------------------------------------------------------------------------------
-void Prop::InitializeLocalVertsForCube()
+void Prop::Render(SoftwareRenderer& renderer) const
 {
-    Vec3 const frontBottomLeft(0.5f, -0.5f, -0.5f);
-    Vec3 const frontBottomRight(0.5f, 0.5f, -0.5f);
-    Vec3 const frontTopLeft(0.5f, -0.5f, 0.5f);
-    Vec3 const frontTopRight(0.5f, 0.5f, 0.5f);
-    Vec3 const backBottomLeft(-0.5f, 0.5f, -0.5f);
-    Vec3 const backBottomRight(-0.5f, -0.5f, -0.5f);
-    Vec3 const backTopLeft(-0.5f, 0.5f, 0.5f);
-    Vec3 const backTopRight(-0.5f, -0.5f, 0.5f);
+    if (GetVertexCount() == 0)
+    {
+        return;
+    }
 
-    AddVertsForQuad3D(m_vertexes, frontBottomLeft, frontBottomRight, frontTopLeft, frontTopRight, Rgba8::RED);          // +X Red
-    AddVertsForQuad3D(m_vertexes, backBottomLeft, backBottomRight, backTopLeft, backTopRight, Rgba8::CYAN);             // -X -Red (Cyan)
-    AddVertsForQuad3D(m_vertexes, frontBottomRight, backBottomLeft, frontTopRight, backTopLeft, Rgba8::GREEN);          // -Y -Green (Magenta)
-    AddVertsForQuad3D(m_vertexes, backBottomRight, frontBottomLeft, backTopRight, frontTopLeft, Rgba8::MAGENTA);        // +Y Green
-    AddVertsForQuad3D(m_vertexes, frontTopLeft, frontTopRight, backTopRight, backTopLeft, Rgba8::BLUE);                 // +Z Blue
-    AddVertsForQuad3D(m_vertexes, backBottomRight, backBottomLeft, frontBottomLeft, frontBottomRight, Rgba8::YELLOW);   // -Z -Blue (Yellow)
+    renderer.SetModelConstants(GetModelToWorldTransform(), m_color);
+    renderer.SetBlendMode(eBlendMode::OPAQUE);
+    renderer.SetRasterizerMode(eRasterizerMode::SOLID_CULL_BACK);
+    renderer.SetSamplerMode(eSamplerMode::POINT_CLAMP);
+    renderer.SetDepthMode(eDepthMode::READ_WRITE_LESS_EQUAL);
+    renderer.BindTexture(nullptr);
+    renderer.DrawQuantizedMesh(m_mesh->m_quantizedLevels[m_lodLevel]);
 }
 
 //----------------------------------------------------------------------------------------------------
-void Prop::InitializeLocalVertsForSphere()
+// Packet form of Render(); the caller sets the shared render state and binds textures on submission.
+//
+bool Prop::BuildDrawPacket(Vec3 const&    cameraPosition,
+                           uint16_t const materialKey,
+                           sDrawPacket&   out_packet) const
 {
-    float constexpr radius    = 0.5f;
-    int constexpr   numSlices = 32;
-    int constexpr   numStacks = 16;
-    Rgba8 const     color     = Rgba8::WHITE;
-    AABB2 const     UVs       = AABB2::ZERO_TO_ONE;
+    if (GetVertexCount() == 0)
+    {
+        return false;
+    }
 
-    AddVertsForSphere3D(m_vertexes, m_position, radius, color, UVs, numSlices, numStacks);
+    VertexList_PCU const& vertexes = GetLevelVertexes();
+
+    out_packet.m_sortKey      = sDrawPacket::MakeSortKey(materialKey, static_cast<uint8_t>(m_meshType), m_lodLevel, GetDistanceSquared3D(m_position, cameraPosition));
+    out_packet.m_vertexCount  = static_cast<uint32_t>(vertexes.size());
+    out_packet.m_vertexes     = vertexes.data();
+    out_packet.m_texture      = m_isAtlasTextured && m_atlasLevels.empty() ? nullptr : m_texture;
+    out_packet.m_modelToWorld = GetModelToWorldTransform();
+    out_packet.m_color        = m_color;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void Prop::InitializeLocalVertsForCube()
+{
+    SetMeshType(ePropMeshType::CUBE);
+}
+
+//----------------------------------------------------------------------------------------------------
+void Prop::InitializeLocalVertsForSphere()
+{
+    SetMeshType(ePropMeshType::SPHERE);
 }
 
 //----------------------------------------------------------------------------------------------------
 void Prop::InitializeLocalVertsForGrid()
 {
-    float gridLineLength = 100.f;
+    SetMeshType(ePropMeshType::GRID);
+}
+
+//----------------------------------------------------------------------------------------------------
+void Prop::SetMeshType(ePropMeshType const meshType)
+{
+    m_meshType = meshType;
+    m_mesh     = &PropMeshCache::GetMesh(meshType);
+    m_lodLevel = 0;
+
+    RebuildAtlasLevels();
+}
 
-    for (int i = -(int)gridLineLength / 2; i < (int)gridLineLength / 2; i++)
+//----------------------------------------------------------------------------------------------------
+void Prop::UpdateLevelOfDetail(Vec3 const& cameraPosition,
+                               float const pixelsPerUnitAtUnitDistance)
+{
+    if (m_mesh == nullptr || m_mesh->GetLevelCount() <= 1)
     {
-        float lineWidth = 0.05f;
-        if (i == 0) lineWidth = 0.3f;
+        return;
+    }
 
-        AABB3 boundsX = AABB3(Vec3(-gridLineLength / 2.f, -lineWidth / 2.f + (float)i, -lineWidth / 2.f), Vec3(gridLineLength / 2.f, lineWidth / 2.f + (float)i, lineWidth / 2.f));
-        AABB3 boundsY = AABB3(Vec3(-lineWidth / 2.f + (float)i, -gridLineLength / 2.f, -lineWidth / 2.f), Vec3(lineWidth / 2.f + (float)i, gridLineLength / 2.f, lineWidth / 2.f));
+    float const distance             = GetDistance3D(m_position, cameraPosition);
+    float const projectedPixelRadius = distance > m_mesh->m_boundingRadius ? m_mesh->m_boundingRadius * pixelsPerUnitAtUnitDistance / distance : FLT_MAX;
 
-        Rgba8 colorX = Rgba8::DARK_GREY;
-        Rgba8 colorY = Rgba8::DARK_GREY;
+    m_lodLevel = PropMeshCache::SelectLevelOfDetail(*m_mesh, m_lodLevel, projectedPixelRadius);
+}
 
-        if (i % 5 == 0)
+//----------------------------------------------------------------------------------------------------
+uint8_t Prop::GetLevelOfDetail() const
+{
+    return m_lodLevel;
+}
+
+//----------------------------------------------------------------------------------------------------
+uint32_t Prop::GetVertexCount() const
+{
+    if (m_mesh == nullptr || m_lodLevel >= m_mesh->GetLevelCount())
+    {
+        return 0;
+    }
+
+    return static_cast<uint32_t>(m_mesh->m_levels[m_lodLevel].size());
+}
+
+//----------------------------------------------------------------------------------------------------
+void Prop::SetOccluder(bool const isOccluder)
+{
+    m_isOccluder = isOccluder;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool Prop::IsOccluder() const
+{
+    return m_isOccluder;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Uses the coarsest LOD: its vertices lie on the full-detail surface, so for the convex prop meshes it
+// sits inside the real shape and can never hide something the full mesh would not.
+//
+void Prop::RenderOccluder(OcclusionCuller& culler) const
+{
+    if (m_mesh == nullptr || m_mesh->GetLevelCount() == 0)
+    {
+        return;
+    }
+
+    culler.AddOccluder(m_mesh->m_levels[m_mesh->GetLevelCount() - 1], GetModelToWorldTransform());
+}
+
+//----------------------------------------------------------------------------------------------------
+AABB3 Prop::GetWorldBounds() const
+{
+    float const radius = m_mesh != nullptr ? m_mesh->m_boundingRadius : 0.f;
+
+    return AABB3(m_position - Vec3(radius, radius, radius), m_position + Vec3(radius, radius, radius));
+}
+
+//----------------------------------------------------------------------------------------------------
+ePropMeshType Prop::GetMeshType() const
+{
+    return m_meshType;
+}
+
+//----------------------------------------------------------------------------------------------------
+Texture const* Prop::GetTexture() const
+{
+    return m_texture;
+}
+
+//----------------------------------------------------------------------------------------------------
+void Prop::SetTextureAtlasRegion(AABB2 const& uvBounds)
+{
+    m_isAtlasTextured = true;
+    m_atlasUVBounds   = uvBounds;
+
+    RebuildAtlasLevels();
+}
+
+//----------------------------------------------------------------------------------------------------
+// The cached meshes are shared by every prop, so an atlased prop keeps its own remapped copy.
+//
+void Prop::RebuildAtlasLevels()
+{
+    m_atlasLevels.clear();
+
+    if (!m_isAtlasTextured || m_mesh == nullptr)
+    {
+        return;
+    }
+
+    m_atlasLevels = m_mesh->m_levels;
+
+    for (VertexList_PCU& level : m_atlasLevels)
+    {
+        if (!TextureAtlas::RemapUVs(level, m_atlasUVBounds))
         {
-            colorX = Rgba8::RED;
-            colorY = Rgba8::GREEN;
+            m_atlasLevels.clear();
+            return;
         }
-
-        AddVertsForAABB3D(m_vertexes, boundsX, colorX);
-        AddVertsForAABB3D(m_vertexes, boundsY, colorY);
     }
 }
+
+//----------------------------------------------------------------------------------------------------
+VertexList_PCU const& Prop::GetLevelVertexes() const
+{
+    return m_atlasLevels.empty() ? m_mesh->m_levels[m_lodLevel] : m_atlasLevels[m_lodLevel];
+}
@@ -6,12 +6,18 @@
 #pragma once
 #include <vector>
 
+#include "Engine/Math/AABB2.hpp"
 #include "Engine/Renderer/BitmapFont.hpp"
 #include "Engine/Renderer/VertexUtils.hpp"
 #include "Game/Entity.hpp"
+#include "Game/PropMeshCache.hpp"
 
 //-Forward-Declaration--------------------------------------------------------------------------------
+class OcclusionCuller;
+class SoftwareRenderer;
 class Texture;
+struct AABB3;
+struct sDrawPacket;
 struct Vertex_PCU;
 
 //----------------------------------------------------------------------------------------------------
@@ -22,12 +28,42 @@ public:
 
     void Update(float deltaSeconds) override;
     void Render() const override;
+    void Render(SoftwareRenderer& renderer) const;      // Same draw on the CPU backend (untextured)
+    bool BuildDrawPacket(Vec3 const& cameraPosition, uint16_t materialKey, sDrawPacket& out_packet) const;     // Thread-safe
 
     void InitializeLocalVertsForCube();
     void InitializeLocalVertsForSphere();
     void InitializeLocalVertsForGrid();
 
+    void           SetMeshType(ePropMeshType meshType);
+    ePropMeshType  GetMeshType() const;
+    Texture const* GetTexture() const;
+
+    // Texture is an atlas page: the mesh UVs are remapped into uvBounds (per prop, for every LOD level)
+    void SetTextureAtlasRegion(AABB2 const& uvBounds);
+
+    // pixelsPerUnitAtUnitDistance = viewportHeight / (2 * tan(fovY / 2)) for the viewing camera
+    void     UpdateLevelOfDetail(Vec3 const& cameraPosition, float pixelsPerUnitAtUnitDistance);
+    uint8_t  GetLevelOfDetail() const;
+    uint32_t GetVertexCount() const;
+
+    // Occluders are rasterized into the occlusion depth buffer and never tested themselves
+    void  SetOccluder(bool isOccluder);
+    bool  IsOccluder() const;
+    void  RenderOccluder(OcclusionCuller& culler) const;
+    AABB3 GetWorldBounds() const;       // Rotation-independent box around the bounding sphere
+
 private:
-    std::vector<Vertex_PCU> m_vertexes;
-    Texture const* m_texture = nullptr;
+    void                  RebuildAtlasLevels();
+    VertexList_PCU const& GetLevelVertexes() const;
+
+    sPropMesh const* m_mesh     = nullptr;     // Shared, owned by PropMeshCache
+    Texture const*   m_texture  = nullptr;
+    ePropMeshType    m_meshType = ePropMeshType::NONE;
+    uint8_t          m_lodLevel = 0;
+    bool             m_isOccluder = false;
+
+    bool                        m_isAtlasTextured = false;
+    AABB2                       m_atlasUVBounds;
+    std::vector<VertexList_PCU> m_atlasLevels;      // Empty when the mesh UVs cannot be remapped (wrapping)
 };
@@ -0,0 +1,171 @@
+//----------------------------------------------------------------------------------------------------
+// PropMeshCache.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/PropMeshCache.hpp"
+
+#include <iterator>
+#include <mutex>
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Math/AABB3.hpp"
+
+//----------------------------------------------------------------------------------------------------
+static sPropMesh      s_meshes[4];
+static std::once_flag s_buildOnceFlag;
+
+//----------------------------------------------------------------------------------------------------
+STATIC sPropMesh const& PropMeshCache::GetMesh(ePropMeshType const type)
+{
+    std::call_once(s_buildOnceFlag, &PropMeshCache::BuildMeshes);
+
+    // Out-of-range types (e.g. from a corrupt snapshot) fall back to the empty NONE mesh.
+    uint8_t const index = static_cast<uint8_t>(type);
+
+    return s_meshes[index < std::size(s_meshes) ? index : 0];
+}
+
+//----------------------------------------------------------------------------------------------------
+// Moves at most as far as the projected size justifies, and only once it is clearly past a switch
+// radius, so a prop sitting on a boundary does not pop back and forth every frame.
+//
+STATIC uint8_t PropMeshCache::SelectLevelOfDetail(sPropMesh const& mesh,
+                                                  uint8_t const    currentLevel,
+                                                  float const      projectedPixelRadius)
+{
+    uint8_t const levelCount = mesh.GetLevelCount();
+
+    if (levelCount <= 1)
+    {
+        return 0;
+    }
+
+    uint8_t level = currentLevel < levelCount ? currentLevel : static_cast<uint8_t>(levelCount - 1);
+
+    while (level + 1 < levelCount && projectedPixelRadius < mesh.m_switchPixelRadii[level] * (1.f - LOD_HYSTERESIS_FRACTION))
+    {
+        ++level;
+    }
+
+    while (level > 0 && projectedPixelRadius > mesh.m_switchPixelRadii[level - 1] * (1.f + LOD_HYSTERESIS_FRACTION))
+    {
+        --level;
+    }
+
+    return level;
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC void PropMeshCache::BuildMeshes()
+{
+    for (uint8_t index = 0; index < std::size(s_meshes); ++index)
+    {
+        BuildMesh(static_cast<ePropMeshType>(index), s_meshes[index]);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC void PropMeshCache::BuildMesh(ePropMeshType const type, sPropMesh& out_mesh)
+{
+    switch (type)
+    {
+    case ePropMeshType::CUBE:   BuildCube(out_mesh);   break;
+    case ePropMeshType::SPHERE: BuildSphere(out_mesh); break;
+    case ePropMeshType::GRID:   BuildGrid(out_mesh);   break;
+    case ePropMeshType::NONE:                          break;
+    }
+
+    BuildQuantizedLevels(out_mesh);
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC void PropMeshCache::BuildQuantizedLevels(sPropMesh& out_mesh)
+{
+    out_mesh.m_quantizedLevels.resize(out_mesh.m_levels.size());
+
+    for (size_t level = 0; level < out_mesh.m_levels.size(); ++level)
+    {
+        QuantizeVertexes(out_mesh.m_levels[level], out_mesh.m_quantizedLevels[level]);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC void PropMeshCache::BuildCube(sPropMesh& out_mesh)
+{
+    Vec3 const frontBottomLeft(0.5f, -0.5f, -0.5f);
+    Vec3 const frontBottomRight(0.5f, 0.5f, -0.5f);
+    Vec3 const frontTopLeft(0.5f, -0.5f, 0.5f);
+    Vec3 const frontTopRight(0.5f, 0.5f, 0.5f);
+    Vec3 const backBottomLeft(-0.5f, 0.5f, -0.5f);
+    Vec3 const backBottomRight(-0.5f, -0.5f, -0.5f);
+    Vec3 const backTopLeft(-0.5f, 0.5f, 0.5f);
+    Vec3 const backTopRight(-0.5f, -0.5f, 0.5f);
+
+    // 36 verts already; a single level.
+    out_mesh.m_boundingRadius = 0.866f;
+    out_mesh.m_levels.resize(1);
+
+    VertexList_PCU& verts = out_mesh.m_levels[0];
+
+    AddVertsForQuad3D(verts, frontBottomLeft, frontBottomRight, frontTopLeft, frontTopRight, Rgba8::RED);          // +X Red
+    AddVertsForQuad3D(verts, backBottomLeft, backBottomRight, backTopLeft, backTopRight, Rgba8::CYAN);             // -X -Red (Cyan)
+    AddVertsForQuad3D(verts, frontBottomRight, backBottomLeft, frontTopRight, backTopLeft, Rgba8::GREEN);          // -Y -Green (Magenta)
+    AddVertsForQuad3D(verts, backBottomRight, frontBottomLeft, backTopRight, frontTopLeft, Rgba8::MAGENTA);        // +Y Green
+    AddVertsForQuad3D(verts, frontTopLeft, frontTopRight, backTopRight, backTopLeft, Rgba8::BLUE);                 // +Z Blue
+    AddVertsForQuad3D(verts, backBottomRight, backBottomLeft, frontBottomLeft, frontBottomRight, Rgba8::YELLOW);   // -Z -Blue (Yellow)
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC void PropMeshCache::BuildSphere(sPropMesh& out_mesh)
+{
+    float constexpr radius = 0.5f;
+    Rgba8 const     color  = Rgba8::WHITE;
+    AABB2 const     UVs    = AABB2::ZERO_TO_ONE;
+
+    // Level 0 is the original 32x16 sphere; each coarser level halves slices and stacks.
+    int constexpr   numSlices[]        = {32, 16, 8};
+    int constexpr   numStacks[]        = {16, 8, 4};
+    float constexpr switchPixelRadii[] = {48.f, 16.f};
+
+    out_mesh.m_boundingRadius = radius;
+    out_mesh.m_levels.resize(std::size(numSlices));
+    out_mesh.m_switchPixelRadii.assign(std::begin(switchPixelRadii), std::end(switchPixelRadii));
+
+    for (size_t level = 0; level < std::size(numSlices); ++level)
+    {
+        AddVertsForSphere3D(out_mesh.m_levels[level], Vec3::ZERO, radius, color, UVs, numSlices[level], numStacks[level]);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC void PropMeshCache::BuildGrid(sPropMesh& out_mesh)
+{
+    // The grid surrounds the camera, so distance-based detail does not apply.
+    out_mesh.m_boundingRadius = 71.f;
+    out_mesh.m_levels.resize(1);
+
+    VertexList_PCU& verts          = out_mesh.m_levels[0];
+    float           gridLineLength = 100.f;
+
+    for (int i = -(int)gridLineLength / 2; i < (int)gridLineLength / 2; i++)
+    {
+        float lineWidth = 0.05f;
+        if (i == 0) lineWidth = 0.3f;
+
+        AABB3 boundsX = AABB3(Vec3(-gridLineLength / 2.f, -lineWidth / 2.f + (float)i, -lineWidth / 2.f), Vec3(gridLineLength / 2.f, lineWidth / 2.f + (float)i, lineWidth / 2.f));
+        AABB3 boundsY = AABB3(Vec3(-lineWidth / 2.f + (float)i, -gridLineLength / 2.f, -lineWidth / 2.f), Vec3(lineWidth / 2.f + (float)i, gridLineLength / 2.f, lineWidth / 2.f));
+
+        Rgba8 colorX = Rgba8::DARK_GREY;
+        Rgba8 colorY = Rgba8::DARK_GREY;
+
+        if (i % 5 == 0)
+        {
+            colorX = Rgba8::RED;
+            colorY = Rgba8::GREEN;
+        }
+
+        AddVertsForAABB3D(verts, boundsX, colorX);
+        AddVertsForAABB3D(verts, boundsY, colorY);
+    }
+}
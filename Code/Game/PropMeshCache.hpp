@@ -0,0 +1,57 @@
+//----------------------------------------------------------------------------------------------------
+// PropMeshCache.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "Engine/Renderer/VertexUtils.hpp"
+#include "Game/Framework/QuantizedVertex.hpp"
+
+//----------------------------------------------------------------------------------------------------
+enum class ePropMeshType : uint8_t
+{
+    NONE,
+    CUBE,
+    SPHERE,
+    GRID
+};
+
+//----------------------------------------------------------------------------------------------------
+// One mesh with its detail levels, finest first. m_switchPixelRadii[i] is the projected radius (in
+// pixels) below which level i+1 replaces level i. m_quantizedLevels holds the same levels in the
+// 16-byte Vertex_PCUQ format, encoded once at build time.
+//----------------------------------------------------------------------------------------------------
+struct sPropMesh
+{
+    std::vector<VertexList_PCU> m_levels;
+    std::vector<sQuantizedMesh> m_quantizedLevels;
+    std::vector<float>          m_switchPixelRadii;
+    float                       m_boundingRadius = 0.f;
+
+    uint8_t GetLevelCount() const { return static_cast<uint8_t>(m_levels.size()); }
+};
+
+//----------------------------------------------------------------------------------------------------
+// Local-space vertex data shared by every Prop of the same mesh type. Meshes are built once on first
+// use and never modified afterwards, so any number of props (and headless worlds on worker threads)
+// can read them concurrently.
+//----------------------------------------------------------------------------------------------------
+class PropMeshCache
+{
+public:
+    static sPropMesh const& GetMesh(ePropMeshType type);
+    static uint8_t          SelectLevelOfDetail(sPropMesh const& mesh, uint8_t currentLevel, float projectedPixelRadius);
+    static void             BuildMesh(ePropMeshType type, sPropMesh& out_mesh);     // Uncached; GetMesh() runs this once per type
+
+    static float constexpr LOD_HYSTERESIS_FRACTION = 0.15f;   // Band around each switch radius to stop flicker
+
+private:
+    static void BuildMeshes();
+    static void BuildCube(sPropMesh& out_mesh);
+    static void BuildSphere(sPropMesh& out_mesh);
+    static void BuildGrid(sPropMesh& out_mesh);
+    static void BuildQuantizedLevels(sPropMesh& out_mesh);
+};
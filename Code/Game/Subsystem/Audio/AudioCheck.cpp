@@ -0,0 +1,317 @@
+//----------------------------------------------------------------------------------------------------
+// AudioCheck.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/HeadlessRunner.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <thread>
+#include <vector>
+
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Math/RandomNumberGenerator.hpp"
+#include "Game/Subsystem/Audio/AudioOutput.hpp"
+#include "Game/Subsystem/Audio/AudioStream.hpp"
+#include "Game/Subsystem/Audio/AudioVoicePool.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// Reference for AudioStream: the same frame rules applied to the whole file in memory.
+//
+static void CountMpegFrames(std::vector<uint8_t> const& bytes,
+                            uint64_t&                   out_frameCount,
+                            uint64_t&                   out_sampleCount)
+{
+    out_frameCount  = 0;
+    out_sampleCount = 0;
+
+    size_t           cursor = AudioStream::GetID3v2TagBytes(bytes.data(), bytes.size());
+    sMpegFrameHeader streamHeader;
+
+    auto const isSameStream = [](sMpegFrameHeader const& a, sMpegFrameHeader const& b) {
+        return a.m_version == b.m_version && a.m_layer == b.m_layer && a.m_sampleRate == b.m_sampleRate;
+    };
+
+    while (cursor + 4 <= bytes.size())
+    {
+        sMpegFrameHeader header;
+        bool             isFrame = AudioStream::ParseFrameHeader(&bytes[cursor], header) && cursor + header.m_frameBytes <= bytes.size() &&
+                                   (out_frameCount == 0 || isSameStream(header, streamHeader));
+
+        if (isFrame && cursor + header.m_frameBytes + 4 <= bytes.size())
+        {
+            uint8_t const*   next = &bytes[cursor + header.m_frameBytes];
+            sMpegFrameHeader nextHeader;
+
+            isFrame = (AudioStream::ParseFrameHeader(next, nextHeader) && isSameStream(header, nextHeader)) || std::memcmp(next, "TAG", 3) == 0;
+        }
+
+        if (!isFrame)
+        {
+            ++cursor;
+            continue;
+        }
+
+        streamHeader = header;
+        ++out_frameCount;
+        out_sampleCount += header.m_sampleCount;
+        cursor += header.m_frameBytes;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+// Audio commands are text; keeping test values at the printed precision makes them round-trip exactly.
+//
+static float RoundToCommandPrecision(float const value)
+{
+    return std::strtof(Stringf("%.3f", value).c_str(), nullptr);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool RunAudioCheck(sHeadlessRunConfig const& config)
+{
+    String report = Stringf("Audio: %s\n", config.m_audioFilePath.c_str());
+
+    std::vector<uint8_t> fileBytes;
+    std::ifstream        file(config.m_audioFilePath, std::ios::binary);
+
+    if (file.is_open())
+    {
+        fileBytes.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    uint64_t referenceFrames  = 0;
+    uint64_t referenceSamples = 0;
+    CountMpegFrames(fileBytes, referenceFrames, referenceSamples);
+
+    report += Stringf("file bytes %u, reference %llu frames, %llu samples\n", static_cast<uint32_t>(fileBytes.size()), referenceFrames, referenceSamples);
+    report += "buffers  bufferBytes  memoryBytes  frames  samples  seconds  peakFilled  stream ms  validation\n";
+
+    struct sStreamCase
+    {
+        uint32_t m_bufferCount;
+        uint32_t m_bufferBytes;
+    };
+
+    sStreamCase const streamCases[] = {{2, AudioStream::MAX_FRAME_BYTES}, {4, 16 * 1024}, {16, 64 * 1024}};
+
+    bool  isValid         = !fileBytes.empty() && referenceFrames > 0;
+    float durationSeconds = 0.f;
+
+    for (sStreamCase const& streamCase : streamCases)
+    {
+        sAudioStreamConfig streamConfig;
+        streamConfig.m_bufferCount = streamCase.m_bufferCount;
+        streamConfig.m_bufferBytes = streamCase.m_bufferBytes;
+
+        AudioStream stream(streamConfig);
+        auto const  startTime = std::chrono::steady_clock::now();
+        bool const  isOpen    = stream.Open(config.m_audioFilePath);
+        uint64_t    frames    = 0;
+        uint64_t    samples   = 0;
+
+        while (isOpen && !stream.IsFinished())
+        {
+            sAudioStreamBuffer const* buffer = stream.AcquireBuffer();
+
+            if (buffer == nullptr)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            frames += buffer->m_frameCount;
+            samples += buffer->m_sampleCount;
+            stream.ReleaseBuffer();
+        }
+
+        double const            streamMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+        sAudioStreamStats const stats              = stream.GetStats();
+        bool const              isMatch            = isOpen && frames == referenceFrames && samples == referenceSamples && stats.m_frameCount == frames;
+
+        isValid         = isValid && isMatch;
+        durationSeconds = static_cast<float>(stats.GetDurationSeconds());
+
+        report += Stringf("%7u  %11u  %11llu  %6llu  %7llu  %7.3f  %10u  %9.3f  %s\n", streamCase.m_bufferCount, streamCase.m_bufferBytes,
+                          stats.m_bufferMemoryBytes, frames, samples, stats.GetDurationSeconds(), stats.m_peakFilledBuffers, streamMilliseconds,
+                          isMatch ? "OK" : "MISMATCH");
+    }
+
+    // The game times its one-shots with MeasureDurationSeconds(); it must agree with the stream.
+    double const measuredSeconds = AudioStream::MeasureDurationSeconds(config.m_audioFilePath);
+    bool const   isMeasuredMatch = std::fabs(measuredSeconds - durationSeconds) <= 1e-3;
+
+    isValid = isValid && isMeasuredMatch;
+    report += Stringf("measured seconds %.3f, %s\n", measuredSeconds, isMeasuredMatch ? "OK" : "MISMATCH");
+
+    // An untimed one-shot that loses its real voice is stopped, not left to replay from the start.
+    NullAudioOutput untimedOutput;
+    AudioVoicePool  untimedPool(sAudioVoicePoolConfig(), untimedOutput);
+    sAudioVoiceDesc untimedDesc;
+    untimedDesc.m_soundID = untimedOutput.CreateOrGetSound("untimed");
+
+    AudioVoiceHandle const untimedHandle = untimedPool.Play(untimedDesc);
+    untimedPool.Update(1.f / 60.f);
+
+    bool const wasUntimedReal = untimedPool.IsReal(untimedHandle);
+    untimedPool.SetRealVoiceBudget(0, 0.f);
+    untimedPool.Update(1.f / 60.f);
+
+    bool const isUntimedValid = wasUntimedReal && !untimedPool.IsValid(untimedHandle) && untimedOutput.GetStats().m_playingCount == 0;
+
+    isValid = isValid && isUntimedValid;
+    report += Stringf("untimed one-shot %s\n", isUntimedValid ? "stopped when virtualized, OK" : "FAILED");
+
+    // Voice pool: every spawn, move and stop goes through one ExecuteCommands() batch per frame.
+    NullAudioOutput output;
+    SoundID const   soundID = output.CreateOrGetSound(config.m_audioFilePath);
+    output.SetSoundDuration(soundID, durationSeconds);
+
+    sAudioVoicePoolConfig poolConfig;
+    poolConfig.m_maxVoices = std::min(config.m_audioVoiceCount, 0xFFFFu);
+
+    AudioVoicePool pool(poolConfig, output);
+
+    struct sVoiceRecord
+    {
+        Vec3  m_position;
+        float m_volume       = 1.f;
+        bool  m_isPositional = false;
+    };
+
+    std::map<AudioVoiceHandle, sVoiceRecord> records;
+    RandomNumberGenerator                    rng;
+
+    uint32_t const spawnsPerFrame = std::max(poolConfig.m_maxVoices / 60, 1u);
+    float const    deltaSeconds   = 1.f / 60.f;
+    double         totalMicros    = 0.0;
+    double         maxMicros      = 0.0;
+    uint32_t       commandCount   = 0;
+    uint32_t       commandErrors  = 0;
+    bool           isPoolValid    = true;
+
+    for (uint32_t frame = 0; frame < config.m_frameCount; ++frame)
+    {
+        String                    commands;
+        std::vector<sVoiceRecord> spawned;
+
+        for (uint32_t spawn = 0; spawn < spawnsPerFrame; ++spawn)
+        {
+            sVoiceRecord record;
+            record.m_volume       = RoundToCommandPrecision(rng.RollRandomFloatInRange(0.05f, 1.f));
+            record.m_isPositional = rng.RollRandomFloatZeroToOne() < 0.75f;
+            record.m_position     = Vec3(RoundToCommandPrecision(rng.RollRandomFloatInRange(-60.f, 60.f)), RoundToCommandPrecision(rng.RollRandomFloatInRange(-60.f, 60.f)),
+                                         RoundToCommandPrecision(rng.RollRandomFloatInRange(-10.f, 10.f)));
+
+            int const isLooped = rng.RollRandomFloatZeroToOne() < 0.3f ? 1 : 0;
+
+            commands += record.m_isPositional ? Stringf("play %s %.3f %d %.3f %.3f %.3f\n", config.m_audioFilePath.c_str(), record.m_volume, isLooped,
+                                                        record.m_position.x, record.m_position.y, record.m_position.z)
+                                              : Stringf("play %s %.3f %d\n", config.m_audioFilePath.c_str(), record.m_volume, isLooped);
+            spawned.push_back(record);
+        }
+
+        // Move a few voices and stop one, picked from what is still alive.
+        for (auto iterator = records.begin(); iterator != records.end() && commands.size() < 64 * 1024; ++iterator)
+        {
+            if (!pool.IsValid(iterator->first) || rng.RollRandomFloatZeroToOne() > 0.02f)
+            {
+                continue;
+            }
+
+            Vec3& position = iterator->second.m_position;
+            position.x     = RoundToCommandPrecision(position.x + rng.RollRandomFloatInRange(-2.f, 2.f));
+            position.y     = RoundToCommandPrecision(position.y + rng.RollRandomFloatInRange(-2.f, 2.f));
+            commands += Stringf("move %u %.3f %.3f %.3f;", iterator->first, position.x, position.y, position.z);
+        }
+
+        if (!records.empty() && frame % 4 == 0)
+        {
+            commands += Stringf("stop %u\n", records.begin()->first);
+        }
+
+        sAudioCommandResult const result = pool.ExecuteCommands(commands);
+        commandCount += result.m_commandCount;
+        commandErrors += result.m_errorCount;
+
+        for (size_t i = 0; i < result.m_playedHandles.size(); ++i)
+        {
+            if (result.m_playedHandles[i] != 0)
+            {
+                records[result.m_playedHandles[i]] = spawned[i];
+            }
+        }
+
+        float const angle = 0.01f * static_cast<float>(frame);
+        Vec3 const  listenerPosition(40.f * std::cos(angle), 40.f * std::sin(angle), 0.f);
+        Vec3 const  listenerLeft(-std::sin(angle), std::cos(angle), 0.f);
+
+        output.Advance(deltaSeconds);
+        pool.SetListener(listenerPosition, listenerLeft);
+        pool.Update(deltaSeconds);
+
+        double const micros = pool.GetStats().m_updateMicroseconds;
+        totalMicros += micros;
+        maxMicros = std::max(maxMicros, micros);
+
+        std::erase_if(records, [&pool](auto const& entry) { return !pool.IsValid(entry.first); });
+
+        // Brute force: recompute every audibility, sort all voices, and compare the top N with IsReal().
+        std::vector<std::pair<float, uint32_t>> ranked;
+        uint32_t                                realCount = 0;
+
+        for (auto const& [handle, record] : records)
+        {
+            float attenuation = 1.f;
+
+            if (record.m_isPositional)
+            {
+                float const distance = (record.m_position - listenerPosition).GetLength();
+                attenuation          = distance >= 50.f ? 0.f : (distance > 1.f ? 1.f / distance : 1.f);
+            }
+
+            float const audibility = record.m_volume * attenuation;
+            isPoolValid            = isPoolValid && std::fabs(audibility - pool.GetAudibility(handle)) <= 1e-5f;
+            realCount += pool.IsReal(handle) ? 1 : 0;
+
+            if (audibility >= poolConfig.m_minAudibility)
+            {
+                ranked.emplace_back(-audibility, handle & 0xFFFF);
+            }
+        }
+
+        std::sort(ranked.begin(), ranked.end());
+        ranked.resize(std::min<size_t>(ranked.size(), poolConfig.m_maxRealVoices));
+
+        for (auto const& [negativeAudibility, slot] : ranked)
+        {
+            auto const iterator = std::find_if(records.begin(), records.end(), [slot](auto const& entry) { return (entry.first & 0xFFFF) == slot; });
+            isPoolValid         = isPoolValid && iterator != records.end() && pool.IsReal(iterator->first);
+        }
+
+        isPoolValid = isPoolValid && realCount == ranked.size() && output.GetStats().m_playingCount == realCount &&
+                      pool.GetStats().m_activeVoiceCount == records.size();
+    }
+
+    sAudioVoicePoolStats const& poolStats = pool.GetStats();
+
+    report += Stringf("voices %u tracked, %u real max, %u frames, %u spawns/frame\n", poolConfig.m_maxVoices, poolConfig.m_maxRealVoices, config.m_frameCount,
+                      spawnsPerFrame);
+    report += Stringf("update us        avg %.2f, max %.2f\n", config.m_frameCount > 0 ? totalMicros / config.m_frameCount : 0.0, maxMicros);
+    report += Stringf("voices           %llu realized, %llu virtualized, %llu evicted, %llu rejected, peak %u real\n", poolStats.m_realizeCount,
+                      poolStats.m_virtualizeCount, poolStats.m_evictedCount, poolStats.m_rejectedCount, output.GetStats().m_peakPlayingCount);
+    report += Stringf("commands         %u in %u batches, %u errors\n", commandCount, config.m_frameCount, commandErrors);
+
+    isValid = isValid && isPoolValid && commandErrors == 0 && output.GetStats().m_peakPlayingCount <= poolConfig.m_maxRealVoices;
+    report += Stringf("validation       %s\n", isValid ? "OK" : "FAILED");
+
+    WriteHeadlessReport(config.m_audioReportPath, report);
+
+    return isValid;
+}
@@ -0,0 +1,162 @@
+//----------------------------------------------------------------------------------------------------
+// AudioOutput.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Subsystem/Audio/AudioOutput.hpp"
+
+#include <algorithm>
+
+#include "Game/Subsystem/Audio/AudioStream.hpp"
+
+//----------------------------------------------------------------------------------------------------
+EngineAudioOutput::EngineAudioOutput(AudioSystem& audioSystem)
+    : m_audioSystem(audioSystem)
+{
+}
+
+//----------------------------------------------------------------------------------------------------
+// The AudioSystem does not expose sound lengths, so MP3 files are measured from their frame headers.
+// Other formats stay at 0 (unknown).
+//
+SoundID EngineAudioOutput::CreateOrGetSound(std::string const& filePath)
+{
+    SoundID const soundID = m_audioSystem.CreateOrGetSound(filePath);
+
+    if (soundID != MISSING_SOUND_ID && !m_soundDurations.contains(soundID))
+    {
+        m_soundDurations.emplace(soundID, static_cast<float>(AudioStream::MeasureDurationSeconds(filePath)));
+    }
+
+    return soundID;
+}
+
+//----------------------------------------------------------------------------------------------------
+float EngineAudioOutput::GetSoundDurationSeconds(SoundID const soundID) const
+{
+    auto const iterator = m_soundDurations.find(soundID);
+
+    return iterator != m_soundDurations.end() ? iterator->second : 0.f;
+}
+
+//----------------------------------------------------------------------------------------------------
+SoundPlaybackID EngineAudioOutput::StartVoice(SoundID const soundID,
+                                              bool const    isLooped,
+                                              float const   volume,
+                                              float const   balance)
+{
+    return m_audioSystem.StartSound(soundID, isLooped, volume, balance);
+}
+
+//----------------------------------------------------------------------------------------------------
+void EngineAudioOutput::StopVoice(SoundPlaybackID const playbackID)
+{
+    m_audioSystem.StopSound(playbackID);
+}
+
+//----------------------------------------------------------------------------------------------------
+void EngineAudioOutput::UpdateVoice(SoundPlaybackID const playbackID,
+                                    float const           volume,
+                                    float const           balance)
+{
+    m_audioSystem.SetSoundPlaybackVolume(playbackID, volume);
+    m_audioSystem.SetSoundPlaybackBalance(playbackID, balance);
+}
+
+//----------------------------------------------------------------------------------------------------
+bool EngineAudioOutput::IsVoicePlaying(SoundPlaybackID const playbackID) const
+{
+    return m_audioSystem.IsPlaying(playbackID);
+}
+
+//----------------------------------------------------------------------------------------------------
+SoundID NullAudioOutput::CreateOrGetSound(std::string const& filePath)
+{
+    return m_soundIDs.try_emplace(filePath, m_soundIDs.size()).first->second;
+}
+
+//----------------------------------------------------------------------------------------------------
+float NullAudioOutput::GetSoundDurationSeconds(SoundID const soundID) const
+{
+    auto const iterator = m_soundDurations.find(soundID);
+
+    return iterator != m_soundDurations.end() ? iterator->second : 0.f;
+}
+
+//----------------------------------------------------------------------------------------------------
+SoundPlaybackID NullAudioOutput::StartVoice(SoundID const soundID,
+                                            bool const    isLooped,
+                                            float,
+                                            float)
+{
+    sPlayingVoice voice;
+    voice.m_soundID          = soundID;
+    voice.m_isLooped         = isLooped;
+    voice.m_remainingSeconds = GetSoundDurationSeconds(soundID);
+
+    SoundPlaybackID const playbackID = m_nextPlaybackID++;
+    m_playingVoices.emplace(playbackID, voice);
+
+    ++m_stats.m_startCount;
+    m_stats.m_playingCount     = static_cast<uint32_t>(m_playingVoices.size());
+    m_stats.m_peakPlayingCount = std::max(m_stats.m_peakPlayingCount, m_stats.m_playingCount);
+
+    return playbackID;
+}
+
+//----------------------------------------------------------------------------------------------------
+void NullAudioOutput::StopVoice(SoundPlaybackID const playbackID)
+{
+    if (m_playingVoices.erase(playbackID) > 0)
+    {
+        ++m_stats.m_stopCount;
+        m_stats.m_playingCount = static_cast<uint32_t>(m_playingVoices.size());
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void NullAudioOutput::UpdateVoice(SoundPlaybackID,
+                                  float,
+                                  float)
+{
+    ++m_stats.m_updateCount;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool NullAudioOutput::IsVoicePlaying(SoundPlaybackID const playbackID) const
+{
+    return m_playingVoices.contains(playbackID);
+}
+
+//----------------------------------------------------------------------------------------------------
+void NullAudioOutput::SetSoundDuration(SoundID const soundID,
+                                       float const   seconds)
+{
+    m_soundDurations[soundID] = seconds;
+}
+
+//----------------------------------------------------------------------------------------------------
+// A sound without a known duration plays until stopped.
+//
+void NullAudioOutput::Advance(float const deltaSeconds)
+{
+    for (auto iterator = m_playingVoices.begin(); iterator != m_playingVoices.end();)
+    {
+        sPlayingVoice& voice = iterator->second;
+
+        if (!voice.m_isLooped && voice.m_remainingSeconds > 0.f)
+        {
+            voice.m_remainingSeconds -= deltaSeconds;
+
+            if (voice.m_remainingSeconds <= 0.f)
+            {
+                iterator = m_playingVoices.erase(iterator);
+                continue;
+            }
+        }
+
+        ++iterator;
+    }
+
+    m_stats.m_playingCount = static_cast<uint32_t>(m_playingVoices.size());
+}
@@ -0,0 +1,90 @@
+//----------------------------------------------------------------------------------------------------
+// AudioOutput.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+#include "Engine/Audio/AudioSystem.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// Where the AudioVoicePool sends its real voices. EngineAudioOutput plays through the engine
+// AudioSystem; NullAudioOutput only keeps the bookkeeping, so voice management can run and be checked
+// without an audio device (headless runs, Linux).
+//----------------------------------------------------------------------------------------------------
+class IAudioOutput
+{
+public:
+    virtual ~IAudioOutput() = default;
+
+    virtual SoundID         CreateOrGetSound(std::string const& filePath) = 0;
+    virtual float           GetSoundDurationSeconds(SoundID soundID) const = 0;     // 0 = unknown
+    virtual SoundPlaybackID StartVoice(SoundID soundID, bool isLooped, float volume, float balance) = 0;
+    virtual void            StopVoice(SoundPlaybackID playbackID) = 0;
+    virtual void            UpdateVoice(SoundPlaybackID playbackID, float volume, float balance) = 0;
+    virtual bool            IsVoicePlaying(SoundPlaybackID playbackID) const = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+class EngineAudioOutput : public IAudioOutput
+{
+public:
+    explicit EngineAudioOutput(AudioSystem& audioSystem);
+
+    SoundID         CreateOrGetSound(std::string const& filePath) override;
+    float           GetSoundDurationSeconds(SoundID soundID) const override;
+    SoundPlaybackID StartVoice(SoundID soundID, bool isLooped, float volume, float balance) override;
+    void            StopVoice(SoundPlaybackID playbackID) override;
+    void            UpdateVoice(SoundPlaybackID playbackID, float volume, float balance) override;
+    bool            IsVoicePlaying(SoundPlaybackID playbackID) const override;
+
+private:
+    AudioSystem&                       m_audioSystem;
+    std::unordered_map<SoundID, float> m_soundDurations;      // Measured once, when the sound is first created
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sNullAudioOutputStats
+{
+    uint64_t m_startCount       = 0;
+    uint64_t m_stopCount        = 0;
+    uint64_t m_updateCount      = 0;
+    uint32_t m_playingCount     = 0;
+    uint32_t m_peakPlayingCount = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Plays nothing: one-shots end once their duration (SetSoundDuration) has passed in Advance().
+//----------------------------------------------------------------------------------------------------
+class NullAudioOutput : public IAudioOutput
+{
+public:
+    SoundID         CreateOrGetSound(std::string const& filePath) override;
+    float           GetSoundDurationSeconds(SoundID soundID) const override;
+    SoundPlaybackID StartVoice(SoundID soundID, bool isLooped, float volume, float balance) override;
+    void            StopVoice(SoundPlaybackID playbackID) override;
+    void            UpdateVoice(SoundPlaybackID playbackID, float volume, float balance) override;
+    bool            IsVoicePlaying(SoundPlaybackID playbackID) const override;
+
+    void SetSoundDuration(SoundID soundID, float seconds);
+    void Advance(float deltaSeconds);
+
+    sNullAudioOutputStats const& GetStats() const { return m_stats; }
+
+private:
+    struct sPlayingVoice
+    {
+        SoundID m_soundID          = MISSING_SOUND_ID;
+        bool    m_isLooped         = false;
+        float   m_remainingSeconds = 0.f;
+    };
+
+    std::unordered_map<std::string, SoundID>           m_soundIDs;
+    std::unordered_map<SoundID, float>                 m_soundDurations;
+    std::unordered_map<SoundPlaybackID, sPlayingVoice> m_playingVoices;
+    SoundPlaybackID                                    m_nextPlaybackID = 1;
+    sNullAudioOutputStats                              m_stats;
+};
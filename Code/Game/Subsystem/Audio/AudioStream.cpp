@@ -0,0 +1,446 @@
+//----------------------------------------------------------------------------------------------------
+// AudioStream.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Subsystem/Audio/AudioStream.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+#include "Engine/Core/EngineCommon.hpp"
+
+//----------------------------------------------------------------------------------------------------
+// kbps by [row][bitrate index]; rows: MPEG-1 layer I, II, III, then MPEG-2/2.5 layer I, II/III.
+static uint16_t constexpr BIT_RATES_KBPS[5][15] = {
+    {0, 32, 64, 96, 128, 160, 192, 224, 256, 288, 320, 352, 384, 416, 448},
+    {0, 32, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384},
+    {0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320},
+    {0, 32, 48, 56, 64, 80, 96, 112, 128, 144, 160, 176, 192, 224, 256},
+    {0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160}
+};
+
+static uint32_t constexpr SAMPLE_RATES[3] = {44100, 48000, 32000};      // MPEG-1; halved for 2, quartered for 2.5
+
+static size_t constexpr READ_CHUNK_BYTES = 8 * 1024;
+
+//----------------------------------------------------------------------------------------------------
+// Frames following each other must agree on these, which is what separates a real frame from sync
+// bits that happen to appear inside audio data.
+static bool IsSameStream(sMpegFrameHeader const& a, sMpegFrameHeader const& b)
+{
+    return a.m_version == b.m_version && a.m_layer == b.m_layer && a.m_sampleRate == b.m_sampleRate;
+}
+
+//----------------------------------------------------------------------------------------------------
+double sAudioStreamStats::GetDurationSeconds() const
+{
+    return m_sampleRate > 0 ? static_cast<double>(m_sampleCount) / m_sampleRate : 0.0;
+}
+
+//----------------------------------------------------------------------------------------------------
+AudioStream::AudioStream(sAudioStreamConfig const& config)
+    : m_config(config)
+{
+    m_config.m_bufferCount = std::max(m_config.m_bufferCount, 2u);
+    m_config.m_bufferBytes = std::max(m_config.m_bufferBytes, MAX_FRAME_BYTES);
+
+    m_buffers.resize(m_config.m_bufferCount);
+
+    for (sAudioStreamBuffer& buffer : m_buffers)
+    {
+        buffer.m_bytes.resize(m_config.m_bufferBytes);
+    }
+
+    m_stats.m_bufferMemoryBytes = static_cast<uint64_t>(m_config.m_bufferCount) * m_config.m_bufferBytes;
+}
+
+//----------------------------------------------------------------------------------------------------
+AudioStream::~AudioStream()
+{
+    Close();
+}
+
+//----------------------------------------------------------------------------------------------------
+bool AudioStream::Open(std::string const& filePath)
+{
+    Close();
+
+    m_file.open(filePath, std::ios::binary);
+
+    if (!m_file.is_open())
+    {
+        return false;
+    }
+
+    for (sAudioStreamBuffer& buffer : m_buffers)
+    {
+        buffer.m_byteCount   = 0;
+        buffer.m_frameCount  = 0;
+        buffer.m_sampleCount = 0;
+    }
+
+    m_fillIndex     = 0;
+    m_readIndex     = 0;
+    m_filledCount   = 0;
+    m_isEndOfStream = false;
+    m_isStopping    = false;
+
+    uint64_t const bufferMemoryBytes = m_stats.m_bufferMemoryBytes;
+    m_stats                          = sAudioStreamStats();
+    m_stats.m_bufferMemoryBytes      = bufferMemoryBytes;
+
+    m_thread = std::thread(&AudioStream::StreamThreadMain, this);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------------------------------
+void AudioStream::Close()
+{
+    {
+        std::lock_guard lock(m_mutex);
+        m_isStopping = true;
+    }
+
+    m_bufferReleased.notify_all();
+
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+
+    if (m_file.is_open())
+    {
+        m_file.close();
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+sAudioStreamBuffer const* AudioStream::AcquireBuffer()
+{
+    std::lock_guard lock(m_mutex);
+
+    if (m_filledCount == 0)
+    {
+        if (!m_isEndOfStream)
+        {
+            ++m_stats.m_underrunCount;
+        }
+
+        return nullptr;
+    }
+
+    return &m_buffers[m_readIndex];
+}
+
+//----------------------------------------------------------------------------------------------------
+void AudioStream::ReleaseBuffer()
+{
+    {
+        std::lock_guard lock(m_mutex);
+
+        if (m_filledCount == 0)
+        {
+            return;
+        }
+
+        sAudioStreamBuffer& buffer = m_buffers[m_readIndex];
+        buffer.m_byteCount         = 0;
+        buffer.m_frameCount        = 0;
+        buffer.m_sampleCount       = 0;
+
+        --m_filledCount;
+        m_readIndex = (m_readIndex + 1) % m_config.m_bufferCount;
+    }
+
+    m_bufferReleased.notify_one();
+}
+
+//----------------------------------------------------------------------------------------------------
+bool AudioStream::IsFinished() const
+{
+    std::lock_guard lock(m_mutex);
+
+    return m_isEndOfStream && m_filledCount == 0;
+}
+
+//----------------------------------------------------------------------------------------------------
+sAudioStreamStats AudioStream::GetStats() const
+{
+    std::lock_guard lock(m_mutex);
+
+    return m_stats;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Rejects reserved versions/layers, free-format and invalid bitrates, and reserved sample rates.
+//
+STATIC bool AudioStream::ParseFrameHeader(uint8_t const*    bytes,
+                                          sMpegFrameHeader& out_header)
+{
+    if (bytes[0] != 0xFF || (bytes[1] & 0xE0) != 0xE0)
+    {
+        return false;
+    }
+
+    uint8_t const versionBits     = (bytes[1] >> 3) & 0x03;
+    uint8_t const layerBits       = (bytes[1] >> 1) & 0x03;
+    uint8_t const bitRateIndex    = (bytes[2] >> 4) & 0x0F;
+    uint8_t const sampleRateIndex = (bytes[2] >> 2) & 0x03;
+    uint8_t const padding         = (bytes[2] >> 1) & 0x01;
+    uint8_t const channelMode     = (bytes[3] >> 6) & 0x03;
+
+    if (versionBits == 1 || layerBits == 0 || bitRateIndex == 0 || bitRateIndex == 15 || sampleRateIndex == 3)
+    {
+        return false;
+    }
+
+    uint8_t const layer      = static_cast<uint8_t>(4 - layerBits);
+    bool const    isVersion1 = versionBits == 3;
+    int const     row        = isVersion1 ? layer - 1 : (layer == 1 ? 3 : 4);
+
+    out_header.m_version      = isVersion1 ? 1 : (versionBits == 2 ? 2 : 25);
+    out_header.m_layer        = layer;
+    out_header.m_bitRate      = BIT_RATES_KBPS[row][bitRateIndex] * 1000u;
+    out_header.m_sampleRate   = SAMPLE_RATES[sampleRateIndex] >> (isVersion1 ? 0 : (versionBits == 2 ? 1 : 2));
+    out_header.m_channelCount = channelMode == 3 ? 1 : 2;
+
+    if (layer == 1)
+    {
+        out_header.m_sampleCount = 384;
+        out_header.m_frameBytes  = (12 * out_header.m_bitRate / out_header.m_sampleRate + padding) * 4;
+    }
+    else
+    {
+        out_header.m_sampleCount = layer == 3 && !isVersion1 ? 576 : 1152;
+        out_header.m_frameBytes  = out_header.m_sampleCount / 8 * out_header.m_bitRate / out_header.m_sampleRate + padding;
+    }
+
+    return out_header.m_frameBytes > 4;
+}
+
+//----------------------------------------------------------------------------------------------------
+// "ID3", version, flags, then a 28-bit syncsafe size that excludes the 10-byte header (and footer).
+//
+STATIC size_t AudioStream::GetID3v2TagBytes(uint8_t const* bytes,
+                                            size_t const   byteCount)
+{
+    if (byteCount < 10 || std::memcmp(bytes, "ID3", 3) != 0)
+    {
+        return 0;
+    }
+
+    size_t const size = static_cast<size_t>(bytes[6] & 0x7F) << 21 | static_cast<size_t>(bytes[7] & 0x7F) << 14 |
+                        static_cast<size_t>(bytes[8] & 0x7F) << 7 | static_cast<size_t>(bytes[9] & 0x7F);
+    bool const hasFooter = (bytes[5] & 0x10) != 0;
+
+    return 10 + size + (hasFooter ? 10 : 0);
+}
+
+//----------------------------------------------------------------------------------------------------
+// The stream thread's frame rules over the whole file at once. Runs once per sound, and a sound file
+// is no larger than what the AudioSystem itself loads for it.
+//
+STATIC double AudioStream::MeasureDurationSeconds(std::string const& filePath)
+{
+    std::ifstream file(filePath, std::ios::binary);
+
+    if (!file.is_open())
+    {
+        return 0.0;
+    }
+
+    std::vector<uint8_t> const bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    size_t           cursor          = GetID3v2TagBytes(bytes.data(), bytes.size());
+    double           durationSeconds = 0.0;
+    sMpegFrameHeader streamHeader;
+    bool             hasStreamHeader = false;
+
+    while (cursor + 4 <= bytes.size())
+    {
+        size_t const     remaining = bytes.size() - cursor;
+        sMpegFrameHeader header;
+
+        bool isFrame = ParseFrameHeader(bytes.data() + cursor, header) && header.m_frameBytes <= remaining &&
+                       (!hasStreamHeader || IsSameStream(header, streamHeader));
+
+        if (isFrame && header.m_frameBytes + 4 <= remaining)
+        {
+            uint8_t const*   next = bytes.data() + cursor + header.m_frameBytes;
+            sMpegFrameHeader nextHeader;
+
+            isFrame = (ParseFrameHeader(next, nextHeader) && IsSameStream(header, nextHeader)) || std::memcmp(next, "TAG", 3) == 0;
+        }
+
+        if (!isFrame)
+        {
+            ++cursor;
+            continue;
+        }
+
+        streamHeader    = header;
+        hasStreamHeader = true;
+        durationSeconds += static_cast<double>(header.m_sampleCount) / header.m_sampleRate;
+        cursor += header.m_frameBytes;
+    }
+
+    return durationSeconds;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Keeps a read-ahead window of at least two frames so each frame's successor can be checked before
+// the frame is accepted.
+//
+void AudioStream::StreamThreadMain()
+{
+    std::vector<uint8_t> window;
+    size_t               cursor          = 0;
+    bool                 isEndOfFile     = false;
+    bool                 hasCheckedTag   = false;
+    size_t               tagBytesLeft    = 0;
+    sMpegFrameHeader     streamHeader;
+    bool                 hasStreamHeader = false;
+
+    auto const refill = [this, &window, &cursor, &isEndOfFile]()
+    {
+        window.erase(window.begin(), window.begin() + static_cast<std::ptrdiff_t>(cursor));
+        cursor = 0;
+
+        size_t const oldSize = window.size();
+        window.resize(oldSize + READ_CHUNK_BYTES);
+        m_file.read(reinterpret_cast<char*>(window.data() + oldSize), static_cast<std::streamsize>(READ_CHUNK_BYTES));
+
+        size_t const readBytes = static_cast<size_t>(m_file.gcount());
+        window.resize(oldSize + readBytes);
+        isEndOfFile = readBytes < READ_CHUNK_BYTES;
+
+        std::lock_guard lock(m_mutex);
+        m_stats.m_fileBytesRead += readBytes;
+    };
+
+    uint64_t skippedBytes = 0;
+
+    while (WaitForFreeBuffer())
+    {
+        if (!isEndOfFile && window.size() - cursor < 2 * MAX_FRAME_BYTES + 4)
+        {
+            refill();
+            continue;
+        }
+
+        if (!hasCheckedTag)
+        {
+            tagBytesLeft  = GetID3v2TagBytes(window.data() + cursor, window.size() - cursor);
+            hasCheckedTag = true;
+        }
+
+        // A tag larger than the window is skipped across several refills.
+        if (tagBytesLeft > 0)
+        {
+            size_t const skip = std::min(tagBytesLeft, window.size() - cursor);
+
+            cursor += skip;
+            skippedBytes += skip;
+            tagBytesLeft -= skip;
+
+            if (isEndOfFile && cursor == window.size())
+            {
+                break;
+            }
+
+            continue;
+        }
+
+        size_t const     remaining = window.size() - cursor;
+        sMpegFrameHeader header;
+
+        if (remaining < 4)
+        {
+            skippedBytes += remaining;
+            cursor += remaining;
+            break;
+        }
+
+        bool isFrame = ParseFrameHeader(window.data() + cursor, header) && header.m_frameBytes <= remaining &&
+                       (!hasStreamHeader || IsSameStream(header, streamHeader));
+
+        // A frame ending right at end of file has no successor to check; the last frame may also be
+        // followed by an ID3v1 tag.
+        if (isFrame && header.m_frameBytes + 4 <= remaining)
+        {
+            uint8_t const*   next = window.data() + cursor + header.m_frameBytes;
+            sMpegFrameHeader nextHeader;
+
+            isFrame = (ParseFrameHeader(next, nextHeader) && IsSameStream(header, nextHeader)) || std::memcmp(next, "TAG", 3) == 0;
+        }
+
+        if (!isFrame)
+        {
+            ++skippedBytes;
+            ++cursor;
+            continue;
+        }
+
+        streamHeader    = header;
+        hasStreamHeader = true;
+
+        sAudioStreamBuffer& buffer = m_buffers[m_fillIndex];
+
+        if (buffer.m_byteCount + header.m_frameBytes > m_config.m_bufferBytes)
+        {
+            PublishBuffer();
+            continue;
+        }
+
+        std::memcpy(buffer.m_bytes.data() + buffer.m_byteCount, window.data() + cursor, header.m_frameBytes);
+        buffer.m_byteCount += header.m_frameBytes;
+        buffer.m_frameCount += 1;
+        buffer.m_sampleCount += header.m_sampleCount;
+        cursor += header.m_frameBytes;
+
+        std::lock_guard lock(m_mutex);
+        m_stats.m_sampleRate   = header.m_sampleRate;
+        m_stats.m_channelCount = header.m_channelCount;
+        m_stats.m_skippedBytes = skippedBytes;
+    }
+
+    // The fill buffer is free here unless the loop stopped for Close().
+    if (m_buffers[m_fillIndex].m_byteCount > 0 && WaitForFreeBuffer())
+    {
+        PublishBuffer();
+    }
+
+    std::lock_guard lock(m_mutex);
+    m_stats.m_skippedBytes = skippedBytes;
+    m_isEndOfStream        = true;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Returns false when the stream is being closed.
+//
+bool AudioStream::WaitForFreeBuffer()
+{
+    std::unique_lock lock(m_mutex);
+
+    m_bufferReleased.wait(lock, [this]() { return m_isStopping || m_filledCount < m_config.m_bufferCount; });
+
+    return !m_isStopping;
+}
+
+//----------------------------------------------------------------------------------------------------
+void AudioStream::PublishBuffer()
+{
+    sAudioStreamBuffer const& buffer = m_buffers[m_fillIndex];
+
+    std::lock_guard lock(m_mutex);
+
+    m_stats.m_frameCount += buffer.m_frameCount;
+    m_stats.m_sampleCount += buffer.m_sampleCount;
+
+    ++m_filledCount;
+    m_stats.m_peakFilledBuffers = std::max(m_stats.m_peakFilledBuffers, m_filledCount);
+    m_fillIndex                 = (m_fillIndex + 1) % m_config.m_bufferCount;
+}
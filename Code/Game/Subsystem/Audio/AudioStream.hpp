@@ -0,0 +1,112 @@
+//----------------------------------------------------------------------------------------------------
+// AudioStream.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+//----------------------------------------------------------------------------------------------------
+struct sMpegFrameHeader
+{
+    uint32_t m_frameBytes   = 0;     // Header included
+    uint32_t m_sampleCount  = 0;     // Per channel
+    uint32_t m_sampleRate   = 0;
+    uint32_t m_bitRate      = 0;     // Bits per second
+    uint8_t  m_channelCount = 0;
+    uint8_t  m_version      = 0;     // 1 = MPEG-1, 2 = MPEG-2, 25 = MPEG-2.5
+    uint8_t  m_layer        = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sAudioStreamConfig
+{
+    uint32_t m_bufferCount = 4;
+    uint32_t m_bufferBytes = 16 * 1024;     // Raised to MAX_FRAME_BYTES if smaller
+};
+
+//----------------------------------------------------------------------------------------------------
+// Whole frames only, so every buffer can be handed to a frame decoder on its own.
+//----------------------------------------------------------------------------------------------------
+struct sAudioStreamBuffer
+{
+    std::vector<uint8_t> m_bytes;
+    uint32_t             m_byteCount   = 0;
+    uint32_t             m_frameCount  = 0;
+    uint32_t             m_sampleCount = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sAudioStreamStats
+{
+    uint64_t m_fileBytesRead     = 0;
+    uint64_t m_skippedBytes      = 0;     // ID3 tags and anything that failed to sync
+    uint64_t m_frameCount        = 0;
+    uint64_t m_sampleCount       = 0;
+    uint32_t m_sampleRate        = 0;
+    uint8_t  m_channelCount      = 0;
+    uint32_t m_underrunCount     = 0;     // AcquireBuffer() calls that found nothing ready before the end
+    uint32_t m_peakFilledBuffers = 0;
+    uint64_t m_bufferMemoryBytes = 0;     // Fixed for the life of the stream, whatever the file length
+
+    double GetDurationSeconds() const;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Streams an MPEG audio file (MP3) from disk on its own thread into a fixed ring of buffers, split on
+// frame boundaries, so memory stays at m_bufferCount * m_bufferBytes however long the file is.
+//
+// The stream thread blocks once every buffer is full and resumes as the consumer releases them;
+// AcquireBuffer() never blocks. One consumer thread only. PCM synthesis is left to the consumer, so
+// only headless runs stream: the engine AudioSystem loads and decodes its sounds itself. The game uses
+// MeasureDurationSeconds() alone, to time the one-shots the AudioVoicePool virtualizes.
+//----------------------------------------------------------------------------------------------------
+class AudioStream
+{
+public:
+    explicit AudioStream(sAudioStreamConfig const& config);
+    ~AudioStream();
+
+    AudioStream(AudioStream const&)            = delete;
+    AudioStream& operator=(AudioStream const&) = delete;
+
+    bool Open(std::string const& filePath);      // false if the file cannot be opened
+    void Close();
+
+    sAudioStreamBuffer const* AcquireBuffer();      // Oldest filled buffer, or nullptr
+    void                      ReleaseBuffer();      // Hands the acquired buffer back to the stream thread
+    bool                      IsFinished() const;   // End of file reached and every buffer consumed
+    sAudioStreamStats         GetStats() const;
+
+    static bool   ParseFrameHeader(uint8_t const* bytes, sMpegFrameHeader& out_header);
+    static size_t GetID3v2TagBytes(uint8_t const* bytes, size_t byteCount);      // 0 when there is no tag
+    static double MeasureDurationSeconds(std::string const& filePath);          // 0 when no MPEG frame is found
+
+    static uint32_t constexpr MAX_FRAME_BYTES = 2881;     // MPEG-2.5 layer II/III at 160 kbps, 8 kHz, padded
+
+private:
+    void StreamThreadMain();
+    bool WaitForFreeBuffer();
+    void PublishBuffer();
+
+    sAudioStreamConfig m_config;
+    std::ifstream      m_file;
+    std::thread        m_thread;
+
+    std::vector<sAudioStreamBuffer> m_buffers;
+    uint32_t                        m_fillIndex = 0;      // Stream thread only
+    uint32_t                        m_readIndex = 0;      // Consumer only
+
+    mutable std::mutex      m_mutex;
+    std::condition_variable m_bufferReleased;
+    uint32_t                m_filledCount   = 0;
+    bool                    m_isEndOfStream = false;
+    bool                    m_isStopping    = false;
+    sAudioStreamStats       m_stats;
+};
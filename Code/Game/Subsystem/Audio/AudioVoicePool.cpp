@@ -0,0 +1,485 @@
+//----------------------------------------------------------------------------------------------------
+// AudioVoicePool.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Subsystem/Audio/AudioVoicePool.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <sstream>
+
+#include "Engine/Math/MathUtils.hpp"
+#include "Game/Subsystem/Audio/AudioOutput.hpp"
+
+//----------------------------------------------------------------------------------------------------
+static bool ParseFloatToken(std::string const& token, float& out_value)
+{
+    char* end = nullptr;
+    out_value = std::strtof(token.c_str(), &end);
+
+    return !token.empty() && end == token.c_str() + token.size();
+}
+
+//----------------------------------------------------------------------------------------------------
+static bool ParseHandleToken(std::string const& token, AudioVoiceHandle& out_handle)
+{
+    char* end = nullptr;
+    out_handle = static_cast<AudioVoiceHandle>(std::strtoul(token.c_str(), &end, 10));
+
+    return !token.empty() && end == token.c_str() + token.size();
+}
+
+//----------------------------------------------------------------------------------------------------
+AudioVoicePool::AudioVoicePool(sAudioVoicePoolConfig const& config,
+                               IAudioOutput&                output)
+    : m_config(config),
+      m_output(output)
+{
+    m_config.m_maxVoices = std::clamp(m_config.m_maxVoices, 1u, 0xFFFFu);
+
+    m_voices.resize(m_config.m_maxVoices);
+    m_candidates.reserve(m_config.m_maxVoices);
+    m_freeSlots.reserve(m_config.m_maxVoices);
+
+    // Popped from the back, so slot 0 is used first.
+    for (uint32_t slot = m_config.m_maxVoices; slot > 0; --slot)
+    {
+        m_freeSlots.push_back(slot - 1);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+AudioVoicePool::~AudioVoicePool()
+{
+    StopAll();
+}
+
+//----------------------------------------------------------------------------------------------------
+// The voice starts virtual; the next Update() decides whether it gets a real output voice. When the
+// pool is full the quietest voice is dropped, unless it is louder than the new one.
+//
+AudioVoiceHandle AudioVoicePool::Play(sAudioVoiceDesc const& desc)
+{
+    if (desc.m_soundID == MISSING_SOUND_ID)
+    {
+        ++m_stats.m_rejectedCount;
+        return 0;
+    }
+
+    sVoice candidate;
+    candidate.m_desc = desc;
+    ComputeAudibility(candidate);
+
+    if (m_freeSlots.empty())
+    {
+        uint32_t quietestSlot = 0;
+
+        for (uint32_t slot = 1; slot < m_voices.size(); ++slot)
+        {
+            if (m_voices[slot].m_audibility < m_voices[quietestSlot].m_audibility)
+            {
+                quietestSlot = slot;
+            }
+        }
+
+        if (m_voices[quietestSlot].m_audibility >= candidate.m_audibility)
+        {
+            ++m_stats.m_rejectedCount;
+            return 0;
+        }
+
+        FreeVoice(quietestSlot);
+        ++m_stats.m_evictedCount;
+    }
+
+    uint32_t const slot = m_freeSlots.back();
+    m_freeSlots.pop_back();
+
+    float const durationSeconds = m_output.GetSoundDurationSeconds(desc.m_soundID);
+
+    sVoice& voice          = m_voices[slot];
+    voice.m_desc           = desc;
+    voice.m_playbackID     = MISSING_SOUND_ID;
+    voice.m_elapsedSeconds = 0.f;
+    voice.m_lengthSeconds  = desc.m_isLooped ? 0.f : (durationSeconds > 0.f ? durationSeconds : m_config.m_unknownDurationSeconds);
+    voice.m_isLengthKnown  = desc.m_isLooped || durationSeconds > 0.f;
+    voice.m_audibility     = candidate.m_audibility;
+    voice.m_balance        = candidate.m_balance;
+    voice.m_isActive       = true;
+    voice.m_isReal         = false;
+
+    ++m_stats.m_activeVoiceCount;
+
+    return MakeHandle(slot);
+}
+
+//----------------------------------------------------------------------------------------------------
+void AudioVoicePool::Stop(AudioVoiceHandle const handle)
+{
+    if (GetVoice(handle) != nullptr)
+    {
+        FreeVoice((handle & 0xFFFF) - 1);
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void AudioVoicePool::StopAll()
+{
+    for (uint32_t slot = 0; slot < m_voices.size(); ++slot)
+    {
+        if (m_voices[slot].m_isActive)
+        {
+            FreeVoice(slot);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void AudioVoicePool::SetVolume(AudioVoiceHandle const handle,
+                               float const            volume)
+{
+    if (sVoice* voice = GetVoice(handle))
+    {
+        voice->m_desc.m_volume = volume;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void AudioVoicePool::SetPosition(AudioVoiceHandle const handle,
+                                 Vec3 const&            position)
+{
+    if (sVoice* voice = GetVoice(handle))
+    {
+        voice->m_desc.m_position = position;
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+bool AudioVoicePool::IsValid(AudioVoiceHandle const handle) const
+{
+    return GetVoice(handle) != nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------
+bool AudioVoicePool::IsReal(AudioVoiceHandle const handle) const
+{
+    sVoice const* voice = GetVoice(handle);
+
+    return voice != nullptr && voice->m_isReal;
+}
+
+//----------------------------------------------------------------------------------------------------
+void AudioVoicePool::SetListener(Vec3 const& position,
+                                 Vec3 const& leftDirection)
+{
+    m_listenerPosition = position;
+    m_listenerLeft     = leftDirection;
+}
+
+//----------------------------------------------------------------------------------------------------
+// Voices over the new budget are stopped by the next Update(), least audible first, like any other
+// voice that loses its place.
+//
+void AudioVoicePool::SetRealVoiceBudget(uint32_t const maxRealVoices,
+                                        float const    minAudibility)
+{
+    m_config.m_maxRealVoices = maxRealVoices;
+    m_config.m_minAudibility = std::max(minAudibility, 0.f);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Stops go out before starts, so the output never holds more than m_maxRealVoices at once.
+//
+void AudioVoicePool::Update(float const deltaSeconds)
+{
+    auto const startTime = std::chrono::steady_clock::now();
+
+    m_candidates.clear();
+
+    for (uint32_t slot = 0; slot < m_voices.size(); ++slot)
+    {
+        sVoice& voice = m_voices[slot];
+
+        if (!voice.m_isActive)
+        {
+            continue;
+        }
+
+        voice.m_elapsedSeconds += deltaSeconds;
+
+        bool const isFinished = voice.m_isReal ? !voice.m_desc.m_isLooped && !m_output.IsVoicePlaying(voice.m_playbackID)
+                                               : voice.m_lengthSeconds > 0.f && voice.m_elapsedSeconds >= voice.m_lengthSeconds;
+
+        if (isFinished)
+        {
+            FreeVoice(slot);
+            continue;
+        }
+
+        ComputeAudibility(voice);
+
+        if (voice.m_audibility >= m_config.m_minAudibility)
+        {
+            m_candidates.push_back(slot);
+        }
+    }
+
+    // Loudest first; ties go to the lower slot so the choice does not flicker between frames.
+    auto const isMoreAudible = [this](uint32_t const a, uint32_t const b)
+    {
+        float const audibilityA = m_voices[a].m_audibility;
+        float const audibilityB = m_voices[b].m_audibility;
+
+        return audibilityA != audibilityB ? audibilityA > audibilityB : a < b;
+    };
+
+    if (m_candidates.size() > m_config.m_maxRealVoices)
+    {
+        std::nth_element(m_candidates.begin(), m_candidates.begin() + m_config.m_maxRealVoices, m_candidates.end(), isMoreAudible);
+        m_candidates.resize(m_config.m_maxRealVoices);
+    }
+
+    std::sort(m_candidates.begin(), m_candidates.end());
+
+    size_t candidateIndex = 0;
+
+    for (uint32_t slot = 0; slot < m_voices.size(); ++slot)
+    {
+        bool const isSelected = candidateIndex < m_candidates.size() && m_candidates[candidateIndex] == slot;
+        candidateIndex += isSelected ? 1 : 0;
+
+        sVoice& voice = m_voices[slot];
+
+        if (voice.m_isReal && !isSelected)
+        {
+            ++m_stats.m_virtualizeCount;
+
+            if (!voice.m_isLengthKnown)
+            {
+                FreeVoice(slot);
+                continue;
+            }
+
+            m_output.StopVoice(voice.m_playbackID);
+            voice.m_playbackID = MISSING_SOUND_ID;
+            voice.m_isReal     = false;
+        }
+    }
+
+    m_stats.m_realVoiceCount = static_cast<uint32_t>(m_candidates.size());
+
+    for (uint32_t const slot : m_candidates)
+    {
+        sVoice&     voice = m_voices[slot];
+        float const gain  = voice.m_desc.m_priority > 0.f ? voice.m_audibility / voice.m_desc.m_priority : 0.f;
+
+        if (voice.m_isReal)
+        {
+            m_output.UpdateVoice(voice.m_playbackID, gain, voice.m_balance);
+            continue;
+        }
+
+        voice.m_playbackID     = m_output.StartVoice(voice.m_desc.m_soundID, voice.m_desc.m_isLooped, gain, voice.m_balance);
+        voice.m_elapsedSeconds = 0.f;
+        voice.m_isReal         = true;
+        ++m_stats.m_realizeCount;
+    }
+
+    m_stats.m_updateMicroseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+//----------------------------------------------------------------------------------------------------
+// Malformed commands are counted and skipped; the rest of the batch still runs.
+//
+sAudioCommandResult AudioVoicePool::ExecuteCommands(std::string const& commands)
+{
+    sAudioCommandResult result;
+
+    std::string lines = commands;
+    std::replace(lines.begin(), lines.end(), ';', '\n');
+
+    std::istringstream lineStream(lines);
+    std::string        line;
+
+    while (std::getline(lineStream, line))
+    {
+        std::istringstream       tokenStream(line);
+        std::vector<std::string> tokens;
+        std::string              token;
+
+        while (tokenStream >> token)
+        {
+            tokens.push_back(token);
+        }
+
+        if (tokens.empty())
+        {
+            continue;
+        }
+
+        ++result.m_commandCount;
+
+        std::string const& name    = tokens[0];
+        bool               isValid = false;
+        AudioVoiceHandle   handle  = 0;
+
+        if (name == "play" && tokens.size() >= 2)
+        {
+            sAudioVoiceDesc desc;
+            float           looped = 0.f;
+
+            isValid = (tokens.size() < 3 || ParseFloatToken(tokens[2], desc.m_volume)) &&
+                      (tokens.size() < 4 || ParseFloatToken(tokens[3], looped)) &&
+                      (tokens.size() < 5 || (tokens.size() == 7 && ParseFloatToken(tokens[4], desc.m_position.x) &&
+                                             ParseFloatToken(tokens[5], desc.m_position.y) && ParseFloatToken(tokens[6], desc.m_position.z)));
+
+            desc.m_isLooped     = looped != 0.f;
+            desc.m_isPositional = tokens.size() == 7;
+            desc.m_soundID      = isValid ? m_output.CreateOrGetSound(tokens[1]) : MISSING_SOUND_ID;
+
+            AudioVoiceHandle const playedHandle = desc.m_soundID != MISSING_SOUND_ID ? Play(desc) : 0;
+            isValid                             = isValid && playedHandle != 0;
+            result.m_playedHandles.push_back(playedHandle);
+        }
+        else if (name == "stop" && tokens.size() == 2 && ParseHandleToken(tokens[1], handle))
+        {
+            Stop(handle);
+            isValid = true;
+        }
+        else if (name == "stopAll" && tokens.size() == 1)
+        {
+            StopAll();
+            isValid = true;
+        }
+        else if (name == "volume" && tokens.size() == 3 && ParseHandleToken(tokens[1], handle))
+        {
+            float volume = 0.f;
+            isValid      = ParseFloatToken(tokens[2], volume);
+
+            if (isValid)
+            {
+                SetVolume(handle, volume);
+            }
+        }
+        else if (name == "move" && tokens.size() == 5 && ParseHandleToken(tokens[1], handle))
+        {
+            Vec3 position;
+            isValid = ParseFloatToken(tokens[2], position.x) && ParseFloatToken(tokens[3], position.y) && ParseFloatToken(tokens[4], position.z);
+
+            if (isValid)
+            {
+                SetPosition(handle, position);
+            }
+        }
+
+        result.m_errorCount += isValid ? 0 : 1;
+    }
+
+    return result;
+}
+
+//----------------------------------------------------------------------------------------------------
+float AudioVoicePool::GetAudibility(AudioVoiceHandle const handle) const
+{
+    sVoice const* voice = GetVoice(handle);
+
+    return voice != nullptr ? voice->m_audibility : 0.f;
+}
+
+//----------------------------------------------------------------------------------------------------
+std::vector<AudioVoiceHandle> AudioVoicePool::GetActiveHandles() const
+{
+    std::vector<AudioVoiceHandle> handles;
+
+    for (uint32_t slot = 0; slot < m_voices.size(); ++slot)
+    {
+        if (m_voices[slot].m_isActive)
+        {
+            handles.push_back(MakeHandle(slot));
+        }
+    }
+
+    return handles;
+}
+
+//----------------------------------------------------------------------------------------------------
+AudioVoicePool::sVoice* AudioVoicePool::GetVoice(AudioVoiceHandle const handle)
+{
+    return const_cast<sVoice*>(static_cast<AudioVoicePool const*>(this)->GetVoice(handle));
+}
+
+//----------------------------------------------------------------------------------------------------
+AudioVoicePool::sVoice const* AudioVoicePool::GetVoice(AudioVoiceHandle const handle) const
+{
+    uint32_t const slotPlusOne = handle & 0xFFFF;
+
+    if (slotPlusOne == 0 || slotPlusOne > m_voices.size())
+    {
+        return nullptr;
+    }
+
+    sVoice const& voice = m_voices[slotPlusOne - 1];
+
+    return voice.m_isActive && voice.m_generation == handle >> 16 ? &voice : nullptr;
+}
+
+//----------------------------------------------------------------------------------------------------
+AudioVoiceHandle AudioVoicePool::MakeHandle(uint32_t const slot) const
+{
+    return static_cast<AudioVoiceHandle>(m_voices[slot].m_generation) << 16 | (slot + 1);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Inverse-distance rolloff between m_minDistance and m_maxDistance; balance is -1 (left) to 1 (right).
+//
+void AudioVoicePool::ComputeAudibility(sVoice& voice) const
+{
+    sAudioVoiceDesc const& desc = voice.m_desc;
+
+    float attenuation = 1.f;
+    voice.m_balance   = 0.f;
+
+    if (desc.m_isPositional)
+    {
+        Vec3 const  offset   = desc.m_position - m_listenerPosition;
+        float const distance = offset.GetLength();
+
+        if (distance >= desc.m_maxDistance)
+        {
+            attenuation = 0.f;
+        }
+        else if (distance > desc.m_minDistance)
+        {
+            attenuation = desc.m_minDistance / distance;
+        }
+
+        if (distance > 0.f)
+        {
+            voice.m_balance = GetClamped(-DotProduct3D(offset, m_listenerLeft) / distance, -1.f, 1.f);
+        }
+    }
+
+    voice.m_audibility = std::max(desc.m_volume, 0.f) * attenuation * std::max(desc.m_priority, 0.f);
+}
+
+//----------------------------------------------------------------------------------------------------
+void AudioVoicePool::FreeVoice(uint32_t const slot)
+{
+    sVoice& voice = m_voices[slot];
+
+    if (voice.m_isReal)
+    {
+        m_output.StopVoice(voice.m_playbackID);
+    }
+
+    voice.m_playbackID = MISSING_SOUND_ID;
+    voice.m_audibility = 0.f;
+    voice.m_isActive   = false;
+    voice.m_isReal     = false;
+    voice.m_generation = static_cast<uint16_t>(voice.m_generation == 0xFFFF ? 1 : voice.m_generation + 1);
+
+    m_freeSlots.push_back(slot);
+    --m_stats.m_activeVoiceCount;
+}
@@ -0,0 +1,133 @@
+//----------------------------------------------------------------------------------------------------
+// AudioVoicePool.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Engine/Audio/AudioSystem.hpp"
+#include "Engine/Math/Vec3.hpp"
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class IAudioOutput;
+
+//----------------------------------------------------------------------------------------------------
+using AudioVoiceHandle = uint32_t;      // Generation (high 16 bits) | slot + 1 (low 16); 0 = invalid
+
+//----------------------------------------------------------------------------------------------------
+struct sAudioVoicePoolConfig
+{
+    uint32_t m_maxVoices              = 512;        // Tracked voices, real or virtual (at most 65535)
+    uint32_t m_maxRealVoices          = 32;         // Voices actually sent to the IAudioOutput
+    float    m_minAudibility          = 0.001f;     // Quieter voices are never made real
+    float    m_unknownDurationSeconds = 10.f;       // Lifetime of an untimed one-shot that has not played yet
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sAudioVoiceDesc
+{
+    SoundID m_soundID      = MISSING_SOUND_ID;
+    float   m_volume       = 1.f;
+    float   m_priority     = 1.f;       // Scales audibility when choosing the real voices
+    bool    m_isLooped     = false;
+    bool    m_isPositional = false;
+    Vec3    m_position;
+    float   m_minDistance  = 1.f;       // Full volume inside this distance
+    float   m_maxDistance  = 50.f;      // Silent beyond this distance
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sAudioVoicePoolStats
+{
+    uint32_t m_activeVoiceCount   = 0;
+    uint32_t m_realVoiceCount     = 0;
+    uint64_t m_realizeCount       = 0;       // Virtual -> real (output starts)
+    uint64_t m_virtualizeCount    = 0;       // Real -> virtual (output stops)
+    uint64_t m_evictedCount       = 0;       // Quietest voice dropped to make room for a new one
+    uint64_t m_rejectedCount      = 0;       // Play() with the pool full of louder voices
+    double   m_updateMicroseconds = 0.0;     // Last Update()
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sAudioCommandResult
+{
+    std::vector<AudioVoiceHandle> m_playedHandles;      // One per "play" command, 0 where it failed
+    uint32_t                      m_commandCount = 0;
+    uint32_t                      m_errorCount   = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+// Voice virtualization: any number of voices (up to m_maxVoices) can be playing, but each Update() only
+// the m_maxRealVoices most audible ones (volume * distance attenuation * priority) are started on the
+// IAudioOutput. The others are virtual: their playheads keep advancing without costing a mixer voice.
+//
+// The output cannot seek, so a voice that becomes real again restarts from the beginning. A one-shot
+// whose length the output cannot tell is stopped for good when it loses its real voice: it could only
+// replay or be cut off. Handles are generation-checked, so a stale handle to a reused slot is ignored.
+//
+// ExecuteCommands() takes a whole batch of commands in one call, so script code can queue its audio
+// work for a frame and cross into C++ once:
+//     play <file> [volume] [looped 0|1] [x y z]
+//     stop <handle>
+//     stopAll
+//     volume <handle> <volume>
+//     move <handle> <x> <y> <z>
+// Commands are separated by newlines or ';'.
+//----------------------------------------------------------------------------------------------------
+class AudioVoicePool
+{
+public:
+    AudioVoicePool(sAudioVoicePoolConfig const& config, IAudioOutput& output);
+    ~AudioVoicePool();
+
+    AudioVoiceHandle Play(sAudioVoiceDesc const& desc);
+    void             Stop(AudioVoiceHandle handle);
+    void             StopAll();
+    void             SetVolume(AudioVoiceHandle handle, float volume);
+    void             SetPosition(AudioVoiceHandle handle, Vec3 const& position);
+    bool             IsValid(AudioVoiceHandle handle) const;
+    bool             IsReal(AudioVoiceHandle handle) const;
+
+    void SetListener(Vec3 const& position, Vec3 const& leftDirection);
+    void SetRealVoiceBudget(uint32_t maxRealVoices, float minAudibility);      // Takes effect at the next Update()
+    void Update(float deltaSeconds);
+
+    sAudioCommandResult ExecuteCommands(std::string const& commands);
+
+    float                         GetAudibility(AudioVoiceHandle handle) const;     // As of the last Update()
+    sAudioVoicePoolStats const&   GetStats() const { return m_stats; }
+    std::vector<AudioVoiceHandle> GetActiveHandles() const;
+
+private:
+    struct sVoice
+    {
+        sAudioVoiceDesc m_desc;
+        SoundPlaybackID m_playbackID     = MISSING_SOUND_ID;
+        float           m_elapsedSeconds = 0.f;
+        float           m_lengthSeconds  = 0.f;      // 0 = looped
+        bool            m_isLengthKnown  = true;
+        float           m_audibility     = 0.f;
+        float           m_balance        = 0.f;
+        uint16_t        m_generation     = 1;
+        bool            m_isActive       = false;
+        bool            m_isReal         = false;
+    };
+
+    sVoice*          GetVoice(AudioVoiceHandle handle);
+    sVoice const*    GetVoice(AudioVoiceHandle handle) const;
+    AudioVoiceHandle MakeHandle(uint32_t slot) const;
+    void             ComputeAudibility(sVoice& voice) const;
+    void             FreeVoice(uint32_t slot);
+
+    sAudioVoicePoolConfig m_config;
+    IAudioOutput&         m_output;
+    std::vector<sVoice>   m_voices;
+    std::vector<uint32_t> m_freeSlots;
+    std::vector<uint32_t> m_candidates;          // Scratch for Update()
+    Vec3                  m_listenerPosition;
+    Vec3                  m_listenerLeft = Vec3(0.f, 1.f, 0.f);
+    sAudioVoicePoolStats  m_stats;
+};
@@ -0,0 +1,313 @@
+//----------------------------------------------------------------------------------------------------
+// LightClusterCuller.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Subsystem/Light/LightClusterCuller.hpp"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#include "Engine/Core/EngineCommon.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Game/Framework/WorkerPool.hpp"
+
+//----------------------------------------------------------------------------------------------------
+LightClusterCuller::LightClusterCuller(sLightClusterConfig const& config)
+    : m_config(config)
+{
+    m_config.m_clusterCountX = std::max(m_config.m_clusterCountX, 1u);
+    m_config.m_clusterCountY = std::max(m_config.m_clusterCountY, 1u);
+    m_config.m_clusterCountZ = std::max(m_config.m_clusterCountZ, 1u);
+
+    m_clusterBounds.resize(GetClusterCount());
+    m_clusterRanges.resize(GetClusterCount());
+    m_sliceLightIndices.resize(m_config.m_clusterCountZ);
+    m_slicePairs.resize(m_config.m_clusterCountZ);
+    m_sliceCursors.resize(m_config.m_clusterCountZ);
+}
+
+//----------------------------------------------------------------------------------------------------
+void LightClusterCuller::Cull(sLightClusterView const&      view,
+                              std::vector<sGpuLight> const& lights,
+                              WorkerPool* const             workerPool)
+{
+    RebuildClusterBoundsIfNeeded(view);
+
+    m_viewSpheres.clear();
+    m_viewSpheres.reserve(lights.size());
+
+    for (uint32_t lightIndex = 0; lightIndex < static_cast<uint32_t>(lights.size()); ++lightIndex)
+    {
+        sViewSphere sphere;
+        sphere.m_lightIndex = lightIndex;
+
+        if (GetLightBoundingSphere(lights[lightIndex], view.m_worldToCamera, sphere.m_center, sphere.m_radius))
+        {
+            m_viewSpheres.push_back(sphere);
+        }
+    }
+
+    uint32_t const sliceCount = m_config.m_clusterCountZ;
+
+    if (workerPool != nullptr)
+    {
+        workerPool->ParallelFor(sliceCount, [this](uint32_t const sliceIndex, uint32_t) { CullSlice(sliceIndex); });
+    }
+    else
+    {
+        for (uint32_t sliceIndex = 0; sliceIndex < sliceCount; ++sliceIndex)
+        {
+            CullSlice(sliceIndex);
+        }
+    }
+
+    // Clusters of one slice are contiguous, so concatenating slices in order only shifts their offsets.
+    m_lightIndices.clear();
+
+    uint32_t const clustersPerSlice = m_config.m_clusterCountX * m_config.m_clusterCountY;
+
+    for (uint32_t sliceIndex = 0; sliceIndex < sliceCount; ++sliceIndex)
+    {
+        uint32_t const sliceBase = static_cast<uint32_t>(m_lightIndices.size());
+
+        for (uint32_t i = 0; i < clustersPerSlice; ++i)
+        {
+            m_clusterRanges[sliceIndex * clustersPerSlice + i].m_offset += sliceBase;
+        }
+
+        std::vector<uint32_t> const& sliceIndices = m_sliceLightIndices[sliceIndex];
+        m_lightIndices.insert(m_lightIndices.end(), sliceIndices.begin(), sliceIndices.end());
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void LightClusterCuller::CullSlice(uint32_t const sliceIndex)
+{
+    uint32_t const countX           = m_config.m_clusterCountX;
+    uint32_t const countY           = m_config.m_clusterCountY;
+    uint32_t const clustersPerSlice = countX * countY;
+    uint32_t const firstCluster     = sliceIndex * clustersPerSlice;
+    float const    sliceNear        = m_sliceDepths[sliceIndex];
+    float const    sliceFar         = m_sliceDepths[sliceIndex + 1];
+
+    for (uint32_t i = 0; i < clustersPerSlice; ++i)
+    {
+        m_clusterRanges[firstCluster + i] = sLightClusterRange();
+    }
+
+    // Walk lights, not clusters: a light only touches the columns and rows its sphere spans, so each one
+    // costs a few exact tests instead of one per cluster in the slice. Hits are collected as
+    // (cluster, light) pairs and bucketed per cluster afterwards.
+    std::vector<sClusterLightPair>& pairs = m_slicePairs[sliceIndex];
+    pairs.clear();
+
+    for (sViewSphere const& sphere : m_viewSpheres)
+    {
+        if (sphere.m_center.x + sphere.m_radius < sliceNear || sphere.m_center.x - sphere.m_radius > sliceFar)
+        {
+            continue;
+        }
+
+        for (uint32_t y = 0; y < countY; ++y)
+        {
+            AABB3 const& rowBounds = m_clusterBounds[firstCluster + y * countX];
+
+            if (sphere.m_center.z + sphere.m_radius < rowBounds.m_mins.z || sphere.m_center.z - sphere.m_radius > rowBounds.m_maxs.z)
+            {
+                continue;
+            }
+
+            for (uint32_t x = 0; x < countX; ++x)
+            {
+                uint32_t const clusterIndex = firstCluster + y * countX + x;
+                AABB3 const&   bounds       = m_clusterBounds[clusterIndex];
+
+                if (sphere.m_center.y + sphere.m_radius < bounds.m_mins.y || sphere.m_center.y - sphere.m_radius > bounds.m_maxs.y)
+                {
+                    continue;
+                }
+
+                if (DoesSphereOverlapBounds(sphere.m_center, sphere.m_radius, bounds))
+                {
+                    pairs.push_back({clusterIndex, sphere.m_lightIndex});
+                    ++m_clusterRanges[clusterIndex].m_count;
+                }
+            }
+        }
+    }
+
+    // Counting sort by cluster. Pairs were produced in light order, so every cluster's list stays sorted.
+    uint32_t offset = 0;
+
+    for (uint32_t i = 0; i < clustersPerSlice; ++i)
+    {
+        sLightClusterRange& range = m_clusterRanges[firstCluster + i];
+        range.m_offset            = offset;
+        offset += range.m_count;
+    }
+
+    std::vector<uint32_t>& sliceIndices = m_sliceLightIndices[sliceIndex];
+    sliceIndices.resize(offset);
+
+    std::vector<uint32_t>& cursors = m_sliceCursors[sliceIndex];
+    cursors.assign(clustersPerSlice, 0);
+
+    for (sClusterLightPair const& pair : pairs)
+    {
+        uint32_t const localCluster = pair.m_clusterIndex - firstCluster;
+
+        sliceIndices[m_clusterRanges[pair.m_clusterIndex].m_offset + cursors[localCluster]] = pair.m_lightIndex;
+        ++cursors[localCluster];
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+void LightClusterCuller::RebuildClusterBoundsIfNeeded(sLightClusterView const& view)
+{
+    if (m_areBoundsValid &&
+        m_boundsView.m_fovDegrees == view.m_fovDegrees &&
+        m_boundsView.m_aspect == view.m_aspect &&
+        m_boundsView.m_near == view.m_near &&
+        m_boundsView.m_far == view.m_far)
+    {
+        m_boundsView = view;
+        return;
+    }
+
+    m_boundsView     = view;
+    m_areBoundsValid = true;
+
+    uint32_t const countX = m_config.m_clusterCountX;
+    uint32_t const countY = m_config.m_clusterCountY;
+    uint32_t const countZ = m_config.m_clusterCountZ;
+
+    // Exponential slices keep clusters roughly cube-shaped; slice 0 starts at the eye and the last one
+    // ends at the far plane, matching the clamp in GetClusterIndex() in the shader.
+    m_sliceDepths.resize(countZ + 1);
+
+    for (uint32_t z = 0; z <= countZ; ++z)
+    {
+        m_sliceDepths[z] = view.m_near * std::pow(view.m_far / view.m_near, static_cast<float>(z) / static_cast<float>(countZ));
+    }
+
+    m_sliceDepths[0] = 0.f;
+
+    float const tanHalfVertical   = TanDegrees(0.5f * view.m_fovDegrees);
+    float const tanHalfHorizontal = tanHalfVertical * view.m_aspect;
+
+    for (uint32_t z = 0; z < countZ; ++z)
+    {
+        float const depths[2] = {m_sliceDepths[z], m_sliceDepths[z + 1]};
+
+        for (uint32_t y = 0; y < countY; ++y)
+        {
+            // Tile row 0 is the top of the screen, like pixel rows.
+            float const ndcYs[2] = {1.f - 2.f * static_cast<float>(y) / static_cast<float>(countY),
+                                    1.f - 2.f * static_cast<float>(y + 1) / static_cast<float>(countY)};
+
+            for (uint32_t x = 0; x < countX; ++x)
+            {
+                float const ndcXs[2] = {-1.f + 2.f * static_cast<float>(x) / static_cast<float>(countX),
+                                        -1.f + 2.f * static_cast<float>(x + 1) / static_cast<float>(countX)};
+
+                Vec3 mins(depths[0], FLT_MAX, FLT_MAX);
+                Vec3 maxs(depths[1], -FLT_MAX, -FLT_MAX);
+
+                for (float const depth : depths)
+                {
+                    for (float const ndcX : ndcXs)
+                    {
+                        float const left = -ndcX * tanHalfHorizontal * depth;
+                        mins.y           = std::min(mins.y, left);
+                        maxs.y           = std::max(maxs.y, left);
+                    }
+
+                    for (float const ndcY : ndcYs)
+                    {
+                        float const up = ndcY * tanHalfVertical * depth;
+                        mins.z         = std::min(mins.z, up);
+                        maxs.z         = std::max(maxs.z, up);
+                    }
+                }
+
+                m_clusterBounds[GetClusterIndex(x, y, z)] = AABB3(mins, maxs);
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------------------
+uint32_t LightClusterCuller::GetClusterCount() const
+{
+    return m_config.m_clusterCountX * m_config.m_clusterCountY * m_config.m_clusterCountZ;
+}
+
+//----------------------------------------------------------------------------------------------------
+uint32_t LightClusterCuller::GetClusterIndex(uint32_t const x,
+                                             uint32_t const y,
+                                             uint32_t const z) const
+{
+    return x + m_config.m_clusterCountX * (y + m_config.m_clusterCountY * z);
+}
+
+//----------------------------------------------------------------------------------------------------
+AABB3 LightClusterCuller::GetClusterBounds(uint32_t const clusterIndex) const
+{
+    return m_clusterBounds[clusterIndex];
+}
+
+//----------------------------------------------------------------------------------------------------
+sLightClusterConstants LightClusterCuller::GetShaderConstants() const
+{
+    float const logDepthRange = std::log(m_boundsView.m_far / m_boundsView.m_near);
+
+    sLightClusterConstants constants;
+    constants.m_clusterCountX          = m_config.m_clusterCountX;
+    constants.m_clusterCountY          = m_config.m_clusterCountY;
+    constants.m_clusterCountZ          = m_config.m_clusterCountZ;
+    constants.m_isClusteringEnabled    = m_areBoundsValid ? 1u : 0u;
+    constants.m_clusterDepthScale      = static_cast<float>(m_config.m_clusterCountZ) / logDepthRange;
+    constants.m_clusterDepthBias       = -static_cast<float>(m_config.m_clusterCountZ) * std::log(m_boundsView.m_near) / logDepthRange;
+    constants.m_clusterViewportSize[0] = m_boundsView.m_viewportSize.x;
+    constants.m_clusterViewportSize[1] = m_boundsView.m_viewportSize.y;
+
+    return constants;
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC bool LightClusterCuller::DoesSphereOverlapBounds(Vec3 const&  center,
+                                                        float const  radius,
+                                                        AABB3 const& bounds)
+{
+    float const dx = std::max({bounds.m_mins.x - center.x, 0.f, center.x - bounds.m_maxs.x});
+    float const dy = std::max({bounds.m_mins.y - center.y, 0.f, center.y - bounds.m_maxs.y});
+    float const dz = std::max({bounds.m_mins.z - center.z, 0.f, center.z - bounds.m_maxs.z});
+
+    return dx * dx + dy * dy + dz * dz <= radius * radius;
+}
+
+//----------------------------------------------------------------------------------------------------
+STATIC bool LightClusterCuller::GetLightBoundingSphere(sGpuLight const& light,
+                                                       Mat44 const&     worldToCamera,
+                                                       Vec3&            out_center,
+                                                       float&           out_radius)
+{
+    if (light.m_lightType != 1 && light.m_lightType != 2)
+    {
+        return false;
+    }
+
+    Vec3 const worldPosition(light.m_worldPosition[0], light.m_worldPosition[1], light.m_worldPosition[2]);
+
+    out_center = worldToCamera.TransformPosition3D(worldPosition);
+    out_radius = light.m_outerRadius;
+
+    if (light.m_lightType == 2)
+    {
+        out_radius += SPOT_LIGHT_ORBIT_RADIUS;
+    }
+
+    return out_radius > 0.f;
+}
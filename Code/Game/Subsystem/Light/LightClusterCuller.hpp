@@ -0,0 +1,148 @@
+//----------------------------------------------------------------------------------------------------
+// LightClusterCuller.hpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#pragma once
+#include <cstdint>
+#include <vector>
+
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Math/Vec2.hpp"
+
+//-Forward-Declaration--------------------------------------------------------------------------------
+class WorkerPool;
+
+//----------------------------------------------------------------------------------------------------
+// Byte-identical to `struct Light` in BlinnPhong.hlsl (64 bytes, StructuredBuffer stride).
+//----------------------------------------------------------------------------------------------------
+struct sGpuLight
+{
+    float   m_color[4]         = {1.f, 1.f, 1.f, 1.f};     // RGB + intensity in alpha
+    float   m_worldPosition[3] = {};
+    float   m_innerRadius      = 0.f;
+    float   m_direction[3]     = {1.f, 0.f, 0.f};
+    float   m_outerRadius      = 1.f;
+    float   m_innerConeAngle   = 0.f;
+    float   m_outerConeAngle   = 0.f;
+    int32_t m_lightType        = 1;                        // 0 = directional, 1 = point, 2 = spot
+    float   m_padding          = 0.f;
+};
+
+static_assert(sizeof(sGpuLight) == 64, "sGpuLight must match struct Light in BlinnPhong.hlsl");
+
+//----------------------------------------------------------------------------------------------------
+// Byte-identical to `cbuffer LightClusterConstants : register(b8)` in BlinnPhong.hlsl.
+//----------------------------------------------------------------------------------------------------
+struct sLightClusterConstants
+{
+    uint32_t m_clusterCountX          = 0;
+    uint32_t m_clusterCountY          = 0;
+    uint32_t m_clusterCountZ          = 0;
+    uint32_t m_isClusteringEnabled    = 0;
+    float    m_clusterDepthScale      = 0.f;
+    float    m_clusterDepthBias       = 0.f;
+    float    m_clusterViewportSize[2] = {};
+};
+
+static_assert(sizeof(sLightClusterConstants) % 16 == 0, "Constant buffers must be 16-byte multiples");
+
+//----------------------------------------------------------------------------------------------------
+// Matches the uint2 elements of t_clusterRanges in BlinnPhong.hlsl.
+//----------------------------------------------------------------------------------------------------
+struct sLightClusterRange
+{
+    uint32_t m_offset = 0;      // First entry in the light index list
+    uint32_t m_count  = 0;
+};
+
+//----------------------------------------------------------------------------------------------------
+struct sLightClusterConfig
+{
+    uint32_t m_clusterCountX = 16;
+    uint32_t m_clusterCountY = 9;
+    uint32_t m_clusterCountZ = 24;
+};
+
+//----------------------------------------------------------------------------------------------------
+// The perspective camera the clusters are built for (e.g. Player::GetCamera()). Camera space follows
+// the engine convention: +X forward, +Y left, +Z up.
+//----------------------------------------------------------------------------------------------------
+struct sLightClusterView
+{
+    Mat44 m_worldToCamera;
+    float m_fovDegrees   = 60.f;        // Vertical
+    float m_aspect       = 2.f;
+    float m_near         = 0.1f;
+    float m_far          = 100.f;
+    Vec2  m_viewportSize = Vec2(1.f, 1.f);
+};
+
+//----------------------------------------------------------------------------------------------------
+// CPU clustered light assignment for the Blinn-Phong shader path.
+//
+// The view frustum is split into screen tiles x exponential depth slices. Cull() tests every point and
+// spot light's bounding sphere against each cluster's camera-space AABB and builds two compact buffers:
+// a range per cluster and one flat light index list, both ready to upload as the shader's
+// t_clusterRanges / t_clusterLightIndices. Directional lights light everything and are skipped here;
+// they stay in the LightConstants array.
+//
+// Depth slices are independent, so with a WorkerPool each slice is culled on its own worker and the
+// per-slice lists are concatenated afterwards in slice order. The result is identical with or without
+// the pool. Nothing here touches the renderer, so it runs (and is benchmarked) headless.
+//----------------------------------------------------------------------------------------------------
+class LightClusterCuller
+{
+public:
+    explicit LightClusterCuller(sLightClusterConfig const& config = sLightClusterConfig());
+
+    void Cull(sLightClusterView const& view, std::vector<sGpuLight> const& lights, WorkerPool* workerPool = nullptr);
+
+    uint32_t GetClusterCount() const;
+    uint32_t GetClusterIndex(uint32_t x, uint32_t y, uint32_t z) const;
+    AABB3    GetClusterBounds(uint32_t clusterIndex) const;       // Camera space, valid after Cull()
+
+    std::vector<sLightClusterRange> const& GetClusterRanges() const { return m_clusterRanges; }
+    std::vector<uint32_t> const&           GetLightIndices() const { return m_lightIndices; }
+    sLightClusterConstants                 GetShaderConstants() const;
+
+    static bool DoesSphereOverlapBounds(Vec3 const& center, float radius, AABB3 const& bounds);
+    static bool GetLightBoundingSphere(sGpuLight const& light, Mat44 const& worldToCamera, Vec3& out_center, float& out_radius);
+
+    // BlinnPhong.hlsl animates spot lights on a circle of this radius around their authored position.
+    static float constexpr SPOT_LIGHT_ORBIT_RADIUS = 5.f;
+
+private:
+    void RebuildClusterBoundsIfNeeded(sLightClusterView const& view);
+    void CullSlice(uint32_t sliceIndex);
+
+    struct sViewSphere
+    {
+        Vec3     m_center;
+        float    m_radius     = 0.f;
+        uint32_t m_lightIndex = 0;
+    };
+
+    struct sClusterLightPair
+    {
+        uint32_t m_clusterIndex;
+        uint32_t m_lightIndex;
+    };
+
+    sLightClusterConfig m_config;
+    sLightClusterView   m_boundsView;                   // View the cluster bounds were built for
+    bool                m_areBoundsValid = false;
+
+    std::vector<AABB3>       m_clusterBounds;
+    std::vector<float>       m_sliceDepths;             // m_clusterCountZ + 1 boundaries
+    std::vector<sViewSphere> m_viewSpheres;             // Point/spot lights in camera space, this frame
+
+    // Per-slice scratch; each slice has exactly one writer during Cull().
+    std::vector<std::vector<uint32_t>>          m_sliceLightIndices;
+    std::vector<std::vector<sClusterLightPair>> m_slicePairs;
+    std::vector<std::vector<uint32_t>>          m_sliceCursors;
+
+    std::vector<sLightClusterRange> m_clusterRanges;
+    std::vector<uint32_t>           m_lightIndices;
+};
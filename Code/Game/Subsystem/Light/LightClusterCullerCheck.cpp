@@ -0,0 +1,114 @@
+//----------------------------------------------------------------------------------------------------
+// LightClusterCullerCheck.cpp
+//----------------------------------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------------------------------
+#include "Game/Framework/HeadlessRunner.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include "Engine/Core/StringUtils.hpp"
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/RandomNumberGenerator.hpp"
+#include "Game/Framework/WorkerPool.hpp"
+#include "Game/Subsystem/Light/LightClusterCuller.hpp"
+
+//----------------------------------------------------------------------------------------------------
+bool RunLightCullingCheck(sHeadlessRunConfig const& config,
+                          WorkerPool&               workerPool)
+{
+    // Camera at the origin looking down +X (identity world-to-camera), lights scattered through and
+    // around the frustum so some fall outside it.
+    sLightClusterView view;
+    view.m_near         = 0.1f;
+    view.m_far          = 200.f;
+    view.m_viewportSize = Vec2(1600.f, 800.f);
+
+    RandomNumberGenerator  rng;
+    std::vector<sGpuLight> lights(config.m_lightCount);
+
+    for (sGpuLight& light : lights)
+    {
+        light.m_worldPosition[0] = rng.RollRandomFloatInRange(-10.f, view.m_far);
+        light.m_worldPosition[1] = rng.RollRandomFloatInRange(-150.f, 150.f);
+        light.m_worldPosition[2] = rng.RollRandomFloatInRange(-60.f, 60.f);
+        light.m_outerRadius      = rng.RollRandomFloatInRange(1.f, 8.f);
+        light.m_innerRadius      = 0.5f * light.m_outerRadius;
+        light.m_lightType        = rng.RollRandomFloatZeroToOne() < 0.8f ? 1 : 2;
+    }
+
+    LightClusterCuller serialCuller;
+    LightClusterCuller parallelCuller;
+
+    uint32_t const frameCount = std::max(config.m_frameCount, 1u);
+
+    auto const measureMilliseconds = [&](LightClusterCuller& culler, WorkerPool* pool)
+    {
+        auto const startTime = std::chrono::steady_clock::now();
+
+        for (uint32_t frame = 0; frame < frameCount; ++frame)
+        {
+            culler.Cull(view, lights, pool);
+        }
+
+        std::chrono::duration<double, std::milli> const elapsed = std::chrono::steady_clock::now() - startTime;
+
+        return elapsed.count() / frameCount;
+    };
+
+    double const serialMilliseconds   = measureMilliseconds(serialCuller, nullptr);
+    double const parallelMilliseconds = measureMilliseconds(parallelCuller, &workerPool);
+
+    // Both paths must produce exactly what a brute-force test of every light against every cluster gives.
+    bool const isParallelIdentical = serialCuller.GetLightIndices() == parallelCuller.GetLightIndices();
+    bool       isBruteForceEqual   = true;
+    uint32_t   maxLightsPerCluster = 0;
+
+    std::vector<sLightClusterRange> const& ranges  = parallelCuller.GetClusterRanges();
+    std::vector<uint32_t> const&           indices = parallelCuller.GetLightIndices();
+
+    for (uint32_t clusterIndex = 0; clusterIndex < parallelCuller.GetClusterCount() && isBruteForceEqual; ++clusterIndex)
+    {
+        AABB3 const               bounds = parallelCuller.GetClusterBounds(clusterIndex);
+        sLightClusterRange const& range  = ranges[clusterIndex];
+        uint32_t                  cursor = range.m_offset;
+
+        for (uint32_t lightIndex = 0; lightIndex < static_cast<uint32_t>(lights.size()); ++lightIndex)
+        {
+            Vec3  center;
+            float radius = 0.f;
+
+            if (!LightClusterCuller::GetLightBoundingSphere(lights[lightIndex], view.m_worldToCamera, center, radius) ||
+                !LightClusterCuller::DoesSphereOverlapBounds(center, radius, bounds))
+            {
+                continue;
+            }
+
+            if (cursor >= range.m_offset + range.m_count || indices[cursor] != lightIndex)
+            {
+                isBruteForceEqual = false;
+                break;
+            }
+
+            ++cursor;
+        }
+
+        isBruteForceEqual   = isBruteForceEqual && cursor == range.m_offset + range.m_count;
+        maxLightsPerCluster = std::max(maxLightsPerCluster, range.m_count);
+    }
+
+    String report = Stringf("Light cluster culling: %u lights, %u clusters, %u frames, %u workers\n",
+                            config.m_lightCount, parallelCuller.GetClusterCount(), frameCount, workerPool.GetWorkerCount());
+    report += Stringf("single-threaded  %8.3f ms/frame\n", serialMilliseconds);
+    report += Stringf("worker pool      %8.3f ms/frame  (%.2fx)\n", parallelMilliseconds,
+                      parallelMilliseconds > 0.0 ? serialMilliseconds / parallelMilliseconds : 0.0);
+    report += Stringf("light indices    %8u  (avg %.2f, max %u per cluster)\n", static_cast<uint32_t>(indices.size()),
+                      static_cast<double>(indices.size()) / parallelCuller.GetClusterCount(), maxLightsPerCluster);
+    report += Stringf("validation       %s\n", isParallelIdentical && isBruteForceEqual ? "OK" : "FAILED");
+
+    WriteHeadlessReport(config.m_lightCullReportPath, report);
+
+    return isParallelIdentical && isBruteForceEqual;
+}
@@ -18,9 +18,65 @@
 class InputSystem {
     constructor() {
         this.lastF1State = false;
+
+        // Action map state, refreshed once per frame from game.getActionState():
+        // [down bits, pressed bits, released bits, axis values...]
+        this.actionIndices = null;
+        this.axisIndices = null;
+        this.actionState = new Float64Array(0);
+
         console.log('CONSTRUCTOR: InputSystem created at', Date.now());
     }
 
+    /**
+     * Read every action and axis in one call; the name tables are fetched once.
+     */
+    updateActions() {
+        if (typeof game === 'undefined' || !game.getActionState) {
+            return;
+        }
+
+        if (this.actionIndices === null) {
+            const names = game.getActionNames();
+            const parsedNames = typeof names === 'string' ? JSON.parse(names) : names;
+
+            this.actionIndices = new Map(parsedNames.actions.map((name, index) => [name, index]));
+            this.axisIndices = new Map(parsedNames.axes.map((name, index) => [name, index]));
+            this.actionState = new Float64Array(3 + parsedNames.axes.length);
+        }
+
+        const state = game.getActionState();
+        this.actionState.set(typeof state === 'string' ? JSON.parse(state) : state);
+    }
+
+    /**
+     * @param {string} name - Action name from Data/Config/ActionMap.xml (e.g. 'Sprint')
+     */
+    isActionDown(name) {
+        return this.testActionBit(0, name);
+    }
+
+    wasActionJustPressed(name) {
+        return this.testActionBit(1, name);
+    }
+
+    wasActionJustReleased(name) {
+        return this.testActionBit(2, name);
+    }
+
+    /**
+     * @param {string} name - Axis name (MoveX, MoveY, LookX, LookY, RollNegative, RollPositive)
+     */
+    getActionAxis(name) {
+        const index = this.axisIndices ? this.axisIndices.get(name) : undefined;
+        return index === undefined ? 0.0 : this.actionState[3 + index];
+    }
+
+    testActionBit(word, name) {
+        const index = this.actionIndices ? this.actionIndices.get(name) : undefined;
+        return index !== undefined && ((this.actionState[word] >>> index) & 1) === 1;
+    }
+
     /**
      * Core input logic extracted from JSGame.js updateInputHandler method
      * Handles F1 key detection and shouldRender toggle functionality
@@ -28,6 +84,8 @@ class InputSystem {
      * @param {number} deltaTime - Frame delta time from JSGame
      */
     handleInput(deltaTime) {
+        this.updateActions();
+
         // F1 key detection logic (extracted from JSGame.js lines 182-184)
         if (!this.logTimer) {
             this.logTimer = 0;
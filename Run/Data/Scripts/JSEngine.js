@@ -15,6 +15,12 @@ class JSEngine {
         this.renderSystems = [];
         this.pendingOperations = [];
 
+        // Event bus handlers, by event name (see subscribeEvent)
+        this.eventHandlers = new Map();
+
+        // Unsettled async bridge calls, by request ID (see callAsync)
+        this.pendingAsync = new Map();
+
         // C++ Hot-Reload System (handled by C++ FileWatcher + ScriptReloader)
         this.hotReloadEnabled = true; // C++ hot-reload system availability flag
 
@@ -208,7 +214,7 @@ class JSEngine {
                     // Pass both gameDeltaSeconds and systemDeltaSeconds to allow systems to choose
                     system.update(gameDeltaSeconds, systemDeltaSeconds);
                 } catch (error) {
-                    console.log(`JSEngine: Error in system '${system.id}' update:`, error);
+                    console.error(`JSEngine: Error in system '${system.id}' update:`, error);
                 }
             }
         }
@@ -229,8 +235,7 @@ class JSEngine {
                 try {
                     system.render();
                 } catch (error) {
-                    console.log(`JSEngine: Error in system '${system.id}' render:`, error);
-                    // console.error(`JSEngine: Error in system '${system.id}' render:`, error);
+                    console.error(`JSEngine: Error in system '${system.id}' render:`, error);
                 }
             }
         }
@@ -298,6 +303,197 @@ class JSEngine {
         return false;
     }
 
+    // ============================================================================
+    // EVENT BUS (C++ EventBus, delivered once per frame)
+    // ============================================================================
+
+    /**
+     * Receive a C++ event bus event, e.g. 'fileChanged' or 'worldSnapshotWritten'.
+     * The handler is called once per frame with every event of that name posted since the last frame:
+     * an array of {event, text, integer, number}.
+     */
+    subscribeEvent(name, handler) {
+        if (typeof handler !== 'function') {
+            console.log('JSEngine: Event handler must be a function');
+            return false;
+        }
+
+        if (!this.eventHandlers.has(name)) {
+            if (typeof game === 'undefined' || !game.subscribeEvent) {
+                console.log('JSEngine: game.subscribeEvent not available');
+                return false;
+            }
+
+            game.subscribeEvent(name);
+            this.eventHandlers.set(name, []);
+        }
+
+        this.eventHandlers.get(name).push(handler);
+        return true;
+    }
+
+    /**
+     * Remove a handler added by subscribeEvent(); the C++ subscription goes with the last one.
+     */
+    unsubscribeEvent(name, handler) {
+        const handlers = this.eventHandlers.get(name);
+        if (!handlers) {
+            return false;
+        }
+
+        const remaining = handlers.filter(h => h !== handler);
+
+        if (remaining.length === 0) {
+            this.eventHandlers.delete(name);
+            game.unsubscribeEvent(name);
+        } else {
+            this.eventHandlers.set(name, remaining);
+        }
+
+        return true;
+    }
+
+    /**
+     * Called by C++ (GameScriptInterface::DeliverScriptEvents) with the frame's events, grouped by name.
+     */
+    dispatchEvents(batch) {
+        let start = 0;
+
+        while (start < batch.length) {
+            const name = batch[start].event;
+            let end = start + 1;
+
+            while (end < batch.length && batch[end].event === name) {
+                end++;
+            }
+
+            const handlers = this.eventHandlers.get(name) || [];
+            const events = batch.slice(start, end);
+
+            for (const handler of handlers) {
+                try {
+                    handler(events);
+                } catch (error) {
+                    console.error(`JSEngine: Error in '${name}' event handler:`, error);
+                }
+            }
+
+            start = end;
+        }
+    }
+
+    // ============================================================================
+    // ASYNC BRIDGE (C++ AsyncBridge; promises settle once per frame, before update)
+    // ============================================================================
+
+    /**
+     * Call an async game method. C++ returns a request ID at once and runs the work on a worker thread;
+     * the Promise settles in a later frame, before JSEngine.update(), with its continuations.
+     * @param {string} method - 'readFileAsync', 'getFileTimestampAsync' or 'executeFileAsync'
+     */
+    callAsync(method, ...args) {
+        return new Promise((resolve, reject) => {
+            if (typeof game === 'undefined' || !game[method]) {
+                reject(new Error(`JSEngine: game.${method} not available`));
+                return;
+            }
+
+            const requestId = game[method](...args);
+
+            if (typeof requestId !== 'number') {
+                reject(new Error(`JSEngine: game.${method} failed: ${requestId}`));
+                return;
+            }
+
+            this.pendingAsync.set(requestId, {resolve, reject});
+        });
+    }
+
+    /** Resolves with the file's text; path is relative to Run/. */
+    readFileAsync(path) {
+        return this.callAsync('readFileAsync', path);
+    }
+
+    /** Resolves with the last write time in milliseconds since the epoch, like game.getFileTimestamp. */
+    getFileTimestampAsync(path) {
+        return this.callAsync('getFileTimestampAsync', path);
+    }
+
+    /** Reads the script off the frame and runs it at the next settle point; resolves with true. */
+    executeFileAsync(path) {
+        return this.callAsync('executeFileAsync', path);
+    }
+
+    /**
+     * Called by C++ (AsyncBridge::ResolveCompletions), one chunk at a time within the frame's budget.
+     * IDs from before a hot reload of this file are no longer pending and are ignored.
+     */
+    resolveAsync(completions) {
+        for (const completion of completions) {
+            const pending = this.pendingAsync.get(completion.id);
+            if (!pending) {
+                continue;
+            }
+
+            this.pendingAsync.delete(completion.id);
+
+            if (completion.ok) {
+                pending.resolve(completion.value);
+            } else {
+                pending.reject(new Error(completion.error));
+            }
+        }
+    }
+
+    // ============================================================================
+    // WORLD SNAPSHOT SUPPORT (called by C++ Game::SaveSnapshot / Game::LoadSnapshot)
+    // ============================================================================
+
+    /**
+     * Collect the serializable part of the JS world: frame counters plus each system's data/enabled flag.
+     * Functions are not serialized; systems are re-registered by JSGame, only their state is restored.
+     */
+    serializeSystemData() {
+        const systems = {};
+        for (const [id, system] of this.registeredSystems) {
+            systems[id] = {enabled: system.enabled, data: system.data};
+        }
+
+        return {
+            frameCount: this.frameCount,
+            gameFrameCount: (this.game !== null && this.game.frameCount !== undefined) ? this.game.frameCount : 0,
+            systems: systems
+        };
+    }
+
+    /**
+     * Restore state produced by serializeSystemData(). Unknown system ids are ignored.
+     */
+    restoreSystemData(snapshot) {
+        if (snapshot == null || typeof snapshot !== 'object') {
+            console.log('JSEngine: restoreSystemData called with invalid snapshot');
+            return false;
+        }
+
+        this.frameCount = snapshot.frameCount || 0;
+
+        if (this.game !== null && this.game.frameCount !== undefined) {
+            this.game.frameCount = snapshot.gameFrameCount || 0;
+        }
+
+        const systems = snapshot.systems || {};
+        for (const id of Object.keys(systems)) {
+            const system = this.registeredSystems.get(id);
+            if (system) {
+                system.enabled = systems[id].enabled !== false;
+                Object.assign(system.data, systems[id].data || {});
+            }
+        }
+
+        console.log(`JSEngine: Restored snapshot data for ${Object.keys(systems).length} systems`);
+        return true;
+    }
+
     /**
      * Get engine status
      */
@@ -310,6 +506,7 @@ class JSEngine {
             updateSystemCount: this.updateSystems.length,
             renderSystemCount: this.renderSystems.length,
             pendingOperations: this.pendingOperations.length,
+            pendingAsyncCalls: this.pendingAsync.size,
             hotReloadEnabled: this.hotReloadEnabled // C++ hot-reload system status
         };
     }
@@ -0,0 +1,113 @@
+//----------------------------------------------------------------------------------------------------
+// StressScenario.js
+//----------------------------------------------------------------------------------------------------
+
+/**
+ * StressScenario.js
+ *
+ * Loaded by Game::StartStressScenario() under -stressScenario=MAX. Ramps the cube count through the
+ * real game.createCube() bridge, one batch per frame, and after each step reports the createCube time
+ * with game.recordStressStep(); C++ then times entity update and draw packet build for the next
+ * framesPerStep frames. game.finishStressScenario() writes Logs/StressScenario.json and .csv.
+ */
+
+const STRESS_SPAWN_BATCH = 5000;       // createCube calls per frame, so the window keeps pumping
+const STRESS_FIELD_HALF_SIZE = 500;
+const STRESS_SETTLE_FRAMES = 2;        // Extra frames per step, so C++ has every sample before the next spawn
+
+class StressScenario {
+    constructor() {
+        this.stepEntityCounts = [];
+        this.framesPerStep = 16;
+        this.stepIndex = 0;
+        this.entityCount = 0;
+        this.spawnedInStep = 0;
+        this.bridgeMilliseconds = 0;
+        this.waitFrames = 0;
+        this.isRunning = false;
+    }
+
+    /**
+     * Step entity counts come from C++ (StressScenario::GetStepEntityCounts) so both sides agree.
+     */
+    start(stepEntityCounts, framesPerStep) {
+        if (typeof game === 'undefined' || !game.createCube || !game.recordStressStep) {
+            console.log('StressScenario: game bridge not available');
+            return false;
+        }
+
+        this.stepEntityCounts = stepEntityCounts;
+        this.framesPerStep = framesPerStep;
+        this.stepIndex = 0;
+        this.entityCount = 0;
+        this.spawnedInStep = 0;
+        this.bridgeMilliseconds = 0;
+        this.waitFrames = 0;
+        this.isRunning = true;
+
+        globalThis.JSEngine.registerSystem('stressScenario', {
+            update: (gameDeltaSeconds, systemDeltaSeconds) => this.update(gameDeltaSeconds, systemDeltaSeconds),
+            priority: 40,
+            data: {description: 'Ramps the entity count for the scalability report'}
+        });
+
+        console.log(`StressScenario: ${stepEntityCounts.length} steps up to ${stepEntityCounts[stepEntityCounts.length - 1]} entities`);
+        return true;
+    }
+
+    update(gameDeltaSeconds, systemDeltaSeconds) {
+        if (!this.isRunning) {
+            return;
+        }
+
+        if (this.waitFrames > 0) {
+            this.waitFrames--;
+            return;
+        }
+
+        if (this.stepIndex >= this.stepEntityCounts.length) {
+            this.finish();
+            return;
+        }
+
+        const targetCount = this.stepEntityCounts[this.stepIndex];
+        const batchCount = Math.min(STRESS_SPAWN_BATCH, targetCount - this.entityCount);
+        const positions = new Float64Array(batchCount * 3);
+
+        // Positions are drawn up front so only the bridge calls are timed.
+        for (let i = 0; i < positions.length; i += 3) {
+            positions[i] = (Math.random() - 0.5) * 2 * STRESS_FIELD_HALF_SIZE;
+            positions[i + 1] = (Math.random() - 0.5) * 2 * STRESS_FIELD_HALF_SIZE;
+            positions[i + 2] = Math.random() * 20;
+        }
+
+        const startTime = Date.now();
+
+        for (let i = 0; i < positions.length; i += 3) {
+            game.createCube(positions[i], positions[i + 1], positions[i + 2]);
+        }
+
+        this.bridgeMilliseconds += Date.now() - startTime;
+        this.entityCount += batchCount;
+        this.spawnedInStep += batchCount;
+
+        if (this.entityCount >= targetCount) {
+            game.recordStressStep(targetCount, this.spawnedInStep, this.bridgeMilliseconds);
+
+            this.stepIndex++;
+            this.spawnedInStep = 0;
+            this.bridgeMilliseconds = 0;
+            this.waitFrames = this.framesPerStep + STRESS_SETTLE_FRAMES;
+        }
+    }
+
+    finish() {
+        this.isRunning = false;
+        globalThis.JSEngine.unregisterSystem('stressScenario');
+
+        const result = game.finishStressScenario();
+        console.log('StressScenario:', result);
+    }
+}
+
+globalThis.stressScenario = new StressScenario();
@@ -151,6 +151,23 @@ cbuffer LightConstants : register(b2)
 	Light 	c_lightArray[MAX_LIGHTS];	// Array of lights
 };
 
+//----------------------------------------------------------------------------------------------------
+// Clustered light assignment, built on the CPU by LightClusterCuller (Code/Game/Subsystem/Light).
+// The camera frustum is split into c_clusterCount{X,Y,Z} clusters (screen tiles x exponential depth
+// slices); each cluster owns a range of t_clusterLightIndices pointing into t_clusterLights.
+// When c_isClusteringEnabled is 0 only c_lightArray is used, as before.
+//----------------------------------------------------------------------------------------------------
+cbuffer LightClusterConstants : register(b8)
+{
+	uint	c_clusterCountX;
+	uint	c_clusterCountY;
+	uint	c_clusterCountZ;
+	uint	c_isClusteringEnabled;
+	float	c_clusterDepthScale;		// slice = log(viewDepth) * scale + bias
+	float	c_clusterDepthBias;
+	float2	c_clusterViewportSize;		// Render target size in pixels
+};
+
 //----------------------------------------------------------------------------------------------------
 cbuffer CameraConstants : register(b3)
 {
@@ -194,6 +211,10 @@ SamplerState		s_diffuseSampler	: register(s0);			// Sampler is bound in sampler
 SamplerState		s_normalSampler		: register(s1);			// Sampler is bound in sampler constant slot #1 (s1)
 SamplerState		s_specGlossEmitSampler : register(s2); 		// Sampler is bound in sampler constant slot #2 (s2)
 
+StructuredBuffer<Light>	t_clusterLights			: register(t3);	// Point/spot lights referenced by the clusters
+StructuredBuffer<uint2>	t_clusterRanges			: register(t4);	// Per cluster: x = first index, y = light count
+StructuredBuffer<uint>	t_clusterLightIndices	: register(t5);	// Flat light index list for all clusters
+
 //----------------------------------------------------------------------------------------------------
 // VERTEX SHADER (VS)
 //
@@ -453,6 +474,35 @@ void CalculateSpotLight(
 	}
 }
 
+//----------------------------------------------------------------------------------------------------
+// Spot lights orbit their authored position; LightClusterCuller inflates spot bounds by this radius.
+//----------------------------------------------------------------------------------------------------
+void AnimateSpotLight( inout Light light )
+{
+	float radius = 5.0;
+	float angle = 0.5 * c_time;
+
+	light.worldPosition = float3(
+		cos(angle) * radius+light.worldPosition.x,
+		sin(angle) * radius+light.worldPosition.y,
+		light.worldPosition.z
+	);
+}
+
+//----------------------------------------------------------------------------------------------------
+// Index of the light cluster containing this pixel; matches LightClusterCuller::GetClusterIndex.
+//----------------------------------------------------------------------------------------------------
+uint GetClusterIndex( float2 pixelPosition, float3 worldPosition )
+{
+	float viewDepth = max( mul( c_worldToCamera, float4( worldPosition, 1.0 ) ).x, 1e-4 );	// Camera space is +X forward
+
+	uint clusterX = min( uint( pixelPosition.x / c_clusterViewportSize.x * c_clusterCountX ), c_clusterCountX - 1 );
+	uint clusterY = min( uint( pixelPosition.y / c_clusterViewportSize.y * c_clusterCountY ), c_clusterCountY - 1 );
+	uint clusterZ = uint( clamp( log( viewDepth ) * c_clusterDepthScale + c_clusterDepthBias, 0.0, float( c_clusterCountZ - 1 ) ) );
+
+	return clusterX + c_clusterCountX * ( clusterY + c_clusterCountY * clusterZ );
+}
+
 //----------------------------------------------------------------------------------------------------
 // PIXEL SHADER (PS)
 //
@@ -571,14 +621,7 @@ float4 PixelMain( VertexOutPixelIn input ) : SV_Target0
 		}
 		else if (light.lightType == 2) // Spot light
 		{
-			float radius = 5.0;
-			float angle = 0.5 * c_time;
-
-			light.worldPosition = float3(
-				cos(angle) * radius+light.worldPosition.x,
-				sin(angle) * radius+light.worldPosition.y,
-				light.worldPosition.z
-			);
+			AnimateSpotLight(light);
 
 			CalculateSpotLight(
 				light,
@@ -594,6 +637,30 @@ float4 PixelMain( VertexOutPixelIn input ) : SV_Target0
 		}
 	}
 
+	// Add clustered point and spot lights (only the lights culled into this pixel's cluster)
+	if (c_isClusteringEnabled != 0)
+	{
+		uint2 clusterRange = t_clusterRanges[ GetClusterIndex( input.v_position.xy, input.v_worldPos ) ];
+
+		for (uint clusterLight = 0; clusterLight < clusterRange.y; clusterLight++)
+		{
+			Light light = t_clusterLights[ t_clusterLightIndices[ clusterRange.x + clusterLight ] ];
+
+			if (light.lightType == 1) // Point light
+			{
+				CalculatePointLight( light, input.v_worldPos, finalNormal, viewDirection, diffuseColor.rgb,
+					specularStrength, specularPower, diffuseLighting, specularLighting );
+			}
+			else if (light.lightType == 2) // Spot light
+			{
+				AnimateSpotLight(light);
+
+				CalculateSpotLight( light, input.v_worldPos, finalNormal, viewDirection, diffuseColor.rgb,
+					specularStrength, specularPower, diffuseLighting, specularLighting );
+			}
+		}
+	}
+
 	// Add emissive contribution
 	float3 emissiveLighting = diffuseColor.rgb * emissiveStrength;
 